@@ -0,0 +1,24 @@
+###
+# Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+#
+# This file is part of Bitwuzla.
+#
+# Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+#
+# See COPYING for more information on using this software.
+##
+# Check if static user-space tracepoints (USDT, <sys/sdt.h>) are available.
+include(CheckCSourceCompiles)
+CHECK_C_SOURCE_COMPILES(
+"
+#include <sys/sdt.h>
+int main ()
+{
+  int x = 0;
+  DTRACE_PROBE(bitwuzla, check);
+  DTRACE_PROBE2(bitwuzla, check2, x, x + 1);
+  return 0;
+}
+"
+HAVE_USDT
+)
@@ -40,6 +40,7 @@ gcov=no
 gprof=no
 python=no
 timestats=no
+tracing=no
 
 docs=no
 
@@ -82,6 +83,7 @@ Options:
 
   --python          compile python API
   --time-stats      compile with time statistics
+  --tracing         compile with static tracepoints (USDT, requires sys/sdt.h)
 
   --no-symfpu       disable FP support
 
@@ -169,6 +171,7 @@ do
 
     --python)     python=yes;;
     --time-stats) timestats=yes;;
+    --tracing)    tracing=yes;;
 
     --no-symfpu) symfpu=no;;
 
@@ -245,6 +248,7 @@ cmake_opts="$CMAKE_OPTS"
 
 [ $python = yes ] && cmake_opts="$cmake_opts -DPYTHON=ON"
 [ $timestats = yes ] && cmake_opts="$cmake_opts -DTIME_STATS=ON"
+[ $tracing = yes ] && cmake_opts="$cmake_opts -DTRACING=ON"
 
 [ $docs = yes ] && cmake_opts="$cmake_opts -DDOCS=ON"
 
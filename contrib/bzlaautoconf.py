@@ -0,0 +1,413 @@
+#!/usr/bin/env python3
+###
+# Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+#
+# This file is part of Bitwuzla.
+#
+# Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+#
+# See COPYING for more information on using this software.
+##
+"""
+Retrain the decision model for automatic engine and SAT solver selection
+(-E auto, see src/bzlaautoconf.h) from benchmark timings.
+
+Collect formula features, time a set of configurations and train a new model:
+
+  ./contrib/bzlaautoconf.py features -b bin/bitwuzla bench/*.smt2 \\
+      > features.csv
+  ./contrib/bzlaautoconf.py time -b bin/bitwuzla -t 60 \\
+      -c fun,fun+preprop,prop,fun/cadical,fun/kissat bench/*.smt2 \\
+      > timings.csv
+  ./contrib/bzlaautoconf.py train features.csv timings.csv \\
+      -o src/bzlaautoconfmodel.h
+
+Timings may also come from elsewhere (e.g., a benchmarking cluster), as CSV
+with columns 'file,config,time' (time in seconds, empty or negative if the
+benchmark was not solved). A configuration has the form
+
+  <engine>[+preprop][/<sat-engine>]
+
+where <engine> and <sat-engine> are values of options --engine and
+--sat-engine, and +preprop enables prop as preprocessing for engine fun.
+
+The model is a CART decision tree that predicts the fastest configuration
+(by Gini impurity, unsolved benchmarks count as 'timeout' * 'penalty').
+Features are the ones printed by 'bitwuzla -E auto -v' after
+simplification, hence features.csv only needs to be regenerated if their
+computation changes.
+"""
+
+import argparse
+import csv
+import math
+import os
+import subprocess
+import sys
+import time
+from collections import Counter, defaultdict
+
+FEATURES_PREFIX = 'auto-config features:'
+
+ENGINES = {
+    'fun': 'BZLA_ENGINE_FUN',
+    'sls': 'BZLA_ENGINE_SLS',
+    'prop': 'BZLA_ENGINE_PROP',
+    'aigprop': 'BZLA_ENGINE_AIGPROP',
+    'quant': 'BZLA_ENGINE_QUANT',
+}
+
+SAT_ENGINES = {
+    'lingeling': 'BZLA_SAT_ENGINE_LINGELING',
+    'picosat': 'BZLA_SAT_ENGINE_PICOSAT',
+    'kissat': 'BZLA_SAT_ENGINE_KISSAT',
+    'gimsatul': 'BZLA_SAT_ENGINE_GIMSATUL',
+    'minisat': 'BZLA_SAT_ENGINE_MINISAT',
+    'cadical': 'BZLA_SAT_ENGINE_CADICAL',
+    'cms': 'BZLA_SAT_ENGINE_CMS',
+}
+
+HEADER = '''/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#ifndef BZLAAUTOCONFMODEL_H_INCLUDED
+#define BZLAAUTOCONFMODEL_H_INCLUDED
+
+#include "bzlaautoconf.h"
+#include "bzlaopt.h"
+
+/*------------------------------------------------------------------------*/
+
+/* Decision model for -E auto (see bzlaautoconf.h), generated by
+ *
+ *   contrib/bzlaautoconf.py train {args}
+ *
+ * from {nbench} benchmarks.
+ */
+
+static const BzlaAutoConfNode bzla_autoconf_model[] = {{
+{nodes}}};
+
+#endif
+'''
+
+
+def die(msg):
+    sys.exit('[bzlaautoconf] error: {}'.format(msg))
+
+
+def parse_config(config):
+    """Split configuration string into (engine, preprop, sat_engine)."""
+    engine, _, sat_engine = config.partition('/')
+    engine, _, preprop = engine.partition('+')
+    if engine not in ENGINES:
+        die('invalid engine in configuration \'{}\''.format(config))
+    if preprop not in ('', 'preprop'):
+        die('invalid configuration \'{}\''.format(config))
+    if sat_engine and sat_engine not in SAT_ENGINES:
+        die('invalid SAT solver in configuration \'{}\''.format(config))
+    return engine, preprop == 'preprop', sat_engine or None
+
+
+def config_options(config):
+    engine, preprop, sat_engine = parse_config(config)
+    opts = ['--engine={}'.format(engine)]
+    if preprop:
+        # as selected by -E auto
+        opts += [
+            '--fun-preprop', '--prop-nprops=10000', '--prop-nupdates=2000000'
+        ]
+    if sat_engine:
+        opts.append('--sat-engine={}'.format(sat_engine))
+    return opts
+
+
+#--- features ----------------------------------------------------------------#
+
+
+def get_features(binary, path, timeout):
+    """Run -E auto until the features of 'path' are printed."""
+    proc = subprocess.Popen(
+        [binary, '-E', 'auto', '-v', '--time={}'.format(timeout), path],
+        stdout=subprocess.PIPE,
+        stderr=subprocess.DEVNULL,
+        universal_newlines=True)
+    features = None
+    try:
+        for line in proc.stdout:
+            pos = line.find(FEATURES_PREFIX)
+            if pos >= 0:
+                features = dict(
+                    kv.split('=')
+                    for kv in line[pos + len(FEATURES_PREFIX):].split())
+                break
+    finally:
+        proc.kill()
+        proc.wait()
+    return features
+
+
+def cmd_features(args):
+    writer = None
+    for path in args.files:
+        features = get_features(args.binary, path, args.timeout)
+        if features is None:
+            # solved by simplification, or timeout
+            print('[bzlaautoconf] no features for {}'.format(path),
+                  file=sys.stderr)
+            continue
+        if writer is None:
+            writer = csv.writer(sys.stdout)
+            writer.writerow(['file'] + list(features))
+        writer.writerow([path] + list(features.values()))
+        sys.stdout.flush()
+
+
+#--- time --------------------------------------------------------------------#
+
+
+def cmd_time(args):
+    args.configs = args.configs.split(',')
+    for config in args.configs:
+        parse_config(config)
+    writer = csv.writer(sys.stdout)
+    writer.writerow(['file', 'config', 'time'])
+    for path in args.files:
+        for config in args.configs:
+            cmd = [args.binary, '--time={}'.format(args.timeout)]
+            cmd += config_options(config) + [path]
+            start = time.time()
+            try:
+                out = subprocess.run(cmd,
+                                     stdout=subprocess.PIPE,
+                                     stderr=subprocess.DEVNULL,
+                                     universal_newlines=True,
+                                     timeout=args.timeout + 10).stdout
+            except subprocess.TimeoutExpired:
+                out = ''
+            elapsed = time.time() - start
+            solved = any(l in ('sat', 'unsat') for l in out.split())
+            writer.writerow(
+                [path, config, '{:.3f}'.format(elapsed) if solved else ''])
+            sys.stdout.flush()
+
+
+#--- train -------------------------------------------------------------------#
+
+
+def read_features(path):
+    with open(path) as infile:
+        reader = csv.DictReader(infile)
+        names = [n for n in reader.fieldnames if n != 'file']
+        return names, {
+            row['file']: [float(row[n]) for n in names]
+            for row in reader
+        }
+
+
+def read_timings(path, timeout, penalty):
+    timings = defaultdict(dict)
+    with open(path) as infile:
+        for row in csv.DictReader(infile):
+            t = float(row['time']) if row['time'] else -1
+            if t < 0 or t > timeout:
+                t = timeout * penalty
+            timings[row['file']][row['config']] = t
+    return timings
+
+
+def gini(labels):
+    n = len(labels)
+    return 1 - sum((c / n)**2 for c in Counter(labels).values())
+
+
+class Tree:
+
+    def __init__(self, label=None, feature=None, threshold=None):
+        self.label = label
+        self.feature = feature
+        self.threshold = threshold
+        self.left = None
+        self.right = None
+
+
+def best_split(samples, labels, min_leaf):
+    """Returns (feature, threshold) with minimal weighted Gini impurity."""
+    n = len(samples)
+    best, best_score = None, gini(labels)
+    for f in range(len(samples[0])):
+        order = sorted(range(n), key=lambda i: samples[i][f])
+        left, right = Counter(), Counter(labels)
+        for k in range(n - 1):
+            i, j = order[k], order[k + 1]
+            left[labels[i]] += 1
+            right[labels[i]] -= 1
+            if samples[i][f] == samples[j][f]:
+                continue
+            if k + 1 < min_leaf or n - k - 1 < min_leaf:
+                continue
+            nl, nr = k + 1, n - k - 1
+            score = (nl * (1 - sum((c / nl)**2 for c in left.values())) +
+                     nr * (1 - sum((c / nr)**2 for c in right.values()))) / n
+            if score < best_score - 1e-12:
+                best_score = score
+                best = (f, (samples[i][f] + samples[j][f]) / 2)
+    return best
+
+
+def train(samples, labels, depth, max_depth, min_leaf):
+    label = Counter(labels).most_common(1)[0][0]
+    if depth == max_depth or len(set(labels)) == 1:
+        return Tree(label=label)
+    split = best_split(samples, labels, min_leaf)
+    if split is None:
+        return Tree(label=label)
+    f, threshold = split
+    node = Tree(feature=f, threshold=threshold)
+    lidx = [i for i in range(len(samples)) if samples[i][f] <= threshold]
+    ridx = [i for i in range(len(samples)) if samples[i][f] > threshold]
+    node.left = train([samples[i] for i in lidx], [labels[i] for i in lidx],
+                      depth + 1, max_depth, min_leaf)
+    node.right = train([samples[i] for i in ridx], [labels[i] for i in ridx],
+                       depth + 1, max_depth, min_leaf)
+    if (node.left.label is not None and node.left.label == node.right.label):
+        return Tree(label=node.left.label)
+    return node
+
+
+def classify(tree, sample):
+    while tree.label is None:
+        tree = (tree.left
+                if sample[tree.feature] <= tree.threshold else tree.right)
+    return tree.label
+
+
+def emit(tree, feature_names):
+    """Flatten tree in breadth-first order into BzlaAutoConfNode rows."""
+    nodes, queue = [], [tree]
+    while queue:
+        nodes.append(queue.pop(0))
+        if nodes[-1].label is None:
+            queue += [nodes[-1].left, nodes[-1].right]
+    index = {id(n): i for i, n in enumerate(nodes)}
+    rows = []
+    for i, n in enumerate(nodes):
+        if n.label is None:
+            row = '{{BZLA_AUTOCONF_F_{}, {:g}, {}, {}, 0, -1, false}}'.format(
+                feature_names[n.feature].upper(), n.threshold,
+                index[id(n.left)], index[id(n.right)])
+        else:
+            engine, preprop, sat_engine = parse_config(n.label)
+            row = '{{-1, 0, 0, 0, {}, {}, {}}}'.format(
+                ENGINES[engine],
+                SAT_ENGINES[sat_engine] if sat_engine else -1,
+                'true' if preprop else 'false')
+        rows.append('    /* {} */ {},\n'.format(i, row))
+    return ''.join(rows)
+
+
+def cmd_train(args):
+    feature_names, features = read_features(args.features)
+    timings = read_timings(args.timings, args.timeout, args.penalty)
+    configs = sorted(set(c for t in timings.values() for c in t))
+    for config in configs:
+        parse_config(config)
+    files = sorted(f for f in features if f in timings)
+    if not files:
+        die('no benchmarks with features and timings')
+
+    samples, labels, times = [], [], []
+    for f in files:
+        t = timings[f]
+        if min(t.values()) >= args.timeout * args.penalty:
+            # not solved by any configuration
+            continue
+        best = min(configs, key=lambda c: t.get(c, math.inf))
+        samples.append(features[f])
+        labels.append(best)
+        times.append(t)
+
+    tree = train(samples, labels, 0, args.max_depth, args.min_leaf)
+
+    # report training performance against the single best configuration
+    def total(choice):
+        return sum(
+            t.get(choice(i), args.timeout * args.penalty)
+            for i, t in enumerate(times))
+
+    print('[bzlaautoconf] {} benchmarks, {} configurations'.format(
+        len(samples), len(configs)),
+          file=sys.stderr)
+    for config in configs:
+        print('[bzlaautoconf] {:>20}: {:10.1f}s'.format(
+            config, total(lambda i: config)),
+              file=sys.stderr)
+    print('[bzlaautoconf] {:>20}: {:10.1f}s'.format(
+        'model', total(lambda i: classify(tree, samples[i]))),
+          file=sys.stderr)
+    print('[bzlaautoconf] {:>20}: {:10.1f}s'.format(
+        'virtual best', total(lambda i: labels[i])),
+          file=sys.stderr)
+
+    model = HEADER.format(args=' '.join(
+        os.path.basename(a) if a in (args.features, args.timings) else a
+        for a in sys.argv[2:]),
+                          nbench=len(samples),
+                          nodes=emit(tree, feature_names))
+    if args.output:
+        with open(args.output, 'w') as outfile:
+            outfile.write(model)
+    else:
+        sys.stdout.write(model)
+
+
+#--- main --------------------------------------------------------------------#
+
+
+def main():
+    ap = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawTextHelpFormatter)
+    sub = ap.add_subparsers(dest='cmd')
+    sub.required = True
+
+    p = sub.add_parser('features', help='collect formula features as CSV')
+    p.add_argument('-b', '--binary', default='bitwuzla')
+    p.add_argument('-t', '--timeout', type=int, default=60,
+                   help='time limit for parsing and simplification')
+    p.add_argument('files', nargs='+')
+    p.set_defaults(func=cmd_features)
+
+    p = sub.add_parser('time', help='time configurations, output as CSV')
+    p.add_argument('-b', '--binary', default='bitwuzla')
+    p.add_argument('-t', '--timeout', type=int, default=60)
+    p.add_argument('-c', '--configs', required=True,
+                   help='comma-separated list of configurations')
+    p.add_argument('files', nargs='+')
+    p.set_defaults(func=cmd_time)
+
+    p = sub.add_parser('train', help='train model from features and timings')
+    p.add_argument('features')
+    p.add_argument('timings')
+    p.add_argument('-o', '--output', help='output file (default: stdout)')
+    p.add_argument('-t', '--timeout', type=float, default=60,
+                   help='time limit used for the timings')
+    p.add_argument('--penalty', type=float, default=2,
+                   help='penalty factor for unsolved benchmarks')
+    p.add_argument('--max-depth', type=int, default=6)
+    p.add_argument('--min-leaf', type=int, default=5,
+                   help='minimum number of benchmarks per leaf')
+    p.set_defaults(func=cmd_train)
+
+    args = ap.parse_args()
+    args.func(args)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+###
+# Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+#
+# This file is part of Bitwuzla.
+#
+# Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+#
+# See COPYING for more information on using this software.
+##
+"""
+Convert Bitwuzla static tracepoint events (see src/bzlatrace.h) recorded with
+perf into folded stacks for flamegraph.pl (or speedscope, inferno, ...).
+
+Build Bitwuzla with tracepoints:
+
+  ./configure.sh production --tracing && cd build && make
+
+Record and render a flame graph of solver phases:
+
+  perf buildid-cache --add bin/bitwuzla
+  perf probe -x bin/bitwuzla -a 'sdt_bitwuzla:*'   # only required by perf < 4.20
+  perf record -e 'sdt_bitwuzla:*' -- bin/bitwuzla input.smt2
+  perf script | ./contrib/bzlatrace2folded.py > phases.folded
+  flamegraph.pl --countname us phases.folded > phases.svg
+
+Each <phase>_start/<phase>_done probe pair becomes one stack frame, weighted
+by the wall-clock time (in microseconds) spent in the phase itself (time
+spent in nested phases is attributed to the nested frame). With --summary,
+a table with accumulated time, number of calls and the maximum of each
+probe argument (node counts, clause counts, ...) is printed instead.
+"""
+
+import argparse
+import re
+import sys
+from collections import defaultdict
+
+# perf script prints '<comm> <tid> [<cpu>] <time>: <event>: <ip> arg1=.. ..'
+EVENT_RE = re.compile(
+    r'^\s*(?P<comm>.*?)\s+(?P<tid>\d+)\s+(?:\[\d+\]\s+)?(?P<time>\d+\.\d+):'
+    r'\s+(?:\S+:)?(?P<phase>\w+)_(?P<kind>start|done):(?P<rest>.*)$')
+ARG_RE = re.compile(r'arg(\d+)=(-?\w+)')
+
+
+def parse_args(rest):
+  args = {}
+  for idx, val in ARG_RE.findall(rest):
+    try:
+      args[int(idx)] = int(val, 0)
+    except ValueError:
+      pass
+  return args
+
+
+def main():
+  ap = argparse.ArgumentParser(description=__doc__,
+                               formatter_class=argparse.RawTextHelpFormatter)
+  ap.add_argument('infile', nargs='?', type=argparse.FileType('r'),
+                  default=sys.stdin, help='output of perf script')
+  ap.add_argument('--summary', action='store_true',
+                  help='print per-phase summary instead of folded stacks')
+  ap.add_argument('--root', default='bitwuzla', help='name of root frame')
+  opts = ap.parse_args()
+
+  stacks = defaultdict(list)      # tid -> [(phase, start time)]
+  last = {}                       # tid -> time of last event
+  folded = defaultdict(float)     # stack -> self time (us)
+  total = defaultdict(float)      # phase -> total time (us)
+  calls = defaultdict(int)        # phase -> number of calls
+  maxargs = defaultdict(dict)     # probe -> {arg index: max value}
+  unmatched = 0
+
+  for line in opts.infile:
+    m = EVENT_RE.match(line)
+    if not m:
+      continue
+    tid = m.group('tid')
+    time = float(m.group('time')) * 1e6
+    phase = m.group('phase')
+    stack = stacks[tid]
+
+    # attribute time since the last event to the innermost open phase
+    if stack:
+      key = ';'.join([opts.root] + [p for p, _ in stack])
+      folded[key] += time - last[tid]
+    last[tid] = time
+
+    probe = '{}_{}'.format(phase, m.group('kind'))
+    for idx, val in parse_args(m.group('rest')).items():
+      cur = maxargs[probe].get(idx)
+      maxargs[probe][idx] = val if cur is None else max(cur, val)
+
+    if m.group('kind') == 'start':
+      stack.append((phase, time))
+      continue
+
+    # done: pop up to the matching start (tolerates lost events)
+    names = [p for p, _ in stack]
+    if phase not in names:
+      unmatched += 1
+      continue
+    while stack:
+      p, start = stack.pop()
+      if p == phase:
+        total[phase] += time - start
+        calls[phase] += 1
+        break
+      unmatched += 1
+
+  if unmatched:
+    print('warning: {} unmatched trace events'.format(unmatched),
+          file=sys.stderr)
+
+  if opts.summary:
+    print('{:<24} {:>14} {:>10}  {}'.format('phase', 'time [ms]', 'calls',
+                                           'max args'))
+    for phase in sorted(total, key=total.get, reverse=True):
+      margs = ' '.join('{}:arg{}={}'.format(k, i, v)
+                       for k in ('start', 'done')
+                       for i, v in sorted(maxargs[phase + '_' + k].items()))
+      print('{:<24} {:>14.3f} {:>10}  {}'.format(phase, total[phase] / 1e3,
+                                               calls[phase], margs))
+  else:
+    for key in sorted(folded):
+      weight = int(round(folded[key]))
+      if weight > 0:
+        print('{} {}'.format(key, weight))
+
+
+if __name__ == '__main__':
+  main()
@@ -62,7 +62,7 @@ bzla_aigprop_get_assignment_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
   if (bzla_aig_is_true(aig)) return 1;
   if (bzla_aig_is_false(aig)) return -1;
 
-  id = bzla_aig_get_id(BZLA_REAL_ADDR_AIG(aig));
+  id = bzla_aig_get_index(aig);
   assert(bzla_hashint_map_get(aprop->model, id));
   res = bzla_hashint_map_get(aprop->model, id)->as_int;
   res = BZLA_IS_INVERTED_AIG(aig) ? -res : res;
@@ -88,31 +88,31 @@ bzla_aigprop_get_assignment_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
     BZLA_AIGPROPLOG(3,                                                    \
                     "        assignment aig0 (%s%d): %d",                 \
                     BZLA_IS_INVERTED_AIG(left) ? "-" : "",                \
-                    BZLA_REAL_ADDR_AIG(left)->id,                         \
+                    bzla_aig_get_index(left),                             \
                     a < 0 ? 0 : 1);                                       \
     a = bzla_aigprop_get_assignment_aig(aprop, right);                    \
     assert(a);                                                            \
     BZLA_AIGPROPLOG(3,                                                    \
                     "        assignment aig1 (%s%d): %d",                 \
                     BZLA_IS_INVERTED_AIG(right) ? "-" : "",               \
-                    BZLA_REAL_ADDR_AIG(right)->id,                        \
+                    bzla_aig_get_index(right),                            \
                     a < 0 ? 0 : 1);                                       \
     BZLA_AIGPROPLOG(3,                                                    \
                     "        score      aig0 (%s%d): %f%s",               \
                     BZLA_IS_INVERTED_AIG(left) ? "-" : "",                \
-                    BZLA_REAL_ADDR_AIG(left)->id,                         \
+                    bzla_aig_get_index(left),                             \
                     s0,                                                   \
                     s0 < 1.0 ? " (< 1.0)" : "");                          \
     BZLA_AIGPROPLOG(3,                                                    \
                     "        score      aig1 (%s%d): %f%s",               \
                     BZLA_IS_INVERTED_AIG(right) ? "-" : "",               \
-                    BZLA_REAL_ADDR_AIG(right)->id,                        \
+                    bzla_aig_get_index(right),                            \
                     s1,                                                   \
                     s1 < 1.0 ? " (< 1.0)" : "");                          \
     BZLA_AIGPROPLOG(3,                                                    \
                     "      * score cur (%s%d): %f%s",                     \
                     BZLA_IS_INVERTED_AIG(cur) ? "-" : "",                 \
-                    real_cur->id,                                         \
+                    bzla_aig_get_id(real_cur),                            \
                     res,                                                  \
                     res < 1.0 ? " (< 1.0)" : "");                         \
   } while (0)
@@ -155,15 +155,16 @@ compute_score_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
     curid = bzla_aig_get_id(cur);
     if (bzla_hashint_map_contains(aprop->score, curid)) continue;
 
-    d = bzla_hashint_map_get(mark, real_cur->id);
+    d = bzla_hashint_map_get(mark, bzla_aig_get_id(real_cur));
     if (d && d->as_int == 1) continue;
 
     if (!d)
     {
-      bzla_hashint_map_add(mark, real_cur->id);
-      assert(bzla_aig_is_var(real_cur) || bzla_aig_is_and(real_cur));
+      bzla_hashint_map_add(mark, bzla_aig_get_id(real_cur));
+      assert(bzla_aig_is_var(aprop->amgr, real_cur)
+             || bzla_aig_is_and(aprop->amgr, real_cur));
       BZLA_PUSH_STACK(stack, cur);
-      if (bzla_aig_is_and(real_cur))
+      if (bzla_aig_is_and(aprop->amgr, real_cur))
       {
         left  = bzla_aig_get_left_child(aprop->amgr, real_cur);
         right = bzla_aig_get_right_child(aprop->amgr, real_cur);
@@ -183,24 +184,24 @@ compute_score_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
       BZLA_AIGPROPLOG(3,
                       "  ** assignment cur (%s%d): %d",
                       BZLA_IS_INVERTED_AIG(cur) ? "-" : "",
-                      real_cur->id,
+                      bzla_aig_get_id(real_cur),
                       a < 0 ? 0 : 1);
 #endif
       assert(!bzla_hashint_map_contains(aprop->score, curid));
       assert(!bzla_hashint_map_contains(aprop->score, -curid));
 
-      if (bzla_aig_is_var(real_cur))
+      if (bzla_aig_is_var(aprop->amgr, real_cur))
       {
         res = bzla_aigprop_get_assignment_aig(aprop, cur) < 0 ? 0.0 : 1.0;
         BZLA_AIGPROPLOG(3,
                         "        * score cur (%s%d): %f",
                         BZLA_IS_INVERTED_AIG(cur) ? "-" : "",
-                        real_cur->id,
+                        bzla_aig_get_id(real_cur),
                         res);
         BZLA_AIGPROPLOG(3,
                         "        * score cur (%s%d): %f",
                         BZLA_IS_INVERTED_AIG(cur) ? "" : "-",
-                        real_cur->id,
+                        bzla_aig_get_id(real_cur),
                         res == 0.0 ? 1.0 : 0.0);
         bzla_hashint_map_add(aprop->score, curid)->as_dbl = res;
         bzla_hashint_map_add(aprop->score, -curid)->as_dbl =
@@ -208,7 +209,7 @@ compute_score_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
       }
       else
       {
-        assert(bzla_aig_is_and(real_cur));
+        assert(bzla_aig_is_and(aprop->amgr, real_cur));
 
         left    = bzla_aig_get_left_child(aprop->amgr, real_cur);
         right   = bzla_aig_get_right_child(aprop->amgr, real_cur);
@@ -236,7 +237,8 @@ compute_score_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
         if (res == 1.0 && (sleft < 1.0 || sright < 1.0))
           res = sleft < sright ? sleft : sright;
         assert(res >= 0.0 && res <= 1.0);
-        bzla_hashint_map_add(aprop->score, real_cur->id)->as_dbl = res;
+        bzla_hashint_map_add(aprop->score, bzla_aig_get_id(real_cur))->as_dbl =
+            res;
 #ifndef NDEBUG
         BZLA_AIGPROP_LOG_COMPUTE_SCORE_AIG(
             real_cur, left, right, sleft, sright, res);
@@ -249,7 +251,8 @@ compute_score_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
                      : bzla_hashint_map_get(aprop->score, -rightid)->as_dbl;
         res = sleft > sright ? sleft : sright;
         assert(res >= 0.0 && res <= 1.0);
-        bzla_hashint_map_add(aprop->score, -real_cur->id)->as_dbl = res;
+        bzla_hashint_map_add(aprop->score, -bzla_aig_get_id(real_cur))
+            ->as_dbl = res;
 #ifndef NDEBUG
         BZLA_AIGPROP_LOG_COMPUTE_SCORE_AIG(BZLA_INVERT_AIG(real_cur),
                                            BZLA_INVERT_AIG(left),
@@ -309,22 +312,23 @@ compute_scores(BzlaAIGProp *aprop)
     if (bzla_aig_is_const(real_cur)) continue;
     if (bzla_hashint_map_contains(aprop->score, bzla_aig_get_id(cur))) continue;
 
-    if (!bzla_hashint_table_contains(cache, real_cur->id))
+    if (!bzla_hashint_table_contains(cache, bzla_aig_get_id(real_cur)))
     {
-      bzla_hashint_table_add(cache, real_cur->id);
-      assert(bzla_aig_is_var(real_cur) || bzla_aig_is_and(real_cur));
+      bzla_hashint_table_add(cache, bzla_aig_get_id(real_cur));
+      assert(bzla_aig_is_var(aprop->amgr, real_cur)
+             || bzla_aig_is_and(aprop->amgr, real_cur));
       BZLA_PUSH_STACK(stack, cur);
-      if (bzla_aig_is_and(real_cur))
+      if (bzla_aig_is_and(aprop->amgr, real_cur))
       {
         left  = bzla_aig_get_left_child(aprop->amgr, real_cur);
         right = bzla_aig_get_right_child(aprop->amgr, real_cur);
         if (!bzla_aig_is_const(left)
             && !bzla_hashint_table_contains(cache,
-                                            BZLA_REAL_ADDR_AIG(left)->id))
+                                            bzla_aig_get_index(left)))
           BZLA_PUSH_STACK(stack, left);
         if (!bzla_aig_is_const(right)
             && !bzla_hashint_table_contains(cache,
-                                            BZLA_REAL_ADDR_AIG(right)->id))
+                                            bzla_aig_get_index(right)))
           BZLA_PUSH_STACK(stack, right);
       }
     }
@@ -367,30 +371,32 @@ recursively_compute_assignment(BzlaAIGProp *aprop, BzlaAIG *aig)
     cur      = BZLA_POP_STACK(stack);
     real_cur = BZLA_REAL_ADDR_AIG(cur);
     assert(!bzla_aig_is_const(real_cur));
-    if (bzla_hashint_map_contains(aprop->model, real_cur->id)) continue;
+    if (bzla_hashint_map_contains(aprop->model, bzla_aig_get_id(real_cur)))
+      continue;
 
-    if (bzla_aig_is_var(real_cur))
+    if (bzla_aig_is_var(aprop->amgr, real_cur))
     {
       /* initialize with false */
-      bzla_hashint_map_add(aprop->model, real_cur->id)->as_int = -1;
+      bzla_hashint_map_add(aprop->model, bzla_aig_get_id(real_cur))->as_int =
+          -1;
     }
     else
     {
-      assert(bzla_aig_is_and(real_cur));
+      assert(bzla_aig_is_and(aprop->amgr, real_cur));
       left  = bzla_aig_get_left_child(aprop->amgr, real_cur);
       right = bzla_aig_get_right_child(aprop->amgr, real_cur);
 
-      if (!bzla_hashint_table_contains(cache, real_cur->id))
+      if (!bzla_hashint_table_contains(cache, bzla_aig_get_id(real_cur)))
       {
-        bzla_hashint_table_add(cache, real_cur->id);
+        bzla_hashint_table_add(cache, bzla_aig_get_id(real_cur));
         BZLA_PUSH_STACK(stack, cur);
         if (!bzla_aig_is_const(left)
             && !bzla_hashint_table_contains(cache,
-                                            BZLA_REAL_ADDR_AIG(left)->id))
+                                            bzla_aig_get_index(left)))
           BZLA_PUSH_STACK(stack, left);
         if (!bzla_aig_is_const(right)
             && !bzla_hashint_table_contains(cache,
-                                            BZLA_REAL_ADDR_AIG(right)->id))
+                                            bzla_aig_get_index(right)))
           BZLA_PUSH_STACK(stack, right);
       }
       else
@@ -400,9 +406,11 @@ recursively_compute_assignment(BzlaAIGProp *aprop, BzlaAIG *aig)
         aright = bzla_aigprop_get_assignment_aig(aprop, right);
         assert(aright);
         if (aleft < 0 || aright < 0)
-          bzla_hashint_map_add(aprop->model, real_cur->id)->as_int = -1;
+          bzla_hashint_map_add(aprop->model, bzla_aig_get_id(real_cur))
+              ->as_int = -1;
         else
-          bzla_hashint_map_add(aprop->model, real_cur->id)->as_int = 1;
+          bzla_hashint_map_add(aprop->model, bzla_aig_get_id(real_cur))
+              ->as_int = 1;
       }
     }
   }
@@ -493,7 +501,7 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
   assert(aprop);
   assert(aig);
   assert(BZLA_IS_REGULAR_AIG(aig));
-  assert(bzla_aig_is_var(aig));
+  assert(bzla_aig_is_var(aprop->amgr, aig));
   assert(assignment == 1 || assignment == -1);
 
   int32_t aleft, aright, ass, leftid, rightid;
@@ -553,11 +561,12 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
   {
     cur = BZLA_POP_STACK(stack);
     assert(BZLA_IS_REGULAR_AIG(cur));
-    if (bzla_hashint_table_contains(cache, cur->id)) continue;
-    bzla_hashint_table_add(cache, cur->id);
+    if (bzla_hashint_table_contains(cache, bzla_aig_get_id(cur))) continue;
+    bzla_hashint_table_add(cache, bzla_aig_get_id(cur));
     if (cur != aig) BZLA_PUSH_STACK(cone, cur);
-    assert(bzla_hashint_map_contains(aprop->parents, cur->id));
-    parents = bzla_hashint_map_get(aprop->parents, cur->id)->as_ptr;
+    assert(bzla_hashint_map_contains(aprop->parents, bzla_aig_get_id(cur)));
+    parents =
+        bzla_hashint_map_get(aprop->parents, bzla_aig_get_id(cur))->as_ptr;
     for (i = 0; i < BZLA_COUNT_STACK(*parents); i++)
       BZLA_PUSH_STACK(
           stack, bzla_aig_get_by_id(aprop->amgr, BZLA_PEEK_STACK(*parents, i)));
@@ -569,21 +578,21 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
 
   /* update assignment and score of 'aig' --------------------------------- */
   /* update model */
-  d = bzla_hashint_map_get(aprop->model, aig->id);
+  d = bzla_hashint_map_get(aprop->model, bzla_aig_get_id(aig));
   assert(d);
   /* update unsatroots table */
   if (d->as_int != assignment
-      && (bzla_hashint_table_contains(aprop->roots, aig->id)
-          || bzla_hashint_table_contains(aprop->roots, -aig->id)))
+      && (bzla_hashint_table_contains(aprop->roots, bzla_aig_get_id(aig))
+          || bzla_hashint_table_contains(aprop->roots, -bzla_aig_get_id(aig))))
     update_unsatroots_table(aprop, aig, assignment);
   d->as_int = assignment;
 
   /* update score */
   if (aprop->score)
   {
-    d         = bzla_hashint_map_get(aprop->score, aig->id);
+    d         = bzla_hashint_map_get(aprop->score, bzla_aig_get_id(aig));
     d->as_dbl = assignment < 0 ? 0.0 : 1.0;
-    d         = bzla_hashint_map_get(aprop->score, -aig->id);
+    d         = bzla_hashint_map_get(aprop->score, -bzla_aig_get_id(aig));
     d->as_dbl = assignment < 0 ? 1.0 : 0.0;
   }
 
@@ -600,8 +609,8 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
   {
     cur = BZLA_PEEK_STACK(cone, i);
     assert(BZLA_IS_REGULAR_AIG(cur));
-    assert(bzla_aig_is_and(cur));
-    assert(bzla_hashint_map_contains(aprop->model, cur->id));
+    assert(bzla_aig_is_and(aprop->amgr, cur));
+    assert(bzla_hashint_map_contains(aprop->model, bzla_aig_get_id(cur)));
 
     left  = bzla_aig_get_left_child(aprop->amgr, cur);
     right = bzla_aig_get_right_child(aprop->amgr, cur);
@@ -610,12 +619,13 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
     aright = bzla_aigprop_get_assignment_aig(aprop, right);
     assert(aright);
     ass = aleft < 0 || aright < 0 ? -1 : 1;
-    d   = bzla_hashint_map_get(aprop->model, cur->id);
+    d   = bzla_hashint_map_get(aprop->model, bzla_aig_get_id(cur));
     assert(d);
     /* update unsatroots table */
     if (d->as_int != ass
-        && (bzla_hashint_table_contains(aprop->roots, cur->id)
-            || bzla_hashint_table_contains(aprop->roots, -cur->id)))
+        && (bzla_hashint_table_contains(aprop->roots, bzla_aig_get_id(cur))
+            || bzla_hashint_table_contains(aprop->roots,
+                                           -bzla_aig_get_id(cur))))
       update_unsatroots_table(aprop, cur, ass);
     d->as_int = ass;
   }
@@ -632,9 +642,9 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
     {
       cur = BZLA_PEEK_STACK(cone, i);
       assert(BZLA_IS_REGULAR_AIG(cur));
-      assert(bzla_aig_is_and(cur));
-      assert(bzla_hashint_map_contains(aprop->score, cur->id));
-      assert(bzla_hashint_map_contains(aprop->score, -cur->id));
+      assert(bzla_aig_is_and(aprop->amgr, cur));
+      assert(bzla_hashint_map_contains(aprop->score, bzla_aig_get_id(cur)));
+      assert(bzla_hashint_map_contains(aprop->score, -bzla_aig_get_id(cur)));
 
       left    = bzla_aig_get_left_child(aprop->amgr, cur);
       right   = bzla_aig_get_right_child(aprop->amgr, cur);
@@ -653,7 +663,7 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
       if (s == 1.0 && (sleft < 1.0 || sright < 1.0))
         s = sleft < sright ? sleft : sright;
       assert(s >= 0.0 && s <= 1.0);
-      bzla_hashint_map_get(aprop->score, cur->id)->as_dbl = s;
+      bzla_hashint_map_get(aprop->score, bzla_aig_get_id(cur))->as_dbl = s;
 
       sleft = bzla_aig_is_const(left)
                   ? (bzla_aig_is_true(left) ? 0.0 : 1.0)
@@ -663,7 +673,7 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
                    : bzla_hashint_map_get(aprop->score, -rightid)->as_dbl;
       s = sleft > sright ? sleft : sright;
       assert(s >= 0.0 && s <= 1.0);
-      bzla_hashint_map_get(aprop->score, -cur->id)->as_dbl = s;
+      bzla_hashint_map_get(aprop->score, -bzla_aig_get_id(cur))->as_dbl = s;
     }
     aprop->time.update_cone_compute_score += bzla_util_time_stamp() - delta;
   }
@@ -777,7 +787,7 @@ select_root(BzlaAIGProp *aprop, uint32_t nmoves)
   BZLA_AIGPROPLOG(1,
                   "*** select root: %s%d",
                   BZLA_IS_INVERTED_AIG(res) ? "-" : "",
-                  BZLA_REAL_ADDR_AIG(res)->id);
+                  bzla_aig_get_index(res));
   return res;
 }
 
@@ -809,7 +819,7 @@ select_move(BzlaAIGProp *aprop,
   max_nprops = aprop->nprops;
   res        = true;
 
-  if (bzla_aig_is_var(BZLA_REAL_ADDR_AIG(cur)))
+  if (bzla_aig_is_var(aprop->amgr, BZLA_REAL_ADDR_AIG(cur)))
   {
     *input      = BZLA_REAL_ADDR_AIG(cur);
     *assignment = BZLA_IS_INVERTED_AIG(cur) ? -asscur : asscur;
@@ -825,13 +835,13 @@ select_move(BzlaAIGProp *aprop,
       }
 
       real_cur = BZLA_REAL_ADDR_AIG(cur);
-      assert(bzla_aig_is_and(real_cur));
+      assert(bzla_aig_is_and(aprop->amgr, real_cur));
       asscur = BZLA_IS_INVERTED_AIG(cur) ? -asscur : asscur;
-      c[0]   = bzla_aig_get_by_id(aprop->amgr, real_cur->children[0]);
-      c[1]   = bzla_aig_get_by_id(aprop->amgr, real_cur->children[1]);
+      c[0]   = bzla_aig_get_left_child(aprop->amgr, real_cur);
+      c[1]   = bzla_aig_get_right_child(aprop->amgr, real_cur);
 
       /* conflict */
-      if (bzla_aig_is_and(real_cur) && bzla_aig_is_const(c[0])
+      if (bzla_aig_is_and(aprop->amgr, real_cur) && bzla_aig_is_const(c[0])
           && bzla_aig_is_const(c[1]))
         break;
 
@@ -847,8 +857,8 @@ select_move(BzlaAIGProp *aprop,
         for (i = 0; i < 2; i++)
         {
           assert(
-              bzla_hashint_map_get(aprop->model, BZLA_REAL_ADDR_AIG(c[i])->id));
-          d = bzla_hashint_map_get(aprop->model, BZLA_REAL_ADDR_AIG(c[i])->id);
+              bzla_hashint_map_get(aprop->model, bzla_aig_get_index(c[i])));
+          d = bzla_hashint_map_get(aprop->model, bzla_aig_get_index(c[i]));
           assert(d);
           ass[i] = BZLA_IS_INVERTED_AIG(c[i]) ? -d->as_int : d->as_int;
         }
@@ -873,7 +883,7 @@ select_move(BzlaAIGProp *aprop,
       asscur = assnew;
       nprops += 1;
 
-      if (bzla_aig_is_var(BZLA_REAL_ADDR_AIG(cur)))
+      if (bzla_aig_is_var(aprop->amgr, BZLA_REAL_ADDR_AIG(cur)))
       {
         *input      = BZLA_REAL_ADDR_AIG(cur);
         *assignment = BZLA_IS_INVERTED_AIG(cur) ? -asscur : asscur;
@@ -908,7 +918,7 @@ move(BzlaAIGProp *aprop, uint32_t nmoves)
     BZLA_AIGPROPLOG(1,
                     "    * input: %s%d",
                     BZLA_IS_INVERTED_AIG(input) ? "-" : "",
-                    BZLA_REAL_ADDR_AIG(input)->id);
+                    bzla_aig_get_index(input));
     BZLA_AIGPROPLOG(1, "      prev. assignment: %d", a);
     BZLA_AIGPROPLOG(1, "      new   assignment: %d", assignment);
 #endif
@@ -965,39 +975,41 @@ bzla_aigprop_sat(BzlaAIGProp *aprop, BzlaIntHashTable *roots)
     cur = BZLA_REAL_ADDR_AIG(BZLA_POP_STACK(stack));
     assert(!bzla_aig_is_const(cur));
 
-    if ((d = bzla_hashint_map_get(cache, cur->id)) && d->as_int == 1) continue;
+    if ((d = bzla_hashint_map_get(cache, bzla_aig_get_id(cur)))
+        && d->as_int == 1)
+      continue;
 
     if (!d)
     {
-      bzla_hashint_map_add(cache, cur->id);
+      bzla_hashint_map_add(cache, bzla_aig_get_id(cur));
       BZLA_PUSH_STACK(stack, cur);
       BZLA_NEW(mm, childparents);
       BZLA_INIT_STACK(mm, *childparents);
-      bzla_hashint_map_add(aprop->parents, cur->id)->as_ptr = childparents;
-      if (bzla_aig_is_and(cur))
+      bzla_hashint_map_add(aprop->parents, bzla_aig_get_id(cur))->as_ptr =
+          childparents;
+      if (bzla_aig_is_and(aprop->amgr, cur))
       {
-        for (i = 0; i < 2; i++)
-        {
-          child = bzla_aig_get_by_id(aprop->amgr, cur->children[i]);
-          if (!bzla_aig_is_const(child)) BZLA_PUSH_STACK(stack, child);
-        }
+        child = bzla_aig_get_left_child(aprop->amgr, cur);
+        if (!bzla_aig_is_const(child)) BZLA_PUSH_STACK(stack, child);
+        child = bzla_aig_get_right_child(aprop->amgr, cur);
+        if (!bzla_aig_is_const(child)) BZLA_PUSH_STACK(stack, child);
       }
     }
     else
     {
       assert(d->as_int == 0);
       d->as_int = 1;
-      if (bzla_aig_is_var(cur)) continue;
+      if (bzla_aig_is_var(aprop->amgr, cur)) continue;
       for (i = 0; i < 2; i++)
       {
-        if (bzla_aig_is_const(
-                bzla_aig_get_by_id(aprop->amgr, cur->children[i])))
-          continue;
-        childid = cur->children[i] < 0 ? -cur->children[i] : cur->children[i];
+        child = i == 0 ? bzla_aig_get_left_child(aprop->amgr, cur)
+                       : bzla_aig_get_right_child(aprop->amgr, cur);
+        if (bzla_aig_is_const(child)) continue;
+        childid = bzla_aig_get_index(child);
         assert(bzla_hashint_map_contains(aprop->parents, childid));
         childparents = bzla_hashint_map_get(aprop->parents, childid)->as_ptr;
         assert(childparents);
-        BZLA_PUSH_STACK(*childparents, cur->id);
+        BZLA_PUSH_STACK(*childparents, bzla_aig_get_id(cur));
       }
     }
   }
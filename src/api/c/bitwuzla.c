@@ -10,11 +10,18 @@
 
 #include "bitwuzla.h"
 
+#ifdef BZLA_HAVE_PTHREADS
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#endif
+
 #include "bzlaconfig.h"
 #include "bzlacore.h"
 #include "bzlaexp.h"
 #include "bzlamodel.h"
 #include "bzlaparse.h"
+#include "bzlapipeline.h"
 #include "bzlaprintmodel.h"
 #include "bzlasubst.h"
 #include "dumper/bzladumpaig.h"
@@ -65,6 +72,8 @@ struct Bitwuzla
   BzlaConstCharPtrStack d_option_info_values;
   /* Map internal sort id to external sort wrapper. */
   BzlaIntHashTable *d_sort_map;
+  /* Handle of asynchronous satisfiability check in progress. */
+  BitwuzlaCheckSatHandle *d_check_sat_handle;
   /* Internal solver. */
   Bzla *d_bzla;
   /* API memory manager. */
@@ -79,14 +88,36 @@ struct BitwuzlaSort
   Bitwuzla *d_bzla;
 };
 
+struct BitwuzlaCheckSatHandle
+{
+  /* Associated solver. */
+  Bitwuzla *d_bitwuzla;
+  /* Result of the check, valid if 'd_done' is true. */
+  BitwuzlaResult d_result;
+  /* True if the check has finished. */
+  bool d_done;
+#ifdef BZLA_HAVE_PTHREADS
+  /* Thread checking satisfiability. */
+  pthread_t d_thread;
+  /* Protects 'd_result' and 'd_done'. */
+  pthread_mutex_t d_mutex;
+  /* Signalled when the check has finished. */
+  pthread_cond_t d_cond;
+#endif
+};
+
 static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_AIGPROP_NPROPS]          = BZLA_OPT_AIGPROP_NPROPS,
     [BITWUZLA_OPT_AIGPROP_USE_BANDIT]      = BZLA_OPT_AIGPROP_USE_BANDIT,
     [BITWUZLA_OPT_AIGPROP_USE_RESTARTS]    = BZLA_OPT_AIGPROP_USE_RESTARTS,
+    [BITWUZLA_OPT_BMC_KIND]                = BZLA_OPT_BMC_KIND,
+    [BITWUZLA_OPT_BMC_KMAX]                = BZLA_OPT_BMC_KMAX,
+    [BITWUZLA_OPT_BW_REDUCE]               = BZLA_OPT_BW_REDUCE,
     [BITWUZLA_OPT_CHECK_MODEL]             = BZLA_OPT_CHECK_MODEL,
     [BITWUZLA_OPT_CHECK_UNCONSTRAINED]     = BZLA_OPT_CHECK_UNCONSTRAINED,
     [BITWUZLA_OPT_CHECK_UNSAT_ASSUMPTIONS] = BZLA_OPT_CHECK_UNSAT_ASSUMPTIONS,
     [BITWUZLA_OPT_DECLSORT_BV_WIDTH]       = BZLA_OPT_DECLSORT_BV_WIDTH,
+    [BITWUZLA_OPT_ITE_CHAINS]              = BZLA_OPT_ITE_CHAINS,
     [BITWUZLA_OPT_ENGINE]                  = BZLA_OPT_ENGINE,
     [BITWUZLA_OPT_EXIT_CODES]              = BZLA_OPT_EXIT_CODES,
     [BITWUZLA_OPT_FUN_DUAL_PROP]           = BZLA_OPT_FUN_DUAL_PROP,
@@ -94,6 +125,7 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_FUN_EAGER_LEMMAS]        = BZLA_OPT_FUN_EAGER_LEMMAS,
     [BITWUZLA_OPT_FUN_JUST]                = BZLA_OPT_FUN_JUST,
     [BITWUZLA_OPT_FUN_JUST_HEURISTIC]      = BZLA_OPT_FUN_JUST_HEURISTIC,
+    [BITWUZLA_OPT_FUN_LAZY_CONSTRAINTS]    = BZLA_OPT_FUN_LAZY_CONSTRAINTS,
     [BITWUZLA_OPT_FUN_LAZY_SYNTHESIZE]     = BZLA_OPT_FUN_LAZY_SYNTHESIZE,
     [BITWUZLA_OPT_FUN_PREPROP]             = BZLA_OPT_FUN_PREPROP,
     [BITWUZLA_OPT_FUN_PRESLS]              = BZLA_OPT_FUN_PRESLS,
@@ -105,6 +137,7 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_OUTPUT_FORMAT]           = BZLA_OPT_OUTPUT_FORMAT,
     [BITWUZLA_OPT_OUTPUT_NUMBER_FORMAT]    = BZLA_OPT_OUTPUT_NUMBER_FORMAT,
     [BITWUZLA_OPT_PARSE_INTERACTIVE]       = BZLA_OPT_PARSE_INTERACTIVE,
+    [BITWUZLA_OPT_PIPELINE]                = BZLA_OPT_PIPELINE,
     [BITWUZLA_OPT_PP_ACKERMANN]            = BZLA_OPT_PP_ACKERMANN,
     [BITWUZLA_OPT_PP_BETA_REDUCE]          = BZLA_OPT_PP_BETA_REDUCE,
     [BITWUZLA_OPT_PP_ELIMINATE_EXTRACTS]   = BZLA_OPT_PP_ELIMINATE_EXTRACTS,
@@ -160,6 +193,7 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_QUANT_SYNTH_ITE_COMPLETE] = BZLA_OPT_QUANT_SYNTH_ITE_COMPLETE,
     [BITWUZLA_OPT_QUANT_SYNTH_LIMIT]        = BZLA_OPT_QUANT_SYNTH_LIMIT,
     [BITWUZLA_OPT_QUANT_SYNTH_QI]           = BZLA_OPT_QUANT_SYNTH_QI,
+    [BITWUZLA_OPT_QUANT_THREADS]            = BZLA_OPT_QUANT_THREADS,
     [BITWUZLA_OPT_RW_EXTRACT_ARITH]         = BZLA_OPT_RW_EXTRACT_ARITH,
     [BITWUZLA_OPT_RW_LEVEL]                 = BZLA_OPT_RW_LEVEL,
     [BITWUZLA_OPT_RW_NORMALIZE]             = BZLA_OPT_RW_NORMALIZE,
@@ -200,10 +234,14 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_AIGPROP_NPROPS]          = BITWUZLA_OPT_AIGPROP_NPROPS,
     [BZLA_OPT_AIGPROP_USE_BANDIT]      = BITWUZLA_OPT_AIGPROP_USE_BANDIT,
     [BZLA_OPT_AIGPROP_USE_RESTARTS]    = BITWUZLA_OPT_AIGPROP_USE_RESTARTS,
+    [BZLA_OPT_BMC_KIND]                = BITWUZLA_OPT_BMC_KIND,
+    [BZLA_OPT_BMC_KMAX]                = BITWUZLA_OPT_BMC_KMAX,
+    [BZLA_OPT_BW_REDUCE]               = BITWUZLA_OPT_BW_REDUCE,
     [BZLA_OPT_CHECK_MODEL]             = BITWUZLA_OPT_CHECK_MODEL,
     [BZLA_OPT_CHECK_UNCONSTRAINED]     = BITWUZLA_OPT_CHECK_UNCONSTRAINED,
     [BZLA_OPT_CHECK_UNSAT_ASSUMPTIONS] = BITWUZLA_OPT_CHECK_UNSAT_ASSUMPTIONS,
     [BZLA_OPT_DECLSORT_BV_WIDTH]       = BITWUZLA_OPT_DECLSORT_BV_WIDTH,
+    [BZLA_OPT_ITE_CHAINS]              = BITWUZLA_OPT_ITE_CHAINS,
     [BZLA_OPT_ENGINE]                  = BITWUZLA_OPT_ENGINE,
     [BZLA_OPT_EXIT_CODES]              = BITWUZLA_OPT_EXIT_CODES,
     [BZLA_OPT_FUN_DUAL_PROP]           = BITWUZLA_OPT_FUN_DUAL_PROP,
@@ -211,6 +249,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_FUN_EAGER_LEMMAS]        = BITWUZLA_OPT_FUN_EAGER_LEMMAS,
     [BZLA_OPT_FUN_JUST]                = BITWUZLA_OPT_FUN_JUST,
     [BZLA_OPT_FUN_JUST_HEURISTIC]      = BITWUZLA_OPT_FUN_JUST_HEURISTIC,
+    [BZLA_OPT_FUN_LAZY_CONSTRAINTS]    = BITWUZLA_OPT_FUN_LAZY_CONSTRAINTS,
     [BZLA_OPT_FUN_LAZY_SYNTHESIZE]     = BITWUZLA_OPT_FUN_LAZY_SYNTHESIZE,
     [BZLA_OPT_FUN_PREPROP]             = BITWUZLA_OPT_FUN_PREPROP,
     [BZLA_OPT_FUN_PRESLS]              = BITWUZLA_OPT_FUN_PRESLS,
@@ -222,6 +261,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_OUTPUT_FORMAT]           = BITWUZLA_OPT_OUTPUT_FORMAT,
     [BZLA_OPT_OUTPUT_NUMBER_FORMAT]    = BITWUZLA_OPT_OUTPUT_NUMBER_FORMAT,
     [BZLA_OPT_PARSE_INTERACTIVE]       = BITWUZLA_OPT_PARSE_INTERACTIVE,
+    [BZLA_OPT_PIPELINE]                = BITWUZLA_OPT_PIPELINE,
     [BZLA_OPT_PP_ACKERMANN]            = BITWUZLA_OPT_PP_ACKERMANN,
     [BZLA_OPT_PP_BETA_REDUCE]          = BITWUZLA_OPT_PP_BETA_REDUCE,
     [BZLA_OPT_PP_ELIMINATE_EXTRACTS]   = BITWUZLA_OPT_PP_ELIMINATE_EXTRACTS,
@@ -277,6 +317,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_QUANT_SYNTH_ITE_COMPLETE] = BITWUZLA_OPT_QUANT_SYNTH_ITE_COMPLETE,
     [BZLA_OPT_QUANT_SYNTH_LIMIT]        = BITWUZLA_OPT_QUANT_SYNTH_LIMIT,
     [BZLA_OPT_QUANT_SYNTH_QI]           = BITWUZLA_OPT_QUANT_SYNTH_QI,
+    [BZLA_OPT_QUANT_THREADS]            = BITWUZLA_OPT_QUANT_THREADS,
     [BZLA_OPT_RW_EXTRACT_ARITH]         = BITWUZLA_OPT_RW_EXTRACT_ARITH,
     [BZLA_OPT_RW_LEVEL]                 = BITWUZLA_OPT_RW_LEVEL,
     [BZLA_OPT_RW_NORMALIZE]             = BITWUZLA_OPT_RW_NORMALIZE,
@@ -428,6 +469,9 @@ static const char *bzla_kind_to_str[BITWUZLA_NUM_KINDS] = {
 #define BZLA_IMPORT_BITWUZLA_SORT(sort) ((sort)->d_bzla_sort)
 #define BZLA_EXPORT_BITWUZLA_SORT(bitwuzla, sort) wrap_sort(bitwuzla, sort)
 
+#define BZLA_IMPORT_BITWUZLA_TERM_STORE(store) ((BzlaTermStore *) (store))
+#define BZLA_EXPORT_BITWUZLA_TERM_STORE(store) ((BitwuzlaTermStore *) (store))
+
 #define BZLA_IMPORT_BITWUZLA_OPTION(option) (bzla_options[option])
 #define BZLA_EXPORT_BITWUZLA_OPTION(option) (bitwuzla_options[option])
 
@@ -480,6 +524,11 @@ static const char *bzla_kind_to_str[BITWUZLA_NUM_KINDS] = {
       "cannot %s if input formula is not sat",                              \
       what);
 
+#define BZLA_CHECK_NOT_SOLVING(bitwuzla)                       \
+  BZLA_ABORT((bitwuzla)->d_check_sat_handle != NULL,           \
+             "asynchronous satisfiability check in progress, " \
+             "'bitwuzla_check_sat_join' must be called first");
+
 /* -------------------------------------------------------------------------- */
 
 #define BZLA_CHECK_ARG_NOT_NULL(arg) \
@@ -1043,6 +1092,8 @@ static void
 reset(Bitwuzla *bitwuzla)
 {
   BzlaIntHashTableIterator it;
+
+  bzla_pipeline_delete(bitwuzla->d_bzla);
   bzla_iter_hashint_init(&it, bitwuzla->d_sort_map);
   while (bzla_iter_hashint_has_next(&it))
   {
@@ -1085,6 +1136,7 @@ void
 bitwuzla_delete(Bitwuzla *bitwuzla)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   reset(bitwuzla);
   BzlaMemMgr *mm = bitwuzla->d_mm;
   BZLA_DELETE(mm, bitwuzla);
@@ -1095,8 +1147,46 @@ void
 bitwuzla_reset(Bitwuzla *bitwuzla)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+
+  Bzla *bzla           = BZLA_IMPORT_BITWUZLA(bitwuzla);
+  BzlaTermStore *store = bzla->term_store_shared ? bzla->term_store : 0;
+
+  if (store) bzla_term_store_copy(store);
   reset(bitwuzla);
   init(bitwuzla, bitwuzla->d_mm);
+  if (store)
+  {
+    bzla_set_term_store(BZLA_IMPORT_BITWUZLA(bitwuzla), store);
+    bzla_term_store_delete(store);
+  }
+}
+
+BitwuzlaTermStore *
+bitwuzla_term_store_new(void)
+{
+  return BZLA_EXPORT_BITWUZLA_TERM_STORE(bzla_term_store_new());
+}
+
+void
+bitwuzla_term_store_delete(BitwuzlaTermStore *store)
+{
+  BZLA_CHECK_ARG_NOT_NULL(store);
+  bzla_term_store_delete(BZLA_IMPORT_BITWUZLA_TERM_STORE(store));
+}
+
+void
+bitwuzla_set_term_store(Bitwuzla *bitwuzla, BitwuzlaTermStore *store)
+{
+  BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
+  BZLA_CHECK_ARG_NOT_NULL(store);
+
+  Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
+  BZLA_ABORT(bzla->term_store_shared,
+             "instance is already attached to a term store");
+  bzla_set_term_store(bzla, BZLA_IMPORT_BITWUZLA_TERM_STORE(store));
 }
 
 const char *
@@ -1165,6 +1255,7 @@ bool
 bitwuzla_terminate(Bitwuzla *bitwuzla)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   return bzla_terminate(BZLA_IMPORT_BITWUZLA(bitwuzla)) != 0;
 }
 
@@ -1174,6 +1265,7 @@ bitwuzla_set_termination_callback(Bitwuzla *bitwuzla,
                                   void *state)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   bzla_set_term(BZLA_IMPORT_BITWUZLA(bitwuzla), fun, state);
 }
 
@@ -1181,9 +1273,20 @@ void *
 bitwuzla_get_termination_callback_state(Bitwuzla *bitwuzla)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   return bzla_get_term_state(BZLA_IMPORT_BITWUZLA(bitwuzla));
 }
 
+void
+bitwuzla_set_aig_optimizer(Bitwuzla *bitwuzla,
+                           int32_t (*fun)(void *, const char *, const char *),
+                           void *state)
+{
+  BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_set_aig_optimizer(BZLA_IMPORT_BITWUZLA(bitwuzla), fun, state);
+}
+
 void
 bitwuzla_set_abort_callback(void (*fun)(const char *msg))
 {
@@ -1194,6 +1297,8 @@ void
 bitwuzla_set_option(Bitwuzla *bitwuzla, BitwuzlaOption option, uint32_t value)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
 
   Bzla *bzla     = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BzlaOption opt = BZLA_IMPORT_BITWUZLA_OPTION(option);
@@ -1331,6 +1436,8 @@ bitwuzla_set_option_str(Bitwuzla *bitwuzla,
                         const char *value)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
 
   Bzla *bzla     = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BzlaOption opt = BZLA_IMPORT_BITWUZLA_OPTION(option);
@@ -1350,6 +1457,7 @@ uint32_t
 bitwuzla_get_option(Bitwuzla *bitwuzla, BitwuzlaOption option)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
 
   Bzla *bzla     = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BzlaOption opt = BZLA_IMPORT_BITWUZLA_OPTION(option);
@@ -1363,6 +1471,7 @@ bitwuzla_get_option_str(Bitwuzla *bitwuzla,
                         BitwuzlaOption option)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
 
   Bzla *bzla     = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BzlaOption opt = BZLA_IMPORT_BITWUZLA_OPTION(option);
@@ -1380,6 +1489,7 @@ bitwuzla_get_option_info(Bitwuzla *bitwuzla,
                          BitwuzlaOptionInfo *info)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(info);
 
   Bzla *bzla     = BZLA_IMPORT_BITWUZLA(bitwuzla);
@@ -1431,6 +1541,7 @@ bitwuzla_mk_array_sort(Bitwuzla *bitwuzla,
                        const BitwuzlaSort *element)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(index);
   BZLA_CHECK_ARG_NOT_NULL(element);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, index);
@@ -1451,6 +1562,7 @@ const BitwuzlaSort *
 bitwuzla_mk_bool_sort(Bitwuzla *bitwuzla)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
 
   Bzla *bzla     = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BzlaSortId res = bzla_sort_bool(bzla);
@@ -1461,6 +1573,7 @@ const BitwuzlaSort *
 bitwuzla_mk_bv_sort(Bitwuzla *bitwuzla, uint32_t size)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_ZERO(size);
 
   Bzla *bzla     = BZLA_IMPORT_BITWUZLA(bitwuzla);
@@ -1472,6 +1585,7 @@ const BitwuzlaSort *
 bitwuzla_mk_fp_sort(Bitwuzla *bitwuzla, uint32_t exp_size, uint32_t sig_size)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_ZERO(exp_size);
   BZLA_CHECK_ARG_NOT_ZERO(sig_size);
 
@@ -1487,6 +1601,7 @@ bitwuzla_mk_fun_sort(Bitwuzla *bitwuzla,
                      const BitwuzlaSort *codomain)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_ZERO(arity);
   BZLA_CHECK_ARG_NOT_NULL(domain);
   BZLA_CHECK_ARG_NOT_NULL(codomain);
@@ -1514,6 +1629,7 @@ const BitwuzlaSort *
 bitwuzla_mk_rm_sort(Bitwuzla *bitwuzla)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
 
   Bzla *bzla     = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BzlaSortId res = bzla_sort_rm(bzla);
@@ -1524,6 +1640,7 @@ const BitwuzlaTerm *
 bitwuzla_mk_true(Bitwuzla *bitwuzla)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
 
   Bzla *bzla    = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BzlaNode *res = bzla_exp_true(bzla);
@@ -1534,6 +1651,7 @@ const BitwuzlaTerm *
 bitwuzla_mk_false(Bitwuzla *bitwuzla)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
 
   Bzla *bzla    = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BzlaNode *res = bzla_exp_false(bzla);
@@ -1544,6 +1662,7 @@ const BitwuzlaTerm *
 bitwuzla_mk_bv_zero(Bitwuzla *bitwuzla, const BitwuzlaSort *sort)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, sort);
 
@@ -1559,6 +1678,7 @@ const BitwuzlaTerm *
 bitwuzla_mk_bv_one(Bitwuzla *bitwuzla, const BitwuzlaSort *sort)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, sort);
 
@@ -1574,6 +1694,7 @@ const BitwuzlaTerm *
 bitwuzla_mk_bv_ones(Bitwuzla *bitwuzla, const BitwuzlaSort *sort)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, sort);
 
@@ -1589,6 +1710,7 @@ const BitwuzlaTerm *
 bitwuzla_mk_bv_min_signed(Bitwuzla *bitwuzla, const BitwuzlaSort *sort)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, sort);
 
@@ -1604,6 +1726,7 @@ const BitwuzlaTerm *
 bitwuzla_mk_bv_max_signed(Bitwuzla *bitwuzla, const BitwuzlaSort *sort)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, sort);
 
@@ -1619,6 +1742,7 @@ const BitwuzlaTerm *
 bitwuzla_mk_fp_pos_zero(Bitwuzla *bitwuzla, const BitwuzlaSort *sort)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, sort);
 
@@ -1634,6 +1758,7 @@ const BitwuzlaTerm *
 bitwuzla_mk_fp_neg_zero(Bitwuzla *bitwuzla, const BitwuzlaSort *sort)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, sort);
 
@@ -1649,6 +1774,7 @@ const BitwuzlaTerm *
 bitwuzla_mk_fp_pos_inf(Bitwuzla *bitwuzla, const BitwuzlaSort *sort)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, sort);
 
@@ -1664,6 +1790,7 @@ const BitwuzlaTerm *
 bitwuzla_mk_fp_neg_inf(Bitwuzla *bitwuzla, const BitwuzlaSort *sort)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, sort);
 
@@ -1679,6 +1806,7 @@ const BitwuzlaTerm *
 bitwuzla_mk_fp_nan(Bitwuzla *bitwuzla, const BitwuzlaSort *sort)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, sort);
 
@@ -1697,6 +1825,7 @@ bitwuzla_mk_bv_value(Bitwuzla *bitwuzla,
                      BitwuzlaBVBase base)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_ARG_STR_NOT_NULL_OR_EMPTY(value);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, sort);
@@ -1781,6 +1910,7 @@ bitwuzla_mk_bv_value_uint64(Bitwuzla *bitwuzla,
                             uint64_t value)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, sort);
 
@@ -1801,6 +1931,7 @@ bitwuzla_mk_fp_value(Bitwuzla *bitwuzla,
                      const BitwuzlaTerm *bv_significand)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(bv_sign);
   BZLA_CHECK_ARG_NOT_NULL(bv_exponent);
   BZLA_CHECK_ARG_NOT_NULL(bv_significand);
@@ -1836,6 +1967,7 @@ bitwuzla_mk_fp_value_from_real(Bitwuzla *bitwuzla,
                                const char *real)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_ARG_NOT_NULL(rm);
   BZLA_CHECK_ARG_STR_NOT_NULL_OR_EMPTY(real);
@@ -1865,6 +1997,7 @@ bitwuzla_mk_fp_value_from_rational(Bitwuzla *bitwuzla,
                                    const char *den)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_ARG_NOT_NULL(rm);
   BZLA_CHECK_ARG_STR_NOT_NULL_OR_EMPTY(num);
@@ -1893,6 +2026,7 @@ const BitwuzlaTerm *
 bitwuzla_mk_rm_value(Bitwuzla *bitwuzla, BitwuzlaRoundingMode rm)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_ABORT(rm >= BITWUZLA_RM_MAX, "invalid rounding mode");
 
   Bzla *bzla    = BZLA_IMPORT_BITWUZLA(bitwuzla);
@@ -1937,6 +2071,7 @@ bitwuzla_mk_term(Bitwuzla *bitwuzla,
                  const BitwuzlaTerm *args[])
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
 
   Bzla *bzla           = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BzlaNode **bzla_args = BZLA_IMPORT_BITWUZLA_TERMS(args);
@@ -2613,6 +2748,7 @@ bitwuzla_mk_term_indexed(Bitwuzla *bitwuzla,
                          const uint32_t idxs[])
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
 
   Bzla *bzla           = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BzlaNode **bzla_args = BZLA_IMPORT_BITWUZLA_TERMS(args);
@@ -2756,6 +2892,7 @@ bitwuzla_mk_const(Bitwuzla *bitwuzla,
                   const char *symbol)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, sort);
 
@@ -2785,6 +2922,7 @@ bitwuzla_mk_const_array(Bitwuzla *bitwuzla,
                         const BitwuzlaTerm *value)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_ARG_NOT_NULL(value);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, sort);
@@ -2810,6 +2948,7 @@ bitwuzla_mk_var(Bitwuzla *bitwuzla,
                 const char *symbol)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(sort);
   BZLA_CHECK_SORT_BITWUZLA(bitwuzla, sort);
 
@@ -2825,24 +2964,20 @@ void
 bitwuzla_push(Bitwuzla *bitwuzla, uint32_t nlevels)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
 
   Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BZLA_CHECK_OPT_INCREMENTAL(bzla);
-  if (nlevels)
-  {
-    for (uint32_t i = 0; i < nlevels; i++)
-    {
-      BZLA_PUSH_STACK(bzla->assertions_trail,
-                      BZLA_COUNT_STACK(bzla->assertions));
-    }
-    bzla->num_push_pop++;
-  }
+  bzla_push(bzla, nlevels);
 }
 
 void
 bitwuzla_pop(Bitwuzla *bitwuzla, uint32_t nlevels)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
 
   Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BZLA_CHECK_OPT_INCREMENTAL(bzla);
@@ -2851,28 +2986,14 @@ bitwuzla_pop(Bitwuzla *bitwuzla, uint32_t nlevels)
       "number of levels to pop (%u) greater than number of pushed levels (%u)",
       nlevels,
       BZLA_COUNT_STACK(bzla->assertions_trail));
-
-  if (nlevels)
-  {
-    uint32_t pos = 0;
-    for (uint32_t i = 0; i < nlevels; i++)
-    {
-      pos = BZLA_POP_STACK(bzla->assertions_trail);
-    }
-    while (BZLA_COUNT_STACK(bzla->assertions) > pos)
-    {
-      BzlaNode *cur = BZLA_POP_STACK(bzla->assertions);
-      bzla_hashint_table_remove(bzla->assertions_cache, bzla_node_get_id(cur));
-      bzla_node_release(bzla, cur);
-    }
-    bzla->num_push_pop++;
-  }
+  bzla_pop(bzla, nlevels);
 }
 
 void
 bitwuzla_assert(Bitwuzla *bitwuzla, const BitwuzlaTerm *term)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(term);
 
   reset_assumptions(bitwuzla);
@@ -2900,12 +3021,15 @@ bitwuzla_assert(Bitwuzla *bitwuzla, const BitwuzlaTerm *term)
   {
     bzla_assert_exp(bzla, bzla_term);
   }
+  bzla_pipeline_push(bzla, bzla_term);
 }
 
 void
 bitwuzla_assume(Bitwuzla *bitwuzla, const BitwuzlaTerm *term)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
   BZLA_CHECK_ARG_NOT_NULL(term);
 
   reset_assumptions(bitwuzla);
@@ -2927,11 +3051,15 @@ bool
 bitwuzla_is_unsat_assumption(Bitwuzla *bitwuzla, const BitwuzlaTerm *term)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
   BZLA_CHECK_ARG_NOT_NULL(term);
 
   Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BZLA_CHECK_OPT_INCREMENTAL(bzla);
   BZLA_CHECK_UNSAT(bzla, "check for unsat assumptions");
+  BZLA_ABORT(bzla->quantifiers->count,
+             "unsat assumptions are currently not supported with quantifiers");
 
   BzlaNode *bzla_term = BZLA_IMPORT_BITWUZLA_TERM(term);
   assert(bzla_node_get_ext_refs(bzla_term));
@@ -2946,11 +3074,15 @@ const BitwuzlaTerm **
 bitwuzla_get_unsat_assumptions(Bitwuzla *bitwuzla, size_t *size)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
   BZLA_CHECK_ARG_NOT_NULL(size);
 
   Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BZLA_CHECK_OPT_INCREMENTAL(bzla);
   BZLA_CHECK_UNSAT(bzla, "get unsat assumptions");
+  BZLA_ABORT(bzla->quantifiers->count,
+             "unsat assumptions are currently not supported with quantifiers");
 
   BZLA_RESET_STACK(bitwuzla->d_unsat_assumptions);
 
@@ -2972,11 +3104,15 @@ const BitwuzlaTerm **
 bitwuzla_get_unsat_core(Bitwuzla *bitwuzla, size_t *size)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
   BZLA_CHECK_ARG_NOT_NULL(size);
 
   Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BZLA_CHECK_OPT_PRODUCE_UNSAT_CORES(bzla);
   BZLA_CHECK_UNSAT(bzla, "get unsat core");
+  BZLA_ABORT(bzla->quantifiers->count,
+             "unsat cores are currently not supported with quantifiers");
 
   BZLA_RESET_STACK(bitwuzla->d_unsat_core);
 
@@ -3000,6 +3136,8 @@ void
 bitwuzla_fixate_assumptions(Bitwuzla *bitwuzla)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
 
   Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BZLA_CHECK_OPT_INCREMENTAL(bzla);
@@ -3010,6 +3148,8 @@ void
 bitwuzla_reset_assumptions(Bitwuzla *bitwuzla)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
 
   Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
   BZLA_CHECK_OPT_INCREMENTAL(bzla);
@@ -3020,6 +3160,8 @@ BitwuzlaResult
 bitwuzla_simplify(Bitwuzla *bitwuzla)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
 
   reset_assumptions(bitwuzla);
 
@@ -3031,33 +3173,182 @@ bitwuzla_simplify(Bitwuzla *bitwuzla)
   return BITWUZLA_UNKNOWN;
 }
 
-BitwuzlaResult
-bitwuzla_check_sat(Bitwuzla *bitwuzla)
+static void
+check_sat_prepare(Bitwuzla *bitwuzla)
 {
-  BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  assert(bitwuzla);
 
   reset_assumptions(bitwuzla);
 
   Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
+  /* wait for formulas that are bit-blasted in the background */
+  bzla_pipeline_sync(bzla);
   if (bzla->bzla_sat_bzla_called > 0)
   {
     BZLA_CHECK_OPT_INCREMENTAL(bzla);
   }
-  BZLA_ABORT(
-      bzla_opt_get(bzla, BZLA_OPT_INCREMENTAL) && bzla->quantifiers->count,
-      "incremental solving is currently not supported with quantifiers");
+  BZLA_ABORT(bzla->quantifiers->count && bzla->slv
+                 && bzla->slv->kind != BZLA_QUANT_SOLVER_KIND,
+             "quantifiers must be asserted before the first check-sat call");
+}
+
+static BitwuzlaResult
+check_sat(Bitwuzla *bitwuzla)
+{
+  assert(bitwuzla);
 
-  BzlaSolverResult bzla_res = bzla_check_sat(bzla, -1, -1);
+  BzlaSolverResult bzla_res =
+      bzla_check_sat(BZLA_IMPORT_BITWUZLA(bitwuzla), -1, -1);
   if (bzla_res == BZLA_RESULT_SAT) return BITWUZLA_SAT;
   if (bzla_res == BZLA_RESULT_UNSAT) return BITWUZLA_UNSAT;
   assert(bzla_res == BZLA_RESULT_UNKNOWN);
   return BITWUZLA_UNKNOWN;
 }
 
+BitwuzlaResult
+bitwuzla_check_sat(Bitwuzla *bitwuzla)
+{
+  BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+
+  check_sat_prepare(bitwuzla);
+  return check_sat(bitwuzla);
+}
+
+#ifdef BZLA_HAVE_PTHREADS
+static void *
+check_sat_async_thread(void *state)
+{
+  BitwuzlaCheckSatHandle *handle = state;
+  BitwuzlaResult res             = check_sat(handle->d_bitwuzla);
+
+  pthread_mutex_lock(&handle->d_mutex);
+  handle->d_result = res;
+  handle->d_done   = true;
+  pthread_cond_broadcast(&handle->d_cond);
+  pthread_mutex_unlock(&handle->d_mutex);
+  return NULL;
+}
+#endif
+
+BitwuzlaCheckSatHandle *
+bitwuzla_check_sat_async(Bitwuzla *bitwuzla)
+{
+  BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+
+  BitwuzlaCheckSatHandle *res;
+  Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
+
+  check_sat_prepare(bitwuzla);
+
+  /* Cancellation is checked as part of the termination checks, make sure
+   * that they are enabled (keeps a configured termination callback). */
+  bzla_set_term(
+      bzla, (int32_t(*)(void *)) bzla->cbs.term.fun, bzla->cbs.term.state);
+
+  BZLA_CNEW(bitwuzla->d_mm, res);
+  res->d_bitwuzla              = bitwuzla;
+  bitwuzla->d_check_sat_handle = res;
+
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_mutex_init(&res->d_mutex, NULL);
+  pthread_cond_init(&res->d_cond, NULL);
+  BZLA_ABORT(pthread_create(&res->d_thread, NULL, check_sat_async_thread, res),
+             "failed to create thread for asynchronous check");
+#else
+  res->d_result = check_sat(bitwuzla);
+  res->d_done   = true;
+#endif
+  return res;
+}
+
+bool
+bitwuzla_check_sat_poll(BitwuzlaCheckSatHandle *handle)
+{
+  BZLA_CHECK_ARG_NOT_NULL(handle);
+  return bitwuzla_check_sat_wait(handle, 0);
+}
+
+bool
+bitwuzla_check_sat_wait(BitwuzlaCheckSatHandle *handle, int64_t timeout_ms)
+{
+  BZLA_CHECK_ARG_NOT_NULL(handle);
+
+#ifdef BZLA_HAVE_PTHREADS
+  bool res;
+  struct timespec deadline;
+
+  if (timeout_ms >= 0)
+  {
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (timeout_ms % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000)
+    {
+      deadline.tv_sec += 1;
+      deadline.tv_nsec -= 1000000000;
+    }
+  }
+
+  pthread_mutex_lock(&handle->d_mutex);
+  while (!handle->d_done)
+  {
+    if (timeout_ms < 0)
+    {
+      pthread_cond_wait(&handle->d_cond, &handle->d_mutex);
+    }
+    else if (pthread_cond_timedwait(
+                 &handle->d_cond, &handle->d_mutex, &deadline)
+             == ETIMEDOUT)
+    {
+      break;
+    }
+  }
+  res = handle->d_done;
+  pthread_mutex_unlock(&handle->d_mutex);
+  return res;
+#else
+  (void) timeout_ms;
+  return handle->d_done;
+#endif
+}
+
+void
+bitwuzla_check_sat_cancel(BitwuzlaCheckSatHandle *handle)
+{
+  BZLA_CHECK_ARG_NOT_NULL(handle);
+  bzla_set_cancel(BZLA_IMPORT_BITWUZLA(handle->d_bitwuzla), true);
+}
+
+BitwuzlaResult
+bitwuzla_check_sat_join(BitwuzlaCheckSatHandle *handle)
+{
+  BZLA_CHECK_ARG_NOT_NULL(handle);
+
+  BitwuzlaResult res;
+  Bitwuzla *bitwuzla = handle->d_bitwuzla;
+
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_join(handle->d_thread, NULL);
+  pthread_cond_destroy(&handle->d_cond);
+  pthread_mutex_destroy(&handle->d_mutex);
+#endif
+  assert(handle->d_done);
+  res = handle->d_result;
+
+  bzla_set_cancel(BZLA_IMPORT_BITWUZLA(bitwuzla), false);
+  bitwuzla->d_check_sat_handle = NULL;
+  BZLA_DELETE(bitwuzla->d_mm, handle);
+  return res;
+}
+
 const BitwuzlaTerm *
 bitwuzla_get_value(Bitwuzla *bitwuzla, const BitwuzlaTerm *term)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
   BZLA_CHECK_ARG_NOT_NULL(term);
 
   Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
@@ -3078,6 +3369,8 @@ const char *
 bitwuzla_get_bv_value(Bitwuzla *bitwuzla, const BitwuzlaTerm *term)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
   BZLA_CHECK_ARG_NOT_NULL(term);
 
   Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
@@ -3109,6 +3402,8 @@ bitwuzla_get_fp_value(Bitwuzla *bitwuzla,
                       const char **significand)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
   BZLA_CHECK_ARG_NOT_NULL(term);
   BZLA_CHECK_ARG_NOT_NULL(sign);
   BZLA_CHECK_ARG_NOT_NULL(exponent);
@@ -3153,6 +3448,8 @@ const char *
 bitwuzla_get_rm_value(Bitwuzla *bitwuzla, const BitwuzlaTerm *term)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
   BZLA_CHECK_ARG_NOT_NULL(term);
 
   Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
@@ -3185,6 +3482,8 @@ bitwuzla_get_array_value(Bitwuzla *bitwuzla,
                          const BitwuzlaTerm **default_value)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
   BZLA_CHECK_ARG_NOT_NULL(term);
   BZLA_CHECK_ARG_NOT_NULL(indices);
   BZLA_CHECK_ARG_NOT_NULL(values);
@@ -3263,6 +3562,8 @@ bitwuzla_get_fun_value(Bitwuzla *bitwuzla,
                        size_t *size)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
   BZLA_CHECK_ARG_NOT_NULL(term);
   BZLA_CHECK_ARG_NOT_NULL(args);
   BZLA_CHECK_ARG_NOT_NULL(arity);
@@ -3337,6 +3638,8 @@ void
 bitwuzla_print_model(Bitwuzla *bitwuzla, const char *format, FILE *file)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
   BZLA_CHECK_ARG_STR_NOT_NULL_OR_EMPTY(format);
   BZLA_CHECK_ARG_NOT_NULL(file);
   BZLA_ABORT(strcmp(format, "btor") && strcmp(format, "smt2"),
@@ -3353,6 +3656,8 @@ void
 bitwuzla_dump_formula(Bitwuzla *bitwuzla, const char *format, FILE *file)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
   BZLA_CHECK_ARG_STR_NOT_NULL_OR_EMPTY(format);
   BZLA_CHECK_ARG_NOT_NULL(file);
 
@@ -3394,6 +3699,7 @@ bitwuzla_parse(Bitwuzla *bitwuzla,
                bool *parsed_smt2)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(infile);
   BZLA_CHECK_ARG_STR_NOT_NULL_OR_EMPTY(infile_name);
   BZLA_CHECK_ARG_NOT_NULL(outfile);
@@ -3427,6 +3733,7 @@ bitwuzla_parse_format(Bitwuzla *bitwuzla,
                       BitwuzlaResult *parsed_status)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_STR_NOT_NULL_OR_EMPTY(format);
   BZLA_CHECK_ARG_NOT_NULL(infile);
   BZLA_CHECK_ARG_STR_NOT_NULL_OR_EMPTY(infile_name);
@@ -3486,6 +3793,8 @@ bitwuzla_substitute_terms(Bitwuzla *bitwuzla,
                           const BitwuzlaTerm *map_values[])
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
+  bzla_pipeline_sync(BZLA_IMPORT_BITWUZLA(bitwuzla));
   BZLA_ABORT(terms_size == 0, "no terms to substitute");
   BZLA_ABORT(map_size == 0, "empty substitution map");
 
@@ -4645,6 +4954,7 @@ void
 bitwuzla_set_bzla_id(Bitwuzla *bitwuzla, const BitwuzlaTerm *term, int32_t id)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(term);
 
   Bzla *bzla          = BZLA_IMPORT_BITWUZLA(bitwuzla);
@@ -4664,6 +4974,7 @@ void
 bitwuzla_add_output(Bitwuzla *bitwuzla, const BitwuzlaTerm *term)
 {
   BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_NOT_SOLVING(bitwuzla);
   BZLA_CHECK_ARG_NOT_NULL(term);
 
   Bzla *bzla          = BZLA_IMPORT_BITWUZLA(bitwuzla);
@@ -59,6 +59,10 @@ enum BitwuzlaOption
    *  * **aigprop**:
    *    The propagation-based local search QF_BV engine that operates on the
    *    bit-blasted formula (the AIG circuit layer).
+   *  * **auto**:
+   *    Select engine and SAT solver automatically, based on features of the
+   *    formula (after simplification) and a built-in decision model.
+   *    Local search engines are only selected for QF_BV formulas.
    *  * **fun** [**default**]:
    *    The default engine for all combinations of QF_AUFBVFP, uses lemmas on
    *    demand for QF_AUFBVFP, and eager bit-blasting (optionally with local
@@ -510,6 +514,25 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_FUN_EAGER_LEMMAS,
 
+  /*! **Function solver engine:
+   *    Lazy synthesis of constraints.**
+   *
+   * Synthesize (bit-blast) constraints on demand when checking
+   * satisfiability under assumptions. Constraints that share variables with
+   * the assumptions are synthesized first, the remaining constraints only if
+   * they are violated by the model of the current bit-vector skeleton.
+   * Satisfiable results are only reported if all constraints are satisfied.
+   * Only applies to formulas without functions, arrays, floating-point terms
+   * and quantifiers.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure the func solver engine.
+   */
+  BITWUZLA_OPT_FUN_LAZY_CONSTRAINTS,
+
   /*! **Function solver engine:
    *    Lazy synthesis.**
    *
@@ -1421,8 +1444,68 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_QUANT_SYNTH_QI,
 
+  /*! **Quantifier solver engine:
+   *    Number of threads for checking instantiations.**
+   *
+   * Configure the number of worker threads that check the instantiated
+   * formula in parallel. The formula is split into independent parts that
+   * are checked by separate ground solvers.
+   *
+   * Values:
+   *  * An unsigned integer value > 0 [**default**: 1]
+   *
+   *  @warning This is an expert option to configure the quantifier solver
+   *  engine.
+   */
+  BITWUZLA_OPT_QUANT_THREADS,
+
   /* ------------------------ Other Expert Options ------------------------- */
 
+  /*! **Model checking: k-induction.**
+   *
+   * For BTOR2 input with model checking extensions, additionally try to
+   * prove that bad properties are unreachable via k-induction while checking
+   * bounds.
+   *
+   * Values:
+   *  * **on**: enable
+   *  * **off**: disable [**default**]
+   *
+   *  @warning This is an expert option.
+   */
+  BITWUZLA_OPT_BMC_KIND,
+
+  /*! **Model checking: maximum bound.**
+   *
+   * For BTOR2 input with model checking extensions, the maximum bound up to
+   * which bad properties are checked via bounded model checking.
+   *
+   * Values:
+   *  * An unsigned integer value (**default**: 20).
+   *
+   *  @warning This is an expert option.
+   */
+  BITWUZLA_OPT_BMC_KMAX,
+
+  /*! **Bit-width reduction abstraction.**
+   *
+   * Before bit-blasting at full width, solve abstractions of the formula
+   * where all bit-vector variables are restricted to their k least
+   * significant bits (sign-extended), starting with k = the given value and
+   * doubling k on unsatisfiable abstractions. Satisfying assignments are
+   * lifted to and checked against the original formula. Falls back to
+   * solving at full width if no abstraction is conclusive.
+   *
+   * Disabled if zero. Only effective for quantifier-free bit-vector formulas
+   * and engine `fun`.
+   *
+   * Values:
+   *  * An unsigned integer value (**default**: 0).
+   *
+   *  @warning This is an expert option.
+   */
+  BITWUZLA_OPT_BW_REDUCE,
+
   /*! **Check model (debug only).**
    *
    * Values:
@@ -1465,6 +1548,25 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_DECLSORT_BV_WIDTH,
 
+  /*! **Encode ITE chains as multiplexer trees.**
+   *
+   * Bit-blast chains of if-then-else terms over equalities between the same
+   * selector term and distinct constants (e.g., encoded switch statements or
+   * table lookups) of at least the given length as a decoder over the
+   * selector bits and a balanced multiplexer tree, rather than as a sequence
+   * of comparators and two-way multiplexers. Chains for which this requires
+   * more AIG nodes (e.g., few cases with sparse constants) are encoded as
+   * before.
+   *
+   * Disabled if zero.
+   *
+   * Values:
+   *  * An unsigned integer value (**default**: 4).
+   *
+   *  @warning This is an expert option.
+   */
+  BITWUZLA_OPT_ITE_CHAINS,
+
   /*! **Share partial models determined via local search with bit-blasting
    *    engine.**
    *
@@ -1489,6 +1591,22 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_PARSE_INTERACTIVE,
 
+  /*! **Pipelined bit-blasting.**
+   *
+   * Bit-blast asserted formulas in a background thread while further
+   * formulas are constructed and asserted. Satisfiability checks wait until
+   * all asserted formulas are bit-blasted. Only effective for engine
+   * **fun** and for pure bit-vector formulas (without arrays, functions,
+   * floating-point terms or quantifiers).
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option.
+   */
+  BITWUZLA_OPT_PIPELINE,
+
   /*! **Use CaDiCaL's freeze/melt.**
    *
    * Values:
@@ -2095,6 +2213,10 @@ typedef struct Bitwuzla Bitwuzla;
 typedef struct BitwuzlaTerm BitwuzlaTerm;
 /** A Bitwuzla sort. */
 typedef struct BitwuzlaSort BitwuzlaSort;
+/** A handle to an asynchronous satisfiability check. */
+typedef struct BitwuzlaCheckSatHandle BitwuzlaCheckSatHandle;
+/** A term store shared between Bitwuzla instances. */
+typedef struct BitwuzlaTermStore BitwuzlaTermStore;
 
 /* -------------------------------------------------------------------------- */
 /* Bitwuzla                                                                   */
@@ -2140,6 +2262,54 @@ void bitwuzla_delete(Bitwuzla *bitwuzla);
  */
 void bitwuzla_reset(Bitwuzla *bitwuzla);
 
+/**
+ * Create a new term store.
+ *
+ * A term store holds hash-consed, immutable data of terms (the values of
+ * bit-vector constants and model values). Every Bitwuzla instance owns a
+ * private term store, a term store created with this function can be shared
+ * between several Bitwuzla instances (see `bitwuzla_set_term_store()`) to
+ * reduce the memory footprint of instances that create largely the same
+ * terms. The store is thread-safe, instances that share a store may be used
+ * concurrently from different threads.
+ *
+ * The returned store must be deleted via `bitwuzla_term_store_delete()`.
+ *
+ * @return A pointer to the created term store.
+ *
+ * @see
+ *   * `bitwuzla_set_term_store`
+ *   * `bitwuzla_term_store_delete`
+ */
+BitwuzlaTermStore *bitwuzla_term_store_new(void);
+
+/**
+ * Delete a term store.
+ *
+ * The store is only released once all instances it is attached to have been
+ * deleted, it is thus safe to delete the store right after attaching it.
+ *
+ * @param store The term store to delete.
+ *
+ * @see
+ *   * `bitwuzla_term_store_new`
+ */
+void bitwuzla_term_store_delete(BitwuzlaTermStore *store);
+
+/**
+ * Attach a term store to a Bitwuzla instance.
+ *
+ * Data of already existing terms is moved into the store. An instance can be
+ * attached to at most one term store, which is kept on `bitwuzla_reset()`.
+ *
+ * @param bitwuzla The Bitwuzla instance.
+ * @param store The term store.
+ *
+ * @see
+ *   * `bitwuzla_term_store_new`
+ */
+void bitwuzla_set_term_store(Bitwuzla *bitwuzla, BitwuzlaTermStore *store);
+
 /**
  * Get copyright information.
  *
@@ -2211,6 +2381,30 @@ void bitwuzla_set_termination_callback(Bitwuzla *bitwuzla,
  */
 void *bitwuzla_get_termination_callback_state(Bitwuzla *bitwuzla);
 
+/**
+ * Configure an external AIG optimizer.
+ *
+ * Before the bit-blasted constraints are encoded to CNF, their AIGs are
+ * written as binary AIGER model to file `in` and the optimizer is called. It
+ * is expected to write an equivalent combinational AIGER model with the same
+ * inputs (in the same order) and outputs to file `out`. The AIGs of the
+ * optimized model then replace the original AIGs. If the optimizer fails or
+ * the optimized model does not match, the original AIGs are used.
+ *
+ * @note The optimizer is only applied to formulas without functions, arrays
+ *       and quantifiers.
+ *
+ * @param bitwuzla The Bitwuzla instance.
+ * @param fun The callback function, returns 0 on success. Disables the
+ *            optimizer if NULL.
+ * @param state The argument to the callback function.
+ */
+void bitwuzla_set_aig_optimizer(Bitwuzla *bitwuzla,
+                                int32_t (*fun)(void *state,
+                                               const char *in,
+                                               const char *out),
+                                void *state);
+
 /**
  * Configure an abort callback function, which is called instead of exit
  * on abort conditions.
@@ -3135,6 +3329,101 @@ BitwuzlaResult bitwuzla_simplify(Bitwuzla *bitwuzla);
  */
 BitwuzlaResult bitwuzla_check_sat(Bitwuzla *bitwuzla);
 
+/**
+ * Check satisfiability of current input formula asynchronously.
+ *
+ * Starts checking satisfiability as `bitwuzla_check_sat()` in a separate
+ * thread and returns immediately. The returned handle can be polled via
+ * `bitwuzla_check_sat_poll()`, waited on via `bitwuzla_check_sat_wait()` and
+ * cancelled via `bitwuzla_check_sat_cancel()`. It must be released via
+ * `bitwuzla_check_sat_join()`, which yields the result of the check.
+ *
+ * @note While the check is in progress, i.e., until the handle is joined,
+ *       the only functions that may be called on `bitwuzla` are the
+ *       `bitwuzla_check_sat_*` functions on the returned handle. Any other
+ *       API call on `bitwuzla` (or on its terms and sorts) aborts or is
+ *       undefined, independent instances may be used concurrently.
+ *       Functions `bitwuzla_check_sat_poll()`,
+ *       `bitwuzla_check_sat_wait()` and `bitwuzla_check_sat_cancel()` may
+ *       be called from any thread. The termination callback configured via
+ *       `bitwuzla_set_termination_callback()` is called from the thread
+ *       checking satisfiability.
+ *
+ * @note If Bitwuzla was built without thread support, the check is
+ *       performed synchronously before this function returns.
+ *
+ * @param bitwuzla The Bitwuzla instance.
+ *
+ * @return A handle to the asynchronous check.
+ *
+ * @see
+ *   * `bitwuzla_check_sat`
+ *   * `bitwuzla_check_sat_join`
+ */
+BitwuzlaCheckSatHandle *bitwuzla_check_sat_async(Bitwuzla *bitwuzla);
+
+/**
+ * Determine if an asynchronous satisfiability check has finished.
+ *
+ * @param handle The handle of the check.
+ *
+ * @return True if the check has finished.
+ *
+ * @see
+ *   * `bitwuzla_check_sat_async`
+ */
+bool bitwuzla_check_sat_poll(BitwuzlaCheckSatHandle *handle);
+
+/**
+ * Wait for an asynchronous satisfiability check to finish.
+ *
+ * @param handle The handle of the check.
+ * @param timeout_ms The maximum time to wait in milliseconds, wait until the
+ *                   check finishes if negative.
+ *
+ * @return True if the check has finished, false if the timeout was reached.
+ *
+ * @see
+ *   * `bitwuzla_check_sat_async`
+ */
+bool bitwuzla_check_sat_wait(BitwuzlaCheckSatHandle *handle,
+                             int64_t timeout_ms);
+
+/**
+ * Cancel an asynchronous satisfiability check.
+ *
+ * Requests termination of the check and returns immediately, use
+ * `bitwuzla_check_sat_wait()` or `bitwuzla_check_sat_join()` to wait until
+ * the check has been terminated. A cancelled check yields
+ * `::BITWUZLA_UNKNOWN` unless it finished before noticing the cancellation.
+ *
+ * @note Cancellation is checked at the same points as the termination
+ *       callback. If the configured SAT solver does not support termination,
+ *       a running SAT solver call is not interrupted.
+ *
+ * @param handle The handle of the check.
+ *
+ * @see
+ *   * `bitwuzla_check_sat_async`
+ */
+void bitwuzla_check_sat_cancel(BitwuzlaCheckSatHandle *handle);
+
+/**
+ * Wait for an asynchronous satisfiability check to finish and release its
+ * handle.
+ *
+ * After this call, the associated Bitwuzla instance can be used as after a
+ * call to `bitwuzla_check_sat()`, e.g., to query model values.
+ *
+ * @param handle The handle of the check.
+ *
+ * @return The result of the check as returned by `bitwuzla_check_sat()`.
+ *
+ * @see
+ *   * `bitwuzla_check_sat_async`
+ */
+BitwuzlaResult bitwuzla_check_sat_join(BitwuzlaCheckSatHandle *handle);
+
 /**
  * Get a term representing the model value of a given term.
  *
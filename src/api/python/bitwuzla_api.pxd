@@ -295,10 +295,10 @@ cdef extern from "bitwuzla.h":
         except +raise_py_error
 
     BitwuzlaResult bitwuzla_simplify(Bitwuzla *bitwuzla) \
-        except +raise_py_error
+        except +raise_py_error nogil
 
     BitwuzlaResult bitwuzla_check_sat(Bitwuzla *bitwuzla) \
-        except +raise_py_error
+        except +raise_py_error nogil
 
     const BitwuzlaTerm *bitwuzla_get_value(Bitwuzla *bitwuzla,
                                            const BitwuzlaTerm *term) \
@@ -338,11 +338,11 @@ cdef extern from "bitwuzla.h":
 
     void bitwuzla_print_model(Bitwuzla *bitwuzla,
                               const char *format, FILE *file) \
-        except +raise_py_error
+        except +raise_py_error nogil
 
     void bitwuzla_dump_formula(Bitwuzla *bitwuzla,
                                const char *format, FILE *file) \
-        except +raise_py_error
+        except +raise_py_error nogil
 
 #    BitwuzlaResult bitwuzla_parse(Bitwuzla *bitwuzla,
 #                                  FILE *infile,
@@ -645,8 +645,19 @@ cdef class Bitwuzla:
            .. seealso::
                :func:`~pybitwuzla.Bitwuzla.get_value`,
                :func:`~pybitwuzla.Bitwuzla.get_value_str`
+
+           .. note::
+               The GIL is released while solving, other Python threads
+               (e.g., solving independent Bitwuzla instances) may run
+               concurrently. A termination callback configured via
+               :func:`~pybitwuzla.Bitwuzla.set_term` reacquires the GIL
+               while it is called.
         """
-        return _to_result(bitwuzla_api.bitwuzla_check_sat(self.ptr()))
+        cdef bitwuzla_api.Bitwuzla *bzla = self.ptr()
+        cdef BitwuzlaResult res
+        with nogil:
+            res = bitwuzla_api.bitwuzla_check_sat(bzla)
+        return _to_result(res)
 
 
     def simplify(self):
@@ -661,8 +672,15 @@ cdef class Bitwuzla:
            .. note::
                Each call to :func:`~pybitwuzla.Bitwuzla.check_sat`
                simplifies the input formula as a preprocessing step.
+
+           .. note::
+               The GIL is released while simplifying.
         """
-        return _to_result(bitwuzla_api.bitwuzla_simplify(self.ptr()))
+        cdef bitwuzla_api.Bitwuzla *bzla = self.ptr()
+        cdef BitwuzlaResult res
+        with nogil:
+            res = bitwuzla_api.bitwuzla_simplify(bzla)
+        return _to_result(res)
 
 
     def get_unsat_core(self):
@@ -784,9 +802,13 @@ cdef class Bitwuzla:
            :rtype: str
         """
         cdef FILE * out
+        cdef bitwuzla_api.Bitwuzla *bzla = self.ptr()
+        cdef bytes cfmt = fmt.encode()
+        cdef const char *c_fmt = cfmt
         with tempfile.NamedTemporaryFile('r') as f:
             out = fopen(_to_cstr(f.name), 'w')
-            bitwuzla_api.bitwuzla_print_model(self.ptr(), _to_cstr(fmt), out)
+            with nogil:
+                bitwuzla_api.bitwuzla_print_model(bzla, c_fmt, out)
             fclose(out)
             return f.read().strip()
 
@@ -803,9 +825,13 @@ cdef class Bitwuzla:
            :rtype: str
         """
         cdef FILE * out
+        cdef bitwuzla_api.Bitwuzla *bzla = self.ptr()
+        cdef bytes cfmt = fmt.encode()
+        cdef const char *c_fmt = cfmt
         with tempfile.NamedTemporaryFile('r') as f:
             out = fopen(_to_cstr(f.name), 'w')
-            bitwuzla_api.bitwuzla_dump_formula(self.ptr(), _to_cstr(fmt), out)
+            with nogil:
+                bitwuzla_api.bitwuzla_dump_formula(bzla, c_fmt, out)
             fclose(out)
             return f.read().strip()
 
@@ -11,6 +11,7 @@
 #include "pybitwuzla_utils.h"
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdlib.h>
 
 #include "utils/bzlaabort.h"
@@ -30,30 +31,33 @@ terminate_callback(void *state)
 {
   assert(state);
 
+  bool failed, is_bool;
   PyObject *res;
   PyGILState_STATE gstate;
   CallbackState *cbstate;
 
-  gstate  = PyGILState_Ensure();
   cbstate = (CallbackState *) state;
   if (!cbstate->fun) return 0;
   if (cbstate->done) return 1;
-  res = PyObject_CallObject((PyObject *) cbstate->fun,
-                            (PyObject *) cbstate->state);
+
+  /* The solver is called with the GIL released, reacquire it for calling
+   * back into Python. Note that the GIL must be released again before
+   * aborting, since aborting throws an exception that unwinds the solver. */
+  gstate = PyGILState_Ensure();
+  res    = PyObject_CallObject((PyObject *) cbstate->fun,
+                               (PyObject *) cbstate->state);
   if (PyErr_Occurred()) PyErr_Print();
-  BZLA_ABORT(!res, "call to callback termination function failed");
-  BZLA_ABORT(!PyBool_Check(res),
-             "expected Boolean result for termination callback");
-  if (res == Py_True)
+  failed  = res == NULL;
+  is_bool = !failed && PyBool_Check(res);
+  if (is_bool)
   {
-    cbstate->done = 1;
+    cbstate->done = res == Py_True;
   }
-  else
-  {
-    cbstate->done = 0;
-  }
-  Py_DECREF(res);
+  Py_XDECREF(res);
   PyGILState_Release(gstate);
+
+  BZLA_ABORT(failed, "call to callback termination function failed");
+  BZLA_ABORT(!is_bool, "expected Boolean result for termination callback");
   return cbstate->done;
 }
 
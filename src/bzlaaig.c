@@ -63,18 +63,43 @@
 /*------------------------------------------------------------------------*/
 
 static void
-setup_aig_and_add_to_id_table(BzlaAIGMgr *amgr, BzlaAIG *aig)
+enlarge_aig_store(BzlaAIGMgr *amgr)
 {
-  int32_t id;
-
-  id = BZLA_COUNT_STACK(amgr->id2aig);
-  BZLA_ABORT(id == INT32_MAX, "AIG id overflow");
-  aig->refs = 1;
-  aig->id   = id;
-  BZLA_PUSH_STACK(amgr->id2aig, aig);
-  assert(aig->id >= 0);
-  assert(BZLA_COUNT_STACK(amgr->id2aig) == (size_t) aig->id + 1);
-  assert(BZLA_PEEK_STACK(amgr->id2aig, aig->id) == aig);
+  assert(amgr);
+
+  BzlaMemMgr *mm;
+  uint32_t size, new_size;
+
+  mm       = amgr->bzla->mm;
+  size     = amgr->size_ids;
+  new_size = size ? 2 * size : 16;
+  BZLA_ABORT(new_size <= size || new_size > INT32_MAX, "AIG id overflow");
+  BZLA_REALLOC(mm, amgr->children, 2 * size, 2 * new_size);
+  BZLA_REALLOC(mm, amgr->cnf_ids, size, new_size);
+  BZLA_REALLOC(mm, amgr->refs, size, new_size);
+  BZLA_REALLOC(mm, amgr->next, size, new_size);
+  BZLA_REALLOC(mm, amgr->local, size, new_size);
+  BZLA_REALLOC(mm, amgr->mark, size, new_size);
+  amgr->size_ids = new_size;
+}
+
+static uint32_t
+new_aig_id(BzlaAIGMgr *amgr)
+{
+  uint32_t id;
+
+  id = amgr->num_ids;
+  if (id == amgr->size_ids) enlarge_aig_store(amgr);
+  assert(id < amgr->size_ids);
+  amgr->children[2 * id]     = 0;
+  amgr->children[2 * id + 1] = 0;
+  amgr->cnf_ids[id]          = 0;
+  amgr->refs[id]             = 1;
+  amgr->next[id]             = 0;
+  amgr->local[id]            = 0;
+  amgr->mark[id]             = 0;
+  amgr->num_ids += 1;
+  return id;
 }
 
 static BzlaAIG *
@@ -84,32 +109,34 @@ new_and_aig(BzlaAIGMgr *amgr, BzlaAIG *left, BzlaAIG *right)
   assert(!bzla_aig_is_const(left));
   assert(!bzla_aig_is_const(right));
 
-  BzlaAIG *aig;
-  size_t size;
+  uint32_t id;
 
-  size = sizeof(BzlaAIG) + 2 * sizeof(int32_t);
-  aig  = bzla_mem_malloc(amgr->bzla->mm, size);
-  memset(aig, 0, size);
-  setup_aig_and_add_to_id_table(amgr, aig);
-  aig->children[0] = bzla_aig_get_id(left);
-  aig->children[1] = bzla_aig_get_id(right);
+  id                         = new_aig_id(amgr);
+  amgr->children[2 * id]     = BZLA_AIG_GET_LIT(left);
+  amgr->children[2 * id + 1] = BZLA_AIG_GET_LIT(right);
   amgr->cur_num_aigs++;
   if (amgr->max_num_aigs < amgr->cur_num_aigs)
     amgr->max_num_aigs = amgr->cur_num_aigs;
-  return aig;
+  return bzla_aig_get_by_id(amgr, id);
 }
 
 static void
 release_cnf_id_aig_mgr(BzlaAIGMgr *amgr, BzlaAIG *aig)
 {
   assert(!BZLA_IS_INVERTED_AIG(aig));
-  assert(aig->cnf_id > 0);
-  assert((size_t) aig->cnf_id < BZLA_SIZE_STACK(amgr->cnfid2aig));
-  assert(amgr->cnfid2aig.start[aig->cnf_id] == aig->id);
+
+  uint32_t id;
+  int32_t cnf_id;
+
+  id     = bzla_aig_get_index(aig);
+  cnf_id = amgr->cnf_ids[id];
+  assert(cnf_id > 0);
+  assert((size_t) cnf_id < BZLA_SIZE_STACK(amgr->cnfid2aig));
+  assert(amgr->cnfid2aig.start[cnf_id] == (int32_t) id);
   if (amgr->smgr->have_restore) return;
-  amgr->cnfid2aig.start[aig->cnf_id] = 0;
-  bzla_sat_mgr_release_cnf_id(amgr->smgr, aig->cnf_id);
-  aig->cnf_id = 0;
+  amgr->cnfid2aig.start[cnf_id] = 0;
+  bzla_sat_mgr_release_cnf_id(amgr->smgr, cnf_id);
+  amgr->cnf_ids[id] = 0;
 }
 
 static void
@@ -117,19 +144,17 @@ delete_aig_node(BzlaAIGMgr *amgr, BzlaAIG *aig)
 {
   assert(!BZLA_IS_INVERTED_AIG(aig));
   assert(amgr);
+
+  uint32_t id;
+
   if (bzla_aig_is_const(aig)) return;
-  if (aig->cnf_id) release_cnf_id_aig_mgr(amgr, aig);
-  amgr->id2aig.start[aig->id] = 0;
-  if (aig->is_var)
-  {
+  id = bzla_aig_get_index(aig);
+  if (amgr->cnf_ids[id]) release_cnf_id_aig_mgr(amgr, aig);
+  if (bzla_aig_is_var(amgr, aig))
     amgr->cur_num_aig_vars--;
-    BZLA_DELETE(amgr->bzla->mm, aig);
-  }
   else
-  {
     amgr->cur_num_aigs--;
-    bzla_mem_free(amgr->bzla->mm, aig, sizeof(BzlaAIG) + 2 * sizeof(int32_t));
-  }
+  amgr->refs[id] = 0;
 }
 
 static uint32_t
@@ -146,12 +171,14 @@ hash_aig(int32_t id0, int32_t id1, uint32_t table_size)
 }
 
 static uint32_t
-compute_aig_hash(BzlaAIG *aig, uint32_t table_size)
+compute_aig_hash(BzlaAIGMgr *amgr, BzlaAIG *aig, uint32_t table_size)
 {
   uint32_t hash;
   assert(!BZLA_IS_INVERTED_AIG(aig));
-  assert(bzla_aig_is_and(aig));
-  hash = hash_aig(aig->children[0], aig->children[1], table_size);
+  assert(bzla_aig_is_and(amgr, aig));
+  hash = hash_aig(bzla_aig_get_index(bzla_aig_get_left_child(amgr, aig)),
+                  bzla_aig_get_index(bzla_aig_get_right_child(amgr, aig)),
+                  table_size);
   return hash;
 }
 
@@ -159,42 +186,44 @@ static void
 delete_aig_nodes_unique_table_entry(BzlaAIGMgr *amgr, BzlaAIG *aig)
 {
   uint32_t hash;
-  BzlaAIG *cur, *prev;
+  int32_t cur, prev, id;
   assert(amgr);
   assert(!BZLA_IS_INVERTED_AIG(aig));
-  assert(bzla_aig_is_and(aig));
+  assert(bzla_aig_is_and(amgr, aig));
   prev = 0;
-  hash = compute_aig_hash(aig, amgr->table.size);
-  cur  = bzla_aig_get_by_id(amgr, amgr->table.chains[hash]);
-  while (cur != aig)
+  id   = bzla_aig_get_id(aig);
+  hash = compute_aig_hash(amgr, aig, amgr->table.size);
+  cur  = amgr->table.chains[hash];
+  while (cur != id)
   {
-    assert(!BZLA_IS_INVERTED_AIG(cur));
+    assert(cur > 0);
     prev = cur;
-    cur  = bzla_aig_get_by_id(amgr, cur->next);
+    cur  = amgr->next[cur];
   }
   assert(cur);
   if (!prev)
-    amgr->table.chains[hash] = cur->next;
+    amgr->table.chains[hash] = amgr->next[cur];
   else
-    prev->next = cur->next;
+    amgr->next[prev] = amgr->next[cur];
   amgr->table.num_elements--;
 }
 
 static void
-inc_aig_ref_counter(BzlaAIG *aig)
+inc_aig_ref_counter(BzlaAIGMgr *amgr, BzlaAIG *aig)
 {
+  uint32_t id;
   if (!bzla_aig_is_const(aig))
   {
-    BZLA_ABORT(BZLA_REAL_ADDR_AIG(aig)->refs == UINT32_MAX,
-               "reference counter overflow");
-    BZLA_REAL_ADDR_AIG(aig)->refs++;
+    id = bzla_aig_get_index(aig);
+    BZLA_ABORT(amgr->refs[id] == UINT32_MAX, "reference counter overflow");
+    amgr->refs[id]++;
   }
 }
 
 static BzlaAIG *
-inc_aig_ref_counter_and_return(BzlaAIG *aig)
+inc_aig_ref_counter_and_return(BzlaAIGMgr *amgr, BzlaAIG *aig)
 {
-  inc_aig_ref_counter(aig);
+  inc_aig_ref_counter(amgr, aig);
   return aig;
 }
 
@@ -205,35 +234,36 @@ find_and_aig(BzlaAIGMgr *amgr, BzlaAIG *left, BzlaAIG *right)
   assert(!bzla_aig_is_const(left));
   assert(!bzla_aig_is_const(right));
 
-  BzlaAIG *cur;
-  uint32_t hash;
+  int32_t cur;
+  uint32_t hash, lleft, lright;
   int32_t *result;
 
   if (bzla_opt_get(amgr->bzla, BZLA_OPT_RW_SORT_AIG) > 0
-      && BZLA_REAL_ADDR_AIG(right)->id < BZLA_REAL_ADDR_AIG(left)->id)
+      && bzla_aig_get_index(right) < bzla_aig_get_index(left))
   {
     BZLA_SWAP(BzlaAIG *, left, right);
   }
 
-  hash   = hash_aig(BZLA_REAL_ADDR_AIG(left)->id,
-                  BZLA_REAL_ADDR_AIG(right)->id,
-                  amgr->table.size);
+  lleft  = BZLA_AIG_GET_LIT(left);
+  lright = BZLA_AIG_GET_LIT(right);
+  hash   = hash_aig(
+      bzla_aig_get_index(left), bzla_aig_get_index(right), amgr->table.size);
   result = amgr->table.chains + hash;
-  cur    = bzla_aig_get_by_id(amgr, *result);
+  cur    = *result;
   while (cur)
   {
-    assert(!BZLA_IS_INVERTED_AIG(cur));
-    assert(bzla_aig_is_and(cur));
-    if (bzla_aig_get_left_child(amgr, cur) == left
-        && bzla_aig_get_right_child(amgr, cur) == right)
+    assert(cur > 0);
+    assert(amgr->children[2 * cur]);
+    if (amgr->children[2 * cur] == lleft
+        && amgr->children[2 * cur + 1] == lright)
       break;
 #ifndef NDEBUG
     if (bzla_opt_get(amgr->bzla, BZLA_OPT_RW_SORT_AIG) > 0)
-      assert(bzla_aig_get_left_child(amgr, cur) != right
-             || bzla_aig_get_right_child(amgr, cur) != left);
+      assert(amgr->children[2 * cur] != lright
+             || amgr->children[2 * cur + 1] != lleft);
 #endif
-    result = &cur->next;
-    cur    = cur->next == 0 ? 0 : bzla_aig_get_by_id(amgr, cur->next);
+    result = amgr->next + cur;
+    cur    = *result;
   }
   return result;
 }
@@ -256,8 +286,7 @@ enlarge_aig_nodes_unique_table(BzlaAIGMgr *amgr)
   int32_t *new_chains;
   uint32_t i, size, new_size;
   uint32_t hash;
-  BzlaAIG *temp = 0;
-  BzlaAIG *cur  = 0;
+  int32_t temp, cur;
   assert(amgr);
   size     = amgr->table.size;
   new_size = size << 1;
@@ -266,15 +295,14 @@ enlarge_aig_nodes_unique_table(BzlaAIGMgr *amgr)
   BZLA_CNEWN(mm, new_chains, new_size);
   for (i = 0; i < size; i++)
   {
-    cur = bzla_aig_get_by_id(amgr, amgr->table.chains[i]);
+    cur = amgr->table.chains[i];
     while (cur)
     {
-      assert(!BZLA_IS_INVERTED_AIG(cur));
-      assert(bzla_aig_is_and(cur));
-      temp             = bzla_aig_get_by_id(amgr, cur->next);
-      hash             = compute_aig_hash(cur, new_size);
-      cur->next        = new_chains[hash];
-      new_chains[hash] = cur->id;
+      assert(cur > 0);
+      temp = amgr->next[cur];
+      hash = compute_aig_hash(amgr, bzla_aig_get_by_id(amgr, cur), new_size);
+      amgr->next[cur]  = new_chains[hash];
+      new_chains[hash] = cur;
       cur              = temp;
     }
   }
@@ -289,7 +317,7 @@ bzla_aig_copy(BzlaAIGMgr *amgr, BzlaAIG *aig)
   assert(amgr);
   (void) amgr;
   if (bzla_aig_is_const(aig)) return aig;
-  return inc_aig_ref_counter_and_return(aig);
+  return inc_aig_ref_counter_and_return(amgr, aig);
 }
 
 void
@@ -298,40 +326,43 @@ bzla_aig_release(BzlaAIGMgr *amgr, BzlaAIG *aig)
   BzlaAIG *cur, *l, *r;
   BzlaAIGPtrStack stack;
   BzlaMemMgr *mm;
+  uint32_t *refs;
 
   assert(amgr);
   mm = amgr->bzla->mm;
 
   if (!bzla_aig_is_const(aig))
   {
-    cur = BZLA_REAL_ADDR_AIG(aig);
-    assert(cur->refs > 0u);
-    if (cur->refs > 1u)
+    cur  = BZLA_REAL_ADDR_AIG(aig);
+    refs = amgr->refs + bzla_aig_get_index(cur);
+    assert(*refs > 0u);
+    if (*refs > 1u)
     {
-      cur->refs--;
+      *refs -= 1;
     }
     else
     {
-      assert(cur->refs == 1u);
+      assert(*refs == 1u);
       BZLA_INIT_STACK(mm, stack);
       goto BZLA_RELEASE_AIG_WITHOUT_POP;
 
       while (!BZLA_EMPTY_STACK(stack))
       {
-        cur = BZLA_POP_STACK(stack);
-        cur = BZLA_REAL_ADDR_AIG(cur);
+        cur  = BZLA_POP_STACK(stack);
+        cur  = BZLA_REAL_ADDR_AIG(cur);
+        refs = amgr->refs + bzla_aig_get_index(cur);
 
-        if (cur->refs > 1u)
+        if (*refs > 1u)
         {
-          cur->refs--;
+          *refs -= 1;
         }
         else
         {
         BZLA_RELEASE_AIG_WITHOUT_POP:
-          assert(cur->refs == 1u);
-          if (!bzla_aig_is_var(cur))
+          assert(*refs == 1u);
+          if (!bzla_aig_is_var(amgr, cur))
           {
-            assert(bzla_aig_is_and(cur));
+            assert(bzla_aig_is_and(amgr, cur));
             l = bzla_aig_get_left_child(amgr, cur);
             r = bzla_aig_get_right_child(amgr, cur);
             BZLA_PUSH_STACK(stack, r);
@@ -350,15 +381,13 @@ bzla_aig_release(BzlaAIGMgr *amgr, BzlaAIG *aig)
 BzlaAIG *
 bzla_aig_var(BzlaAIGMgr *amgr)
 {
-  BzlaAIG *aig;
+  uint32_t id;
   assert(amgr);
-  BZLA_CNEW(amgr->bzla->mm, aig);
-  setup_aig_and_add_to_id_table(amgr, aig);
-  aig->is_var = 1;
+  id = new_aig_id(amgr);
   amgr->cur_num_aig_vars++;
   if (amgr->max_num_aig_vars < amgr->cur_num_aig_vars)
     amgr->max_num_aig_vars = amgr->cur_num_aig_vars;
-  return aig;
+  return bzla_aig_get_by_id(amgr, id);
 }
 
 BzlaAIG *
@@ -366,7 +395,7 @@ bzla_aig_not(BzlaAIGMgr *amgr, BzlaAIG *aig)
 {
   assert(amgr);
   (void) amgr;
-  inc_aig_ref_counter(aig);
+  inc_aig_ref_counter(amgr, aig);
   return BZLA_INVERT_AIG(aig);
 }
 
@@ -383,7 +412,7 @@ find_and_contradiction_aig(
 
   if (*calls >= BZLA_FIND_AND_AIG_CONTRADICTION_LIMIT) return false;
 
-  if (!BZLA_IS_INVERTED_AIG(aig) && bzla_aig_is_and(aig))
+  if (!BZLA_IS_INVERTED_AIG(aig) && bzla_aig_is_and(amgr, aig))
   {
     if (bzla_aig_get_left_child(amgr, aig) == BZLA_INVERT_AIG(a0)
         || bzla_aig_get_left_child(amgr, aig) == BZLA_INVERT_AIG(a1)
@@ -409,7 +438,7 @@ simp_aig_by_sat(BzlaAIGMgr *amgr, BzlaAIG *aig)
    * (returns 0) FIXME why? */
   if (bzla_aig_is_const(aig)) return aig;
 
-  lit = bzla_aig_get_cnf_id(aig);
+  lit = bzla_aig_get_cnf_id(amgr, aig);
   if (!lit) return aig;
   val = bzla_sat_fixed(amgr->smgr, lit);
   if (val) return (val < 0) ? BZLA_AIG_FALSE : BZLA_AIG_TRUE;
@@ -443,10 +472,10 @@ bzla_aig_and(BzlaAIGMgr *amgr, BzlaAIG *left, BzlaAIG *right)
 BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
   if (left == BZLA_AIG_FALSE || right == BZLA_AIG_FALSE) return BZLA_AIG_FALSE;
 
-  if (left == BZLA_AIG_TRUE) return inc_aig_ref_counter_and_return(right);
+  if (left == BZLA_AIG_TRUE) return inc_aig_ref_counter_and_return(amgr, right);
 
   if (right == BZLA_AIG_TRUE || (left == right))
-    return inc_aig_ref_counter_and_return(left);
+    return inc_aig_ref_counter_and_return(amgr, left);
   if (left == BZLA_INVERT_AIG(right)) return BZLA_AIG_FALSE;
 
   real_left  = BZLA_REAL_ADDR_AIG(left);
@@ -454,21 +483,21 @@ BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
 
   /* 2 level minimization rules for AIGs */
   /* first rule of contradiction */
-  if (bzla_aig_is_and(real_left) && !BZLA_IS_INVERTED_AIG(left))
+  if (bzla_aig_is_and(amgr, real_left) && !BZLA_IS_INVERTED_AIG(left))
   {
     if (bzla_aig_get_left_child(amgr, real_left) == BZLA_INVERT_AIG(right)
         || bzla_aig_get_right_child(amgr, real_left) == BZLA_INVERT_AIG(right))
       return BZLA_AIG_FALSE;
   }
   /* use commutativity */
-  if (bzla_aig_is_and(real_right) && !BZLA_IS_INVERTED_AIG(right))
+  if (bzla_aig_is_and(amgr, real_right) && !BZLA_IS_INVERTED_AIG(right))
   {
     if (bzla_aig_get_left_child(amgr, real_right) == BZLA_INVERT_AIG(left)
         || bzla_aig_get_right_child(amgr, real_right) == BZLA_INVERT_AIG(left))
       return BZLA_AIG_FALSE;
   }
   /* second rule of contradiction */
-  if (bzla_aig_is_and(real_right) && bzla_aig_is_and(real_left)
+  if (bzla_aig_is_and(amgr, real_right) && bzla_aig_is_and(amgr, real_left)
       && !BZLA_IS_INVERTED_AIG(left) && !BZLA_IS_INVERTED_AIG(right))
   {
     if (bzla_aig_get_left_child(amgr, real_left)
@@ -482,21 +511,21 @@ BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
       return BZLA_AIG_FALSE;
   }
   /* first rule of subsumption */
-  if (bzla_aig_is_and(real_left) && BZLA_IS_INVERTED_AIG(left))
+  if (bzla_aig_is_and(amgr, real_left) && BZLA_IS_INVERTED_AIG(left))
   {
     if (bzla_aig_get_left_child(amgr, real_left) == BZLA_INVERT_AIG(right)
         || bzla_aig_get_right_child(amgr, real_left) == BZLA_INVERT_AIG(right))
-      return inc_aig_ref_counter_and_return(right);
+      return inc_aig_ref_counter_and_return(amgr, right);
   }
   /* use commutativity */
-  if (bzla_aig_is_and(real_right) && BZLA_IS_INVERTED_AIG(right))
+  if (bzla_aig_is_and(amgr, real_right) && BZLA_IS_INVERTED_AIG(right))
   {
     if (bzla_aig_get_left_child(amgr, real_right) == BZLA_INVERT_AIG(left)
         || bzla_aig_get_right_child(amgr, real_right) == BZLA_INVERT_AIG(left))
-      return inc_aig_ref_counter_and_return(left);
+      return inc_aig_ref_counter_and_return(amgr, left);
   }
   /* second rule of subsumption */
-  if (bzla_aig_is_and(real_right) && bzla_aig_is_and(real_left)
+  if (bzla_aig_is_and(amgr, real_right) && bzla_aig_is_and(amgr, real_left)
       && BZLA_IS_INVERTED_AIG(left) && !BZLA_IS_INVERTED_AIG(right))
   {
     if (bzla_aig_get_left_child(amgr, real_left)
@@ -507,10 +536,10 @@ BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
                == BZLA_INVERT_AIG(bzla_aig_get_left_child(amgr, real_right))
         || bzla_aig_get_right_child(amgr, real_left)
                == BZLA_INVERT_AIG(bzla_aig_get_right_child(amgr, real_right)))
-      return inc_aig_ref_counter_and_return(right);
+      return inc_aig_ref_counter_and_return(amgr, right);
   }
   /* use commutativity */
-  if (bzla_aig_is_and(real_right) && bzla_aig_is_and(real_left)
+  if (bzla_aig_is_and(amgr, real_right) && bzla_aig_is_and(amgr, real_left)
       && !BZLA_IS_INVERTED_AIG(left) && BZLA_IS_INVERTED_AIG(right))
   {
     if (bzla_aig_get_left_child(amgr, real_left)
@@ -521,10 +550,10 @@ BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
                == BZLA_INVERT_AIG(bzla_aig_get_left_child(amgr, real_right))
         || bzla_aig_get_right_child(amgr, real_left)
                == BZLA_INVERT_AIG(bzla_aig_get_right_child(amgr, real_right)))
-      return inc_aig_ref_counter_and_return(left);
+      return inc_aig_ref_counter_and_return(amgr, left);
   }
   /* rule of resolution */
-  if (bzla_aig_is_and(real_right) && bzla_aig_is_and(real_left)
+  if (bzla_aig_is_and(amgr, real_right) && bzla_aig_is_and(amgr, real_left)
       && BZLA_IS_INVERTED_AIG(left) && BZLA_IS_INVERTED_AIG(right))
   {
     if ((bzla_aig_get_left_child(amgr, real_left)
@@ -536,11 +565,11 @@ BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
             && bzla_aig_get_right_child(amgr, real_left)
                    == BZLA_INVERT_AIG(
                        bzla_aig_get_left_child(amgr, real_right))))
-      return inc_aig_ref_counter_and_return(
+      return inc_aig_ref_counter_and_return(amgr, 
           BZLA_INVERT_AIG(bzla_aig_get_left_child(amgr, real_left)));
   }
   /* use commutativity */
-  if (bzla_aig_is_and(real_right) && bzla_aig_is_and(real_left)
+  if (bzla_aig_is_and(amgr, real_right) && bzla_aig_is_and(amgr, real_left)
       && BZLA_IS_INVERTED_AIG(left) && BZLA_IS_INVERTED_AIG(right))
   {
     if ((bzla_aig_get_right_child(amgr, real_right)
@@ -552,25 +581,25 @@ BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
             && bzla_aig_get_left_child(amgr, real_right)
                    == BZLA_INVERT_AIG(
                        bzla_aig_get_right_child(amgr, real_left))))
-      return inc_aig_ref_counter_and_return(
+      return inc_aig_ref_counter_and_return(amgr, 
           BZLA_INVERT_AIG(bzla_aig_get_right_child(amgr, real_right)));
   }
   /* asymmetric rule of idempotency */
-  if (bzla_aig_is_and(real_left) && !BZLA_IS_INVERTED_AIG(left))
+  if (bzla_aig_is_and(amgr, real_left) && !BZLA_IS_INVERTED_AIG(left))
   {
     if (bzla_aig_get_left_child(amgr, real_left) == right
         || bzla_aig_get_right_child(amgr, real_left) == right)
-      return inc_aig_ref_counter_and_return(left);
+      return inc_aig_ref_counter_and_return(amgr, left);
   }
   /* use commutativity */
-  if (bzla_aig_is_and(real_right) && !BZLA_IS_INVERTED_AIG(right))
+  if (bzla_aig_is_and(amgr, real_right) && !BZLA_IS_INVERTED_AIG(right))
   {
     if (bzla_aig_get_left_child(amgr, real_right) == left
         || bzla_aig_get_right_child(amgr, real_right) == left)
-      return inc_aig_ref_counter_and_return(right);
+      return inc_aig_ref_counter_and_return(amgr, right);
   }
   /* symmetric rule of idempotency */
-  if (bzla_aig_is_and(real_right) && bzla_aig_is_and(real_left)
+  if (bzla_aig_is_and(amgr, real_right) && bzla_aig_is_and(amgr, real_left)
       && !BZLA_IS_INVERTED_AIG(left) && !BZLA_IS_INVERTED_AIG(right))
   {
     if (bzla_aig_get_left_child(amgr, real_left)
@@ -583,7 +612,7 @@ BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
     }
   }
   /* use commutativity */
-  if (bzla_aig_is_and(real_right) && bzla_aig_is_and(real_left)
+  if (bzla_aig_is_and(amgr, real_right) && bzla_aig_is_and(amgr, real_left)
       && !BZLA_IS_INVERTED_AIG(left) && !BZLA_IS_INVERTED_AIG(right))
   {
     if (bzla_aig_get_left_child(amgr, real_left)
@@ -596,7 +625,7 @@ BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
     }
   }
   /* asymmetric rule of substitution */
-  if (bzla_aig_is_and(real_left) && BZLA_IS_INVERTED_AIG(left))
+  if (bzla_aig_is_and(amgr, real_left) && BZLA_IS_INVERTED_AIG(left))
   {
     if (bzla_aig_get_right_child(amgr, real_left) == right)
     {
@@ -610,7 +639,7 @@ BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
     }
   }
   /* use commutativity */
-  if (bzla_aig_is_and(real_right) && BZLA_IS_INVERTED_AIG(right))
+  if (bzla_aig_is_and(amgr, real_right) && BZLA_IS_INVERTED_AIG(right))
   {
     if (bzla_aig_get_left_child(amgr, real_right) == left)
     {
@@ -624,8 +653,8 @@ BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
     }
   }
   /* symmetric rule of substitution */
-  if (bzla_aig_is_and(real_left) && BZLA_IS_INVERTED_AIG(left)
-      && bzla_aig_is_and(real_right) && !BZLA_IS_INVERTED_AIG(right))
+  if (bzla_aig_is_and(amgr, real_left) && BZLA_IS_INVERTED_AIG(left)
+      && bzla_aig_is_and(amgr, real_right) && !BZLA_IS_INVERTED_AIG(right))
   {
     if ((bzla_aig_get_right_child(amgr, real_left)
          == bzla_aig_get_left_child(amgr, real_right))
@@ -645,8 +674,8 @@ BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
     }
   }
   /* use commutativity */
-  if (bzla_aig_is_and(real_right) && BZLA_IS_INVERTED_AIG(right)
-      && bzla_aig_is_and(real_left) && !BZLA_IS_INVERTED_AIG(left))
+  if (bzla_aig_is_and(amgr, real_right) && BZLA_IS_INVERTED_AIG(right)
+      && bzla_aig_is_and(amgr, real_left) && !BZLA_IS_INVERTED_AIG(left))
   {
     if ((bzla_aig_get_left_child(amgr, real_right)
          == bzla_aig_get_right_child(amgr, real_left))
@@ -672,8 +701,8 @@ BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
 
   // Implicit XOR normalization .... (TODO keep it?)
 
-  if (BZLA_IS_INVERTED_AIG(left) && bzla_aig_is_and(real_left)
-      && BZLA_IS_INVERTED_AIG(right) && bzla_aig_is_and(real_right)
+  if (BZLA_IS_INVERTED_AIG(left) && bzla_aig_is_and(amgr, real_left)
+      && BZLA_IS_INVERTED_AIG(right) && bzla_aig_is_and(amgr, real_right)
       && bzla_aig_get_left_child(amgr, real_left)
              == BZLA_INVERT_AIG(bzla_aig_get_left_child(amgr, real_right))
       && bzla_aig_get_right_child(amgr, real_left)
@@ -694,7 +723,7 @@ BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
         res = find_and_aig_node(amgr, BZLA_INVERT_AIG(l), BZLA_INVERT_AIG(r));
         if (res)
         {
-          inc_aig_ref_counter(res);
+          inc_aig_ref_counter(amgr, res);
           return BZLA_INVERT_AIG(res);
         }
       }
@@ -708,6 +737,13 @@ BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
   res = *lookup ? bzla_aig_get_by_id(amgr, *lookup) : 0;
   if (!res)
   {
+    /* 'lookup' may point into the AIG store, which must not be enlarged by
+     * new_and_aig */
+    if (amgr->num_ids == amgr->size_ids)
+    {
+      enlarge_aig_store(amgr);
+      lookup = find_and_aig(amgr, left, right);
+    }
     if (amgr->table.num_elements == amgr->table.size
         && bzla_util_log_2(amgr->table.size) < BZLA_AIG_UNIQUE_TABLE_LIMIT)
     {
@@ -715,20 +751,20 @@ BZLA_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
       lookup = find_and_aig(amgr, left, right);
     }
     if (bzla_opt_get(amgr->bzla, BZLA_OPT_RW_SORT_AIG) > 0
-        && real_right->id < real_left->id)
+        && bzla_aig_get_index(real_right) < bzla_aig_get_index(real_left))
     {
       BZLA_SWAP(BzlaAIG *, left, right);
     }
     res     = new_and_aig(amgr, left, right);
-    *lookup = res->id;
-    inc_aig_ref_counter(left);
-    inc_aig_ref_counter(right);
+    *lookup = bzla_aig_get_id(res);
+    inc_aig_ref_counter(amgr, left);
+    inc_aig_ref_counter(amgr, right);
     assert(amgr->table.num_elements < INT32_MAX);
     amgr->table.num_elements++;
   }
   else
   {
-    inc_aig_ref_counter(res);
+    inc_aig_ref_counter(amgr, res);
   }
   return res;
 }
@@ -779,62 +815,44 @@ bzla_aig_mgr_new(Bzla *bzla)
   amgr->bzla = bzla;
   BZLA_INIT_AIG_UNIQUE_TABLE(bzla->mm, amgr->table);
   amgr->smgr = bzla_sat_mgr_new(bzla);
-  BZLA_INIT_STACK(bzla->mm, amgr->id2aig);
-  BZLA_PUSH_STACK(amgr->id2aig, BZLA_AIG_FALSE);
-  BZLA_PUSH_STACK(amgr->id2aig, BZLA_AIG_TRUE);
+  /* ids 0 and 1 are reserved */
+  (void) new_aig_id(amgr);
+  (void) new_aig_id(amgr);
+  assert(amgr->num_ids == 2);
   assert((size_t) BZLA_AIG_FALSE == 0);
   assert((size_t) BZLA_AIG_TRUE == 1);
   BZLA_INIT_STACK(bzla->mm, amgr->cnfid2aig);
   return amgr;
 }
 
-static BzlaAIG *
-clone_aig(BzlaMemMgr *mm, BzlaAIG *aig)
-{
-  assert(mm);
-
-  size_t size;
-  BzlaAIG *res, *real_aig;
-
-  if (bzla_aig_is_const(aig)) return aig;
-
-  real_aig = BZLA_REAL_ADDR_AIG(aig);
-  size     = sizeof(BzlaAIG);
-  if (!real_aig->is_var) size += 2 * sizeof(int32_t);
-  res = bzla_mem_malloc(mm, size);
-  memcpy(res, real_aig, size);
-
-  res = BZLA_IS_INVERTED_AIG(aig) ? BZLA_INVERT_AIG(res) : res;
-  return res;
-}
-
 static void
 clone_aigs(BzlaAIGMgr *amgr, BzlaAIGMgr *clone)
 {
   assert(amgr);
   assert(clone);
 
-  uint32_t i;
   size_t size;
   BzlaMemMgr *mm;
-  BzlaAIG *aig;
 
   mm = clone->bzla->mm;
 
-  /* clone id2aig table */
-  BZLA_INIT_STACK(mm, clone->id2aig);
-  size = BZLA_SIZE_STACK(amgr->id2aig);
-  if (size)
-  {
-    BZLA_CNEWN(mm, clone->id2aig.start, size);
-    clone->id2aig.end = clone->id2aig.start + size;
-    clone->id2aig.top = clone->id2aig.start + BZLA_COUNT_STACK(amgr->id2aig);
-  }
-  for (i = 0; i < BZLA_COUNT_STACK(amgr->id2aig); i++)
-  {
-    aig = clone_aig(mm, BZLA_PEEK_STACK(amgr->id2aig, i));
-    BZLA_POKE_STACK(clone->id2aig, i, aig);
-  }
+  /* clone AIG store, AIGs keep their ids (and literals) */
+  size            = amgr->size_ids;
+  clone->num_ids  = amgr->num_ids;
+  clone->size_ids = amgr->size_ids;
+  BZLA_NEWN(mm, clone->children, 2 * size);
+  BZLA_NEWN(mm, clone->cnf_ids, size);
+  BZLA_NEWN(mm, clone->refs, size);
+  BZLA_NEWN(mm, clone->next, size);
+  BZLA_NEWN(mm, clone->local, size);
+  BZLA_NEWN(mm, clone->mark, size);
+  size = amgr->num_ids;
+  memcpy(clone->children, amgr->children, 2 * size * sizeof(uint32_t));
+  memcpy(clone->cnf_ids, amgr->cnf_ids, size * sizeof(int32_t));
+  memcpy(clone->refs, amgr->refs, size * sizeof(uint32_t));
+  memcpy(clone->next, amgr->next, size * sizeof(int32_t));
+  memcpy(clone->local, amgr->local, size * sizeof(uint32_t));
+  memcpy(clone->mark, amgr->mark, size * sizeof(uint8_t));
 
   /* clone unique table */
   BZLA_CNEWN(mm, clone->table.chains, amgr->table.size);
@@ -895,7 +913,12 @@ bzla_aig_mgr_delete(BzlaAIGMgr *amgr)
   mm = amgr->bzla->mm;
   BZLA_RELEASE_AIG_UNIQUE_TABLE(mm, amgr->table);
   bzla_sat_mgr_delete(amgr->smgr);
-  BZLA_RELEASE_STACK(amgr->id2aig);
+  BZLA_DELETEN(mm, amgr->children, 2 * amgr->size_ids);
+  BZLA_DELETEN(mm, amgr->cnf_ids, amgr->size_ids);
+  BZLA_DELETEN(mm, amgr->refs, amgr->size_ids);
+  BZLA_DELETEN(mm, amgr->next, amgr->size_ids);
+  BZLA_DELETEN(mm, amgr->local, amgr->size_ids);
+  BZLA_DELETEN(mm, amgr->mark, amgr->size_ids);
   BZLA_RELEASE_STACK(amgr->cnfid2aig);
   BZLA_DELETE(mm, amgr);
 }
@@ -906,21 +929,23 @@ is_xor_aig(BzlaAIGMgr *amgr, BzlaAIG *aig, BzlaAIGPtrStack *leafs)
 #ifdef BZLA_AIG_TO_CNF_EXTRACT_XOR
   BzlaAIG *l, *r, *ll, *lr, *rl, *rr;
 
-  assert(bzla_aig_is_and(aig));
+  assert(bzla_aig_is_and(amgr, aig));
   assert(!BZLA_IS_INVERTED_AIG(aig));
 
   l = bzla_aig_get_left_child(amgr, aig);
   if (!BZLA_IS_INVERTED_AIG(l)) return false;
   l = BZLA_REAL_ADDR_AIG(l);
+  if (!bzla_aig_is_and(amgr, l)) return false;
 #ifdef BZLA_AIG_TO_CNF_EXTRACT_ONLY_NON_SHARED
-  if (l->refs > 1) return false;
+  if (bzla_aig_get_refs(amgr, l) > 1) return false;
 #endif
 
   r = bzla_aig_get_right_child(amgr, aig);
   if (!BZLA_IS_INVERTED_AIG(r)) return false;
   r = BZLA_REAL_ADDR_AIG(r);
+  if (!bzla_aig_is_and(amgr, r)) return false;
 #ifdef BZLA_AIG_TO_CNF_EXTRACT_ONLY_NON_SHARED
-  if (r->refs > 1) return false;
+  if (bzla_aig_get_refs(amgr, r) > 1) return false;
 #endif
 
   ll = bzla_aig_get_left_child(amgr, l);
@@ -954,21 +979,23 @@ is_ite_aig(BzlaAIGMgr *amgr, BzlaAIG *aig, BzlaAIGPtrStack *leafs)
 #ifdef BZLA_AIG_TO_CNF_EXTRACT_ITE
   BzlaAIG *l, *r, *ll, *lr, *rl, *rr;
 
-  assert(bzla_aig_is_and(aig));
+  assert(bzla_aig_is_and(amgr, aig));
   assert(!BZLA_IS_INVERTED_AIG(aig));
 
   l = bzla_aig_get_left_child(amgr, aig);
   if (!BZLA_IS_INVERTED_AIG(l)) return false;
   l = BZLA_REAL_ADDR_AIG(l);
+  if (!bzla_aig_is_and(amgr, l)) return false;
 #ifdef BZLA_AIG_TO_CNF_EXTRACT_ONLY_NON_SHARED
-  if (l->refs > 1) return false;
+  if (bzla_aig_get_refs(amgr, l) > 1) return false;
 #endif
 
   r = bzla_aig_get_right_child(amgr, aig);
   if (!BZLA_IS_INVERTED_AIG(r)) return false;
   r = BZLA_REAL_ADDR_AIG(r);
+  if (!bzla_aig_is_and(amgr, r)) return false;
 #ifdef BZLA_AIG_TO_CNF_EXTRACT_ONLY_NON_SHARED
-  if (r->refs > 1) return false;
+  if (bzla_aig_get_refs(amgr, r) > 1) return false;
 #endif
 
   ll = bzla_aig_get_left_child(amgr, l);
@@ -1025,12 +1052,17 @@ static void
 set_next_id_aig_mgr(BzlaAIGMgr *amgr, BzlaAIG *root)
 {
   assert(!BZLA_IS_INVERTED_AIG(root));
-  assert(!root->cnf_id);
-  root->cnf_id = bzla_sat_mgr_next_cnf_id(amgr->smgr);
-  assert(root->cnf_id > 0);
-  BZLA_FIT_STACK(amgr->cnfid2aig, (size_t) root->cnf_id);
-  amgr->cnfid2aig.start[root->cnf_id] = root->id;
-  assert(amgr->cnfid2aig.start[root->cnf_id] == root->id);
+
+  uint32_t id;
+  int32_t cnf_id;
+
+  id = bzla_aig_get_index(root);
+  assert(!amgr->cnf_ids[id]);
+  cnf_id = bzla_sat_mgr_next_cnf_id(amgr->smgr);
+  assert(cnf_id > 0);
+  amgr->cnf_ids[id] = cnf_id;
+  BZLA_FIT_STACK(amgr->cnfid2aig, (size_t) cnf_id);
+  amgr->cnfid2aig.start[cnf_id] = id;
   amgr->num_cnf_vars++;
 }
 
@@ -1047,7 +1079,8 @@ is_or_aig(BzlaAIGMgr *amgr, BzlaAIG *root, BzlaAIGPtrStack *leafs)
   BzlaAIGPtrStack tree;
   BzlaMemMgr *mm;
 
-  if (!BZLA_IS_INVERTED_AIG(root) || !bzla_aig_is_and(BZLA_REAL_ADDR_AIG(root)))
+  if (!BZLA_IS_INVERTED_AIG(root)
+      || !bzla_aig_is_and(amgr, BZLA_REAL_ADDR_AIG(root)))
     return false;
 
   mm   = amgr->bzla->mm;
@@ -1068,9 +1101,9 @@ is_or_aig(BzlaAIGMgr *amgr, BzlaAIG *root, BzlaAIGPtrStack *leafs)
       continue;
     }
 
-    if (real_cur->mark) continue;
+    if (amgr->mark[bzla_aig_get_index(real_cur)]) continue;
 
-    if (!BZLA_IS_INVERTED_AIG(cur) && bzla_aig_is_and(real_cur))
+    if (!BZLA_IS_INVERTED_AIG(cur) && bzla_aig_is_and(amgr, real_cur))
     {
       BZLA_PUSH_STACK(tree, bzla_aig_get_right_child(amgr, real_cur));
       BZLA_PUSH_STACK(tree, bzla_aig_get_left_child(amgr, real_cur));
@@ -1078,15 +1111,15 @@ is_or_aig(BzlaAIGMgr *amgr, BzlaAIG *root, BzlaAIGPtrStack *leafs)
     else
     {
       BZLA_PUSH_STACK(*leafs, cur);
-      real_cur->mark = 1;
+      amgr->mark[bzla_aig_get_index(real_cur)] = 1;
     }
   }
 
   for (p = (*leafs).start; p < (*leafs).top; p++)
   {
     cur = *p;
-    assert(BZLA_REAL_ADDR_AIG(cur)->mark);
-    BZLA_REAL_ADDR_AIG(cur)->mark = 0;
+    assert(amgr->mark[bzla_aig_get_index(cur)]);
+    amgr->mark[bzla_aig_get_index(cur)] = 0;
   }
 
   BZLA_RELEASE_STACK(tree);
@@ -1103,7 +1136,7 @@ bzla_aig_to_sat_tseitin(BzlaAIGMgr *amgr, BzlaAIG *start)
   BzlaAIG *root, *cur;
   BzlaSATMgr *smgr;
   BzlaMemMgr *mm;
-  uint32_t local;
+  uint32_t id, local;
   BzlaAIG **p;
 
   if (bzla_aig_is_const(start)) return;
@@ -1124,25 +1157,26 @@ bzla_aig_to_sat_tseitin(BzlaAIGMgr *amgr, BzlaAIG *start)
   while (!BZLA_EMPTY_STACK(stack))
   {
     root = BZLA_REAL_ADDR_AIG(BZLA_POP_STACK(stack));
+    id   = bzla_aig_get_index(root);
 
-    if (root->mark == 2)
+    if (amgr->mark[id] == 2)
     {
-      assert(root->cnf_id);
-      assert(root->local < root->refs);
-      root->local++;
+      assert(amgr->cnf_ids[id]);
+      assert(amgr->local[id] < amgr->refs[id]);
+      amgr->local[id]++;
       continue;
     }
 
-    if (root->cnf_id) continue;
+    if (amgr->cnf_ids[id]) continue;
 
-    if (bzla_aig_is_var(root))
+    if (bzla_aig_is_var(amgr, root))
     {
       set_next_id_aig_mgr(amgr, root);
       continue;
     }
 
-    assert(root->mark < 2);
-    assert(bzla_aig_is_and(root));
+    assert(amgr->mark[id] < 2);
+    assert(bzla_aig_is_and(amgr, root));
     assert(BZLA_EMPTY_STACK(tree));
     assert(BZLA_EMPTY_STACK(leafs));
 
@@ -1161,8 +1195,9 @@ bzla_aig_to_sat_tseitin(BzlaAIGMgr *amgr, BzlaAIG *start)
       {
         cur = BZLA_POP_STACK(tree);
 
-        if (BZLA_IS_INVERTED_AIG(cur) || bzla_aig_is_var(cur) || cur->refs > 1u
-            || cur->cnf_id)
+        if (BZLA_IS_INVERTED_AIG(cur) || bzla_aig_is_var(amgr, cur)
+            || bzla_aig_get_refs(amgr, cur) > 1u
+            || bzla_aig_get_cnf_id(amgr, cur))
         {
           BZLA_PUSH_STACK(leafs, cur);
         }
@@ -1178,30 +1213,30 @@ bzla_aig_to_sat_tseitin(BzlaAIGMgr *amgr, BzlaAIG *start)
 #endif
     }
 
-    if (root->mark == 0)
+    if (amgr->mark[id] == 0)
     {
-      root->mark = 1;
-      assert(root->refs >= 1);
-      assert(!root->local);
-      root->local = 1;
+      amgr->mark[id] = 1;
+      assert(amgr->refs[id] >= 1);
+      assert(!amgr->local[id]);
+      amgr->local[id] = 1;
       BZLA_PUSH_STACK(marked, root);
       BZLA_PUSH_STACK(stack, root);
       for (p = leafs.start; p < leafs.top; p++) BZLA_PUSH_STACK(stack, *p);
     }
     else
     {
-      assert(root->mark == 1);
-      root->mark = 2;
+      assert(amgr->mark[id] == 1);
+      amgr->mark[id] = 2;
 
       set_next_id_aig_mgr(amgr, root);
-      x = root->cnf_id;
+      x = amgr->cnf_ids[id];
       assert(x);
 
       if (isxor)
       {
         assert(BZLA_COUNT_STACK(leafs) == 2);
-        a = bzla_aig_get_cnf_id(leafs.start[0]);
-        b = bzla_aig_get_cnf_id(leafs.start[1]);
+        a = bzla_aig_get_cnf_id(amgr, leafs.start[0]);
+        b = bzla_aig_get_cnf_id(amgr, leafs.start[1]);
 
         bzla_sat_add(smgr, -x);
         bzla_sat_add(smgr, a);
@@ -1228,9 +1263,9 @@ bzla_aig_to_sat_tseitin(BzlaAIGMgr *amgr, BzlaAIG *start)
       else if (isite)
       {
         assert(BZLA_COUNT_STACK(leafs) == 3);
-        a = bzla_aig_get_cnf_id(leafs.start[0]);  // else
-        b = bzla_aig_get_cnf_id(leafs.start[1]);  // then
-        c = bzla_aig_get_cnf_id(leafs.start[2]);  // cond
+        a = bzla_aig_get_cnf_id(amgr, leafs.start[0]);  // else
+        b = bzla_aig_get_cnf_id(amgr, leafs.start[1]);  // then
+        c = bzla_aig_get_cnf_id(amgr, leafs.start[2]);  // cond
 
         bzla_sat_add(smgr, -x);
         bzla_sat_add(smgr, -c);
@@ -1259,7 +1294,7 @@ bzla_aig_to_sat_tseitin(BzlaAIGMgr *amgr, BzlaAIG *start)
         for (p = leafs.start; p < leafs.top; p++)
         {
           cur = *p;
-          y   = bzla_aig_get_cnf_id(cur);
+          y   = bzla_aig_get_cnf_id(amgr, cur);
           assert(y);
           bzla_sat_add(smgr, -y);
           amgr->num_cnf_literals++;
@@ -1272,7 +1307,7 @@ bzla_aig_to_sat_tseitin(BzlaAIGMgr *amgr, BzlaAIG *start)
         for (p = leafs.start; p < leafs.top; p++)
         {
           cur = *p;
-          y   = bzla_aig_get_cnf_id(cur);
+          y   = bzla_aig_get_cnf_id(amgr, cur);
           bzla_sat_add(smgr, -x);
           bzla_sat_add(smgr, y);
           bzla_sat_add(smgr, 0);
@@ -1291,16 +1326,17 @@ bzla_aig_to_sat_tseitin(BzlaAIGMgr *amgr, BzlaAIG *start)
   {
     cur = BZLA_POP_STACK(marked);
     assert(!BZLA_IS_INVERTED_AIG(cur));
-    assert(cur->mark > 0);
-    cur->mark = 0;
-    assert(cur->cnf_id);
-    assert(bzla_aig_is_and(cur));
-    local = cur->local;
+    id = bzla_aig_get_index(cur);
+    assert(amgr->mark[id] > 0);
+    amgr->mark[id] = 0;
+    assert(amgr->cnf_ids[id]);
+    assert(bzla_aig_is_and(amgr, cur));
+    local = amgr->local[id];
     assert(local > 0);
-    cur->local = 0;
+    amgr->local[id] = 0;
     if (cur == start) continue;
-    assert(cur->refs >= local);
-    if (cur->refs > local) continue;
+    assert(amgr->refs[id] >= local);
+    if (amgr->refs[id] > local) continue;
     release_cnf_id_aig_mgr(amgr, cur);
   }
   BZLA_RELEASE_STACK(marked);
@@ -1367,7 +1403,7 @@ bzla_aig_add_toplevel_to_sat(BzlaAIGMgr *amgr, BzlaAIG *root)
   {
     aig = BZLA_POP_STACK(stack);
   BZLA_ADD_TOPLEVEL_AIG_TO_SAT_WITHOUT_POP:
-    if (!BZLA_IS_INVERTED_AIG(aig) && bzla_aig_is_and(aig))
+    if (!BZLA_IS_INVERTED_AIG(aig) && bzla_aig_is_and(amgr, aig))
     {
       BZLA_PUSH_STACK(stack, bzla_aig_get_right_child(amgr, aig));
       BZLA_PUSH_STACK(stack, bzla_aig_get_left_child(amgr, aig));
@@ -1389,8 +1425,8 @@ bzla_aig_add_toplevel_to_sat(BzlaAIGMgr *amgr, BzlaAIG *root)
         for (p = leafs.start; p < leafs.top; p++)
         {
           left = *p;
-          assert(bzla_aig_get_cnf_id(left));
-          bzla_sat_add(smgr, bzla_aig_get_cnf_id(BZLA_INVERT_AIG(left)));
+          assert(bzla_aig_get_cnf_id(amgr, left));
+          bzla_sat_add(smgr, bzla_aig_get_cnf_id(amgr, BZLA_INVERT_AIG(left)));
           amgr->num_cnf_literals++;
         }
         bzla_sat_add(smgr, 0);
@@ -1399,7 +1435,7 @@ bzla_aig_add_toplevel_to_sat(BzlaAIGMgr *amgr, BzlaAIG *root)
       else
       {
         bzla_aig_to_sat(amgr, aig);
-        bzla_sat_add(smgr, bzla_aig_get_cnf_id(aig));
+        bzla_sat_add(smgr, bzla_aig_get_cnf_id(amgr, aig));
         bzla_sat_add(smgr, 0);
         amgr->num_cnf_literals++;
         amgr->num_cnf_clauses++;
@@ -1407,14 +1443,14 @@ bzla_aig_add_toplevel_to_sat(BzlaAIGMgr *amgr, BzlaAIG *root)
       BZLA_RELEASE_STACK(leafs);
 #else
       real_aig = BZLA_REAL_ADDR_AIG(aig);
-      if (BZLA_IS_INVERTED_AIG(aig) && bzla_aig_is_and(real_aig))
+      if (BZLA_IS_INVERTED_AIG(aig) && bzla_aig_is_and(amgr, real_aig))
       {
         left  = BZLA_INVERT_AIG(bzla_aig_get_left_child(amgr, real_aig));
         right = BZLA_INVERT_AIG(bzla_aig_get_right_child(amgr, real_aig));
         bzla_aig_to_sat(amgr, left);
         bzla_aig_to_sat(amgr, right);
-        bzla_sat_add(smgr, bzla_aig_get_cnf_id(left));
-        bzla_sat_add(smgr, bzla_aig_get_cnf_id(right));
+        bzla_sat_add(smgr, bzla_aig_get_cnf_id(amgr, left));
+        bzla_sat_add(smgr, bzla_aig_get_cnf_id(amgr, right));
         bzla_sat_add(smgr, 0);
         amgr->num_cnf_clauses++;
         amgr->num_cnf_literals += 2;
@@ -1422,7 +1458,7 @@ bzla_aig_add_toplevel_to_sat(BzlaAIGMgr *amgr, BzlaAIG *root)
       else
       {
         bzla_aig_to_sat(amgr, aig);
-        bzla_sat_add(smgr, bzla_aig_get_cnf_id(aig));
+        bzla_sat_add(smgr, bzla_aig_get_cnf_id(amgr, aig));
         bzla_sat_add(smgr, 0);
         amgr->num_cnf_clauses++;
         amgr->num_cnf_literals++;
@@ -1440,7 +1476,7 @@ bzla_aig_add_toplevel_to_sat(BzlaAIGMgr *amgr, BzlaAIG *root)
     return;
   }
   bzla_aig_to_sat(amgr, root);
-  bzla_sat_add(amgr->smgr, bzla_aig_get_cnf_id(root));
+  bzla_sat_add(amgr->smgr, bzla_aig_get_cnf_id(amgr, root));
   bzla_sat_add(amgr->smgr, 0);
 #endif
 }
@@ -1460,10 +1496,11 @@ bzla_aig_get_assignment(BzlaAIGMgr *amgr, BzlaAIG *aig)
 
   /* Note: If an AIG is not yet encoded to SAT or if the SAT solver returns
    * undefined for a variable, we implicitly initialize it with false (-1). */
-  int32_t val = -1;
-  if (BZLA_REAL_ADDR_AIG(aig)->cnf_id > 0)
+  int32_t val    = -1;
+  int32_t cnf_id = amgr->cnf_ids[bzla_aig_get_index(aig)];
+  if (cnf_id > 0)
   {
-    val = bzla_sat_deref(amgr->smgr, BZLA_REAL_ADDR_AIG(aig)->cnf_id);
+    val = bzla_sat_deref(amgr->smgr, cnf_id);
     if (val == 0)
     {
       val = -1;
@@ -1483,7 +1520,7 @@ bzla_aig_compare(const BzlaAIG *aig0, const BzlaAIG *aig1)
   if (BZLA_IS_INVERTED_AIG(aig1)) aig1 = BZLA_INVERT_AIG(aig1);
   if (aig1 == BZLA_AIG_FALSE) return 1;
   assert(aig1 != BZLA_AIG_TRUE);
-  return aig0->id - aig1->id;
+  return bzla_aig_get_id(aig0) - bzla_aig_get_id(aig1);
 }
 
 /* hash AIG by id */
@@ -1520,7 +1557,7 @@ bzla_compare_aig_by_id_qsort_asc(const void *aig0, const void *aig1)
 
   int32_t id0, id1;
 
-  id0 = BZLA_REAL_ADDR_AIG(*(BzlaAIG **) aig0)->id;
-  id1 = BZLA_REAL_ADDR_AIG(*(BzlaAIG **) aig1)->id;
+  id0 = bzla_aig_get_index(*(BzlaAIG **) aig0);
+  id1 = bzla_aig_get_index(*(BzlaAIG **) aig1);
   return id0 - id1;
 }
@@ -23,18 +23,12 @@
 
 /*------------------------------------------------------------------------*/
 
-struct BzlaAIG
-{
-  int32_t id;
-  int32_t cnf_id;
-  uint32_t refs;
-  int32_t next; /* next AIG id for unique table */
-  uint8_t mark : 2;
-  uint8_t is_var : 1; /* is it an AIG variable or an AND? */
-  uint32_t local;
-  int32_t children[]; /* only allocated for AIG AND */
-};
-
+/* AIGs are not allocated individually but kept in structure-of-arrays
+ * layout in the AIG manager (see BzlaAIGMgr), indexed by AIG id. An AIG is
+ * referenced by a 32-bit literal 2 * id + sign, where sign is 1 for inverted
+ * AIGs. Id 0 is reserved for constant false, hence literal 0 is false and
+ * literal 1 is true. A 'BzlaAIG *' holds such a literal and is never
+ * dereferenced, struct BzlaAIG is intentionally left incomplete. */
 typedef struct BzlaAIG BzlaAIG;
 
 BZLA_DECLARE_STACK(BzlaAIGPtr, BzlaAIG *);
@@ -53,7 +47,18 @@ struct BzlaAIGMgr
   Bzla *bzla;
   BzlaAIGUniqueTable table;
   BzlaSATMgr *smgr;
-  BzlaAIGPtrStack id2aig; /* id to AIG node */
+
+  /* AIG store, all arrays are indexed by AIG id. Ids 0 and 1 are reserved,
+   * ids of deleted AIGs are not reused. */
+  uint32_t num_ids;   /* number of used ids */
+  uint32_t size_ids;  /* number of allocated ids */
+  uint32_t *children; /* 2 child literals per id, 0 for AIG variables */
+  int32_t *cnf_ids;
+  uint32_t *refs; /* 0 if deleted */
+  int32_t *next;  /* next AIG id for unique table */
+  uint32_t *local;
+  uint8_t *mark;
+
   BzlaIntStack cnfid2aig; /* cnf id to AIG id */
 
   uint_least64_t cur_num_aigs;     /* current number of ANDs */
@@ -84,6 +89,17 @@ typedef struct BzlaAIGMgr BzlaAIGMgr;
 
 #define BZLA_IS_REGULAR_AIG(aig) (!((uintptr_t) 1 & (uintptr_t)(aig)))
 
+#define BZLA_AIG_GET_LIT(aig) ((uint32_t)(uintptr_t)(aig))
+
+#define BZLA_AIG_FROM_LIT(lit) ((BzlaAIG *) (uintptr_t)(lit))
+
+#define BZLA_AIG_LIT_GET_ID(lit) ((lit) >> 1)
+
+/* Number of bytes allocated per id in the AIG store. */
+#define BZLA_AIG_STORE_BYTES_PER_ID                          \
+  (2 * sizeof(uint32_t) + sizeof(int32_t) + sizeof(uint32_t) \
+   + sizeof(int32_t) + sizeof(uint32_t) + sizeof(uint8_t))
+
 /*------------------------------------------------------------------------*/
 
 static inline bool
@@ -104,62 +120,81 @@ bzla_aig_is_true(const BzlaAIG *aig)
   return aig == BZLA_AIG_TRUE;
 }
 
+/* Get the (positive) index of 'aig' into the AIG store. */
+static inline uint32_t
+bzla_aig_get_index(const BzlaAIG *aig)
+{
+  return BZLA_AIG_LIT_GET_ID(BZLA_AIG_GET_LIT(aig));
+}
+
 static inline bool
-bzla_aig_is_var(const BzlaAIG *aig)
+bzla_aig_is_var(const BzlaAIGMgr *amgr, const BzlaAIG *aig)
 {
+  assert(amgr);
   if (bzla_aig_is_const(aig)) return false;
-  return aig->is_var;
+  return amgr->children[2 * bzla_aig_get_index(aig)] == 0;
 }
 
 static inline bool
-bzla_aig_is_and(const BzlaAIG *aig)
+bzla_aig_is_and(const BzlaAIGMgr *amgr, const BzlaAIG *aig)
 {
+  assert(amgr);
   if (bzla_aig_is_const(aig)) return false;
-  return !aig->is_var;
+  return amgr->children[2 * bzla_aig_get_index(aig)] != 0;
 }
 
 static inline int32_t
 bzla_aig_get_id(const BzlaAIG *aig)
 {
-  assert(aig);
   assert(!bzla_aig_is_const(aig));
-  return BZLA_IS_INVERTED_AIG(aig) ? -BZLA_REAL_ADDR_AIG(aig)->id : aig->id;
+  return BZLA_IS_INVERTED_AIG(aig) ? -(int32_t) bzla_aig_get_index(aig)
+                                   : (int32_t) bzla_aig_get_index(aig);
 }
 
 static inline BzlaAIG *
-bzla_aig_get_by_id(BzlaAIGMgr *amgr, int32_t id)
+bzla_aig_get_by_id(const BzlaAIGMgr *amgr, int32_t id)
 {
   assert(amgr);
-
-  return id < 0 ? BZLA_INVERT_AIG(BZLA_PEEK_STACK(amgr->id2aig, -id))
-                : BZLA_PEEK_STACK(amgr->id2aig, id);
+  (void) amgr;
+  assert(id < 0 || (uint32_t) id < amgr->num_ids);
+  assert(id >= 0 || (uint32_t) -id < amgr->num_ids);
+  return id < 0 ? BZLA_AIG_FROM_LIT(2 * (uint32_t) -id + 1)
+                : BZLA_AIG_FROM_LIT(2 * (uint32_t) id);
 }
 
 static inline int32_t
-bzla_aig_get_cnf_id(const BzlaAIG *aig)
+bzla_aig_get_cnf_id(const BzlaAIGMgr *amgr, const BzlaAIG *aig)
 {
+  assert(amgr);
+  int32_t cnf_id;
   if (bzla_aig_is_true(aig)) return 1;
   if (bzla_aig_is_false(aig)) return -1;
-  return BZLA_IS_INVERTED_AIG(aig) ? -BZLA_REAL_ADDR_AIG(aig)->cnf_id
-                                   : aig->cnf_id;
+  cnf_id = amgr->cnf_ids[bzla_aig_get_index(aig)];
+  return BZLA_IS_INVERTED_AIG(aig) ? -cnf_id : cnf_id;
 }
 
-static inline BzlaAIG *
-bzla_aig_get_left_child(BzlaAIGMgr *amgr, const BzlaAIG *aig)
+static inline uint32_t
+bzla_aig_get_refs(const BzlaAIGMgr *amgr, const BzlaAIG *aig)
 {
   assert(amgr);
-  assert(aig);
   assert(!bzla_aig_is_const(aig));
-  return bzla_aig_get_by_id(amgr, BZLA_REAL_ADDR_AIG(aig)->children[0]);
+  return amgr->refs[bzla_aig_get_index(aig)];
 }
 
 static inline BzlaAIG *
-bzla_aig_get_right_child(BzlaAIGMgr *amgr, const BzlaAIG *aig)
+bzla_aig_get_left_child(const BzlaAIGMgr *amgr, const BzlaAIG *aig)
 {
   assert(amgr);
-  assert(aig);
-  assert(!bzla_aig_is_const(aig));
-  return bzla_aig_get_by_id(amgr, BZLA_REAL_ADDR_AIG(aig)->children[1]);
+  assert(bzla_aig_is_and(amgr, aig));
+  return BZLA_AIG_FROM_LIT(amgr->children[2 * bzla_aig_get_index(aig)]);
+}
+
+static inline BzlaAIG *
+bzla_aig_get_right_child(const BzlaAIGMgr *amgr, const BzlaAIG *aig)
+{
+  assert(amgr);
+  assert(bzla_aig_is_and(amgr, aig));
+  return BZLA_AIG_FROM_LIT(amgr->children[2 * bzla_aig_get_index(aig) + 1]);
 }
 
 /*------------------------------------------------------------------------*/
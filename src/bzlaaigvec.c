@@ -871,6 +871,137 @@ bzla_aigvec_cond(BzlaAIGVecMgr *avmgr,
   return result;
 }
 
+/* Build the multiplexer tree for cases 'idx[0..n-1]', which agree on all
+ * selector bits above 'pos'. Selector bits on which all cases agree are not
+ * branched on but only checked in 'match', which is true if the selector
+ * matches any of the cases. */
+static BzlaAIGVec *
+select_aux(BzlaAIGVecMgr *avmgr,
+           BzlaAIGVec *av_sel,
+           BzlaBitVector **consts,
+           BzlaAIGVec **av_cases,
+           uint32_t *idx,
+           uint32_t n,
+           uint32_t pos,
+           BzlaAIG **match)
+{
+  assert(n > 0);
+
+  BzlaAIGMgr *amgr;
+  BzlaAIGVec *result, *av0, *av1;
+  BzlaAIG *guard, *lit, *tmp, *m0, *m1;
+  uint32_t i, j, k, bit, width;
+
+  amgr  = avmgr->amgr;
+  width = av_sel->width;
+  guard = BZLA_AIG_TRUE;
+
+  for (; pos < width; pos++)
+  {
+    bit = bzla_bv_get_bit(consts[idx[0]], width - 1 - pos);
+    for (i = 1; i < n; i++)
+    {
+      if (bzla_bv_get_bit(consts[idx[i]], width - 1 - pos) != bit) break;
+    }
+    if (i < n) break;
+    lit = bit ? av_sel->aigs[pos] : BZLA_INVERT_AIG(av_sel->aigs[pos]);
+    tmp = bzla_aig_and(amgr, guard, lit);
+    bzla_aig_release(amgr, guard);
+    guard = tmp;
+  }
+
+  if (pos == width)
+  {
+    assert(n == 1);
+    *match = guard;
+    return bzla_aigvec_copy(avmgr, av_cases[idx[0]]);
+  }
+
+  /* partition cases, cases with bit 'pos' set first */
+  for (i = 0, j = 0; i < n; i++)
+  {
+    if (bzla_bv_get_bit(consts[idx[i]], width - 1 - pos))
+    {
+      k        = idx[i];
+      idx[i]   = idx[j];
+      idx[j++] = k;
+    }
+  }
+  assert(j > 0 && j < n);
+
+  av1 = select_aux(avmgr, av_sel, consts, av_cases, idx, j, pos + 1, &m1);
+  av0 = select_aux(
+      avmgr, av_sel, consts, av_cases, idx + j, n - j, pos + 1, &m0);
+
+  result = new_aigvec(avmgr, av0->width);
+  for (i = 0; i < av0->width; i++)
+    result->aigs[i] =
+        bzla_aig_cond(amgr, av_sel->aigs[pos], av1->aigs[i], av0->aigs[i]);
+
+  /* either subtree covers all selector values below 'pos' if its match is
+   * true, which is common for dense case constants */
+  if (m1 == BZLA_AIG_TRUE)
+    tmp = bzla_aig_or(amgr, av_sel->aigs[pos], m0);
+  else if (m0 == BZLA_AIG_TRUE)
+    tmp = bzla_aig_or(amgr, BZLA_INVERT_AIG(av_sel->aigs[pos]), m1);
+  else
+    tmp = bzla_aig_cond(amgr, av_sel->aigs[pos], m1, m0);
+  *match = bzla_aig_and(amgr, guard, tmp);
+
+  bzla_aig_release(amgr, tmp);
+  bzla_aig_release(amgr, m0);
+  bzla_aig_release(amgr, m1);
+  bzla_aig_release(amgr, guard);
+  bzla_aigvec_release_delete(avmgr, av0);
+  bzla_aigvec_release_delete(avmgr, av1);
+  return result;
+}
+
+BzlaAIGVec *
+bzla_aigvec_select(BzlaAIGVecMgr *avmgr,
+                   BzlaAIGVec *av_sel,
+                   uint32_t n,
+                   BzlaBitVector **consts,
+                   BzlaAIGVec **av_cases,
+                   BzlaAIGVec *av_default)
+{
+  assert(avmgr);
+  assert(av_sel);
+  assert(n > 0);
+  assert(consts);
+  assert(av_cases);
+  assert(av_default);
+
+  BzlaAIGMgr *amgr;
+  BzlaAIGVec *result, *tree;
+  BzlaAIG *match;
+  uint32_t i, width, *idx;
+  BzlaMemMgr *mm;
+
+  mm    = avmgr->bzla->mm;
+  amgr  = avmgr->amgr;
+  width = av_default->width;
+
+  BZLA_NEWN(mm, idx, n);
+  for (i = 0; i < n; i++)
+  {
+    assert(bzla_bv_get_width(consts[i]) == av_sel->width);
+    assert(av_cases[i]->width == width);
+    idx[i] = i;
+  }
+
+  tree   = select_aux(avmgr, av_sel, consts, av_cases, idx, n, 0, &match);
+  result = new_aigvec(avmgr, width);
+  for (i = 0; i < width; i++)
+    result->aigs[i] =
+        bzla_aig_cond(amgr, match, tree->aigs[i], av_default->aigs[i]);
+
+  bzla_aig_release(amgr, match);
+  bzla_aigvec_release_delete(avmgr, tree);
+  BZLA_DELETEN(mm, idx, n);
+  return result;
+}
+
 BzlaAIGVec *
 bzla_aigvec_copy(BzlaAIGVecMgr *avmgr, BzlaAIGVec *av)
 {
@@ -895,30 +1026,14 @@ bzla_aigvec_clone(BzlaAIGVec *av, BzlaAIGVecMgr *avmgr)
 
   uint32_t i;
   BzlaAIGVec *res;
-  BzlaAIGMgr *amgr;
-  BzlaAIG *aig, *caig;
 
-  amgr = avmgr->amgr;
-  res  = new_aigvec(avmgr, av->width);
+  res = new_aigvec(avmgr, av->width);
   for (i = 0; i < av->width; i++)
   {
-    if (bzla_aig_is_const(av->aigs[i]))
-      res->aigs[i] = av->aigs[i];
-    else
-    {
-      aig = av->aigs[i];
-      assert(BZLA_REAL_ADDR_AIG(aig)->id >= 0);
-      assert((size_t) BZLA_REAL_ADDR_AIG(aig)->id
-             < BZLA_COUNT_STACK(amgr->id2aig));
-      caig = BZLA_PEEK_STACK(amgr->id2aig, BZLA_REAL_ADDR_AIG(aig)->id);
-      assert(caig);
-      assert(!bzla_aig_is_const(caig));
-      if (BZLA_IS_INVERTED_AIG(aig))
-        res->aigs[i] = BZLA_INVERT_AIG(caig);
-      else
-        res->aigs[i] = caig;
-      assert(res->aigs[i]);
-    }
+    /* cloned AIGs keep their ids */
+    assert(bzla_aig_is_const(av->aigs[i])
+           || bzla_aig_get_refs(avmgr->amgr, av->aigs[i]) > 0);
+    res->aigs[i] = av->aigs[i];
   }
   return res;
 }
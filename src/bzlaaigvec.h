@@ -186,6 +186,24 @@ BzlaAIGVec *bzla_aigvec_cond(BzlaAIGVecMgr *avmgr,
                              BzlaAIGVec *av_cond,
                              BzlaAIGVec *av_if,
                              BzlaAIGVec *av_else);
+/**
+ * Create an AIG vector representing the ITE chain
+ *   av_sel = consts[0] ? av_cases[0]
+ *   : av_sel = consts[1] ? av_cases[1]
+ *   : ...
+ *   : av_default
+ * as a decoder over the selector bits and a balanced multiplexer tree.
+ * All constants must be distinct.
+ * width(consts[i]) = width(av_sel)
+ * width(av_cases[i]) = width(av_default)
+ * width(result) = width(av_default)
+ */
+BzlaAIGVec *bzla_aigvec_select(BzlaAIGVecMgr *avmgr,
+                               BzlaAIGVec *av_sel,
+                               uint32_t n,
+                               BzlaBitVector **consts,
+                               BzlaAIGVec **av_cases,
+                               BzlaAIGVec *av_default);
 /**
  * Creates an AIG vector representing a copy of av.
  * width(result) = width(av)
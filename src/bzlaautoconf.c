@@ -0,0 +1,292 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include "bzlaautoconf.h"
+
+#include <stdio.h>
+
+#include "bzlaautoconfmodel.h"
+#include "bzlacore.h"
+#include "bzlanode.h"
+#include "bzlaopt.h"
+#include "bzlasat.h"
+#include "utils/bzlahashint.h"
+#include "utils/bzlautil.h"
+
+/*------------------------------------------------------------------------*/
+
+const char *const g_bzla_autoconf_feature_names[BZLA_AUTOCONF_F_NUM] = {
+    [BZLA_AUTOCONF_F_NODES]       = "nodes",
+    [BZLA_AUTOCONF_F_VARS]        = "vars",
+    [BZLA_AUTOCONF_F_MAX_WIDTH]   = "max_width",
+    [BZLA_AUTOCONF_F_AVG_WIDTH]   = "avg_width",
+    [BZLA_AUTOCONF_F_ARITH]       = "arith",
+    [BZLA_AUTOCONF_F_BITWISE]     = "bitwise",
+    [BZLA_AUTOCONF_F_SHIFT]       = "shift",
+    [BZLA_AUTOCONF_F_ARRAYS]      = "arrays",
+    [BZLA_AUTOCONF_F_APPLIES]     = "applies",
+    [BZLA_AUTOCONF_F_QUANTIFIERS] = "quantifiers",
+    [BZLA_AUTOCONF_F_FP]          = "fp",
+    [BZLA_AUTOCONF_F_AIGS]        = "aigs",
+};
+
+static const char *const g_bzla_engine_name[BZLA_ENGINE_MAX + 1] = {
+    [BZLA_ENGINE_FUN]     = "fun",
+    [BZLA_ENGINE_SLS]     = "sls",
+    [BZLA_ENGINE_PROP]    = "prop",
+    [BZLA_ENGINE_AIGPROP] = "aigprop",
+    [BZLA_ENGINE_QUANT]   = "quant",
+    [BZLA_ENGINE_AUTO]    = "auto",
+};
+
+/*------------------------------------------------------------------------*/
+
+/* Rough estimate of the number of AIG ANDs required to bit-blast 'exp'
+ * (based on the encodings in bzlaaigvec.c). */
+static double
+estimate_aigs(Bzla *bzla, BzlaNode *exp)
+{
+  uint32_t width, log_width;
+
+  if (!bzla_node_is_bv(bzla, exp)) return 0;
+
+  /* bit-width of the operands, except for conditionals */
+  if (exp->kind == BZLA_COND_NODE)
+    width = bzla_node_bv_get_width(bzla, exp);
+  else if (exp->arity && bzla_node_is_bv(bzla, exp->e[0]))
+    width = bzla_node_bv_get_width(bzla, exp->e[0]);
+  else
+    return 0;
+
+  switch (exp->kind)
+  {
+    case BZLA_BV_AND_NODE: return width;
+    case BZLA_BV_EQ_NODE: return 4 * width;
+    case BZLA_BV_ADD_NODE: return 7 * width;
+    case BZLA_BV_ULT_NODE:
+    case BZLA_BV_SLT_NODE: return 5 * width;
+    case BZLA_BV_MUL_NODE: return 7.0 * width * width;
+    case BZLA_BV_UDIV_NODE:
+    case BZLA_BV_UREM_NODE: return 10.0 * width * width;
+    case BZLA_BV_SLL_NODE:
+    case BZLA_BV_SRL_NODE:
+      for (log_width = 1; log_width < 32 && (1u << log_width) < width;
+           log_width++)
+        ;
+      return 3.0 * width * log_width;
+    case BZLA_COND_NODE: return 3 * width;
+    default: return 0;
+  }
+}
+
+void
+bzla_autoconf_features(Bzla *bzla, double *features)
+{
+  assert(bzla);
+  assert(features);
+
+  uint32_t i, width, nbv, nops, narith, nbitwise, nshift;
+  double sum_width;
+  BzlaNode *cur;
+  BzlaNodePtrStack visit;
+  BzlaPtrHashTableIterator it;
+  BzlaIntHashTable *cache;
+  BzlaMemMgr *mm;
+
+  mm    = bzla->mm;
+  cache = bzla_hashint_table_new(mm);
+  BZLA_INIT_STACK(mm, visit);
+
+  for (i = 0; i < BZLA_AUTOCONF_F_NUM; i++) features[i] = 0;
+
+  nbv       = 0;
+  sum_width = 0;
+
+  bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->embedded_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->assumptions);
+  while (bzla_iter_hashptr_has_next(&it))
+    BZLA_PUSH_STACK(visit, bzla_iter_hashptr_next(&it));
+
+  while (!BZLA_EMPTY_STACK(visit))
+  {
+    cur = bzla_node_real_addr(BZLA_POP_STACK(visit));
+
+    if (bzla_hashint_table_contains(cache, cur->id)) continue;
+    bzla_hashint_table_add(cache, cur->id);
+
+    features[BZLA_AUTOCONF_F_NODES] += 1;
+    if (bzla_node_is_bv(bzla, cur))
+    {
+      width = bzla_node_bv_get_width(bzla, cur);
+      nbv += 1;
+      sum_width += width;
+      if (width > features[BZLA_AUTOCONF_F_MAX_WIDTH])
+        features[BZLA_AUTOCONF_F_MAX_WIDTH] = width;
+      if (bzla_node_is_bv_var(cur)) features[BZLA_AUTOCONF_F_VARS] += 1;
+      features[BZLA_AUTOCONF_F_AIGS] += estimate_aigs(bzla, cur);
+    }
+    else if (bzla_node_is_fp(bzla, cur) || bzla_node_is_rm(bzla, cur))
+    {
+      features[BZLA_AUTOCONF_F_FP] = 1;
+    }
+    if (bzla_node_is_apply(cur)) features[BZLA_AUTOCONF_F_APPLIES] += 1;
+
+    for (i = 0; i < cur->arity; i++) BZLA_PUSH_STACK(visit, cur->e[i]);
+  }
+  if (nbv) features[BZLA_AUTOCONF_F_AVG_WIDTH] = sum_width / nbv;
+
+  /* operator histogram over all bit-vector operators */
+  narith   = bzla->ops[BZLA_BV_MUL_NODE].cur + bzla->ops[BZLA_BV_UDIV_NODE].cur
+           + bzla->ops[BZLA_BV_UREM_NODE].cur;
+  nbitwise = bzla->ops[BZLA_BV_AND_NODE].cur + bzla->ops[BZLA_BV_SLICE_NODE].cur
+             + bzla->ops[BZLA_BV_CONCAT_NODE].cur;
+  nshift   = bzla->ops[BZLA_BV_SLL_NODE].cur + bzla->ops[BZLA_BV_SRL_NODE].cur;
+  nops     = narith + nbitwise + nshift + bzla->ops[BZLA_BV_EQ_NODE].cur
+         + bzla->ops[BZLA_BV_ADD_NODE].cur + bzla->ops[BZLA_BV_ULT_NODE].cur
+         + bzla->ops[BZLA_BV_SLT_NODE].cur + bzla->ops[BZLA_COND_NODE].cur;
+  if (nops)
+  {
+    features[BZLA_AUTOCONF_F_ARITH]   = 100.0 * narith / nops;
+    features[BZLA_AUTOCONF_F_BITWISE] = 100.0 * nbitwise / nops;
+    features[BZLA_AUTOCONF_F_SHIFT]   = 100.0 * nshift / nops;
+  }
+
+  features[BZLA_AUTOCONF_F_ARRAYS] =
+      bzla->ufs->count + bzla->lambdas->count + bzla->feqs->count;
+  features[BZLA_AUTOCONF_F_QUANTIFIERS] = bzla->quantifiers->count;
+
+  BZLA_RELEASE_STACK(visit);
+  bzla_hashint_table_delete(cache);
+}
+
+const BzlaAutoConfNode *
+bzla_autoconf_classify(const BzlaAutoConfNode *model, const double *features)
+{
+  assert(model);
+  assert(features);
+
+  const BzlaAutoConfNode *cur;
+
+  for (cur = model; cur->feature >= 0;)
+  {
+    assert(cur->feature < BZLA_AUTOCONF_F_NUM);
+    if (features[cur->feature] <= cur->threshold)
+      cur = &model[cur->left];
+    else
+      cur = &model[cur->right];
+  }
+  return cur;
+}
+
+/*------------------------------------------------------------------------*/
+
+static bool
+is_sat_engine_available(int32_t sat_engine, bool incremental)
+{
+  (void) incremental;
+  switch (sat_engine)
+  {
+#ifdef BZLA_USE_LINGELING
+    case BZLA_SAT_ENGINE_LINGELING: return true;
+#endif
+#ifdef BZLA_USE_PICOSAT
+    case BZLA_SAT_ENGINE_PICOSAT: return true;
+#endif
+#ifdef BZLA_USE_MINISAT
+    case BZLA_SAT_ENGINE_MINISAT: return true;
+#endif
+#ifdef BZLA_USE_CADICAL
+    case BZLA_SAT_ENGINE_CADICAL: return true;
+#endif
+#ifdef BZLA_USE_CMS
+    case BZLA_SAT_ENGINE_CMS: return true;
+#endif
+    /* no support for assumptions */
+#ifdef BZLA_USE_KISSAT
+    case BZLA_SAT_ENGINE_KISSAT: return !incremental;
+#endif
+#ifdef BZLA_USE_GIMSATUL
+    case BZLA_SAT_ENGINE_GIMSATUL: return !incremental;
+#endif
+    default: return false;
+  }
+}
+
+void
+bzla_autoconf(Bzla *bzla)
+{
+  assert(bzla);
+  assert(!bzla->slv);
+
+  uint32_t i, engine;
+  int32_t sat_engine;
+  bool incremental, qf_bv, preprop;
+  char buf[BZLA_AUTOCONF_F_NUM * 40], *p;
+  double features[BZLA_AUTOCONF_F_NUM];
+  const BzlaAutoConfNode *leaf;
+
+  if (bzla_opt_get(bzla, BZLA_OPT_ENGINE) != BZLA_ENGINE_AUTO) return;
+
+  bzla_autoconf_features(bzla, features);
+
+  /* contrib/bzlaautoconf.py parses this line */
+  p = buf;
+  for (i = 0; i < BZLA_AUTOCONF_F_NUM; i++)
+  {
+    p += sprintf(p, " %s=%g", g_bzla_autoconf_feature_names[i], features[i]);
+  }
+  BZLA_MSG(bzla->msg, 1, "auto-config features:%s", buf);
+
+  leaf        = bzla_autoconf_classify(bzla_autoconf_model, features);
+  engine      = leaf->engine;
+  sat_engine  = leaf->sat_engine;
+  preprop     = leaf->preprop;
+  incremental = bzla_opt_get(bzla, BZLA_OPT_INCREMENTAL) != 0;
+  qf_bv       = bzla->ufs->count == 0 && bzla->feqs->count == 0
+          && bzla->quantifiers->count == 0 && !features[BZLA_AUTOCONF_F_FP];
+
+  /* only select engines that support the formula */
+  if (bzla->quantifiers->count > 0)
+  {
+    engine = BZLA_ENGINE_QUANT;
+  }
+  else if (engine == BZLA_ENGINE_QUANT
+           || (engine != BZLA_ENGINE_FUN && !qf_bv))
+  {
+    engine = BZLA_ENGINE_FUN;
+  }
+  bzla_opt_set(bzla, BZLA_OPT_ENGINE, engine);
+
+  /* sequential portfolio of prop and bit-blasting, as in SMT-COMP mode */
+  preprop = preprop && engine == BZLA_ENGINE_FUN && qf_bv && !incremental;
+  if (preprop)
+  {
+    bzla_opt_set(bzla, BZLA_OPT_FUN_PREPROP, 1);
+    if (!bzla_opt_get(bzla, BZLA_OPT_PROP_NPROPS))
+      bzla_opt_set(bzla, BZLA_OPT_PROP_NPROPS, 10000);
+    if (!bzla_opt_get(bzla, BZLA_OPT_PROP_NUPDATES))
+      bzla_opt_set(bzla, BZLA_OPT_PROP_NUPDATES, 2000000);
+  }
+
+  if (sat_engine >= 0 && !bzla_sat_is_initialized(bzla_get_sat_mgr(bzla))
+      && is_sat_engine_available(sat_engine, incremental))
+  {
+    bzla_opt_set(bzla, BZLA_OPT_SAT_ENGINE, sat_engine);
+  }
+
+  BZLA_MSG(bzla->msg,
+           1,
+           "auto-config: selected engine %s%s with SAT solver %s",
+           g_bzla_engine_name[engine],
+           preprop ? " (prop preprocessing)" : "",
+           g_bzla_se_name[bzla_opt_get(bzla, BZLA_OPT_SAT_ENGINE)]);
+}
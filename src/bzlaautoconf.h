@@ -0,0 +1,76 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#ifndef BZLAAUTOCONF_H_INCLUDED
+#define BZLAAUTOCONF_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bzlatypes.h"
+
+/*------------------------------------------------------------------------*/
+
+/* Formula features used for automatic engine and SAT solver selection
+ * (-E auto). Feature names (see g_bzla_autoconf_feature_names) are part of
+ * the interface to contrib/bzlaautoconf.py and must not be reordered. */
+enum BzlaAutoConfFeature
+{
+  BZLA_AUTOCONF_F_NODES,       /* number of nodes in the formula */
+  BZLA_AUTOCONF_F_VARS,        /* number of bit-vector variables */
+  BZLA_AUTOCONF_F_MAX_WIDTH,   /* maximum bit-width */
+  BZLA_AUTOCONF_F_AVG_WIDTH,   /* average bit-width of bit-vector nodes */
+  BZLA_AUTOCONF_F_ARITH,       /* % of mul, udiv, urem nodes */
+  BZLA_AUTOCONF_F_BITWISE,     /* % of and, slice, concat nodes */
+  BZLA_AUTOCONF_F_SHIFT,       /* % of shift nodes */
+  BZLA_AUTOCONF_F_ARRAYS,      /* number of UFs, lambdas, function eqs */
+  BZLA_AUTOCONF_F_APPLIES,     /* number of function applications */
+  BZLA_AUTOCONF_F_QUANTIFIERS, /* number of quantifiers */
+  BZLA_AUTOCONF_F_FP,          /* 1 if formula contains FP terms */
+  BZLA_AUTOCONF_F_AIGS,        /* estimated number of AIG ANDs */
+  BZLA_AUTOCONF_F_NUM,
+};
+typedef enum BzlaAutoConfFeature BzlaAutoConfFeature;
+
+extern const char *const g_bzla_autoconf_feature_names[BZLA_AUTOCONF_F_NUM];
+
+/* Node of the decision tree that maps features to a configuration. Inner
+ * nodes continue with 'left' if 'feature' <= 'threshold' and with 'right'
+ * otherwise. Leaves (feature < 0) hold the selected configuration. */
+struct BzlaAutoConfNode
+{
+  int32_t feature;
+  double threshold;
+  uint32_t left;
+  uint32_t right;
+  uint32_t engine;    /* BzlaOptEngine */
+  int32_t sat_engine; /* BzlaOptSatEngine, < 0 keeps the configured one */
+  bool preprop;       /* run prop engine as preprocessing (fun only) */
+};
+typedef struct BzlaAutoConfNode BzlaAutoConfNode;
+
+/* Compute the features of the current (simplified) formula. */
+void bzla_autoconf_features(Bzla *bzla, double *features);
+
+/* Evaluate decision tree 'model' on 'features', returns the selected leaf. */
+const BzlaAutoConfNode *bzla_autoconf_classify(const BzlaAutoConfNode *model,
+                                               const double *features);
+
+/**
+ * Select engine and SAT solver for the current formula if BZLA_OPT_ENGINE is
+ * BZLA_ENGINE_AUTO, based on its features and the built-in decision model
+ * (bzlaautoconfmodel.h). Must be called after simplification and before
+ * the solver is created. Engines that do not support the formula and SAT
+ * solvers that are not compiled in (or are non-incremental in incremental
+ * mode) are not selected.
+ */
+void bzla_autoconf(Bzla *bzla);
+
+#endif
@@ -0,0 +1,40 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#ifndef BZLAAUTOCONFMODEL_H_INCLUDED
+#define BZLAAUTOCONFMODEL_H_INCLUDED
+
+#include "bzlaautoconf.h"
+#include "bzlaopt.h"
+
+/*------------------------------------------------------------------------*/
+
+/* Decision model for -E auto (see bzlaautoconf.h). This is the built-in
+ * default model, regenerate from benchmark timings with
+ *
+ *   contrib/bzlaautoconf.py train features.csv timings.csv \
+ *     -o src/bzlaautoconfmodel.h
+ */
+
+static const BzlaAutoConfNode bzla_autoconf_model[] = {
+    /* 0 */ {BZLA_AUTOCONF_F_QUANTIFIERS, 0.5, 1, 2, 0, -1, false},
+    /* 1 */ {BZLA_AUTOCONF_F_ARRAYS, 0.5, 3, 4, 0, -1, false},
+    /* 2 */ {-1, 0, 0, 0, BZLA_ENGINE_QUANT, -1, false},
+    /* 3 */ {BZLA_AUTOCONF_F_FP, 0.5, 5, 6, 0, -1, false},
+    /* 4 */ {-1, 0, 0, 0, BZLA_ENGINE_FUN, -1, false},
+    /* 5 */ {BZLA_AUTOCONF_F_AIGS, 250000, 7, 8, 0, -1, false},
+    /* 6 */ {-1, 0, 0, 0, BZLA_ENGINE_FUN, -1, false},
+    /* 7 */ {-1, 0, 0, 0, BZLA_ENGINE_FUN, -1, false},
+    /* 8 */ {BZLA_AUTOCONF_F_ARITH, 5, 9, 10, 0, -1, false},
+    /* 9 */ {-1, 0, 0, 0, BZLA_ENGINE_FUN, -1, false},
+    /* 10 */ {-1, 0, 0, 0, BZLA_ENGINE_FUN, -1, true},
+};
+
+#endif
@@ -14,6 +14,7 @@
 #include "bzlalog.h"
 #include "bzlarewrite.h"
 #include "bzlaslvfun.h"
+#include "bzlatrace.h"
 #include "utils/bzlahashint.h"
 #include "utils/bzlanodeiter.h"
 #include "utils/bzlautil.h"
@@ -262,6 +263,7 @@ beta_reduce(Bzla *bzla,
 
   start = bzla_util_time_stamp();
   bzla->stats.beta_reduce_calls++;
+  BZLA_TRACE2(beta_start, mode, bzla_node_get_id(exp));
 
   mm = bzla->mm;
   BZLA_INIT_STACK(mm, stack);
@@ -574,6 +576,7 @@ beta_reduce(Bzla *bzla,
           bzla_util_node2string(result),
           bzla_node_is_inverted(result));
   bzla->time.beta += bzla_util_time_stamp() - start;
+  BZLA_TRACE2(beta_done, mode, bzla_node_get_id(result));
   return result;
 }
 
@@ -69,7 +69,8 @@ bzla_bv_new_random(BzlaMemMgr *mm, BzlaRNG *rng, uint32_t bw)
   BzlaBitVector *res;
 
   res = bzla_bv_new(mm, bw);
-  mpz_urandomb(res->val, *((gmp_randstate_t *) rng->gmp_state), bw);
+  mpz_urandomb(
+      res->val, *((gmp_randstate_t *) bzla_rng_get_gmp_state(rng)), bw);
   mpz_fdiv_r_2exp(res->val, res->val, bw);
 
   return res;
@@ -91,17 +92,8 @@ bzla_bv_new_random_range(BzlaMemMgr *mm,
 
   BzlaBitVector *res;
 
-  mpz_t n_to;
-
   res = bzla_bv_new(mm, bw);
-  mpz_init_set(n_to, to->val);
-  mpz_sub(n_to, n_to, from->val);
-  mpz_add_ui(n_to, n_to, 1);
-
-  mpz_urandomm(res->val, *((gmp_randstate_t *) rng->gmp_state), n_to);
-  mpz_add(res->val, res->val, from->val);
-  mpz_clear(n_to);
-
+  bzla_bv_set_random_range(res, rng, from, to);
   return res;
 }
 
@@ -781,6 +773,40 @@ bzla_bv_get_num_leading_ones(const BzlaBitVector *bv)
   return get_num_leading(bv, false);
 }
 
+uint32_t
+bzla_bv_get_num_diff_bits(const BzlaBitVector *a, const BzlaBitVector *b)
+{
+  assert(a);
+  assert(b);
+  assert(a->width == b->width);
+  return mpz_hamdist(a->val, b->val);
+}
+
+bool
+bzla_bv_is_bits_subset(const BzlaBitVector *a, const BzlaBitVector *b)
+{
+  assert(a);
+  assert(b);
+  assert(a->width == b->width);
+
+  size_t i, size_a, size_b;
+
+  size_a = mpz_size(a->val);
+  size_b = mpz_size(b->val);
+  for (i = 0; i < size_a; i++)
+  {
+    if (i >= size_b)
+    {
+      if (mpz_getlimbn(a->val, i)) return false;
+    }
+    else if (mpz_getlimbn(a->val, i) & ~mpz_getlimbn(b->val, i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 /*------------------------------------------------------------------------*/
 
 BzlaBitVector *
@@ -840,10 +866,8 @@ bzla_bv_neg(BzlaMemMgr *mm, const BzlaBitVector *bv)
   assert(bv);
 
   BzlaBitVector *res;
-  uint32_t bw = bv->width;
-  res = bzla_bv_not(mm, bv);
-  mpz_add_ui(res->val, res->val, 1);
-  mpz_fdiv_r_2exp(res->val, res->val, bw);
+  res = bzla_bv_new(mm, bv->width);
+  bzla_bv_neg_into(res, bv);
   return res;
 }
 
@@ -854,10 +878,8 @@ bzla_bv_not(BzlaMemMgr *mm, const BzlaBitVector *bv)
   assert(bv);
 
   BzlaBitVector *res;
-  uint32_t bw = bv->width;
-  res = bzla_bv_new(mm, bw);
-  mpz_com(res->val, bv->val);
-  mpz_fdiv_r_2exp(res->val, res->val, bw);
+  res = bzla_bv_new(mm, bv->width);
+  bzla_bv_not_into(res, bv);
   return res;
 }
 
@@ -868,10 +890,8 @@ bzla_bv_inc(BzlaMemMgr *mm, const BzlaBitVector *bv)
   assert(bv);
 
   BzlaBitVector *res;
-  uint32_t bw = bv->width;
-  res = bzla_bv_new(mm, bw);
-  mpz_add_ui(res->val, bv->val, 1);
-  mpz_fdiv_r_2exp(res->val, res->val, bw);
+  res = bzla_bv_new(mm, bv->width);
+  bzla_bv_inc_into(res, bv);
   return res;
 }
 
@@ -882,10 +902,8 @@ bzla_bv_dec(BzlaMemMgr *mm, const BzlaBitVector *bv)
   assert(bv);
 
   BzlaBitVector *res;
-  uint32_t bw = bv->width;
-  res = bzla_bv_new(mm, bw);
-  mpz_sub_ui(res->val, bv->val, 1);
-  mpz_fdiv_r_2exp(res->val, res->val, bw);
+  res = bzla_bv_new(mm, bv->width);
+  bzla_bv_dec_into(res, bv);
   return res;
 }
 
@@ -924,12 +942,8 @@ bzla_bv_add(BzlaMemMgr *mm, const BzlaBitVector *a, const BzlaBitVector *b)
   assert(a->width == b->width);
 
   BzlaBitVector *res;
-
-  uint32_t bw = a->width;
-  res         = bzla_bv_new(mm, bw);
-  mpz_add(res->val, a->val, b->val);
-  mpz_fdiv_r_2exp(res->val, res->val, bw);
-
+  res = bzla_bv_new(mm, a->width);
+  bzla_bv_add_into(res, a, b);
   return res;
 }
 
@@ -942,12 +956,8 @@ bzla_bv_sub(BzlaMemMgr *mm, const BzlaBitVector *a, const BzlaBitVector *b)
   assert(a->width == b->width);
 
   BzlaBitVector *res;
-
-  uint32_t bw = a->width;
-  res         = bzla_bv_new(mm, bw);
-  mpz_sub(res->val, a->val, b->val);
-  mpz_fdiv_r_2exp(res->val, res->val, bw);
-
+  res = bzla_bv_new(mm, a->width);
+  bzla_bv_sub_into(res, a, b);
   return res;
 }
 
@@ -960,12 +970,8 @@ bzla_bv_and(BzlaMemMgr *mm, const BzlaBitVector *a, const BzlaBitVector *b)
   assert(a->width == b->width);
 
   BzlaBitVector *res;
-  uint32_t bw = a->width;
-
-  res = bzla_bv_new(mm, bw);
-  mpz_and(res->val, a->val, b->val);
-  mpz_fdiv_r_2exp(res->val, res->val, bw);
-
+  res = bzla_bv_new(mm, a->width);
+  bzla_bv_and_into(res, a, b);
   return res;
 }
 
@@ -991,12 +997,8 @@ bzla_bv_or(BzlaMemMgr *mm, const BzlaBitVector *a, const BzlaBitVector *b)
   assert(a->width == b->width);
 
   BzlaBitVector *res;
-  uint32_t bw = a->width;
-
-  res = bzla_bv_new(mm, bw);
-  mpz_ior(res->val, a->val, b->val);
-  mpz_fdiv_r_2exp(res->val, res->val, bw);
-
+  res = bzla_bv_new(mm, a->width);
+  bzla_bv_or_into(res, a, b);
   return res;
 }
 
@@ -1066,12 +1068,8 @@ bzla_bv_xor(BzlaMemMgr *mm, const BzlaBitVector *a, const BzlaBitVector *b)
   assert(a->width == b->width);
 
   BzlaBitVector *res;
-  uint32_t bw = a->width;
-
-  res = bzla_bv_new(mm, bw);
-  mpz_xor(res->val, a->val, b->val);
-  mpz_fdiv_r_2exp(res->val, res->val, bw);
-
+  res = bzla_bv_new(mm, a->width);
+  bzla_bv_xor_into(res, a, b);
   return res;
 }
 
@@ -1268,42 +1266,20 @@ bzla_bv_sll_uint64(BzlaMemMgr *mm, const BzlaBitVector *a, uint64_t shift)
   assert(a);
 
   BzlaBitVector *res;
-  uint32_t bw = a->width;
-
-  res = bzla_bv_new(mm, bw);
-  if (shift >= bw) return res;
-
-  mpz_mul_2exp(res->val, a->val, shift);
-  mpz_fdiv_r_2exp(res->val, res->val, bw);
+  res = bzla_bv_new(mm, a->width);
+  bzla_bv_sll_uint64_into(res, a, shift);
   assert(check_bits_sll_dbg(a, res, shift));
-
   return res;
 }
 
 static bool
-shift_is_uint64(BzlaMemMgr *mm, const BzlaBitVector *b, uint64_t *res)
+shift_is_uint64(const BzlaBitVector *b, uint64_t *res)
 {
-  assert(mm);
   assert(b);
   assert(res);
 
-  uint64_t zeroes;
-  BzlaBitVector *shift;
-
-  if (b->width <= 64)
-  {
-    *res = bzla_bv_to_uint64(b);
-    return true;
-  }
-
-  zeroes = bzla_bv_get_num_leading_zeros(b);
-  if (zeroes < b->width - 64) return false;
-
-  shift =
-      bzla_bv_slice(mm, b, zeroes < b->width ? b->width - 1 - zeroes : 0, 0);
-  assert(shift->width <= 64);
-  *res = bzla_bv_to_uint64(shift);
-  bzla_bv_free(mm, shift);
+  if (b->width > 64 && mpz_sizeinbase(b->val, 2) > 64) return false;
+  *res = mpz_get_ui(b->val);
   return true;
 }
 
@@ -1315,13 +1291,10 @@ bzla_bv_sll(BzlaMemMgr *mm, const BzlaBitVector *a, const BzlaBitVector *b)
   assert(b);
   assert(a->width == b->width);
 
-  uint64_t ushift;
-
-  if (shift_is_uint64(mm, b, &ushift))
-  {
-    return bzla_bv_sll_uint64(mm, a, ushift);
-  }
-  return bzla_bv_new(mm, a->width);
+  BzlaBitVector *res;
+  res = bzla_bv_new(mm, a->width);
+  bzla_bv_sll_into(res, a, b);
+  return res;
 }
 
 BzlaBitVector *
@@ -1333,18 +1306,8 @@ bzla_bv_sra(BzlaMemMgr *mm, const BzlaBitVector *a, const BzlaBitVector *b)
   assert(a->width == b->width);
 
   BzlaBitVector *res;
-  if (bzla_bv_get_bit(a, a->width - 1))
-  {
-    BzlaBitVector *not_a       = bzla_bv_not(mm, a);
-    BzlaBitVector *not_a_srl_b = bzla_bv_srl(mm, not_a, b);
-    res                        = bzla_bv_not(mm, not_a_srl_b);
-    bzla_bv_free(mm, not_a);
-    bzla_bv_free(mm, not_a_srl_b);
-  }
-  else
-  {
-    res = bzla_bv_srl(mm, a, b);
-  }
+  res = bzla_bv_new(mm, a->width);
+  bzla_bv_sra_into(res, a, b);
   return res;
 }
 
@@ -1355,11 +1318,8 @@ bzla_bv_srl_uint64(BzlaMemMgr *mm, const BzlaBitVector *a, uint64_t shift)
   assert(a);
 
   BzlaBitVector *res;
-
   res = bzla_bv_new(mm, a->width);
-  if (shift >= a->width) return res;
-  mpz_fdiv_q_2exp(res->val, a->val, shift);
-
+  bzla_bv_srl_uint64_into(res, a, shift);
   return res;
 }
 
@@ -1371,13 +1331,10 @@ bzla_bv_srl(BzlaMemMgr *mm, const BzlaBitVector *a, const BzlaBitVector *b)
   assert(b);
   assert(a->width == b->width);
 
-  uint64_t ushift;
-
-  if (shift_is_uint64(mm, b, &ushift))
-  {
-    return bzla_bv_srl_uint64(mm, a, ushift);
-  }
-  return bzla_bv_new(mm, a->width);
+  BzlaBitVector *res;
+  res = bzla_bv_new(mm, a->width);
+  bzla_bv_srl_into(res, a, b);
+  return res;
 }
 
 BzlaBitVector *
@@ -1389,12 +1346,8 @@ bzla_bv_mul(BzlaMemMgr *mm, const BzlaBitVector *a, const BzlaBitVector *b)
   assert(a->width == b->width);
 
   BzlaBitVector *res;
-  uint32_t bw = a->width;
-
-  res = bzla_bv_new(mm, bw);
-  mpz_mul(res->val, a->val, b->val);
-  mpz_fdiv_r_2exp(res->val, res->val, bw);
-
+  res = bzla_bv_new(mm, a->width);
+  bzla_bv_mul_into(res, a, b);
   return res;
 }
 
@@ -1410,21 +1363,9 @@ bzla_bv_udiv_urem(BzlaMemMgr *mm,
   assert(b);
   assert(a->width == b->width);
 
-  uint32_t bw = a->width;
-
-  if (bzla_bv_is_zero(b))
-  {
-    *q = bzla_bv_ones(mm, bw);
-    *r = bzla_bv_copy(mm, a);
-  }
-  else
-  {
-    *q = bzla_bv_new(mm, bw);
-    *r = bzla_bv_new(mm, bw);
-    mpz_fdiv_qr((*q)->val, (*r)->val, a->val, b->val);
-    mpz_fdiv_r_2exp((*q)->val, (*q)->val, bw);
-    mpz_fdiv_r_2exp((*r)->val, (*r)->val, bw);
-  }
+  *q = bzla_bv_new(mm, a->width);
+  *r = bzla_bv_new(mm, a->width);
+  bzla_bv_udiv_urem_into(*q, *r, a, b);
 }
 
 BzlaBitVector *
@@ -1436,13 +1377,8 @@ bzla_bv_udiv(BzlaMemMgr *mm, const BzlaBitVector *a, const BzlaBitVector *b)
   assert(a->width == b->width);
 
   BzlaBitVector *res;
-  uint32_t bw = a->width;
-
-  if (bzla_bv_is_zero(b)) return bzla_bv_ones(mm, bw);
-  res = bzla_bv_new(mm, bw);
-  mpz_fdiv_q(res->val, a->val, b->val);
-  mpz_fdiv_r_2exp(res->val, res->val, bw);
-
+  res = bzla_bv_new(mm, a->width);
+  bzla_bv_udiv_into(res, a, b);
   return res;
 }
 
@@ -1455,13 +1391,8 @@ bzla_bv_urem(BzlaMemMgr *mm, const BzlaBitVector *a, const BzlaBitVector *b)
   assert(a->width == b->width);
 
   BzlaBitVector *res;
-  uint32_t bw = a->width;
-
-  if (bzla_bv_is_zero(b)) return bzla_bv_copy(mm, a);
-  res = bzla_bv_new(mm, bw);
-  mpz_fdiv_r(res->val, a->val, b->val);
-  mpz_fdiv_r_2exp(res->val, res->val, bw);
-
+  res = bzla_bv_new(mm, a->width);
+  bzla_bv_urem_into(res, a, b);
   return res;
 }
 
@@ -1567,13 +1498,8 @@ bzla_bv_concat(BzlaMemMgr *mm, const BzlaBitVector *a, const BzlaBitVector *b)
   assert(b);
 
   BzlaBitVector *res;
-  uint32_t bw = a->width + b->width;
-
-  res = bzla_bv_new(mm, bw);
-  mpz_mul_2exp(res->val, a->val, b->width);
-  mpz_add(res->val, res->val, b->val);
-  mpz_fdiv_r_2exp(res->val, res->val, bw);
-
+  res = bzla_bv_new(mm, a->width + b->width);
+  bzla_bv_concat_into(res, a, b);
   return res;
 }
 
@@ -1589,81 +1515,553 @@ bzla_bv_slice(BzlaMemMgr *mm,
   assert(upper >= lower);
 
   BzlaBitVector *res;
-  uint32_t bw = upper - lower + 1;
+  res = bzla_bv_new(mm, upper - lower + 1);
+  bzla_bv_slice_into(res, bv, upper, lower);
+  return res;
+}
 
-  res = bzla_bv_new(mm, bw);
-  mpz_fdiv_r_2exp(res->val, bv->val, upper + 1);
-  mpz_fdiv_q_2exp(res->val, res->val, lower);
+BzlaBitVector *
+bzla_bv_sext(BzlaMemMgr *mm, const BzlaBitVector *bv, uint32_t len)
+{
+  assert(mm);
+  assert(bv);
 
+  BzlaBitVector *res;
+  res = bzla_bv_new(mm, bv->width + len);
+  bzla_bv_sext_into(res, bv, len);
   return res;
 }
 
 BzlaBitVector *
-bzla_bv_sext(BzlaMemMgr *mm, const BzlaBitVector *bv, uint32_t len)
+bzla_bv_uext(BzlaMemMgr *mm, const BzlaBitVector *bv, uint32_t len)
 {
   assert(mm);
   assert(bv);
 
   BzlaBitVector *res;
-  uint32_t bw;
+  res = bzla_bv_new(mm, bv->width + len);
+  bzla_bv_uext_into(res, bv, len);
+  return res;
+}
+
+BzlaBitVector *
+bzla_bv_ite(BzlaMemMgr *mm,
+            const BzlaBitVector *c,
+            const BzlaBitVector *t,
+            const BzlaBitVector *e)
+{
+  assert(c);
+  assert(t);
+  assert(e);
+  assert(t->width == e->width);
+
+  return bzla_bv_is_one(c) ? bzla_bv_copy(mm, t) : bzla_bv_copy(mm, e);
+}
+
+/*------------------------------------------------------------------------*/
+
+void
+bzla_bv_set(BzlaBitVector *res, const BzlaBitVector *bv)
+{
+  assert(res);
+  assert(bv);
+  assert(res->width == bv->width);
+  mpz_set(res->val, bv->val);
+}
+
+void
+bzla_bv_set_zero(BzlaBitVector *res)
+{
+  assert(res);
+  mpz_set_ui(res->val, 0);
+}
+
+void
+bzla_bv_set_one(BzlaBitVector *res)
+{
+  assert(res);
+  mpz_set_ui(res->val, 1);
+}
+
+void
+bzla_bv_set_ones(BzlaBitVector *res)
+{
+  assert(res);
+  mpz_set_ui(res->val, 1);
+  mpz_mul_2exp(res->val, res->val, res->width);
+  mpz_sub_ui(res->val, res->val, 1);
+}
+
+void
+bzla_bv_set_min_signed(BzlaBitVector *res)
+{
+  assert(res);
+  mpz_set_ui(res->val, 0);
+  mpz_setbit(res->val, res->width - 1);
+}
+
+void
+bzla_bv_set_max_signed(BzlaBitVector *res)
+{
+  assert(res);
+  bzla_bv_set_ones(res);
+  mpz_clrbit(res->val, res->width - 1);
+}
+
+void
+bzla_bv_set_uint64(BzlaBitVector *res, uint64_t value)
+{
+  assert(res);
+  mpz_set_ui(res->val, value);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
+}
+
+void
+bzla_bv_set_random(BzlaBitVector *res, BzlaRNG *rng)
+{
+  assert(res);
+  assert(rng);
+  mpz_urandomb(res->val,
+               *((gmp_randstate_t *) bzla_rng_get_gmp_state(rng)),
+               res->width);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
+}
+
+void
+bzla_bv_set_random_range(BzlaBitVector *res,
+                         BzlaRNG *rng,
+                         const BzlaBitVector *from,
+                         const BzlaBitVector *to)
+{
+  assert(res);
+  assert(rng);
+  assert(res != from);
+  assert(res->width == from->width);
+  assert(from->width == to->width);
+  assert(bzla_bv_compare(from, to) <= 0);
+
+  /* mpz_urandomm supports overlapping operands */
+  mpz_sub(res->val, to->val, from->val);
+  mpz_add_ui(res->val, res->val, 1);
+  mpz_urandomm(
+      res->val, *((gmp_randstate_t *) bzla_rng_get_gmp_state(rng)), res->val);
+  mpz_add(res->val, res->val, from->val);
+}
+
+void
+bzla_bv_neg_into(BzlaBitVector *res, const BzlaBitVector *bv)
+{
+  assert(res);
+  assert(bv);
+  assert(res->width == bv->width);
+
+  mpz_com(res->val, bv->val);
+  mpz_add_ui(res->val, res->val, 1);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
+}
+
+void
+bzla_bv_not_into(BzlaBitVector *res, const BzlaBitVector *bv)
+{
+  assert(res);
+  assert(bv);
+  assert(res->width == bv->width);
+
+  mpz_com(res->val, bv->val);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
+}
+
+void
+bzla_bv_inc_into(BzlaBitVector *res, const BzlaBitVector *bv)
+{
+  assert(res);
+  assert(bv);
+  assert(res->width == bv->width);
+
+  mpz_add_ui(res->val, bv->val, 1);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
+}
+
+void
+bzla_bv_dec_into(BzlaBitVector *res, const BzlaBitVector *bv)
+{
+  assert(res);
+  assert(bv);
+  assert(res->width == bv->width);
+
+  mpz_sub_ui(res->val, bv->val, 1);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
+}
+
+void
+bzla_bv_add_into(BzlaBitVector *res,
+                 const BzlaBitVector *a,
+                 const BzlaBitVector *b)
+{
+  assert(res);
+  assert(a);
+  assert(b);
+  assert(a->width == b->width);
+  assert(res->width == a->width);
+
+  mpz_add(res->val, a->val, b->val);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
+}
+
+void
+bzla_bv_sub_into(BzlaBitVector *res,
+                 const BzlaBitVector *a,
+                 const BzlaBitVector *b)
+{
+  assert(res);
+  assert(a);
+  assert(b);
+  assert(a->width == b->width);
+  assert(res->width == a->width);
+
+  mpz_sub(res->val, a->val, b->val);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
+}
+
+void
+bzla_bv_and_into(BzlaBitVector *res,
+                 const BzlaBitVector *a,
+                 const BzlaBitVector *b)
+{
+  assert(res);
+  assert(a);
+  assert(b);
+  assert(a->width == b->width);
+  assert(res->width == a->width);
+
+  mpz_and(res->val, a->val, b->val);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
+}
 
-  if (len == 0)
+void
+bzla_bv_or_into(BzlaBitVector *res,
+                const BzlaBitVector *a,
+                const BzlaBitVector *b)
+{
+  assert(res);
+  assert(a);
+  assert(b);
+  assert(a->width == b->width);
+  assert(res->width == a->width);
+
+  mpz_ior(res->val, a->val, b->val);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
+}
+
+void
+bzla_bv_xor_into(BzlaBitVector *res,
+                 const BzlaBitVector *a,
+                 const BzlaBitVector *b)
+{
+  assert(res);
+  assert(a);
+  assert(b);
+  assert(a->width == b->width);
+  assert(res->width == a->width);
+
+  mpz_xor(res->val, a->val, b->val);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
+}
+
+void
+bzla_bv_mul_into(BzlaBitVector *res,
+                 const BzlaBitVector *a,
+                 const BzlaBitVector *b)
+{
+  assert(res);
+  assert(a);
+  assert(b);
+  assert(a->width == b->width);
+  assert(res->width == a->width);
+
+  mpz_mul(res->val, a->val, b->val);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
+}
+
+void
+bzla_bv_udiv_into(BzlaBitVector *res,
+                  const BzlaBitVector *a,
+                  const BzlaBitVector *b)
+{
+  assert(res);
+  assert(a);
+  assert(b);
+  assert(a->width == b->width);
+  assert(res->width == a->width);
+
+  if (bzla_bv_is_zero(b))
   {
-    return bzla_bv_copy(mm, bv);
+    bzla_bv_set_ones(res);
+    return;
   }
+  mpz_fdiv_q(res->val, a->val, b->val);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
+}
 
-  bw = bv->width;
+void
+bzla_bv_urem_into(BzlaBitVector *res,
+                  const BzlaBitVector *a,
+                  const BzlaBitVector *b)
+{
+  assert(res);
+  assert(a);
+  assert(b);
+  assert(a->width == b->width);
+  assert(res->width == a->width);
 
-  if (bzla_bv_get_bit(bv, bw - 1))
+  if (bzla_bv_is_zero(b))
   {
-    size_t i, n;
-    res = bzla_bv_copy(mm, bv);
-    res->width += len;
-    for (i = bw, n = bw + len; i < n; i++) mpz_setbit(res->val, i);
+    bzla_bv_set(res, a);
+    return;
+  }
+  mpz_fdiv_r(res->val, a->val, b->val);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
+}
+
+void
+bzla_bv_udiv_urem_into(BzlaBitVector *q,
+                       BzlaBitVector *r,
+                       const BzlaBitVector *a,
+                       const BzlaBitVector *b)
+{
+  assert(q);
+  assert(r);
+  assert(q != r);
+  assert(a);
+  assert(b);
+  assert(a->width == b->width);
+  assert(q->width == a->width);
+  assert(r->width == a->width);
+
+  if (bzla_bv_is_zero(b))
+  {
+    /* set 'r' first, 'q' may be 'a' */
+    bzla_bv_set(r, a);
+    bzla_bv_set_ones(q);
+    return;
+  }
+  mpz_fdiv_qr(q->val, r->val, a->val, b->val);
+  mpz_fdiv_r_2exp(q->val, q->val, q->width);
+  mpz_fdiv_r_2exp(r->val, r->val, r->width);
+}
+
+void
+bzla_bv_sll_uint64_into(BzlaBitVector *res,
+                        const BzlaBitVector *a,
+                        uint64_t shift)
+{
+  assert(res);
+  assert(a);
+  assert(res->width == a->width);
+
+  if (shift >= res->width)
+  {
+    bzla_bv_set_zero(res);
+    return;
+  }
+  mpz_mul_2exp(res->val, a->val, shift);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
+}
+
+void
+bzla_bv_sll_into(BzlaBitVector *res,
+                 const BzlaBitVector *a,
+                 const BzlaBitVector *b)
+{
+  assert(res);
+  assert(a);
+  assert(b);
+  assert(a->width == b->width);
+
+  uint64_t ushift;
+
+  if (!shift_is_uint64(b, &ushift)) ushift = a->width;
+  bzla_bv_sll_uint64_into(res, a, ushift);
+}
+
+void
+bzla_bv_srl_uint64_into(BzlaBitVector *res,
+                        const BzlaBitVector *a,
+                        uint64_t shift)
+{
+  assert(res);
+  assert(a);
+  assert(res->width == a->width);
+
+  if (shift >= res->width)
+  {
+    bzla_bv_set_zero(res);
+    return;
+  }
+  mpz_fdiv_q_2exp(res->val, a->val, shift);
+}
+
+void
+bzla_bv_srl_into(BzlaBitVector *res,
+                 const BzlaBitVector *a,
+                 const BzlaBitVector *b)
+{
+  assert(res);
+  assert(a);
+  assert(b);
+  assert(a->width == b->width);
+
+  uint64_t ushift;
+
+  if (!shift_is_uint64(b, &ushift)) ushift = a->width;
+  bzla_bv_srl_uint64_into(res, a, ushift);
+}
+
+void
+bzla_bv_sra_into(BzlaBitVector *res,
+                 const BzlaBitVector *a,
+                 const BzlaBitVector *b)
+{
+  assert(res);
+  assert(a);
+  assert(b);
+  assert(a->width == b->width);
+
+  uint64_t ushift;
+
+  /* read all of 'b' before writing to 'res', which may be 'b' */
+  if (!shift_is_uint64(b, &ushift)) ushift = a->width;
+  if (bzla_bv_get_bit(a, a->width - 1))
+  {
+    bzla_bv_not_into(res, a);
+    bzla_bv_srl_uint64_into(res, res, ushift);
+    bzla_bv_not_into(res, res);
   }
   else
   {
-    res = bzla_bv_uext(mm, bv, len);
+    bzla_bv_srl_uint64_into(res, a, ushift);
   }
+}
 
-  return res;
+void
+bzla_bv_concat_into(BzlaBitVector *res,
+                    const BzlaBitVector *a,
+                    const BzlaBitVector *b)
+{
+  assert(res);
+  assert(a);
+  assert(b);
+  assert(res->width == a->width + b->width);
+
+  mpz_mul_2exp(res->val, a->val, b->width);
+  mpz_add(res->val, res->val, b->val);
+  mpz_fdiv_r_2exp(res->val, res->val, res->width);
 }
 
-BzlaBitVector *
-bzla_bv_uext(BzlaMemMgr *mm, const BzlaBitVector *bv, uint32_t len)
+void
+bzla_bv_slice_into(BzlaBitVector *res,
+                   const BzlaBitVector *bv,
+                   uint32_t upper,
+                   uint32_t lower)
 {
-  assert(mm);
+  assert(res);
   assert(bv);
+  assert(bv->width > upper);
+  assert(upper >= lower);
+  assert(res->width == upper - lower + 1);
 
-  BzlaBitVector *res;
-  uint32_t bw;
+  mpz_fdiv_r_2exp(res->val, bv->val, upper + 1);
+  mpz_fdiv_q_2exp(res->val, res->val, lower);
+}
+
+void
+bzla_bv_uext_into(BzlaBitVector *res, const BzlaBitVector *bv, uint32_t len)
+{
+  assert(res);
+  assert(bv);
+  assert(res->width == bv->width + len);
+  (void) len;
+
+  mpz_set(res->val, bv->val);
+}
+
+void
+bzla_bv_sext_into(BzlaBitVector *res, const BzlaBitVector *bv, uint32_t len)
+{
+  assert(res);
+  assert(bv);
+  assert(res->width == bv->width + len);
+
+  size_t i, n;
+  uint32_t bw = bv->width;
+  bool sign   = bzla_bv_get_bit(bv, bw - 1);
 
-  if (len == 0)
+  mpz_set(res->val, bv->val);
+  if (sign)
   {
-    return bzla_bv_copy(mm, bv);
+    for (i = bw, n = bw + len; i < n; i++) mpz_setbit(res->val, i);
   }
+}
 
-  bw  = bv->width + len;
-  res = bzla_bv_new(mm, bw);
-  mpz_set(res->val, bv->val);
+/*------------------------------------------------------------------------*/
 
-  return res;
+void
+bzla_bv_scratch_init(BzlaMemMgr *mm, BzlaBitVectorScratch *scratch)
+{
+  assert(mm);
+  assert(scratch);
+  BZLA_INIT_STACK(mm, scratch->bvs);
+  scratch->top = 0;
+}
+
+void
+bzla_bv_scratch_delete(BzlaBitVectorScratch *scratch)
+{
+  assert(scratch);
+  while (!BZLA_EMPTY_STACK(scratch->bvs))
+  {
+    bzla_bv_free(scratch->bvs.mm, BZLA_POP_STACK(scratch->bvs));
+  }
+  BZLA_RELEASE_STACK(scratch->bvs);
+  scratch->top = 0;
 }
 
 BzlaBitVector *
-bzla_bv_ite(BzlaMemMgr *mm,
-            const BzlaBitVector *c,
-            const BzlaBitVector *t,
-            const BzlaBitVector *e)
+bzla_bv_scratch_get(BzlaBitVectorScratch *scratch, uint32_t bw)
 {
-  assert(c);
-  assert(t);
-  assert(e);
-  assert(t->width == e->width);
+  assert(scratch);
+  assert(bw > 0);
 
-  return bzla_bv_is_one(c) ? bzla_bv_copy(mm, t) : bzla_bv_copy(mm, e);
+  BzlaBitVector *res;
+
+  if (scratch->top == BZLA_COUNT_STACK(scratch->bvs))
+  {
+    BZLA_PUSH_STACK(scratch->bvs, bzla_bv_new(scratch->bvs.mm, bw));
+  }
+  res        = BZLA_PEEK_STACK(scratch->bvs, scratch->top);
+  res->width = bw;
+  mpz_set_ui(res->val, 0);
+  scratch->top += 1;
+  return res;
 }
 
+uint32_t
+bzla_bv_scratch_mark(const BzlaBitVectorScratch *scratch)
+{
+  assert(scratch);
+  return scratch->top;
+}
+
+void
+bzla_bv_scratch_release(BzlaBitVectorScratch *scratch, uint32_t mark)
+{
+  assert(scratch);
+  assert(mark <= scratch->top);
+  scratch->top = mark;
+}
+
+/*------------------------------------------------------------------------*/
+
 BzlaBitVector *
 bzla_bv_flipped_bit(BzlaMemMgr *mm, const BzlaBitVector *bv, uint32_t pos)
 {
@@ -1732,6 +2130,13 @@ bzla_bv_is_umulo(BzlaMemMgr *mm, const BzlaBitVector *a, const BzlaBitVector *b)
   if (a->width > 1)
   {
     (void) mm;
+    size_t size;
+    if (mpz_sgn(a->val) == 0 || mpz_sgn(b->val) == 0) return false;
+    /* 2^(n-1) <= a < 2^n and 2^(m-1) <= b < 2^m imply
+     * 2^(n+m-2) <= a * b < 2^(n+m), only compute the product if required */
+    size = mpz_sizeinbase(a->val, 2) + mpz_sizeinbase(b->val, 2);
+    if (size <= bw) return false;
+    if (size > bw + 1) return true;
     mpz_t mul;
     mpz_init(mul);
     mpz_mul(mul, a->val, b->val);
@@ -177,6 +177,11 @@ uint32_t bzla_bv_get_num_trailing_zeros(const BzlaBitVector *bv);
 uint32_t bzla_bv_get_num_leading_zeros(const BzlaBitVector *bv);
 /** Return the of count leading ones (starting from MSB). */
 uint32_t bzla_bv_get_num_leading_ones(const BzlaBitVector *bv);
+/** Return the number of bits that differ in 'a' and 'b'. */
+uint32_t bzla_bv_get_num_diff_bits(const BzlaBitVector *a,
+                                   const BzlaBitVector *b);
+/** Return true if all bits set in 'a' are also set in 'b'. */
+bool bzla_bv_is_bits_subset(const BzlaBitVector *a, const BzlaBitVector *b);
 
 /*------------------------------------------------------------------------*/
 
@@ -394,6 +399,167 @@ BzlaBitVector *bzla_bv_sext(BzlaMemMgr *mm,
 
 /*------------------------------------------------------------------------*/
 
+/*
+ * Destination-passing variants of the above operations.
+ *
+ * The result is written into the caller-owned bit-vector 'res', which must
+ * have the bit-width of the result. No bit-vectors are allocated, the memory
+ * of 'res' is reused. Unless noted otherwise, 'res' may be an operand.
+ */
+
+/** Set 'res' to the value of the given bit-vector. */
+void bzla_bv_set(BzlaBitVector *res, const BzlaBitVector *bv);
+/** Set 'res' to 0. */
+void bzla_bv_set_zero(BzlaBitVector *res);
+/** Set 'res' to 1. */
+void bzla_bv_set_one(BzlaBitVector *res);
+/** Set 'res' to ~0. */
+void bzla_bv_set_ones(BzlaBitVector *res);
+/** Set 'res' to the minimum signed value 10...0. */
+void bzla_bv_set_min_signed(BzlaBitVector *res);
+/** Set 'res' to the maximum signed value 01...1. */
+void bzla_bv_set_max_signed(BzlaBitVector *res);
+/** Set 'res' to the given unsigned integer value (truncated to its width). */
+void bzla_bv_set_uint64(BzlaBitVector *res, uint64_t value);
+/** Set 'res' to a random value. */
+void bzla_bv_set_random(BzlaBitVector *res, BzlaRNG *rng);
+/**
+ * Set 'res' to a random value within given range (inclusive).
+ * Note: 'res' must not be 'from'.
+ */
+void bzla_bv_set_random_range(BzlaBitVector *res,
+                              BzlaRNG *rng,
+                              const BzlaBitVector *from,
+                              const BzlaBitVector *to);
+
+/** Compute the negation (two's complement) of 'bv' into 'res'. */
+void bzla_bv_neg_into(BzlaBitVector *res, const BzlaBitVector *bv);
+/** Compute the bit-wise negation of 'bv' into 'res'. */
+void bzla_bv_not_into(BzlaBitVector *res, const BzlaBitVector *bv);
+/** Compute the increment (+1) of 'bv' into 'res'. */
+void bzla_bv_inc_into(BzlaBitVector *res, const BzlaBitVector *bv);
+/** Compute the decrement (-1) of 'bv' into 'res'. */
+void bzla_bv_dec_into(BzlaBitVector *res, const BzlaBitVector *bv);
+
+/** Compute the addition of 'a' and 'b' into 'res'. */
+void bzla_bv_add_into(BzlaBitVector *res,
+                      const BzlaBitVector *a,
+                      const BzlaBitVector *b);
+/** Compute the subtraction of 'a' and 'b' into 'res'. */
+void bzla_bv_sub_into(BzlaBitVector *res,
+                      const BzlaBitVector *a,
+                      const BzlaBitVector *b);
+/** Compute the bit-wise and of 'a' and 'b' into 'res'. */
+void bzla_bv_and_into(BzlaBitVector *res,
+                      const BzlaBitVector *a,
+                      const BzlaBitVector *b);
+/** Compute the bit-wise or of 'a' and 'b' into 'res'. */
+void bzla_bv_or_into(BzlaBitVector *res,
+                     const BzlaBitVector *a,
+                     const BzlaBitVector *b);
+/** Compute the bit-wise xor of 'a' and 'b' into 'res'. */
+void bzla_bv_xor_into(BzlaBitVector *res,
+                      const BzlaBitVector *a,
+                      const BzlaBitVector *b);
+/** Compute the multiplication of 'a' and 'b' into 'res'. */
+void bzla_bv_mul_into(BzlaBitVector *res,
+                      const BzlaBitVector *a,
+                      const BzlaBitVector *b);
+/** Compute the unsigned division of 'a' and 'b' into 'res'. */
+void bzla_bv_udiv_into(BzlaBitVector *res,
+                       const BzlaBitVector *a,
+                       const BzlaBitVector *b);
+/** Compute the unsigned remainder of 'a' and 'b' into 'res'. */
+void bzla_bv_urem_into(BzlaBitVector *res,
+                       const BzlaBitVector *a,
+                       const BzlaBitVector *b);
+/**
+ * Compute the unsigned division and remainder of 'a' and 'b' into 'q' and
+ * 'r'. Note: 'q' and 'r' must be different bit-vectors.
+ */
+void bzla_bv_udiv_urem_into(BzlaBitVector *q,
+                            BzlaBitVector *r,
+                            const BzlaBitVector *a,
+                            const BzlaBitVector *b);
+
+/** Compute the logical shift left of 'a' by 'shift' into 'res'. */
+void bzla_bv_sll_uint64_into(BzlaBitVector *res,
+                             const BzlaBitVector *a,
+                             uint64_t shift);
+/** Compute the logical shift left of 'a' by 'b' into 'res'. */
+void bzla_bv_sll_into(BzlaBitVector *res,
+                      const BzlaBitVector *a,
+                      const BzlaBitVector *b);
+/** Compute the logical shift right of 'a' by 'shift' into 'res'. */
+void bzla_bv_srl_uint64_into(BzlaBitVector *res,
+                             const BzlaBitVector *a,
+                             uint64_t shift);
+/** Compute the logical shift right of 'a' by 'b' into 'res'. */
+void bzla_bv_srl_into(BzlaBitVector *res,
+                      const BzlaBitVector *a,
+                      const BzlaBitVector *b);
+/** Compute the arithmetic shift right of 'a' by 'b' into 'res'. */
+void bzla_bv_sra_into(BzlaBitVector *res,
+                      const BzlaBitVector *a,
+                      const BzlaBitVector *b);
+
+/** Compute the concatenation of 'a' and 'b' into 'res'. */
+void bzla_bv_concat_into(BzlaBitVector *res,
+                         const BzlaBitVector *a,
+                         const BzlaBitVector *b);
+/** Compute the slice from bit index upper to lower of 'bv' into 'res'. */
+void bzla_bv_slice_into(BzlaBitVector *res,
+                        const BzlaBitVector *bv,
+                        uint32_t upper,
+                        uint32_t lower);
+/** Compute the unsigned/zero extension of 'bv' by 'len' bits into 'res'. */
+void bzla_bv_uext_into(BzlaBitVector *res,
+                       const BzlaBitVector *bv,
+                       uint32_t len);
+/** Compute the signed extension of 'bv' by 'len' bits into 'res'. */
+void bzla_bv_sext_into(BzlaBitVector *res,
+                       const BzlaBitVector *bv,
+                       uint32_t len);
+
+/*------------------------------------------------------------------------*/
+
+/**
+ * A stack of reusable bit-vectors for temporary results of the
+ * destination-passing operations above. Bit-vectors are never freed while the
+ * scratch stack is alive, only their memory is reused.
+ *
+ * Usage:
+ *   mark = bzla_bv_scratch_mark(scratch);
+ *   tmp  = bzla_bv_scratch_get(scratch, bw);
+ *   ...
+ *   bzla_bv_scratch_release(scratch, mark);
+ */
+struct BzlaBitVectorScratch
+{
+  BzlaBitVectorPtrStack bvs;
+  uint32_t top; /* number of bit-vectors in use */
+};
+
+typedef struct BzlaBitVectorScratch BzlaBitVectorScratch;
+
+/** Initialize an empty scratch stack. */
+void bzla_bv_scratch_init(BzlaMemMgr *mm, BzlaBitVectorScratch *scratch);
+/** Free all bit-vectors of the scratch stack. */
+void bzla_bv_scratch_delete(BzlaBitVectorScratch *scratch);
+
+/**
+ * Get a bit-vector of given bit-width, initialized to zero. It is valid until
+ * the scratch stack is released to a mark obtained before this call.
+ */
+BzlaBitVector *bzla_bv_scratch_get(BzlaBitVectorScratch *scratch, uint32_t bw);
+
+/** Get the current mark of the scratch stack. */
+uint32_t bzla_bv_scratch_mark(const BzlaBitVectorScratch *scratch);
+/** Release all bit-vectors obtained after given mark for reuse. */
+void bzla_bv_scratch_release(BzlaBitVectorScratch *scratch, uint32_t mark);
+
+/*------------------------------------------------------------------------*/
+
 /**
  * Create the unsigned division and remainder of bit-vectors 'a' and 'b'.
  * The result of the division is stored in 'q', and the result of the remainder
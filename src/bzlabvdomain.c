@@ -207,21 +207,15 @@ bzla_bvdomain_is_valid(BzlaMemMgr *mm, const BzlaBvDomain *d)
 bool
 bzla_bvdomain_is_fixed(BzlaMemMgr *mm, const BzlaBvDomain *d)
 {
-  BzlaBitVector *equal = bzla_bv_eq(mm, d->lo, d->hi);
-  bool res             = bzla_bv_is_true(equal);
-  bzla_bv_free(mm, equal);
-  return res;
+  (void) mm;
+  return bzla_bv_compare(d->lo, d->hi) == 0;
 }
 
 bool
 bzla_bvdomain_has_fixed_bits(BzlaMemMgr *mm, const BzlaBvDomain *d)
 {
-  BzlaBitVector *xnor  = bzla_bv_xnor(mm, d->lo, d->hi);
-  BzlaBitVector *redor = bzla_bv_redor(mm, xnor);
-  bool res             = bzla_bv_is_true(redor);
-  bzla_bv_free(mm, xnor);
-  bzla_bv_free(mm, redor);
-  return res;
+  (void) mm;
+  return bzla_bv_get_num_diff_bits(d->lo, d->hi) < bzla_bv_get_width(d->lo);
 }
 
 void
@@ -264,14 +258,10 @@ bzla_bvdomain_check_fixed_bits(BzlaMemMgr *mm,
                                const BzlaBvDomain *d,
                                const BzlaBitVector *bv)
 {
-  bool res;
-  BzlaBitVector *and, * or ;
-  and = bzla_bv_and(mm, bv, d->hi);
-  or  = bzla_bv_or(mm, and, d->lo);
-  res = bzla_bv_compare(or, bv) == 0;
-  bzla_bv_free(mm, or);
-  bzla_bv_free(mm, and);
-  return res;
+  (void) mm;
+  /* ((bv & hi) | lo) = bv */
+  return bzla_bv_is_bits_subset(d->lo, bv)
+         && bzla_bv_is_bits_subset(bv, d->hi);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -0,0 +1,275 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include "bzlabwreduce.h"
+
+#include "bzlaclone.h"
+#include "bzlacore.h"
+#include "bzlaexp.h"
+#include "bzlalog.h"
+#include "bzlamodel.h"
+#include "bzlaopt.h"
+#include "utils/bzlahashint.h"
+#include "utils/bzlautil.h"
+
+/*------------------------------------------------------------------------*/
+
+/* Collect roots (constraints and assumptions) and the bit-vector variables
+ * below. Returns false if the formula contains functions. */
+static bool
+collect_roots_and_vars(Bzla *bzla,
+                       BzlaNodePtrStack *roots,
+                       BzlaNodePtrStack *vars,
+                       uint32_t *max_width)
+{
+  assert(bzla);
+  assert(roots);
+  assert(vars);
+  assert(max_width);
+
+  bool res = true;
+  uint32_t i, width;
+  BzlaNode *cur;
+  BzlaNodePtrStack visit;
+  BzlaPtrHashTableIterator it;
+  BzlaIntHashTable *cache;
+  BzlaMemMgr *mm;
+
+  mm    = bzla->mm;
+  cache = bzla_hashint_table_new(mm);
+  BZLA_INIT_STACK(mm, visit);
+
+  *max_width = 0;
+
+  bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->assumptions);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    cur = bzla_iter_hashptr_next(&it);
+    if (bzla_node_real_addr(cur)->lambda_below
+        || bzla_node_real_addr(cur)->apply_below)
+    {
+      res = false;
+      break;
+    }
+    BZLA_PUSH_STACK(*roots, cur);
+    BZLA_PUSH_STACK(visit, cur);
+  }
+
+  while (res && !BZLA_EMPTY_STACK(visit))
+  {
+    cur = bzla_node_real_addr(BZLA_POP_STACK(visit));
+
+    if (bzla_hashint_table_contains(cache, cur->id)) continue;
+    bzla_hashint_table_add(cache, cur->id);
+
+    if (bzla_node_is_bv_var(cur))
+    {
+      BZLA_PUSH_STACK(*vars, cur);
+      width = bzla_node_bv_get_width(bzla, cur);
+      if (width > *max_width) *max_width = width;
+    }
+    else if (!bzla_node_is_bv(bzla, cur) || bzla_node_is_param(cur)
+             || bzla_node_is_quantifier(cur) || cur->parameterized)
+    {
+      res = false;
+      break;
+    }
+
+    for (i = 0; i < cur->arity; i++) BZLA_PUSH_STACK(visit, cur->e[i]);
+  }
+
+  BZLA_RELEASE_STACK(visit);
+  bzla_hashint_table_delete(cache);
+  return res;
+}
+
+/* Solve the abstraction of the formula in 'bzla' where all variables wider
+ * than 'k' are restricted to their 'k' least significant bits. On SAT,
+ * 'bv_model' holds the (lifted) assignments of variables 'vars'. */
+static BzlaSolverResult
+solve_reduced(Bzla *bzla,
+              BzlaNodePtrStack *vars,
+              uint32_t k,
+              BzlaIntHashTable *bv_model)
+{
+  assert(bzla);
+  assert(vars);
+  assert(k > 0);
+  assert(bv_model);
+
+  uint32_t i, width, nreduced;
+  BzlaSolverResult res;
+  BzlaNode *var, *cvar, *fresh, *ext, *eq;
+  BzlaNodePtrStack cvars;
+  BzlaSortId sort;
+  const BzlaBitVector *bv;
+  Bzla *clone;
+
+  clone = bzla_clone_formula(bzla);
+  BZLA_INIT_STACK(bzla->mm, cvars);
+  bzla_opt_set(clone, BZLA_OPT_BW_REDUCE, 0);
+  bzla_opt_set(clone, BZLA_OPT_PRODUCE_MODELS, 1);
+#ifndef NDEBUG
+  bzla_opt_set(clone, BZLA_OPT_CHECK_MODEL, 0);
+#endif
+  bzla_set_msg_prefix(clone, "bwr");
+
+  /* Restrict variables via definitional equalities var = sext(fresh), which
+   * are eliminated via variable substitution as with slice elimination. */
+  nreduced = 0;
+  for (i = 0; i < BZLA_COUNT_STACK(*vars); i++)
+  {
+    var = BZLA_PEEK_STACK(*vars, i);
+
+    /* node ids are preserved when cloning, keep a reference since the
+     * variable may get substituted while solving the clone */
+    cvar = BZLA_PEEK_STACK(clone->nodes_id_table, var->id);
+    assert(cvar);
+    assert(bzla_node_is_bv_var(cvar));
+    BZLA_PUSH_STACK(cvars, bzla_node_copy(clone, cvar));
+
+    width = bzla_node_bv_get_width(bzla, var);
+    if (width <= k) continue;
+
+    sort  = bzla_sort_bv(clone, k);
+    fresh = bzla_exp_var(clone, sort, 0);
+    ext   = bzla_exp_bv_sext(clone, fresh, width - k);
+    eq    = bzla_exp_eq(clone, cvar, ext);
+    bzla_assert_exp(clone, eq);
+    bzla_node_release(clone, eq);
+    bzla_node_release(clone, ext);
+    bzla_node_release(clone, fresh);
+    bzla_sort_release(clone, sort);
+    nreduced++;
+  }
+
+  BZLA_MSG(bzla->msg,
+           1,
+           "solve bit-width reduced abstraction with %u of %u variables "
+           "restricted to %u bits",
+           nreduced,
+           BZLA_COUNT_STACK(*vars),
+           k);
+
+  res = bzla_check_sat(clone, -1, -1);
+
+  if (res == BZLA_RESULT_SAT)
+  {
+    /* lift model */
+    for (i = 0; i < BZLA_COUNT_STACK(*vars); i++)
+    {
+      var = BZLA_PEEK_STACK(*vars, i);
+      bv  = bzla_model_get_bv(clone, BZLA_PEEK_STACK(cvars, i));
+      bzla_model_add_to_bv(bzla, bv_model, var, bv);
+    }
+  }
+
+  while (!BZLA_EMPTY_STACK(cvars))
+    bzla_node_release(clone, BZLA_POP_STACK(cvars));
+  BZLA_RELEASE_STACK(cvars);
+  bzla_delete(clone);
+  return res;
+}
+
+/* Check lifted model 'bv_model' against the original formula. */
+static bool
+check_model(Bzla *bzla, BzlaNodePtrStack *roots, BzlaIntHashTable *bv_model)
+{
+  assert(bzla);
+  assert(roots);
+  assert(bv_model);
+
+  bool res = true;
+  uint32_t i;
+  BzlaBitVector *bv;
+  BzlaIntHashTable *fun_model;
+
+  /* no functions, fun_model stays empty */
+  fun_model = bzla_hashint_map_new(bzla->mm);
+  for (i = 0; res && i < BZLA_COUNT_STACK(*roots); i++)
+  {
+    bv = bzla_model_recursively_compute_assignment(
+        bzla, bv_model, fun_model, BZLA_PEEK_STACK(*roots, i));
+    res = bzla_bv_is_true(bv);
+    bzla_bv_free(bzla->mm, bv);
+  }
+  bzla_hashint_map_delete(fun_model);
+  return res;
+}
+
+BzlaSolverResult
+bzla_bwreduce_check_sat(Bzla *bzla)
+{
+  assert(bzla);
+  assert(bzla_opt_get(bzla, BZLA_OPT_BW_REDUCE));
+
+  uint32_t k, max_width;
+  double start;
+  BzlaSolverResult res;
+  BzlaNodePtrStack roots, vars;
+  BzlaIntHashTable *bv_model;
+
+  start = bzla_util_time_stamp();
+  res   = BZLA_RESULT_UNKNOWN;
+
+  BZLA_INIT_STACK(bzla->mm, roots);
+  BZLA_INIT_STACK(bzla->mm, vars);
+
+  if (!collect_roots_and_vars(bzla, &roots, &vars, &max_width))
+  {
+    BZLA_MSG(bzla->msg, 1, "bit-width reduction not supported for formula");
+    goto DONE;
+  }
+
+  for (k = bzla_opt_get(bzla, BZLA_OPT_BW_REDUCE); k < max_width; k *= 2)
+  {
+    if (bzla_terminate(bzla)) break;
+
+    bzla->stats.bw_reduce_abstractions++;
+    bv_model = 0;
+    bzla_model_init_bv(bzla, &bv_model);
+    res = solve_reduced(bzla, &vars, k, bv_model);
+
+    if (res == BZLA_RESULT_SAT)
+    {
+      if (check_model(bzla, &roots, bv_model))
+      {
+        BZLA_MSG(bzla->msg,
+                 1,
+                 "bit-width reduced abstraction with %u bits is satisfiable",
+                 k);
+        bzla->stats.bw_reduce_sat++;
+        bzla_model_delete_bv(bzla, &bzla->bv_model);
+        bzla->bv_model = bv_model;
+        break;
+      }
+      /* should not happen, restricting the variables is exact */
+      BZLA_MSG(bzla->msg, 1, "lifted model does not satisfy formula");
+    }
+    bzla_model_delete_bv(bzla, &bv_model);
+    if (res == BZLA_RESULT_UNKNOWN) break;
+    res = BZLA_RESULT_UNKNOWN;
+    /* widen, unless the abstraction would be close to full width */
+    if (k > max_width / 2) break;
+  }
+
+  if (res != BZLA_RESULT_SAT)
+  {
+    BZLA_MSG(bzla->msg, 1, "fall back to solving at full bit-width");
+  }
+
+DONE:
+  BZLA_RELEASE_STACK(roots);
+  BZLA_RELEASE_STACK(vars);
+  bzla->time.bw_reduce += bzla_util_time_stamp() - start;
+  return res;
+}
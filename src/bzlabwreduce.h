@@ -0,0 +1,37 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#ifndef BZLABWREDUCE_H_INCLUDED
+#define BZLABWREDUCE_H_INCLUDED
+
+#include "bzlaslv.h"
+#include "bzlatypes.h"
+
+/*------------------------------------------------------------------------*/
+
+/**
+ * Try to solve the current (QF_BV) formula via bit-width reduced
+ * abstractions, where all bit-vector variables wider than k are restricted
+ * to their k least significant bits (sign-extended to their original width).
+ *
+ * Starting with k = BZLA_OPT_BW_REDUCE, the abstraction is solved on a clone
+ * of the formula. If it is satisfiable, its model is lifted to the original
+ * variables and checked against the original formula via model evaluation.
+ * If the check succeeds, the model is installed as bit-vector model of
+ * 'bzla' and BZLA_RESULT_SAT is returned. Otherwise (unsat abstraction), k
+ * is doubled until the abstraction would not reduce any variable anymore.
+ *
+ * Returns BZLA_RESULT_UNKNOWN if the formula is not supported or no
+ * abstraction was conclusive, in which case the formula must be solved at
+ * full width.
+ */
+BzlaSolverResult bzla_bwreduce_check_sat(Bzla *bzla);
+
+#endif
@@ -303,93 +303,36 @@ chkclone_opts(Bzla *bzla, Bzla *clone)
   assert(bzla);
   assert(clone);
 
-  BzlaOpt *opt, *copt;
+  const char *valstr, *cvalstr;
   BzlaOption o;
 
+  /* option metadata is shared */
   assert(bzla->options);
-  assert(clone->options);
+  assert(bzla->options == clone->options);
+  assert(bzla->str2opt == clone->str2opt);
 
   for (o = bzla_opt_first(bzla); bzla_opt_is_valid(bzla, o);
        o = bzla_opt_next(bzla, o))
   {
-    opt  = &bzla->options[o];
-    copt = &clone->options[o];
-    assert(opt->expert == copt->expert);
     /* Note: auto_cleanup.val = 1 in clone! */
     if (o != BZLA_OPT_AUTO_CLEANUP && o != BZLA_OPT_AUTO_CLEANUP_INTERNAL)
-      assert(opt->val == copt->val);
-    assert(opt->dflt == copt->dflt);
-    assert(opt->min == copt->min);
-    assert(opt->max == copt->max);
-    assert(opt->lng && !strcmp(opt->lng, copt->lng));
-    assert((!opt->shrt && !copt->shrt)
-           || (opt->shrt && !strcmp(opt->shrt, copt->shrt)));
-    assert((!opt->desc && !copt->desc)
-           || (opt->desc && !strcmp(opt->desc, copt->desc)));
-    assert((!opt->valstr && !copt->valstr)
-           || (opt->valstr && !strcmp(opt->valstr, copt->valstr)));
+      assert(bzla_opt_get(bzla, o) == bzla_opt_get(clone, o));
+    valstr  = bzla_opt_get_valstr(bzla, o);
+    cvalstr = bzla_opt_get_valstr(clone, o);
+    assert((!valstr && !cvalstr) || (valstr && !strcmp(valstr, cvalstr)));
   }
 }
 
 /*------------------------------------------------------------------------*/
 
-#define BZLA_CHKCLONE_AIG(field)                  \
-  do                                              \
-  {                                               \
-    assert(real_clone->field == real_aig->field); \
+#define BZLA_CHKCLONE_AIG_STORE(field, n)       \
+  do                                            \
+  {                                             \
+    assert(bmgr->field != cmgr->field);         \
+    for (i = 0; i < (n); i++)                   \
+      assert(bmgr->field[i] == cmgr->field[i]); \
   } while (0)
 
-#define BZLA_CHKCLONE_AIGPID(field)                       \
-  do                                                      \
-  {                                                       \
-    if (!real_aig->field)                                 \
-    {                                                     \
-      assert(!real_clone->field);                         \
-      break;                                              \
-    }                                                     \
-    assert(bzla_aig_is_const(real_aig->field)             \
-           || real_aig->field != real_clone->field);      \
-    assert(real_aig->field->id == real_clone->field->id); \
-  } while (0)
-
-#define BZLA_CHKCLONE_AIGINV(field)                     \
-  do                                                    \
-  {                                                     \
-    if (!real_aig->field)                               \
-    {                                                   \
-      assert(!real_clone->field);                       \
-      break;                                            \
-    }                                                   \
-    assert(BZLA_IS_INVERTED_AIG(real_aig->field)        \
-           == BZLA_IS_INVERTED_AIG(real_clone->field)); \
-    BZLA_CHKCLONE_AIGPID(field);                        \
-  } while (0)
-
-static void
-chkclone_aig(BzlaAIG *aig, BzlaAIG *clone)
-{
-  int32_t i;
-  BzlaAIG *real_aig, *real_clone;
-
-  real_aig   = BZLA_REAL_ADDR_AIG(aig);
-  real_clone = BZLA_REAL_ADDR_AIG(clone);
-  assert((real_aig == BZLA_AIG_FALSE && real_clone == BZLA_AIG_FALSE)
-         || real_aig != real_clone);
-
-  if (real_aig != BZLA_AIG_FALSE)
-  {
-    BZLA_CHKCLONE_AIG(id);
-    BZLA_CHKCLONE_AIG(refs);
-    BZLA_CHKCLONE_AIG(next);
-    BZLA_CHKCLONE_AIG(cnf_id);
-    BZLA_CHKCLONE_AIG(mark);
-    BZLA_CHKCLONE_AIG(is_var);
-    BZLA_CHKCLONE_AIG(local);
-    if (!real_aig->is_var)
-      for (i = 0; i < 2; i++) BZLA_CHKCLONE_AIG(children[i]);
-  }
-}
-
 static inline void
 chkclone_aig_unique_table(Bzla *bzla, Bzla *clone)
 {
@@ -408,17 +351,22 @@ chkclone_aig_unique_table(Bzla *bzla, Bzla *clone)
 }
 
 static inline void
-chkclone_aig_id_table(Bzla *bzla, Bzla *clone)
+chkclone_aig_store(Bzla *bzla, Bzla *clone)
 {
   uint32_t i;
-  BzlaAIGPtrStack *btable, *ctable;
-
-  btable = &bzla_get_aig_mgr(bzla)->id2aig;
-  ctable = &bzla_get_aig_mgr(clone)->id2aig;
-  assert(btable != ctable);
-
-  for (i = 0; i < BZLA_COUNT_STACK(*btable); i++)
-    chkclone_aig(btable->start[i], ctable->start[i]);
+  BzlaAIGMgr *bmgr, *cmgr;
+
+  bmgr = bzla_get_aig_mgr(bzla);
+  cmgr = bzla_get_aig_mgr(clone);
+  assert(bmgr != cmgr);
+
+  assert(bmgr->num_ids == cmgr->num_ids);
+  BZLA_CHKCLONE_AIG_STORE(children, 2 * bmgr->num_ids);
+  BZLA_CHKCLONE_AIG_STORE(cnf_ids, bmgr->num_ids);
+  BZLA_CHKCLONE_AIG_STORE(refs, bmgr->num_ids);
+  BZLA_CHKCLONE_AIG_STORE(next, bmgr->num_ids);
+  BZLA_CHKCLONE_AIG_STORE(local, bmgr->num_ids);
+  BZLA_CHKCLONE_AIG_STORE(mark, bmgr->num_ids);
 }
 
 static inline void
@@ -542,8 +490,9 @@ bzla_chkclone_exp(Bzla *bzla,
     {
       assert(real_cexp->av);
       assert(real_exp->av->width == real_cexp->av->width);
+      /* cloned AIGs keep their ids */
       for (i = 0; i < real_exp->av->width; i++)
-        chkclone_aig(real_exp->av->aigs[i], real_cexp->av->aigs[i]);
+        assert(real_exp->av->aigs[i] == real_cexp->av->aigs[i]);
     }
     else
       assert(real_exp->av == real_cexp->av);
@@ -1227,7 +1176,7 @@ bzla_chkclone(Bzla *bzla, Bzla *clone)
   if (bzla->avmgr)
   {
     chkclone_aig_unique_table(bzla, clone);
-    chkclone_aig_id_table(bzla, clone);
+    chkclone_aig_store(bzla, clone);
     chkclone_aig_cnf_id_table(bzla, clone);
   }
 
@@ -16,6 +16,7 @@
 #include "bzlaaigvec.h"
 #include "bzlabeta.h"
 #include "bzlabv.h"
+#include "bzlabvdomain.h"
 #include "bzlacore.h"
 #include "bzlaexp.h"
 #include "bzlafp.h"
@@ -197,6 +198,20 @@ bzla_clone_data_as_bv_ptr(BzlaMemMgr *mm,
   cloned_data->as_ptr = bzla_bv_copy(mm, (BzlaBitVector *) data->as_ptr);
 }
 
+void
+bzla_clone_data_as_bvdomain_ptr(BzlaMemMgr *mm,
+                                const void *map,
+                                BzlaHashTableData *data,
+                                BzlaHashTableData *cloned_data)
+{
+  assert(mm);
+  assert(data);
+  assert(cloned_data);
+
+  (void) map;
+  cloned_data->as_ptr = bzla_bvdomain_copy(mm, (BzlaBvDomain *) data->as_ptr);
+}
+
 void
 bzla_clone_data_as_ptr_htable(BzlaMemMgr *mm,
                               const void *map,
@@ -253,23 +268,41 @@ bzla_clone_data_as_int_htable(BzlaMemMgr *mm,
 }
 
 void
-bzla_clone_data_as_bv_ptr_htable(BzlaMemMgr *mm,
+bzla_clone_data_as_stored_bv_ptr(BzlaMemMgr *mm,
                                  const void *map,
                                  BzlaHashTableData *data,
                                  BzlaHashTableData *cloned_data)
 {
   assert(mm);
+  assert(map);
+  assert(data);
+  assert(cloned_data);
+
+  (void) mm;
+  cloned_data->as_ptr = bzla_term_store_get_bv((BzlaTermStore *) map,
+                                               (BzlaBitVector *) data->as_ptr);
+}
+
+void
+bzla_clone_data_as_stored_bv_ptr_htable(BzlaMemMgr *mm,
+                                        const void *map,
+                                        BzlaHashTableData *data,
+                                        BzlaHashTableData *cloned_data)
+{
+  assert(mm);
+  assert(map);
   assert(data);
   assert(cloned_data);
 
   BzlaPtrHashTable *table;
   table               = (BzlaPtrHashTable *) data->as_ptr;
-  cloned_data->as_ptr = bzla_hashptr_table_clone(mm,
-                                                 table,
-                                                 bzla_clone_key_as_bv_tuple,
-                                                 bzla_clone_data_as_bv_ptr,
-                                                 map,
-                                                 map);
+  cloned_data->as_ptr =
+      bzla_hashptr_table_clone(mm,
+                               table,
+                               bzla_clone_key_as_bv_tuple,
+                               bzla_clone_data_as_stored_bv_ptr,
+                               0,
+                               map);
 }
 
 /*------------------------------------------------------------------------*/
@@ -527,10 +560,15 @@ clone_exp(Bzla *clone,
   /* ------------------- BZLA_VAR_NODE_STRUCT (all nodes) -----------------> */
   if (bzla_node_is_bv_const(exp))
   {
-    bits = bzla_bv_copy(mm, bzla_node_bv_const_get_bits_ptr(exp));
-    bzla_node_bv_const_set_bits(res, bits);
-    bits = bzla_bv_copy(mm, bzla_node_bv_const_get_invbits_ptr(exp));
-    bzla_node_bv_const_set_invbits(res, bits);
+    bits = bzla_node_bv_const_get_bits_ptr(exp);
+    bzla_node_bv_const_set_bits(
+        res, bzla_term_store_get_bv(clone->term_store, bits));
+    bits = bzla_node_bv_const_get_invbits_ptr(exp);
+    if (bits)
+    {
+      bzla_node_bv_const_set_invbits(
+          res, bzla_term_store_get_bv(clone->term_store, bits));
+    }
   }
   else if (bzla_node_is_fp_const(exp))
   {
@@ -896,6 +934,17 @@ clone_nodes_unique_table(Bzla *bzla, Bzla *clone, BzlaNodeMap *exp_map)
     CHKCLONE_MEM_PTR_HASH_TABLE(bzla->table, clone->table);              \
   } while (0)
 
+#define CLONE_PTR_HASH_TABLE_DATA_MAP(table, data_func, data_map)             \
+  do                                                                         \
+  {                                                                          \
+    BZLALOG_TIMESTAMP(delta);                                                \
+    clone->table = bzla_hashptr_table_clone(                                 \
+        mm, bzla->table, bzla_clone_key_as_node, data_func, emap, data_map); \
+    BZLALOG(2,                                                               \
+            "  clone " #table " table: %.3f s",                              \
+            (bzla_util_time_stamp() - delta));                               \
+  } while (0)
+
 #if 0
 #define CLONE_INT_HASH_MAP_DATA(table, data_func)                         \
   do                                                                      \
@@ -911,6 +960,52 @@ clone_nodes_unique_table(Bzla *bzla, Bzla *clone, BzlaNodeMap *exp_map)
 
 #define MEM_BITVEC(bv) ((bv) ? bzla_bv_size(bv) : 0)
 
+#ifndef NDEBUG
+static size_t
+mem_bvdomain_map(BzlaIntHashTable *domains)
+{
+  size_t res;
+  BzlaIntHashTableIterator it;
+  BzlaBvDomain *d;
+
+  res = MEM_INT_HASH_MAP(domains);
+  bzla_iter_hashint_init(&it, domains);
+  while (bzla_iter_hashint_has_next(&it))
+  {
+    d = bzla_iter_hashint_next_data(&it)->as_ptr;
+    res += sizeof(BzlaBvDomain) + MEM_BITVEC(d->lo) + MEM_BITVEC(d->hi);
+  }
+  return res;
+}
+#endif
+
+/* Clone the AIG stacks of the assumption cache, 'map' is the cloned AIG
+ * manager (AIGs keep their ids and literals when cloned). */
+static void
+clone_data_as_aig_ptr_stack(BzlaMemMgr *mm,
+                            const void *map,
+                            BzlaHashTableData *data,
+                            BzlaHashTableData *cloned_data)
+{
+  assert(mm);
+  assert(map);
+  assert(data);
+  assert(cloned_data);
+  (void) map;
+
+  uint32_t i;
+  BzlaAIGPtrStack *aigs, *res;
+
+  aigs = (BzlaAIGPtrStack *) data->as_ptr;
+
+  BZLA_NEW(mm, res);
+  BZLA_INIT_STACK(mm, *res);
+  for (i = 0; i < BZLA_COUNT_STACK(*aigs); i++)
+    BZLA_PUSH_STACK(*res, BZLA_PEEK_STACK(*aigs, i));
+  BZLA_ADJUST_STACK(*aigs, *res);
+  cloned_data->as_ptr = res;
+}
+
 static Bzla *
 clone_aux_bzla(Bzla *bzla,
                BzlaNodeMap **exp_map,
@@ -932,6 +1027,7 @@ clone_aux_bzla(Bzla *bzla,
   BzlaNodePtrStack rhos;
 #ifndef NDEBUG
   uint32_t h;
+  BzlaAIGPtrStack *aigs;
   size_t allocated;
   BzlaNode *cur;
   BzlaAIGMgr *amgr;
@@ -960,23 +1056,23 @@ clone_aux_bzla(Bzla *bzla,
   clone->rng = bzla_rng_clone(bzla->rng, mm);
 #ifndef NDEBUG
   allocated += sizeof(BzlaRNG);
-  allocated += sizeof(gmp_randstate_t);
 #endif
 
   BZLA_CLR(&clone->cbs);
+  /* background bit-blasting is not cloned, all queued formulas are
+   * processed before solving */
+  clone->pipeline = 0;
+  /* temporary bit-vectors are not cloned */
+  bzla_bv_scratch_init(mm, &clone->bv_scratch);
+  /* constant and model values are shared with the clone */
+  clone->term_store = bzla_term_store_copy(bzla->term_store);
   bzla_opt_clone_opts(bzla, clone);
 #ifndef NDEBUG
-  allocated += BZLA_OPT_NUM_OPTS * sizeof(BzlaOpt);
   for (o = bzla_opt_first(bzla); bzla_opt_is_valid(bzla, o);
        o = bzla_opt_next(bzla, o))
   {
-    if (bzla->options[o].valstr)
-      allocated += strlen(bzla->options[o].valstr) + 1;
-    if (bzla->options[o].options)
-      allocated += MEM_PTR_HASH_TABLE(clone->options[o].options)
-                   + clone->options[o].options->count * sizeof(BzlaOptHelp);
+    if (bzla->optvalstrs[o]) allocated += strlen(bzla->optvalstrs[o]) + 1;
   }
-  allocated += MEM_PTR_HASH_TABLE(clone->str2opt);
 #endif
   assert(allocated == clone->mm->allocated);
 
@@ -1069,8 +1165,9 @@ clone_aux_bzla(Bzla *bzla,
       clone->avmgr = bzla_aigvec_mgr_new(clone);
       assert((allocated += sizeof(BzlaAIGVecMgr) + sizeof(BzlaAIGMgr)
                            + sizeof(BzlaSATMgr)
-                           /* true and false AIGs */
-                           + 2 * sizeof(BzlaAIG *)
+                           /* AIG store with reserved ids 0 and 1 */
+                           + clone->avmgr->amgr->size_ids
+                                 * BZLA_AIG_STORE_BYTES_PER_ID
                            + sizeof(int32_t)) /* unique table chains */
              == clone->mm->allocated);
     }
@@ -1083,13 +1180,10 @@ clone_aux_bzla(Bzla *bzla,
       allocated +=
           sizeof(BzlaAIGVecMgr) + sizeof(BzlaAIGMgr)
           + sizeof(BzlaSATMgr)
-          /* memory of AIG nodes */
-          + (amgr->cur_num_aigs + amgr->cur_num_aig_vars) * sizeof(BzlaAIG)
-          /* children for AND AIGs */
-          + amgr->cur_num_aigs * sizeof(int32_t) * 2
+          /* AIG store */
+          + amgr->size_ids * BZLA_AIG_STORE_BYTES_PER_ID
           /* unique table chain */
           + amgr->table.size * sizeof(int32_t)
-          + BZLA_SIZE_STACK(amgr->id2aig) * sizeof(BzlaAIG *)
           + BZLA_SIZE_STACK(amgr->cnfid2aig) * sizeof(int32_t);
 #ifdef BZLA_USE_LINGELING
       assert(strcmp(amgr->smgr->name, "Lingeling") == 0
@@ -1152,12 +1246,7 @@ clone_aux_bzla(Bzla *bzla,
   {
     if (!(cur = BZLA_PEEK_STACK(bzla->nodes_id_table, i))) continue;
     allocated += cur->bytes;
-    if (bzla_node_is_bv_const(cur))
-    {
-      allocated += MEM_BITVEC(bzla_node_bv_const_get_bits_ptr(cur));
-      allocated += MEM_BITVEC(bzla_node_bv_const_get_invbits_ptr(cur));
-    }
-    else if (bzla_node_is_fp_const(cur))
+    if (bzla_node_is_fp_const(cur))
     {
       allocated += bzla_fp_get_bytes(cur);
     }
@@ -1173,8 +1262,8 @@ clone_aux_bzla(Bzla *bzla,
       allocated += MEM_PTR_HASH_TABLE(bzla_node_lambda_get_static_rho(cur));
     }
   }
-  /* Note: hash table is initialized with size 1 */
-  allocated += (emap->table->size - 1) * sizeof(BzlaPtrHashBucket *)
+  /* Note: bucket array of hash table is allocated on first insertion */
+  allocated += emap->table->size * sizeof(BzlaPtrHashBucket *)
                + emap->table->count * sizeof(BzlaPtrHashBucket)
                + BZLA_SIZE_STACK(bzla->nodes_id_table) * sizeof(BzlaNode *);
   assert(allocated == clone->mm->allocated);
@@ -1251,6 +1340,34 @@ clone_aux_bzla(Bzla *bzla,
   assert((allocated += MEM_PTR_HASH_TABLE(bzla->orig_assumptions))
          == clone->mm->allocated);
 
+  if (exp_layer_only)
+  {
+    /* AIG layer is not cloned, start with an empty assumption cache */
+    clone->assumption_cache =
+        bzla_hashptr_table_new(mm,
+                               (BzlaHashPtr) bzla_node_hash_by_id,
+                               (BzlaCmpPtr) bzla_node_compare_by_id);
+    assert((allocated += MEM_PTR_HASH_TABLE(clone->assumption_cache))
+           == clone->mm->allocated);
+  }
+  else
+  {
+    CLONE_PTR_HASH_TABLE_DATA_MAP(assumption_cache,
+                                  clone_data_as_aig_ptr_stack,
+                                  bzla_get_aig_mgr(clone));
+#ifndef NDEBUG
+    allocated += MEM_PTR_HASH_TABLE(bzla->assumption_cache);
+    bzla_iter_hashptr_init(&pit, bzla->assumption_cache);
+    while (bzla_iter_hashptr_has_next(&pit))
+    {
+      aigs = bzla_iter_hashptr_next_data(&pit)->as_ptr;
+      allocated +=
+          sizeof(BzlaAIGPtrStack) + BZLA_SIZE_STACK(*aigs) * sizeof(BzlaAIG *);
+    }
+    assert(allocated == clone->mm->allocated);
+#endif
+  }
+
   clone->assertions_cache =
       bzla_hashint_table_clone(clone->mm, bzla->assertions_cache);
   assert((allocated += MEM_INT_HASH_TABLE(bzla->assertions_cache))
@@ -1270,21 +1387,18 @@ clone_aux_bzla(Bzla *bzla,
       (allocated += BZLA_SIZE_STACK(bzla->assertions_trail) * sizeof(uint32_t))
       == clone->mm->allocated);
 
+  BZLA_INIT_STACK(clone->mm, clone->opt_trail);
+  for (i = 0; i < BZLA_COUNT_STACK(bzla->opt_trail); i++)
+    BZLA_PUSH_STACK(clone->opt_trail, BZLA_PEEK_STACK(bzla->opt_trail, i));
+  BZLA_ADJUST_STACK(bzla->opt_trail, clone->opt_trail);
+  assert((allocated +=
+          BZLA_SIZE_STACK(bzla->opt_trail) * sizeof(BzlaOptTrailEntry))
+         == clone->mm->allocated);
+
   if (bzla->bv_model)
   {
+    /* model values are shared via the term store */
     clone->bv_model = bzla_model_clone_bv(clone, bzla->bv_model, false);
-#ifndef NDEBUG
-    bzla_iter_hashint_init(&iit, bzla->bv_model);
-    bzla_iter_hashint_init(&ciit, clone->bv_model);
-    while (bzla_iter_hashint_has_next(&iit))
-    {
-      data  = bzla_iter_hashint_next_data(&iit);
-      cdata = bzla_iter_hashint_next_data(&ciit);
-      assert(bzla_bv_size((BzlaBitVector *) data->as_ptr)
-             == bzla_bv_size((BzlaBitVector *) cdata->as_ptr));
-      allocated += bzla_bv_size((BzlaBitVector *) cdata->as_ptr);
-    }
-#endif
   }
   assert((allocated += MEM_INT_HASH_MAP(bzla->bv_model))
          == clone->mm->allocated);
@@ -1318,7 +1432,6 @@ clone_aux_bzla(Bzla *bzla,
       bzla_iter_hashptr_init(&ncpit, ((BzlaPtrHashTable *) data->as_ptr));
       while (bzla_iter_hashptr_has_next(&ncpit))
       {
-        allocated += bzla_bv_size((BzlaBitVector *) ncpit.bucket->data.as_ptr);
         allocated += bzla_bv_size_tuple(
             (BzlaBitVectorTuple *) bzla_iter_hashptr_next(&ncpit));
       }
@@ -1512,7 +1625,8 @@ clone_aux_bzla(Bzla *bzla,
 
       allocated += sizeof(BzlaSLSSolver) + MEM_INT_HASH_MAP(cslv->roots)
                    + MEM_INT_HASH_MAP(cslv->score)
-                   + MEM_INT_HASH_MAP(cslv->weights);
+                   + MEM_INT_HASH_MAP(cslv->weights)
+                   + mem_bvdomain_map(cslv->domains);
 
       if (slv->weights)
         allocated += slv->weights->count * sizeof(BzlaSLSConstrData);
@@ -1555,7 +1669,7 @@ clone_aux_bzla(Bzla *bzla,
 
       allocated +=
           sizeof(BzlaPropSolver) + MEM_PTR_HASH_TABLE(cslv->roots)
-          + MEM_PTR_HASH_TABLE(cslv->score)
+          + MEM_PTR_HASH_TABLE(cslv->score) + mem_bvdomain_map(cslv->domains)
 #ifndef NDEBUG
           + BZLA_SIZE_STACK(cslv->prop_path) * sizeof(BzlaPropEntailInfo);
 #endif
@@ -76,16 +76,27 @@ void bzla_clone_data_as_bv_ptr(BzlaMemMgr *mm,
                                BzlaHashTableData *data,
                                BzlaHashTableData *cloned_data);
 
+void bzla_clone_data_as_bvdomain_ptr(BzlaMemMgr *mm,
+                                     const void *map,
+                                     BzlaHashTableData *data,
+                                     BzlaHashTableData *cloned_data);
+
 void bzla_clone_data_as_ptr_htable(BzlaMemMgr *mm,
                                    const void *map,
                                    BzlaHashTableData *data,
                                    BzlaHashTableData *cloned_data);
 
-void bzla_clone_data_as_bv_ptr_htable(BzlaMemMgr *mm,
+/* Clone bit-vectors stored in term store 'map' (see bzlatermstore.h). */
+void bzla_clone_data_as_stored_bv_ptr(BzlaMemMgr *mm,
                                       const void *map,
                                       BzlaHashTableData *data,
                                       BzlaHashTableData *cloned_data);
 
+void bzla_clone_data_as_stored_bv_ptr_htable(BzlaMemMgr *mm,
+                                             const void *map,
+                                             BzlaHashTableData *data,
+                                             BzlaHashTableData *cloned_data);
+
 void bzla_clone_data_as_int_htable(BzlaMemMgr *mm,
                                    const void *map,
                                    BzlaHashTableData *data,
@@ -11,7 +11,11 @@
 #include "bzlacore.h"
 
 #include <limits.h>
+#include <stdlib.h>
+#include <unistd.h>
 
+#include "bzlaautoconf.h"
+#include "bzlabwreduce.h"
 #ifndef NDEBUG
 #include "bzlachkfailed.h"
 #include "bzlachkmodel.h"
@@ -24,6 +28,7 @@
 #include "bzlalog.h"
 #include "bzlamodel.h"
 #include "bzlaopt.h"
+#include "bzlapipeline.h"
 #include "bzlarewrite.h"
 #include "bzlaslvaigprop.h"
 #include "bzlaslvfun.h"
@@ -31,6 +36,9 @@
 #include "bzlaslvquant.h"
 #include "bzlaslvsls.h"
 #include "bzlasubst.h"
+#include "bzlatrace.h"
+#include "dumper/bzladumpaig.h"
+#include "parser/bzlaaiger.h"
 #include "preprocess/bzlapreprocess.h"
 #include "preprocess/bzlavarsubst.h"
 #include "utils/bzlaabort.h"
@@ -407,6 +415,7 @@ bzla_print_stats(Bzla *bzla)
 {
   uint32_t i, num_final_ops;
   uint32_t verbosity;
+  BzlaTermStoreStats store_stats;
 
   if (!bzla) return;
 
@@ -432,6 +441,14 @@ bzla_print_stats(Bzla *bzla)
              1,
              "%.2f MB allocated for nodes",
              bzla->stats.node_bytes_alloc / (double) (1 << 20));
+    bzla_term_store_get_stats(bzla->term_store, &store_stats);
+    BZLA_MSG(bzla->msg,
+             1,
+             "%llu bit-vector values stored (%llu references), "
+             "%.2f MB saved by sharing",
+             (unsigned long long) store_stats.bvs,
+             (unsigned long long) store_stats.refs,
+             store_stats.saved / (double) (1 << 20));
     if (num_final_ops > 0)
       for (i = 1; i < BZLA_NUM_OPS_NODE - 1; i++)
         if (bzla->ops[i].cur || bzla->ops[i].max)
@@ -505,6 +522,45 @@ bzla_print_stats(Bzla *bzla)
   BZLA_MSG(
       bzla->msg, 1, "%5lld beta reductions", bzla->stats.beta_reduce_calls);
   BZLA_MSG(bzla->msg, 1, "%5lld clone calls", bzla->stats.clone_calls);
+  if (bzla->stats.assumptions_synthesized)
+  {
+    BZLA_MSG(bzla->msg,
+             1,
+             "%5u assumptions bit-blasted (%lld reused)",
+             bzla->stats.assumptions_synthesized,
+             bzla->stats.assumptions_cached);
+    BZLA_MSG(bzla->msg,
+             1,
+             "%.3f seconds assuming (%.6f per call)",
+             bzla->time.assumptions,
+             bzla->bzla_sat_bzla_called
+                 ? bzla->time.assumptions / bzla->bzla_sat_bzla_called
+                 : 0.0);
+  }
+  if (bzla->pipeline)
+  {
+    BZLA_MSG(bzla->msg,
+             1,
+             "%5u formulas bit-blasted in background (%u skipped)",
+             bzla->stats.pipeline_synthesized,
+             bzla->stats.pipeline_skipped);
+    BZLA_MSG(bzla->msg,
+             1,
+             "%.3f seconds waiting for background bit-blasting",
+             bzla->time.pipeline_sync);
+  }
+  if (bzla_opt_get(bzla, BZLA_OPT_BW_REDUCE))
+  {
+    BZLA_MSG(bzla->msg,
+             1,
+             "%5u bit-width reduced abstractions (%u sat)",
+             bzla->stats.bw_reduce_abstractions,
+             bzla->stats.bw_reduce_sat);
+    BZLA_MSG(bzla->msg,
+             1,
+             "%.3f seconds bit-width reduction",
+             bzla->time.bw_reduce);
+  }
 
   BZLA_MSG(bzla->msg, 1, "");
   BZLA_MSG(bzla->msg, 1, "rewrite rule cache");
@@ -567,6 +623,26 @@ bzla_print_stats(Bzla *bzla)
            1,
            "  %7lld CNF literals",
            bzla->avmgr ? bzla->avmgr->amgr->num_cnf_literals : 0);
+  if (bzla->stats.ite_chains)
+  {
+    /* Tseitin encoding of an AND gate requires 3 clauses */
+    BZLA_MSG(bzla->msg,
+             1,
+             "  %7u ITE chains (%u cases, %u as multiplexer trees)",
+             bzla->stats.ite_chains,
+             bzla->stats.ite_chain_cases,
+             bzla->stats.ite_chains_mux);
+    BZLA_MSG(bzla->msg,
+             1,
+             "  %7lld AIG ANDs (%lld Tseitin clauses) for ITE chains",
+             bzla->stats.ite_chain_aigs,
+             3 * bzla->stats.ite_chain_aigs);
+    BZLA_MSG(bzla->msg,
+             1,
+             "  %7lld AIG ANDs (%lld Tseitin clauses) with pairwise encoding",
+             bzla->stats.ite_chain_aigs_pairwise,
+             3 * bzla->stats.ite_chain_aigs_pairwise);
+  }
 
   if (bzla->slv) bzla->slv->api.print_stats(bzla->slv);
 
@@ -756,6 +832,10 @@ bzla_new(void)
       bzla_hashptr_table_new(mm,
                              (BzlaHashPtr) bzla_node_hash_by_id,
                              (BzlaCmpPtr) bzla_node_compare_by_id);
+  bzla->assumption_cache =
+      bzla_hashptr_table_new(mm,
+                             (BzlaHashPtr) bzla_node_hash_by_id,
+                             (BzlaCmpPtr) bzla_node_compare_by_id);
   bzla->parameterized =
       bzla_hashptr_table_new(mm,
                              (BzlaHashPtr) bzla_node_hash_by_id,
@@ -763,7 +843,10 @@ bzla_new(void)
 
   BZLA_INIT_STACK(mm, bzla->assertions);
   BZLA_INIT_STACK(mm, bzla->assertions_trail);
+  BZLA_INIT_STACK(mm, bzla->opt_trail);
   bzla->assertions_cache = bzla_hashint_table_new(mm);
+  bzla_bv_scratch_init(mm, &bzla->bv_scratch);
+  bzla->term_store = bzla_term_store_new();
 
 #ifndef NDEBUG
   bzla->stats.rw_rules_applied = bzla_hashptr_table_new(
@@ -787,6 +870,7 @@ terminate_aux_bzla(void *bzla)
   Bzla *bt;
 
   bt = (Bzla *) bzla;
+  if (bt->cbs.term.cancel) return 1;
   if (!bt->cbs.term.fun) return 0;
   res = ((int32_t(*)(void *)) bt->cbs.term.fun)(bt->cbs.term.state);
   return res;
@@ -816,6 +900,25 @@ bzla_set_term(Bzla *bzla, int32_t (*fun)(void *), void *state)
   bzla_sat_mgr_set_term(smgr, terminate_aux_bzla, bzla);
 }
 
+void
+bzla_set_aig_optimizer(Bzla *bzla,
+                       int32_t (*fun)(void *, const char *, const char *),
+                       void *state)
+{
+  assert(bzla);
+
+  bzla->cbs.aig_opt.fun   = fun;
+  bzla->cbs.aig_opt.state = state;
+}
+
+void
+bzla_set_cancel(Bzla *bzla, bool cancel)
+{
+  assert(bzla);
+  assert(bzla->cbs.term.termfun);
+  bzla->cbs.term.cancel = cancel;
+}
+
 void *
 bzla_get_term_state(Bzla *bzla)
 {
@@ -823,6 +926,79 @@ bzla_get_term_state(Bzla *bzla)
   return bzla->cbs.term.state;
 }
 
+/* Move stored bit-vector 'bv' from term store 'from' to term store 'to'. */
+static BzlaBitVector *
+move_to_term_store(BzlaTermStore *from, BzlaTermStore *to, BzlaBitVector *bv)
+{
+  BzlaBitVector *res;
+
+  res = bzla_term_store_get_bv(to, bv);
+  bzla_term_store_release_bv(from, bv);
+  return res;
+}
+
+void
+bzla_set_term_store(Bzla *bzla, BzlaTermStore *store)
+{
+  assert(bzla);
+  assert(store);
+  assert(!bzla->term_store_shared);
+
+  size_t i;
+  BzlaNode *cur;
+  BzlaBitVector *bits;
+  BzlaTermStore *old;
+  BzlaHashTableData *d;
+  BzlaPtrHashTable *t;
+  BzlaIntHashTableIterator iit;
+  BzlaPtrHashTableIterator it;
+
+  old                     = bzla->term_store;
+  bzla->term_store        = bzla_term_store_copy(store);
+  bzla->term_store_shared = true;
+
+  /* Move values of existing constants into the store. */
+  for (i = 1; i < BZLA_COUNT_STACK(bzla->nodes_id_table); i++)
+  {
+    cur = BZLA_PEEK_STACK(bzla->nodes_id_table, i);
+    if (!cur || !bzla_node_is_bv_const(cur)) continue;
+    bits = bzla_node_bv_const_get_bits_ptr(cur);
+    bzla_node_bv_const_set_bits(cur, move_to_term_store(old, store, bits));
+    bits = bzla_node_bv_const_get_invbits_ptr(cur);
+    if (bits)
+    {
+      bzla_node_bv_const_set_invbits(cur,
+                                     move_to_term_store(old, store, bits));
+    }
+  }
+
+  /* Move model values into the store. */
+  if (bzla->bv_model)
+  {
+    bzla_iter_hashint_init(&iit, bzla->bv_model);
+    while (bzla_iter_hashint_has_next(&iit))
+    {
+      d         = bzla_iter_hashint_next_data(&iit);
+      d->as_ptr = move_to_term_store(old, store, d->as_ptr);
+    }
+  }
+  if (bzla->fun_model)
+  {
+    bzla_iter_hashint_init(&iit, bzla->fun_model);
+    while (bzla_iter_hashint_has_next(&iit))
+    {
+      t = bzla_iter_hashint_next_data(&iit)->as_ptr;
+      bzla_iter_hashptr_init(&it, t);
+      while (bzla_iter_hashptr_has_next(&it))
+      {
+        d         = bzla_iter_hashptr_next_data(&it);
+        d->as_ptr = move_to_term_store(old, store, d->as_ptr);
+      }
+    }
+  }
+  bzla_term_store_delete(old);
+}
+
 static void
 release_all_exp_refs(Bzla *bzla, bool internal)
 {
@@ -911,6 +1087,34 @@ bzla_delete_varsubst_constraints(Bzla *bzla)
   bzla_hashptr_table_delete(bzla->varsubst_constraints);
 }
 
+static void
+release_cached_assumption(Bzla *bzla, BzlaNode *exp, BzlaAIGPtrStack *aigs)
+{
+  BzlaAIGMgr *amgr;
+
+  amgr = bzla_get_aig_mgr(bzla);
+  while (!BZLA_EMPTY_STACK(*aigs))
+    bzla_aig_release(amgr, BZLA_POP_STACK(*aigs));
+  BZLA_RELEASE_STACK(*aigs);
+  BZLA_DELETE(bzla->mm, aigs);
+  bzla_node_release(bzla, exp);
+}
+
+static void
+delete_assumption_cache(Bzla *bzla)
+{
+  BzlaPtrHashTableIterator it;
+  BzlaAIGPtrStack *aigs;
+
+  bzla_iter_hashptr_init(&it, bzla->assumption_cache);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    aigs = it.bucket->data.as_ptr;
+    release_cached_assumption(bzla, bzla_iter_hashptr_next(&it), aigs);
+  }
+  bzla_hashptr_table_delete(bzla->assumption_cache);
+}
+
 void
 bzla_delete(Bzla *bzla)
 {
@@ -923,6 +1127,7 @@ bzla_delete(Bzla *bzla)
   BzlaPtrHashTableIterator it;
 
   mm = bzla->mm;
+  bzla_pipeline_delete(bzla);
   bzla_rng_delete(bzla->rng);
   bzla_fp_word_blaster_delete(bzla);
 
@@ -938,6 +1143,7 @@ bzla_delete(Bzla *bzla)
           || bzla_opt_get(bzla, BZLA_OPT_AUTO_CLEANUP_INTERNAL));
 
   bzla_delete_varsubst_constraints(bzla);
+  delete_assumption_cache(bzla);
 
   bzla_iter_hashptr_init(&it, bzla->inputs);
   bzla_iter_hashptr_queue(&it, bzla->embedded_constraints);
@@ -959,7 +1165,9 @@ bzla_delete(Bzla *bzla)
     bzla_node_release(bzla, BZLA_PEEK_STACK(bzla->assertions, i));
   BZLA_RELEASE_STACK(bzla->assertions);
   BZLA_RELEASE_STACK(bzla->assertions_trail);
+  BZLA_RELEASE_STACK(bzla->opt_trail);
   bzla_hashint_table_delete(bzla->assertions_cache);
+  bzla_bv_scratch_delete(&bzla->bv_scratch);
 
   bzla_model_delete(bzla);
   bzla_node_release(bzla, bzla->true_exp);
@@ -1026,6 +1234,7 @@ bzla_delete(Bzla *bzla)
   assert(getenv("BZLALEAK") || getenv("BZLALEAKSORT")
          || bzla->sorts_unique_table.num_elements == 0);
   BZLA_RELEASE_SORT_UNIQUE_TABLE(mm, bzla->sorts_unique_table);
+  bzla_term_store_delete(bzla->term_store);
 
   bzla_iter_hashptr_init(&it, bzla->node2symbol);
   while (bzla_iter_hashptr_has_next(&it))
@@ -1069,6 +1278,155 @@ bzla_set_msg_prefix(Bzla *bzla, const char *prefix)
 }
 
 /* synthesizes unsynthesized constraints and updates constraints tables. */
+/* Apply the external AIG optimizer to the AIGs in 'roots'. The roots are
+ * exported as binary AIGER model, and replaced by the outputs of the optimized
+ * model, which is imported with its inputs mapped back to the original AIG
+ * variables. The original AIGs are kept if the optimizer fails. */
+static void
+optimize_aigs(Bzla *bzla, BzlaAIGPtrStack *roots)
+{
+  assert(bzla->cbs.aig_opt.fun);
+
+  char in[]  = "/tmp/bitwuzla-aig-in-XXXXXX";
+  char out[] = "/tmp/bitwuzla-aig-out-XXXXXX";
+  int32_t fd_in, fd_out;
+  const char *err;
+  double start;
+  size_t i;
+  FILE *file;
+  BzlaAIGMgr *amgr;
+  BzlaAIGPtrStack inputs, outputs;
+
+  start = bzla_util_time_stamp();
+  amgr  = bzla_get_aig_mgr(bzla);
+  err   = 0;
+  BZLA_INIT_STACK(bzla->mm, inputs);
+  BZLA_INIT_STACK(bzla->mm, outputs);
+
+  fd_in  = mkstemp(in);
+  fd_out = fd_in < 0 ? -1 : mkstemp(out);
+  if (fd_in < 0 || fd_out < 0)
+  {
+    err = "could not create temporary file";
+    goto DONE;
+  }
+  close(fd_out);
+
+  file = fdopen(fd_in, "w");
+  bzla_dumpaig_dump_roots(amgr,
+                          true,
+                          file,
+                          BZLA_COUNT_STACK(*roots),
+                          roots->start,
+                          &inputs);
+  fclose(file);
+
+  if (bzla->cbs.aig_opt.fun(bzla->cbs.aig_opt.state, in, out))
+  {
+    err = "optimizer failed";
+    goto DONE;
+  }
+
+  if (!(file = fopen(out, "r")))
+  {
+    err = "could not open optimized model";
+    goto DONE;
+  }
+  err = bzla_aiger_import(
+      amgr, file, BZLA_COUNT_STACK(inputs), inputs.start, &outputs);
+  fclose(file);
+  if (!err && BZLA_COUNT_STACK(outputs) != BZLA_COUNT_STACK(*roots))
+    err = "unexpected number of outputs";
+  if (err) goto DONE;
+
+  for (i = 0; i < BZLA_COUNT_STACK(*roots); i++)
+  {
+    bzla_aig_release(amgr, BZLA_PEEK_STACK(*roots, i));
+    BZLA_POKE_STACK(*roots, i, BZLA_PEEK_STACK(outputs, i));
+  }
+  BZLA_RESET_STACK(outputs);
+
+DONE:
+  if (fd_in >= 0) unlink(in);
+  if (fd_out >= 0) unlink(out);
+  while (!BZLA_EMPTY_STACK(outputs))
+    bzla_aig_release(amgr, BZLA_POP_STACK(outputs));
+  BZLA_RELEASE_STACK(outputs);
+  BZLA_RELEASE_STACK(inputs);
+
+  if (err)
+    BZLA_MSG(bzla->msg,
+             1,
+             "AIG optimizer: %s, using original AIGs of %zu constraints",
+             err,
+             BZLA_COUNT_STACK(*roots));
+  else
+    BZLA_MSG(bzla->msg,
+             1,
+             "AIG optimizer: optimized AIGs of %zu constraints in %.2f seconds",
+             BZLA_COUNT_STACK(*roots),
+             bzla_util_time_stamp() - start);
+}
+
+/* Synthesize unsynthesized constraint 'cur' and move it to the synthesized
+ * constraints. The AIG of the constraint is added to the SAT solver, or pushed
+ * onto 'roots' if given. */
+static void
+synthesize_constraint(Bzla *bzla, BzlaNode *cur, BzlaAIGPtrStack *roots)
+{
+  assert(bzla_hashptr_table_get(bzla->unsynthesized_constraints, cur));
+
+  BzlaPtrHashTable *uc, *sc;
+  BzlaAIG *aig;
+  BzlaAIGMgr *amgr;
+
+  uc   = bzla->unsynthesized_constraints;
+  sc   = bzla->synthesized_constraints;
+  amgr = bzla_get_aig_mgr(bzla);
+
+  if (!bzla_hashptr_table_get(sc, cur))
+  {
+    aig = exp_to_aig(bzla, cur);
+    if (aig == BZLA_AIG_FALSE)
+    {
+      bzla->found_constraint_false = true;
+      return;
+    }
+    if (roots)
+    {
+      BZLA_PUSH_STACK(*roots, aig);
+    }
+    else
+    {
+      bzla_aig_add_toplevel_to_sat(amgr, aig);
+      bzla_aig_release(amgr, aig);
+    }
+    (void) bzla_hashptr_table_add(sc, cur);
+    bzla_hashptr_table_remove(uc, cur, 0, 0);
+    /* assert constraints added during word-blasting */
+    bzla_fp_word_blaster_add_additional_assertions(bzla);
+
+    bzla->stats.constraints.synthesized++;
+    report_constraint_stats(bzla, false);
+  }
+  else
+  {
+    /* constraint is already in sc */
+    bzla_hashptr_table_remove(uc, cur, 0, 0);
+    bzla_node_release(bzla, cur);
+  }
+}
+
+void
+bzla_synthesize_constraint(Bzla *bzla, BzlaNode *constraint)
+{
+  assert(bzla);
+  assert(constraint);
+  assert(!bzla->inconsistent);
+
+  synthesize_constraint(bzla, constraint, 0);
+}
+
 void
 bzla_process_unsynthesized_constraints(Bzla *bzla)
 {
@@ -1076,16 +1434,23 @@ bzla_process_unsynthesized_constraints(Bzla *bzla)
   assert(!bzla->inconsistent);
 
   BzlaPtrHashTableIterator it;
-  BzlaPtrHashTable *uc, *sc;
+  BzlaPtrHashTable *uc;
   BzlaPtrHashBucket *bucket;
   BzlaNode *cur;
   BzlaAIG *aig;
   BzlaAIGMgr *amgr;
+  BzlaAIGPtrStack roots;
+  bool optimize;
 
   uc   = bzla->unsynthesized_constraints;
-  sc   = bzla->synthesized_constraints;
   amgr = bzla_get_aig_mgr(bzla);
 
+  /* With an AIG optimizer, the AIGs of all constraints are collected and
+   * optimized at once before they are encoded to SAT. */
+  optimize = bzla->cbs.aig_opt.fun && bzla->ufs->count == 0
+             && bzla->lambdas->count == 0 && bzla->quantifiers->count == 0;
+  BZLA_INIT_STACK(bzla->mm, roots);
+
   /* We have to always synthesize FP inputs in order to guarantee that they
    * have a valid assignment when unconstrained. If not, when the model is
    * generated, they will be word-blasted into components and are assigned a
@@ -1146,31 +1511,21 @@ bzla_process_unsynthesized_constraints(Bzla *bzla)
 #endif
 #endif
 
-    if (!bzla_hashptr_table_get(sc, cur))
+    synthesize_constraint(bzla, cur, optimize ? &roots : 0);
+    if (bzla->found_constraint_false) break;
+  }
+
+  if (!BZLA_EMPTY_STACK(roots))
+  {
+    if (!bzla->found_constraint_false) optimize_aigs(bzla, &roots);
+    while (!BZLA_EMPTY_STACK(roots))
     {
-      aig = exp_to_aig(bzla, cur);
-      if (aig == BZLA_AIG_FALSE)
-      {
-        bzla->found_constraint_false = true;
-        break;
-      }
+      aig = BZLA_POP_STACK(roots);
       bzla_aig_add_toplevel_to_sat(amgr, aig);
       bzla_aig_release(amgr, aig);
-      (void) bzla_hashptr_table_add(sc, cur);
-      bzla_hashptr_table_remove(uc, cur, 0, 0);
-      /* assert constraints added during word-blasting */
-      bzla_fp_word_blaster_add_additional_assertions(bzla);
-
-      bzla->stats.constraints.synthesized++;
-      report_constraint_stats(bzla, false);
-    }
-    else
-    {
-      /* constraint is already in sc */
-      bzla_hashptr_table_remove(uc, cur, 0, 0);
-      bzla_node_release(bzla, cur);
     }
   }
+  BZLA_RELEASE_STACK(roots);
 }
 
 void
@@ -1671,6 +2026,88 @@ bzla_reset_assumptions(Bzla *bzla)
                              (BzlaCmpPtr) bzla_node_compare_by_id);
 }
 
+void
+bzla_push(Bzla *bzla, uint32_t nlevels)
+{
+  assert(bzla);
+  assert(bzla_opt_get(bzla, BZLA_OPT_INCREMENTAL));
+
+  if (nlevels)
+  {
+    for (uint32_t i = 0; i < nlevels; i++)
+    {
+      BZLA_PUSH_STACK(bzla->assertions_trail,
+                      BZLA_COUNT_STACK(bzla->assertions));
+    }
+    bzla->num_push_pop++;
+  }
+}
+
+void
+bzla_pop(Bzla *bzla, uint32_t nlevels)
+{
+  assert(bzla);
+  assert(bzla_opt_get(bzla, BZLA_OPT_INCREMENTAL));
+  assert(nlevels <= BZLA_COUNT_STACK(bzla->assertions_trail));
+
+  BzlaOptTrailEntry e;
+  uint32_t pos = 0, level;
+
+  if (nlevels)
+  {
+    for (uint32_t i = 0; i < nlevels; i++)
+    {
+      pos = BZLA_POP_STACK(bzla->assertions_trail);
+    }
+    while (BZLA_COUNT_STACK(bzla->assertions) > pos)
+    {
+      BzlaNode *cur = BZLA_POP_STACK(bzla->assertions);
+      bzla_hashint_table_remove(bzla->assertions_cache, bzla_node_get_id(cur));
+      bzla_node_release(bzla, cur);
+    }
+
+    /* Restore options that were set based on the formula characteristics of
+     * the popped levels (unless they have been reconfigured since). */
+    level = BZLA_COUNT_STACK(bzla->assertions_trail);
+    while (!BZLA_EMPTY_STACK(bzla->opt_trail)
+           && BZLA_TOP_STACK(bzla->opt_trail).level > level)
+    {
+      e = BZLA_POP_STACK(bzla->opt_trail);
+      if (bzla_opt_get(bzla, e.opt) == e.val)
+      {
+        BZLALOG(1, "restore option %u to %u", e.opt, e.old_val);
+        bzla_opt_set(bzla, e.opt, e.old_val);
+      }
+    }
+    bzla->num_push_pop++;
+  }
+}
+
+void
+bzla_set_opt_scoped(Bzla *bzla, BzlaOption opt, uint32_t val)
+{
+  assert(bzla);
+
+  BzlaOptTrailEntry e;
+  uint32_t old_val;
+
+  old_val = bzla_opt_get(bzla, opt);
+  if (old_val == val) return;
+
+  /* Assertions at level 0 are permanent, and so are the options set based
+   * on their characteristics. */
+  if (BZLA_COUNT_STACK(bzla->assertions_trail) > 0)
+  {
+    assert(bzla_opt_get(bzla, BZLA_OPT_INCREMENTAL));
+    e.level   = BZLA_COUNT_STACK(bzla->assertions_trail);
+    e.opt     = opt;
+    e.val     = val;
+    e.old_val = old_val;
+    BZLA_PUSH_STACK(bzla->opt_trail, e);
+  }
+  bzla_opt_set(bzla, opt, val);
+}
+
 static void
 reset_functions_with_model(Bzla *bzla)
 {
@@ -1815,9 +2252,9 @@ exp_to_cnf_lit(Bzla *bzla, BzlaNode *exp)
       sign *= -1;
     }
 
-    if (!aig->cnf_id) bzla_aig_to_sat_tseitin(amgr, aig);
+    if (!bzla_aig_get_cnf_id(amgr, aig)) bzla_aig_to_sat_tseitin(amgr, aig);
 
-    res = aig->cnf_id;
+    res = bzla_aig_get_cnf_id(amgr, aig);
     bzla_aig_release(amgr, aig);
 
     if ((val = bzla_sat_fixed(smgr, res)))
@@ -2313,13 +2750,184 @@ bzla_simplify_exp(Bzla *bzla, BzlaNode *exp)
 
 /*------------------------------------------------------------------------*/
 
+/* Collect the ITE chain
+ *   ite(sel = c0, t0, ite(sel = c1, t1, ... ite(sel = cn, tn, e)))
+ * starting at 'exp' into 'chain' as [sel, e, c0, t0, ..., cn, tn], where ci
+ * are constants. Negated conditions swap the branches, cases with duplicate
+ * constants are unreachable and skipped. Inner ITEs that are already
+ * synthesized or have other parents end the chain. Returns true if the chain
+ * has at least 'min_cases' cases. */
+static bool
+get_ite_chain(Bzla *bzla,
+              BzlaNode *exp,
+              uint32_t min_cases,
+              BzlaNodePtrStack *chain)
+{
+  assert(bzla_node_is_regular(exp));
+  assert(bzla_node_is_bv_cond(exp));
+
+  BzlaNode *cur, *cond, *sel, *c, *s, *t, *e, *def;
+  BzlaIntHashTable *cache;
+
+  BZLA_RESET_STACK(*chain);
+  BZLA_PUSH_STACK(*chain, 0);
+  BZLA_PUSH_STACK(*chain, 0);
+
+  cache = bzla_hashint_table_new(bzla->mm);
+  sel   = 0;
+  def   = 0;
+  c     = 0;
+  cur   = exp;
+  while (!def)
+  {
+    assert(bzla_node_is_regular(cur));
+    assert(bzla_node_is_bv_cond(cur));
+
+    cond = bzla_node_real_addr(cur->e[0]);
+    s    = 0;
+    if (bzla_node_is_bv_eq(cond))
+    {
+      if (bzla_node_is_bv_const(cond->e[0]))
+      {
+        c = cond->e[0];
+        s = cond->e[1];
+      }
+      else if (bzla_node_is_bv_const(cond->e[1]))
+      {
+        c = cond->e[1];
+        s = cond->e[0];
+      }
+    }
+    if (!s || (sel && s != sel))
+    {
+      if (cur != exp) def = cur;
+      break;
+    }
+    sel = s;
+
+    t = cur->e[1];
+    e = cur->e[2];
+    if (bzla_node_is_inverted(cur->e[0]))
+    {
+      t = cur->e[2];
+      e = cur->e[1];
+    }
+    if (!bzla_hashint_table_contains(cache, bzla_node_get_id(c)))
+    {
+      bzla_hashint_table_add(cache, bzla_node_get_id(c));
+      BZLA_PUSH_STACK(*chain, c);
+      BZLA_PUSH_STACK(*chain, t);
+    }
+
+    if (bzla_node_is_inverted(e) || !bzla_node_is_bv_cond(e)
+        || bzla_node_is_synth(e) || e->parents > 1)
+    {
+      def = e;
+    }
+    cur = e;
+  }
+  bzla_hashint_table_delete(cache);
+
+  if (!def || BZLA_COUNT_STACK(*chain) / 2 - 1 < min_cases) return false;
+  chain->start[0] = sel;
+  chain->start[1] = def;
+  return true;
+}
+
+/* Bit-blast ITE chain as sequence of comparators and two-way multiplexers,
+ * i.e., as if it was not recognized as chain. */
+static BzlaAIGVec *
+ite_chain_pairwise(BzlaAIGVecMgr *avmgr,
+                   BzlaAIGVec *av_sel,
+                   uint32_t n,
+                   BzlaBitVector **consts,
+                   BzlaAIGVec **av_cases,
+                   BzlaAIGVec *av_default)
+{
+  uint32_t i;
+  BzlaAIGVec *res, *av_c, *av_eq, *av_tmp;
+
+  res = bzla_aigvec_copy(avmgr, av_default);
+  for (i = n; i > 0; i--)
+  {
+    av_c   = bzla_aigvec_const(avmgr, consts[i - 1]);
+    av_eq  = bzla_aigvec_eq(avmgr, av_sel, av_c);
+    av_tmp = bzla_aigvec_cond(avmgr, av_eq, av_cases[i - 1], res);
+    bzla_aigvec_release_delete(avmgr, res);
+    bzla_aigvec_release_delete(avmgr, av_eq);
+    bzla_aigvec_release_delete(avmgr, av_c);
+    res = av_tmp;
+  }
+  return res;
+}
+
+/* Bit-blast ITE chain 'chain' (see get_ite_chain) as multiplexer tree, or
+ * pairwise if that requires fewer AIG ANDs (for sparse case constants). */
+static BzlaAIGVec *
+synthesize_ite_chain(Bzla *bzla, BzlaNodePtrStack *chain)
+{
+  uint32_t i, n;
+  uint_least64_t num_aigs, num_pairwise, num_mux;
+  BzlaAIGVec *res, *av_sel, *av_def, **av_cases;
+  BzlaBitVector **consts;
+  BzlaAIGVecMgr *avmgr;
+  BzlaAIGMgr *amgr;
+  BzlaMemMgr *mm;
+
+  mm     = bzla->mm;
+  avmgr  = bzla->avmgr;
+  amgr   = avmgr->amgr;
+  n      = BZLA_COUNT_STACK(*chain) / 2 - 1;
+  av_sel = BZLA_AIGVEC_NODE(bzla, BZLA_PEEK_STACK(*chain, 0));
+  av_def = BZLA_AIGVEC_NODE(bzla, BZLA_PEEK_STACK(*chain, 1));
+  BZLA_NEWN(mm, consts, n);
+  BZLA_NEWN(mm, av_cases, n);
+  for (i = 0; i < n; i++)
+  {
+    consts[i]   = bzla_node_bv_const_get_bits(BZLA_PEEK_STACK(*chain, 2 + 2 * i));
+    av_cases[i] = BZLA_AIGVEC_NODE(bzla, BZLA_PEEK_STACK(*chain, 3 + 2 * i));
+  }
+
+  /* AIGs are hash-consed, hence both encodings are measured separately */
+  num_aigs     = amgr->cur_num_aigs;
+  res          = ite_chain_pairwise(avmgr, av_sel, n, consts, av_cases, av_def);
+  num_pairwise = amgr->cur_num_aigs - num_aigs;
+  bzla_aigvec_release_delete(avmgr, res);
+
+  num_aigs = amgr->cur_num_aigs;
+  res      = bzla_aigvec_select(avmgr, av_sel, n, consts, av_cases, av_def);
+  num_mux  = amgr->cur_num_aigs - num_aigs;
+
+  if (num_mux > num_pairwise)
+  {
+    bzla_aigvec_release_delete(avmgr, res);
+    res = ite_chain_pairwise(avmgr, av_sel, n, consts, av_cases, av_def);
+    bzla->stats.ite_chain_aigs += num_pairwise;
+  }
+  else
+  {
+    bzla->stats.ite_chains_mux += 1;
+    bzla->stats.ite_chain_aigs += num_mux;
+  }
+  bzla->stats.ite_chain_aigs_pairwise += num_pairwise;
+  bzla->stats.ite_chains += 1;
+  bzla->stats.ite_chain_cases += n;
+
+  for (i = 0; i < n; i++) bzla_aigvec_release_delete(avmgr, av_cases[i]);
+  BZLA_DELETEN(mm, av_cases, n);
+  BZLA_DELETEN(mm, consts, n);
+  bzla_aigvec_release_delete(avmgr, av_def);
+  bzla_aigvec_release_delete(avmgr, av_sel);
+  return res;
+}
+
 /* bit vector skeleton is always encoded, i.e., if bzla_node_is_synth is true,
  * then it is also encoded. with option lazy_synthesize enabled,
  * 'bzla_synthesize_exp' stops at feq and apply nodes */
 void
 bzla_synthesize_exp(Bzla *bzla, BzlaNode *exp, BzlaPtrHashTable *backannotation)
 {
-  BzlaNodePtrStack exp_stack;
+  BzlaNodePtrStack exp_stack, ite_chain;
   BzlaNode *cur, *wb, *value, *args, *real_e;
   BzlaAIGVec *av0, *av1, *av2;
   BzlaMemMgr *mm;
@@ -2335,7 +2943,8 @@ bzla_synthesize_exp(Bzla *bzla, BzlaNode *exp, BzlaPtrHashTable *backannotation)
   bool invert_av1 = false;
   bool invert_av2 = false;
   double start;
-  bool restart, opt_lazy_synth;
+  bool restart, opt_lazy_synth, is_ite_chain;
+  uint32_t opt_ite_chains;
   BzlaIntHashTable *cache;
 
   assert(bzla);
@@ -2347,8 +2956,19 @@ bzla_synthesize_exp(Bzla *bzla, BzlaNode *exp, BzlaPtrHashTable *backannotation)
   count          = 0;
   cache          = bzla_hashint_table_new(mm);
   opt_lazy_synth = bzla_opt_get(bzla, BZLA_OPT_FUN_LAZY_SYNTHESIZE) == 1;
+  opt_ite_chains = bzla_opt_get(bzla, BZLA_OPT_ITE_CHAINS);
+  /* constant bits handling of the prop engine requires all nodes below
+   * constraints to be synthesized */
+  if (bzla_opt_get(bzla, BZLA_OPT_PROP_CONST_BITS)) opt_ite_chains = 0;
+  /* ITE chain detection depends on the parents of a node, which may change
+   * concurrently while bit-blasting in the background */
+  if (bzla->pipeline) opt_ite_chains = 0;
+  BZLA_TRACE2(synth_start,
+              bzla_node_get_id(exp),
+              bzla_get_aig_mgr(bzla)->num_cnf_clauses);
 
   BZLA_INIT_STACK(mm, exp_stack);
+  BZLA_INIT_STACK(mm, ite_chain);
   BZLA_PUSH_STACK(exp_stack, exp);
   BZLALOG(2, "%s: %s", __FUNCTION__, bzla_util_node2string(exp));
 
@@ -2428,9 +3048,23 @@ bzla_synthesize_exp(Bzla *bzla, BzlaNode *exp, BzlaPtrHashTable *backannotation)
           wb = bzla_fp_word_blast(bzla, cur);
           BZLA_PUSH_STACK(exp_stack, wb);
         }
-        for (j = 1; j <= cur->arity; j++)
+        /* only the leaves of ITE chains are synthesized */
+        if (opt_ite_chains && bzla_node_is_bv_cond(cur) && !cur->parameterized
+            && get_ite_chain(bzla, cur, opt_ite_chains, &ite_chain))
+        {
+          for (j = 1; j <= BZLA_COUNT_STACK(ite_chain); j++)
+          {
+            BZLA_PUSH_STACK(
+                exp_stack,
+                BZLA_PEEK_STACK(ite_chain, BZLA_COUNT_STACK(ite_chain) - j));
+          }
+        }
+        else
         {
-          BZLA_PUSH_STACK(exp_stack, cur->e[cur->arity - j]);
+          for (j = 1; j <= cur->arity; j++)
+          {
+            BZLA_PUSH_STACK(exp_stack, cur->e[cur->arity - j]);
+          }
         }
 
         /* synthesize nodes in static_rho of lambda nodes */
@@ -2470,7 +3104,25 @@ bzla_synthesize_exp(Bzla *bzla, BzlaNode *exp, BzlaPtrHashTable *backannotation)
       {
         assert(bzla_node_is_bv(bzla, cur));
 
-        if (!opt_lazy_synth)
+        is_ite_chain = opt_ite_chains && bzla_node_is_bv_cond(cur)
+                       && get_ite_chain(bzla, cur, opt_ite_chains, &ite_chain);
+        if (is_ite_chain)
+        {
+          /* the chain may have changed since its leaves were pushed */
+          restart = false;
+          for (i = 0; i < BZLA_COUNT_STACK(ite_chain); i++)
+          {
+            real_e = bzla_node_real_addr(BZLA_PEEK_STACK(ite_chain, i));
+            if (!bzla_node_is_synth(real_e))
+            {
+              BZLA_PUSH_STACK(exp_stack, real_e);
+              restart = true;
+              break;
+            }
+          }
+          if (restart) continue;
+        }
+        else if (!opt_lazy_synth)
         {
           /* due to pushing nodes from static_rho onto 'exp_stack' a strict
            * DFS order is not guaranteed anymore. hence, we have to check
@@ -2490,7 +3142,11 @@ bzla_synthesize_exp(Bzla *bzla, BzlaNode *exp, BzlaPtrHashTable *backannotation)
           if (restart) continue;
         }
 
-        if (cur->arity == 1)
+        if (is_ite_chain)
+        {
+          cur->av = synthesize_ite_chain(bzla, &ite_chain);
+        }
+        else if (cur->arity == 1)
         {
           assert(bzla_node_is_bv_slice(cur));
           invert_av0 = bzla_node_is_inverted(cur->e[0]);
@@ -2628,6 +3284,7 @@ bzla_synthesize_exp(Bzla *bzla, BzlaNode *exp, BzlaPtrHashTable *backannotation)
     }
   }
   BZLA_RELEASE_STACK(exp_stack);
+  BZLA_RELEASE_STACK(ite_chain);
   bzla_hashint_table_delete(cache);
 
   if (count > 0 && bzla_opt_get(bzla, BZLA_OPT_VERBOSITY) > 3)
@@ -2635,6 +3292,80 @@ bzla_synthesize_exp(Bzla *bzla, BzlaNode *exp, BzlaPtrHashTable *backannotation)
         bzla->msg, 3, "synthesized %u expressions into AIG vectors", count);
 
   bzla->time.synth_exp += bzla_util_time_stamp() - start;
+  BZLA_TRACE2(synth_done, count, bzla_get_aig_mgr(bzla)->num_cnf_clauses);
+}
+
+/* Bit-blast assumption 'exp' and collect the AIGs of its top-level conjuncts
+ * (constant true conjuncts are skipped). */
+static BzlaAIGPtrStack *
+synthesize_assumption(Bzla *bzla, BzlaNode *exp)
+{
+  assert(bzla);
+  assert(exp);
+  assert(!bzla_node_is_simplified(exp));
+
+  uint32_t i;
+  BzlaNode *cur, *e;
+  BzlaNodePtrStack stack, conjuncts;
+  BzlaAIGPtrStack *res;
+  BzlaAIG *aig;
+  BzlaAIGMgr *amgr;
+  BzlaIntHashTable *mark, *cache;
+  BzlaMemMgr *mm;
+
+  mm    = bzla->mm;
+  amgr  = bzla_get_aig_mgr(bzla);
+  mark  = bzla_hashint_table_new(mm);
+  cache = bzla_hashint_table_new(mm);
+  BZLA_INIT_STACK(mm, stack);
+  BZLA_INIT_STACK(mm, conjuncts);
+
+  if (bzla_node_is_inverted(exp) || !bzla_node_is_bv_and(exp))
+  {
+    BZLA_PUSH_STACK(conjuncts, exp);
+  }
+  else
+  {
+    BZLA_PUSH_STACK(stack, exp);
+    while (!BZLA_EMPTY_STACK(stack))
+    {
+      cur = BZLA_POP_STACK(stack);
+      assert(!bzla_node_is_inverted(cur));
+      assert(bzla_node_is_bv_and(cur));
+      if (bzla_hashint_table_contains(mark, cur->id)) continue;
+      bzla_hashint_table_add(mark, cur->id);
+      for (i = 0; i < 2; i++)
+      {
+        e = cur->e[i];
+        if (!bzla_node_is_inverted(e) && bzla_node_is_bv_and(e))
+          BZLA_PUSH_STACK(stack, e);
+        else if (!bzla_hashint_table_contains(cache, bzla_node_get_id(e)))
+        {
+          bzla_hashint_table_add(cache, bzla_node_get_id(e));
+          BZLA_PUSH_STACK(conjuncts, e);
+        }
+      }
+    }
+  }
+
+  BZLA_NEW(mm, res);
+  BZLA_INIT_STACK(mm, *res);
+  for (i = 0; i < BZLA_COUNT_STACK(conjuncts); i++)
+  {
+    cur = BZLA_PEEK_STACK(conjuncts, i);
+    assert(bzla_node_bv_get_width(bzla, cur) == 1);
+    assert(!bzla_node_is_simplified(cur));
+    aig = exp_to_aig(bzla, cur);
+    bzla_aig_to_sat(amgr, aig);
+    if (aig == BZLA_AIG_TRUE) continue;
+    BZLA_PUSH_STACK(*res, aig);
+  }
+
+  BZLA_RELEASE_STACK(stack);
+  BZLA_RELEASE_STACK(conjuncts);
+  bzla_hashint_table_delete(mark);
+  bzla_hashint_table_delete(cache);
+  return res;
 }
 
 /* forward assumptions to the SAT solver */
@@ -2644,25 +3375,37 @@ bzla_add_again_assumptions(Bzla *bzla)
   assert(bzla);
   assert(bzla_dbg_check_assumptions_simp_free(bzla));
 
-  int32_t i;
-  BzlaNode *exp, *cur, *e;
-  BzlaNodePtrStack stack;
-  BzlaPtrHashTable *assumptions;
+  uint32_t i;
+  double start;
+  BzlaNode *exp;
+  BzlaNodePtrStack stale;
   BzlaPtrHashTableIterator it;
+  BzlaPtrHashBucket *b;
+  BzlaAIGPtrStack *aigs;
   BzlaAIG *aig;
   BzlaSATMgr *smgr;
   BzlaAIGMgr *amgr;
-  BzlaIntHashTable *mark;
-
-  amgr = bzla_get_aig_mgr(bzla);
-  smgr = bzla_get_sat_mgr(bzla);
 
-  BZLA_INIT_STACK(bzla->mm, stack);
-  mark = bzla_hashint_table_new(bzla->mm);
+  start = bzla_util_time_stamp();
+  amgr  = bzla_get_aig_mgr(bzla);
+  smgr  = bzla_get_sat_mgr(bzla);
 
-  assumptions = bzla_hashptr_table_new(bzla->mm,
-                                       (BzlaHashPtr) bzla_node_hash_by_id,
-                                       (BzlaCmpPtr) bzla_node_compare_by_id);
+  /* drop cached assumptions that got simplified in the meantime */
+  BZLA_INIT_STACK(bzla->mm, stale);
+  bzla_iter_hashptr_init(&it, bzla->assumption_cache);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    exp = bzla_iter_hashptr_next(&it);
+    if (bzla_node_is_simplified(exp)) BZLA_PUSH_STACK(stale, exp);
+  }
+  while (!BZLA_EMPTY_STACK(stale))
+  {
+    exp  = BZLA_POP_STACK(stale);
+    aigs = bzla_hashptr_table_get(bzla->assumption_cache, exp)->data.as_ptr;
+    bzla_hashptr_table_remove(bzla->assumption_cache, exp, 0, 0);
+    release_cached_assumption(bzla, exp, aigs);
+  }
+  BZLA_RELEASE_STACK(stale);
 
   bzla_iter_hashptr_init(&it, bzla->assumptions);
   while (bzla_iter_hashptr_has_next(&it))
@@ -2670,55 +3413,35 @@ bzla_add_again_assumptions(Bzla *bzla)
     exp = bzla_iter_hashptr_next(&it);
     assert(!bzla_node_is_simplified(exp));
 
-    if (bzla_node_is_inverted(exp) || !bzla_node_is_bv_and(exp))
+    if ((b = bzla_hashptr_table_get(bzla->assumption_cache, exp)))
     {
-      if (!bzla_hashptr_table_get(assumptions, exp))
-        bzla_hashptr_table_add(assumptions, exp);
+      bzla->stats.assumptions_cached++;
     }
     else
     {
-      BZLA_PUSH_STACK(stack, exp);
-      while (!BZLA_EMPTY_STACK(stack))
-      {
-        cur = BZLA_POP_STACK(stack);
-        assert(!bzla_node_is_inverted(cur));
-        assert(bzla_node_is_bv_and(cur));
-        if (bzla_hashint_table_contains(mark, cur->id)) continue;
-        bzla_hashint_table_add(mark, cur->id);
-        for (i = 0; i < 2; i++)
-        {
-          e = cur->e[i];
-          if (!bzla_node_is_inverted(e) && bzla_node_is_bv_and(e))
-            BZLA_PUSH_STACK(stack, e);
-          else if (!bzla_hashptr_table_get(assumptions, e))
-            bzla_hashptr_table_add(assumptions, e);
-        }
-      }
+      aigs = synthesize_assumption(bzla, exp);
+      b    = bzla_hashptr_table_add(bzla->assumption_cache,
+                                 bzla_node_copy(bzla, exp));
+      b->data.as_ptr = aigs;
+      bzla->stats.assumptions_synthesized++;
     }
-  }
 
-  bzla_iter_hashptr_init(&it, assumptions);
-  while (bzla_iter_hashptr_has_next(&it))
-  {
-    cur = bzla_iter_hashptr_next(&it);
-    assert(bzla_node_bv_get_width(bzla, cur) == 1);
-    assert(!bzla_node_is_simplified(cur));
-    aig = exp_to_aig(bzla, cur);
-    bzla_aig_to_sat(amgr, aig);
-    if (aig == BZLA_AIG_TRUE) continue;
-    if (bzla_sat_is_initialized(smgr))
+    if (!bzla_sat_is_initialized(smgr)) continue;
+
+    aigs = b->data.as_ptr;
+    for (i = 0; i < BZLA_COUNT_STACK(*aigs); i++)
     {
-      assert(bzla_aig_get_cnf_id(aig) != 0);
-      bzla_sat_assume(smgr, bzla_aig_get_cnf_id(aig));
+      aig = BZLA_PEEK_STACK(*aigs, i);
+      /* SAT solver may have been initialized after caching */
+      if (bzla_aig_get_cnf_id(amgr, aig) == 0) bzla_aig_to_sat(amgr, aig);
+      assert(bzla_aig_get_cnf_id(amgr, aig) != 0);
+      bzla_sat_assume(smgr, bzla_aig_get_cnf_id(amgr, aig));
     }
-    bzla_aig_release(amgr, aig);
   }
   /* assert constraints added during word-blasting */
   bzla_fp_word_blaster_add_additional_assertions(bzla);
 
-  BZLA_RELEASE_STACK(stack);
-  bzla_hashptr_table_delete(assumptions);
-  bzla_hashint_table_delete(mark);
+  bzla->time.assumptions += bzla_util_time_stamp() - start;
 }
 
 #if 0
@@ -2801,13 +3524,11 @@ bzla_check_sat(Bzla *bzla, int32_t lod_limit, int32_t sat_limit)
     }
   }
 
-  BZLA_ABORT(bzla->quantifiers->count, "Quantifiers support is disabled.");
-
   // FIXME: this is temporary until we support FP handling with LOD for Lambdas
   if (is_fp_logic(bzla))
   {
     BZLA_MSG(bzla->msg, 1, "found FP expressions, disable lambda extraction");
-    bzla_opt_set(bzla, BZLA_OPT_PP_EXTRACT_LAMBDAS, 0);
+    bzla_set_opt_scoped(bzla, BZLA_OPT_PP_EXTRACT_LAMBDAS, 0);
   }
 
 #ifndef NDEBUG
@@ -2856,14 +3577,14 @@ bzla_check_sat(Bzla *bzla, int32_t lod_limit, int32_t sat_limit)
     BZLA_MSG(bzla->msg,
              1,
              "no UFs or function equalities, enable beta-reduction=all");
-    bzla_opt_set(bzla, BZLA_OPT_PP_BETA_REDUCE, BZLA_BETA_REDUCE_ALL);
+    bzla_set_opt_scoped(bzla, BZLA_OPT_PP_BETA_REDUCE, BZLA_BETA_REDUCE_ALL);
   }
 
   /* Lambdas are not supported with FP right now since we can't handle FP
    * expressions in bzla_eval_exp yet. */
   if (is_fp_logic(bzla))
   {
-    bzla_opt_set(bzla, BZLA_OPT_PP_BETA_REDUCE, BZLA_BETA_REDUCE_FUN);
+    bzla_set_opt_scoped(bzla, BZLA_OPT_PP_BETA_REDUCE, BZLA_BETA_REDUCE_FUN);
   }
 
   // FIXME (ma): not sound with slice elimination. see red-vsl.proof3106.smt2
@@ -2874,20 +3595,22 @@ bzla_check_sat(Bzla *bzla, int32_t lod_limit, int32_t sat_limit)
              1,
              "found %s, disable slice elimination",
              bzla->ufs->count > 0 ? "UFs" : "quantifiers");
-    bzla_opt_set(bzla, BZLA_OPT_PP_ELIMINATE_EXTRACTS, 0);
+    bzla_set_opt_scoped(bzla, BZLA_OPT_PP_ELIMINATE_EXTRACTS, 0);
   }
 
   /* set options for quantifiers */
   if (bzla->quantifiers->count > 0)
   {
-    bzla_opt_set(bzla, BZLA_OPT_PP_UNCONSTRAINED_OPTIMIZATION, 0);
-    bzla_opt_set(bzla, BZLA_OPT_PP_BETA_REDUCE, BZLA_BETA_REDUCE_ALL);
+    bzla_set_opt_scoped(bzla, BZLA_OPT_PP_UNCONSTRAINED_OPTIMIZATION, 0);
+    bzla_set_opt_scoped(bzla, BZLA_OPT_PP_BETA_REDUCE, BZLA_BETA_REDUCE_ALL);
   }
 
   res = bzla_simplify(bzla);
 
   if (res != BZLA_RESULT_UNSAT)
   {
+    /* select engine and SAT solver for -E auto */
+    if (!bzla->slv) bzla_autoconf(bzla);
     engine = bzla_opt_get(bzla, BZLA_OPT_ENGINE);
 
     if (!bzla->slv)
@@ -2923,16 +3646,7 @@ bzla_check_sat(Bzla *bzla, int32_t lod_limit, int32_t sat_limit)
       else if ((engine == BZLA_ENGINE_QUANT && bzla->quantifiers->count > 0)
                || bzla->quantifiers->count > 0)
       {
-        BzlaPtrHashTableIterator it;
-        BzlaNode *cur;
-        bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
-        bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
-        while (bzla_iter_hashptr_has_next(&it))
-        {
-          cur = bzla_node_real_addr(bzla_iter_hashptr_next(&it));
-          BZLA_ABORT(cur->lambda_below || cur->apply_below,
-                     "quantifiers with functions not supported yet");
-        }
+        /* the quantifier solver checks for functions in each call */
         bzla->slv = bzla_new_quantifier_solver(bzla);
       }
       else
@@ -2945,7 +3659,17 @@ bzla_check_sat(Bzla *bzla, int32_t lod_limit, int32_t sat_limit)
     }
 
     assert(bzla->slv);
-    res = bzla->slv->api.sat(bzla->slv);
+    res = BZLA_RESULT_UNKNOWN;
+    if (bzla_opt_get(bzla, BZLA_OPT_BW_REDUCE)
+        && bzla->slv->kind == BZLA_FUN_SOLVER_KIND && !is_fp_logic(bzla))
+    {
+      /* sets bzla->bv_model if sat */
+      res = bzla_bwreduce_check_sat(bzla);
+    }
+    if (res == BZLA_RESULT_UNKNOWN)
+    {
+      res = bzla->slv->api.sat(bzla->slv);
+    }
   }
   bzla->last_sat_result = res;
   bzla->bzla_sat_bzla_called++;
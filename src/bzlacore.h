@@ -21,6 +21,7 @@
 #include "bzlasat.h"
 #include "bzlaslv.h"
 #include "bzlasort.h"
+#include "bzlatermstore.h"
 #include "bzlatypes.h"
 #include "utils/bzlahashint.h"
 #include "utils/bzlamem.h"
@@ -53,11 +54,38 @@ struct BzlaCallbacks
 
     void *fun;   /* termination callback function */
     void *state; /* termination callback function arguments */
+
+    /* set (possibly from another thread) to force termination, checked
+     * before calling the termination callback function */
+    volatile int32_t cancel;
   } term;
+
+  struct
+  {
+    /* external AIG optimizer, reads the AIGER model in file 'in' and writes
+     * an equivalent AIGER model with the same inputs and outputs to file
+     * 'out', returns 0 on success */
+    int32_t (*fun)(void *state, const char *in, const char *out);
+    void *state; /* AIG optimizer arguments */
+  } aig_opt;
 };
 
 typedef struct BzlaCallbacks BzlaCallbacks;
 
+/* Option value set based on formula characteristics within a context level
+ * (incremental mode), restored when the context level is popped. */
+struct BzlaOptTrailEntry
+{
+  uint32_t level;   /* context level the option was set at */
+  BzlaOption opt;   /* the option */
+  uint32_t val;     /* the value set at 'level' */
+  uint32_t old_val; /* the value to restore on pop */
+};
+
+typedef struct BzlaOptTrailEntry BzlaOptTrailEntry;
+
+BZLA_DECLARE_STACK(BzlaOptTrailEntry, BzlaOptTrailEntry);
+
 struct BzlaConstraintStats
 {
   uint32_t varsubst;
@@ -82,8 +110,11 @@ struct Bzla
   BzlaNodePtrStack nodes_id_table;
   BzlaNodeUniqueTable nodes_unique_table;
   BzlaSortUniqueTable sorts_unique_table;
+  BzlaTermStore *term_store; /* store for constant and model values */
+  bool term_store_shared;    /* term_store set via bzla_set_term_store */
 
   BzlaAIGVecMgr *avmgr;
+  struct BzlaPipeline *pipeline; /* background bit-blasting (optional) */
 
   void *word_blaster;
 
@@ -132,13 +163,23 @@ struct Bzla
   BzlaPtrHashTable *assumptions;
   /* maintains the non-simplified (original) assumptions */
   BzlaPtrHashTable *orig_assumptions;
+  /* maps simplified assumptions to the AIGs of their bit-blasted conjuncts
+   * (BzlaAIGPtrStack), kept across incremental calls */
+  BzlaPtrHashTable *assumption_cache;
 
   /* maintain assertions for different contexts push/pop */
   BzlaNodePtrStack assertions;
   /* caches the assertions on stack 'assertions' */
   BzlaIntHashTable *assertions_cache;
+
   /* saves the number of assertions on each push */
   BzlaUIntStack assertions_trail;
+  /* options set based on formula characteristics at context level > 0 */
+  BzlaOptTrailEntryStack opt_trail;
+
+  /* reusable temporary bit-vectors, e.g., for inverse value computation */
+  BzlaBitVectorScratch bv_scratch;
+
   /* Number of push/pop calls (used for unique symbol prefixes) */
   uint32_t num_push_pop;
 
@@ -149,8 +190,10 @@ struct Bzla
   FILE *apitrace;
   int8_t close_apitrace;
 
-  BzlaOpt *options;
-  BzlaPtrHashTable *str2opt;
+  const BzlaOpt *options;     /* shared option metadata */
+  BzlaPtrHashTable *str2opt;  /* shared, maps long option names to options */
+  uint32_t optvals[BZLA_OPT_NUM_OPTS];
+  char *optvalstrs[BZLA_OPT_NUM_OPTS];
 
   BzlaMsg *msg;
   BzlaRNG *rng;
@@ -191,6 +234,19 @@ struct Bzla
     BzlaPtrHashTable *rw_rules_applied;
 #endif
     uint_least64_t rewrite_synth;
+    uint32_t bw_reduce_abstractions; /* number of bit-width reductions */
+    uint32_t bw_reduce_sat;          /* number of sat bit-width reductions */
+    uint32_t ite_chains;             /* number of bit-blasted ITE chains */
+    uint32_t ite_chains_mux;         /* number of mux encoded ITE chains */
+    uint32_t ite_chain_cases;        /* number of cases in ITE chains */
+    uint_least64_t ite_chain_aigs;   /* number of ANDs of ITE chains */
+    uint_least64_t ite_chain_aigs_pairwise; /* ... with pairwise encoding */
+    uint32_t assumptions_synthesized; /* number of bit-blasted assumptions */
+    uint_least64_t assumptions_cached; /* number of reused assumptions */
+    uint32_t pipeline_synthesized; /* number of formulas bit-blasted in
+                                      background */
+    uint32_t pipeline_skipped;     /* number of formulas not supported by
+                                      background bit-blasting */
   } stats;
 
   struct
@@ -217,6 +273,9 @@ struct Bzla
     double ack;
     double rewrite;
     double occurrence;
+    double bw_reduce;
+    double assumptions;
+    double pipeline_sync; /* waiting for background bit-blasting */
   } time;
 };
 
@@ -241,6 +300,27 @@ void *bzla_get_term_state(Bzla *bzla);
 /* Determine if bitwuzla has been terminated via termination callback. */
 int32_t bzla_terminate(Bzla *bzla);
 
+/* Set cancellation flag, which forces termination independently from the
+ * termination callback function. Setting the flag is safe while another
+ * thread checks satisfiability, but requires that termination checks have
+ * been enabled before via bzla_set_term. */
+void bzla_set_cancel(Bzla *bzla, bool cancel);
+
+/* Set AIG optimizer callback, which is applied to the AIGs of constraints
+ * before they are encoded to SAT (see BzlaCallbacks). Disabled if 'fun' is 0.
+ * Only used for formulas without functions and quantifiers. */
+void bzla_set_aig_optimizer(Bzla *bzla,
+                            int32_t (*fun)(void *state,
+                                           const char *in,
+                                           const char *out),
+                            void *state);
+
+/* Attach given shared term store, which replaces the term store owned by
+ * 'bzla'. Values of bit-vector constants and model values (including the
+ * already existing ones) are then stored in and shared via the term store.
+ * Increments the reference count of the store. */
+void bzla_set_term_store(Bzla *bzla, BzlaTermStore *store);
+
 /* Set verbosity message prefix. */
 void bzla_set_msg_prefix(Bzla *bzla, const char *prefix);
 
@@ -278,9 +358,16 @@ int32_t bzla_check_sat(Bzla *bzla, int32_t lod_limit, int32_t sat_limit);
 BzlaSATMgr *bzla_get_sat_mgr(const Bzla *bzla);
 BzlaAIGMgr *bzla_get_aig_mgr(const Bzla *bzla);
 
-void bzla_push(Bzla *bzla, uint32_t level);
+/* Push 'nlevels' context levels. */
+void bzla_push(Bzla *bzla, uint32_t nlevels);
+
+/* Pop 'nlevels' context levels, removes the assertions of these levels and
+ * restores options set via bzla_set_opt_scoped at these levels. */
+void bzla_pop(Bzla *bzla, uint32_t nlevels);
 
-void bzla_pop(Bzla *bzla, uint32_t level);
+/* Set option 'opt' to 'val' based on the characteristics of the current
+ * formula. At context level > 0, the previous value is restored on pop. */
+void bzla_set_opt_scoped(Bzla *bzla, BzlaOption opt, uint32_t val);
 
 /*------------------------------------------------------------------------*/
 
@@ -324,6 +411,8 @@ BzlaNode *bzla_find_substitution(Bzla *, BzlaNode *);
 void bzla_reset_incremental_usage(Bzla *bzla);
 void bzla_add_again_assumptions(Bzla *bzla);
 void bzla_process_unsynthesized_constraints(Bzla *bzla);
+/* Synthesize single unsynthesized constraint. */
+void bzla_synthesize_constraint(Bzla *bzla, BzlaNode *constraint);
 void bzla_insert_unsynthesized_constraint(Bzla *bzla, BzlaNode *constraint);
 void bzla_set_simplified_exp(Bzla *bzla, BzlaNode *exp, BzlaNode *simplified);
 void bzla_delete_varsubst_constraints(Bzla *bzla);
@@ -32,9 +32,9 @@
 /* Check invertibility without considering constant bits in x.                */
 /* -------------------------------------------------------------------------- */
 
-typedef BzlaBitVector *(*BzlaBitVectorBinFun)(BzlaMemMgr *,
-                                              const BzlaBitVector *,
-                                              const BzlaBitVector *);
+typedef void (*BzlaBitVectorBinIntoFun)(BzlaBitVector *,
+                                        const BzlaBitVector *,
+                                        const BzlaBitVector *);
 
 /**
  * Check invertibility condition (without considering const bits in x) for:
@@ -70,17 +70,20 @@ bzla_is_inv_and(Bzla *bzla, BzlaPropInfo *pi)
   (void) bzla;
 
   bool res;
+  uint32_t mark;
   const BzlaBitVector *s, *t;
   BzlaBitVector *t_and_s;
-  BzlaMemMgr *mm;
+  BzlaBitVectorScratch *scratch;
 
   s = pi->bv[1 - pi->pos_x];
   t = pi->target_value;
 
-  mm      = bzla->mm;
-  t_and_s = bzla_bv_and(mm, t, s);
-  res     = bzla_bv_compare(t_and_s, t) == 0;
-  bzla_bv_free(mm, t_and_s);
+  scratch = &bzla->bv_scratch;
+  mark    = bzla_bv_scratch_mark(scratch);
+  t_and_s = bzla_bv_scratch_get(scratch, bzla_bv_get_width(t));
+  bzla_bv_and_into(t_and_s, t, s);
+  res = bzla_bv_compare(t_and_s, t) == 0;
+  bzla_bv_scratch_release(scratch, mark);
   return res;
 }
 
@@ -106,27 +109,29 @@ bzla_is_inv_concat(Bzla *bzla, BzlaPropInfo *pi)
   const BzlaBitVector *s, *t;
   BzlaBitVector *slice;
   bool res;
-  uint32_t bw_s, bw_t;
-  BzlaMemMgr *mm;
+  uint32_t bw_s, bw_t, mark;
+  BzlaBitVectorScratch *scratch;
 
-  mm = bzla->mm;
+  scratch = &bzla->bv_scratch;
 
   s    = pi->bv[1 - pi->pos_x];
   t    = pi->target_value;
   bw_s = bzla_bv_get_width(s);
   bw_t = bzla_bv_get_width(t);
 
+  mark  = bzla_bv_scratch_mark(scratch);
+  slice = bzla_bv_scratch_get(scratch, bw_s);
   if (pi->pos_x == 0)
   {
-    slice = bzla_bv_slice(mm, t, bw_s - 1, 0);
+    bzla_bv_slice_into(slice, t, bw_s - 1, 0);
   }
   else
   {
     assert(pi->pos_x == 1);
-    slice = bzla_bv_slice(mm, t, bw_t - 1, bw_t - bw_s);
+    bzla_bv_slice_into(slice, t, bw_t - 1, bw_t - bw_s);
   }
   res = bzla_bv_compare(s, slice) == 0;
-  bzla_bv_free(mm, slice);
+  bzla_bv_scratch_release(scratch, mark);
   return res;
 }
 
@@ -163,21 +168,22 @@ bzla_is_inv_mul(Bzla *bzla, BzlaPropInfo *pi)
   assert(pi);
 
   bool res;
+  uint32_t mark;
   const BzlaBitVector *s, *t;
-  BzlaBitVector *neg_s, *neg_s_or_s, *and_t;
-  BzlaMemMgr *mm;
+  BzlaBitVector *tmp;
+  BzlaBitVectorScratch *scratch;
 
   s = pi->bv[1 - pi->pos_x];
   t = pi->target_value;
 
-  mm         = bzla->mm;
-  neg_s      = bzla_bv_neg(mm, s);
-  neg_s_or_s = bzla_bv_or(mm, neg_s, s);
-  and_t      = bzla_bv_and(mm, neg_s_or_s, t);
-  res        = bzla_bv_compare(and_t, t) == 0;
-  bzla_bv_free(mm, neg_s);
-  bzla_bv_free(mm, neg_s_or_s);
-  bzla_bv_free(mm, and_t);
+  scratch = &bzla->bv_scratch;
+  mark    = bzla_bv_scratch_mark(scratch);
+  tmp     = bzla_bv_scratch_get(scratch, bzla_bv_get_width(s));
+  bzla_bv_neg_into(tmp, s);
+  bzla_bv_or_into(tmp, tmp, s);
+  bzla_bv_and_into(tmp, tmp, t);
+  res = bzla_bv_compare(tmp, t) == 0;
+  bzla_bv_scratch_release(scratch, mark);
   return res;
 }
 
@@ -227,36 +233,37 @@ is_inv_shift(Bzla *bzla, BzlaPropInfo *pi, BzlaBvShiftKind kind)
   assert(pi);
 
   bool res;
-  BzlaMemMgr *mm;
   const BzlaBitVector *s, *t;
-  BzlaBitVector *shift1, *shift2, *bw_bv, *not_s = 0, *not_t = 0;
+  BzlaBitVector *shift, *bw_bv, *not_s, *not_t;
   int32_t pos_x, cmp;
-  uint32_t bw, cnt_t, cnt_s;
-  BzlaBitVectorBinFun shift1_fun, shift2_fun;
+  uint32_t bw, cnt_t, cnt_s, mark;
+  BzlaBitVectorBinIntoFun shift1_fun, shift2_fun;
   uint32_t (*count_fun)(const BzlaBitVector *) = 0;
-  BzlaBitVector *(*ishift_fun)(BzlaMemMgr *, const BzlaBitVector *, uint64_t);
+  void (*ishift_fun)(BzlaBitVector *, const BzlaBitVector *, uint64_t);
+  BzlaBitVectorScratch *scratch;
 
-  mm    = bzla->mm;
-  pos_x = pi->pos_x;
-  s     = pi->bv[1 - pos_x];
-  t     = pi->target_value;
-  bw    = bzla_bv_get_width(s);
+  scratch = &bzla->bv_scratch;
+  pos_x   = pi->pos_x;
+  s       = pi->bv[1 - pos_x];
+  t       = pi->target_value;
+  bw      = bzla_bv_get_width(s);
+  mark    = bzla_bv_scratch_mark(scratch);
 
   ishift_fun = 0;
 
   if (kind == BZLA_BV_SHIFT_SLL)
   {
     count_fun  = bzla_bv_get_num_trailing_zeros;
-    shift1_fun = bzla_bv_srl;
-    shift2_fun = bzla_bv_sll;
-    ishift_fun = bzla_bv_sll_uint64;
+    shift1_fun = bzla_bv_srl_into;
+    shift2_fun = bzla_bv_sll_into;
+    ishift_fun = bzla_bv_sll_uint64_into;
   }
   else if (kind == BZLA_BV_SHIFT_SRL)
   {
     count_fun  = bzla_bv_get_num_leading_zeros;
-    shift1_fun = bzla_bv_sll;
-    shift2_fun = bzla_bv_srl;
-    ishift_fun = bzla_bv_srl_uint64;
+    shift1_fun = bzla_bv_sll_into;
+    shift2_fun = bzla_bv_srl_into;
+    ishift_fun = bzla_bv_srl_uint64_into;
   }
   else
   {
@@ -265,39 +272,40 @@ is_inv_shift(Bzla *bzla, BzlaPropInfo *pi, BzlaBvShiftKind kind)
     {
       if (bzla_bv_get_bit(s, bw - 1) == 1)
       {
-        not_s = bzla_bv_not(mm, s);
-        not_t = bzla_bv_not(mm, t);
-        s     = not_s;
-        t     = not_t;
+        not_s = bzla_bv_scratch_get(scratch, bw);
+        not_t = bzla_bv_scratch_get(scratch, bw);
+        bzla_bv_not_into(not_s, s);
+        bzla_bv_not_into(not_t, t);
+        s = not_s;
+        t = not_t;
       }
 
       count_fun  = bzla_bv_get_num_leading_zeros;
-      shift1_fun = bzla_bv_sll;
-      shift2_fun = bzla_bv_srl;
-      ishift_fun = bzla_bv_srl_uint64;
+      shift1_fun = bzla_bv_sll_into;
+      shift2_fun = bzla_bv_srl_into;
+      ishift_fun = bzla_bv_srl_uint64_into;
       kind       = BZLA_BV_SHIFT_SRL;
     }
     else
     {
-      shift1_fun = bzla_bv_sll;
-      shift2_fun = bzla_bv_sra;
+      shift1_fun = bzla_bv_sll_into;
+      shift2_fun = bzla_bv_sra_into;
     }
   }
 
   if (pos_x == 0)
   {
-    shift1 = shift1_fun(mm, t, s);
-    shift2 = shift2_fun(mm, shift1, s);
-    res    = bzla_bv_compare(shift2, t) == 0;
-    bzla_bv_free(mm, shift1);
-    bzla_bv_free(mm, shift2);
-    bw_bv = bzla_bv_uint64_to_bv(mm, bw, bw);
-    cmp   = bzla_bv_compare(s, bw_bv);
+    shift = bzla_bv_scratch_get(scratch, bw);
+    shift1_fun(shift, t, s);
+    shift2_fun(shift, shift, s);
+    res   = bzla_bv_compare(shift, t) == 0;
+    bw_bv = bzla_bv_scratch_get(scratch, bw);
+    bzla_bv_set_uint64(bw_bv, bw);
+    cmp = bzla_bv_compare(s, bw_bv);
     if (cmp >= 0 && kind == BZLA_BV_SHIFT_SRA)
     {
       res = bzla_bv_is_zero(t) || bzla_bv_is_ones(t);
     }
-    bzla_bv_free(mm, bw_bv);
   }
   else
   {
@@ -320,18 +328,13 @@ is_inv_shift(Bzla *bzla, BzlaPropInfo *pi, BzlaBvShiftKind kind)
       else
       {
         assert(ishift_fun);
-        shift1 = ishift_fun(mm, s, cnt_t - cnt_s);
-        res    = bzla_bv_compare(shift1, t) == 0;
-        bzla_bv_free(mm, shift1);
+        shift = bzla_bv_scratch_get(scratch, bw);
+        ishift_fun(shift, s, cnt_t - cnt_s);
+        res = bzla_bv_compare(shift, t) == 0;
       }
     }
   }
-  if (not_s)
-  {
-    assert(not_t);
-    bzla_bv_free(mm, not_s);
-    bzla_bv_free(mm, not_t);
-  }
+  bzla_bv_scratch_release(scratch, mark);
   return res;
 }
 
@@ -449,29 +452,30 @@ bzla_is_inv_udiv(Bzla *bzla, BzlaPropInfo *pi)
   assert(pi);
 
   bool res;
+  uint32_t mark;
   BzlaBitVector *udiv;
   const BzlaBitVector *s, *t;
-  BzlaMemMgr *mm;
+  BzlaBitVectorScratch *scratch;
 
   s = pi->bv[1 - pi->pos_x];
   t = pi->target_value;
 
-  mm = bzla->mm;
+  scratch = &bzla->bv_scratch;
+  mark    = bzla_bv_scratch_mark(scratch);
+  udiv    = bzla_bv_scratch_get(scratch, bzla_bv_get_width(t));
   if (pi->pos_x == 0)
   {
-    BzlaBitVector *s_mul_t = bzla_bv_mul(mm, s, t);
-    udiv                   = bzla_bv_udiv(mm, s_mul_t, s);
-    bzla_bv_free(mm, s_mul_t);
+    bzla_bv_mul_into(udiv, s, t);
+    bzla_bv_udiv_into(udiv, udiv, s);
   }
   else
   {
     assert(pi->pos_x == 1);
-    BzlaBitVector *s_udiv_t = bzla_bv_udiv(mm, s, t);
-    udiv                    = bzla_bv_udiv(mm, s, s_udiv_t);
-    bzla_bv_free(mm, s_udiv_t);
+    bzla_bv_udiv_into(udiv, s, t);
+    bzla_bv_udiv_into(udiv, s, udiv);
   }
   res = bzla_bv_compare(udiv, t) == 0;
-  bzla_bv_free(mm, udiv);
+  bzla_bv_scratch_release(scratch, mark);
   return res;
 }
 
@@ -493,34 +497,33 @@ bzla_is_inv_urem(Bzla *bzla, BzlaPropInfo *pi)
   assert(pi);
 
   bool res;
+  uint32_t mark;
   const BzlaBitVector *s, *t;
-  BzlaBitVector *neg_s;
-  BzlaMemMgr *mm;
+  BzlaBitVector *tmp;
+  BzlaBitVectorScratch *scratch;
 
   s = pi->bv[1 - pi->pos_x];
   t = pi->target_value;
 
-  mm    = bzla->mm;
-  neg_s = bzla_bv_neg(mm, s);
+  scratch = &bzla->bv_scratch;
+  mark    = bzla_bv_scratch_mark(scratch);
+  tmp     = bzla_bv_scratch_get(scratch, bzla_bv_get_width(s));
 
   if (pi->pos_x == 0)
   {
-    BzlaBitVector *not_neg_s = bzla_bv_not(mm, neg_s);
-    res                      = bzla_bv_compare(t, not_neg_s) <= 0;
-    bzla_bv_free(mm, not_neg_s);
+    bzla_bv_neg_into(tmp, s);
+    bzla_bv_not_into(tmp, tmp);
+    res = bzla_bv_compare(t, tmp) <= 0;
   }
   else
   {
     assert(pi->pos_x == 1);
-    BzlaBitVector *t_add_t = bzla_bv_add(mm, t, t);
-    BzlaBitVector *sub_s   = bzla_bv_add(mm, t_add_t, neg_s);
-    BzlaBitVector *and_s   = bzla_bv_and(mm, sub_s, s);
-    res                    = bzla_bv_compare(t, and_s) <= 0;
-    bzla_bv_free(mm, t_add_t);
-    bzla_bv_free(mm, sub_s);
-    bzla_bv_free(mm, and_s);
+    bzla_bv_add_into(tmp, t, t);
+    bzla_bv_sub_into(tmp, tmp, s);
+    bzla_bv_and_into(tmp, tmp, s);
+    res = bzla_bv_compare(t, tmp) <= 0;
   }
-  bzla_bv_free(mm, neg_s);
+  bzla_bv_scratch_release(scratch, mark);
   return res;
 }
 
@@ -598,28 +601,32 @@ bzla_is_inv_sext(Bzla *bzla, BzlaPropInfo *pi)
 
   bool res = false;
   BzlaMemMgr *mm;
-  uint32_t n, bw;
+  uint32_t n, bw, mark;
   const BzlaBitVector *t;
   BzlaBitVector *t_ext, *t_x;
+  BzlaBitVectorScratch *scratch;
 
   /* Note: pi->exp is a concat representing a sign_extend. pi->bv store the
    * assignments to the concat's operands. */
 
-  mm = bzla->mm;
-  n  = bzla_bv_get_width(pi->bv[0]);
-  t  = pi->target_value;
+  mm      = bzla->mm;
+  scratch = &bzla->bv_scratch;
+  n       = bzla_bv_get_width(pi->bv[0]);
+  t       = pi->target_value;
 
   bw    = bzla_bv_get_width(t);
-  t_ext = bzla_bv_slice(mm, t, bw - 1, bw - n - 1);
-  t_x   = bzla_bv_slice(mm, t, bw - 1 - n, 0);
+  mark  = bzla_bv_scratch_mark(scratch);
+  t_ext = bzla_bv_scratch_get(scratch, n + 1);
+  bzla_bv_slice_into(t_ext, t, bw - 1, bw - n - 1);
 
   if (bzla_bv_is_zero(t_ext) || bzla_bv_is_ones(t_ext))
   {
     res = true;
+    t_x = bzla_bv_scratch_get(scratch, bw - n);
+    bzla_bv_slice_into(t_x, t, bw - 1 - n, 0);
     bzla_propinfo_set_result(bzla, pi, bzla_bvdomain_new(mm, t_x, t_x));
   }
-  bzla_bv_free(mm, t_ext);
-  bzla_bv_free(mm, t_x);
+  bzla_bv_scratch_release(scratch, mark);
   return res;
 }
 
@@ -660,18 +667,21 @@ bzla_is_inv_add_const(Bzla *bzla, BzlaPropInfo *pi)
   assert(pi);
 
   bool res;
+  uint32_t mark;
   const BzlaBitVector *s, *t;
   BzlaBitVector *sub;
-  BzlaMemMgr *mm;
+  BzlaBitVectorScratch *scratch;
 
-  mm = bzla->mm;
+  scratch = &bzla->bv_scratch;
   bzla_propinfo_set_result(bzla, pi, 0);
   s = pi->bv[1 - pi->pos_x];
   t = pi->target_value;
 
-  sub = bzla_bv_sub(mm, t, s);
-  res = bzla_bvdomain_check_fixed_bits(mm, pi->bvd[pi->pos_x], sub);
-  bzla_bv_free(mm, sub);
+  mark = bzla_bv_scratch_mark(scratch);
+  sub  = bzla_bv_scratch_get(scratch, bzla_bv_get_width(t));
+  bzla_bv_sub_into(sub, t, s);
+  res = bzla_bvdomain_check_fixed_bits(bzla->mm, pi->bvd[pi->pos_x], sub);
+  bzla_bv_scratch_release(scratch, mark);
   return res;
 }
 
@@ -697,11 +707,12 @@ bzla_is_inv_and_const(Bzla *bzla, BzlaPropInfo *pi)
   bool res;
   const BzlaBitVector *s, *t;
   int32_t pos_x;
-  BzlaBitVector *and1, *and2, *and3, *mask;
+  uint32_t bw, mark;
+  BzlaBitVector *and1, *and2, *mask;
   const BzlaBvDomain *x;
-  BzlaMemMgr *mm;
+  BzlaBitVectorScratch *scratch;
 
-  mm = bzla->mm;
+  scratch = &bzla->bv_scratch;
   bzla_propinfo_set_result(bzla, pi, 0);
   pos_x = pi->pos_x;
   x     = pi->bvd[pos_x];
@@ -710,15 +721,18 @@ bzla_is_inv_and_const(Bzla *bzla, BzlaPropInfo *pi)
 
   if (!bzla_is_inv_and(bzla, pi)) return false;
 
-  mask = bzla_bv_xnor(mm, x->lo, x->hi);
-  and1 = bzla_bv_and(mm, s, x->hi);
-  and2 = bzla_bv_and(mm, and1, mask);
-  and3 = bzla_bv_and(mm, t, mask);
-  res  = bzla_bv_compare(and2, and3) == 0;
-  bzla_bv_free(mm, and1);
-  bzla_bv_free(mm, and2);
-  bzla_bv_free(mm, and3);
-  bzla_bv_free(mm, mask);
+  bw   = bzla_bv_get_width(t);
+  mark = bzla_bv_scratch_mark(scratch);
+  mask = bzla_bv_scratch_get(scratch, bw);
+  and1 = bzla_bv_scratch_get(scratch, bw);
+  and2 = bzla_bv_scratch_get(scratch, bw);
+  bzla_bv_xor_into(mask, x->lo, x->hi);
+  bzla_bv_not_into(mask, mask);
+  bzla_bv_and_into(and1, s, x->hi);
+  bzla_bv_and_into(and1, and1, mask);
+  bzla_bv_and_into(and2, t, mask);
+  res = bzla_bv_compare(and1, and2) == 0;
+  bzla_bv_scratch_release(scratch, mark);
   return res;
 }
 
@@ -739,15 +753,15 @@ bzla_is_inv_concat_const(Bzla *bzla, BzlaPropInfo *pi)
 
   bool res;
   int32_t pos_x;
-  uint32_t bw_t, bw_s, bw_x;
+  uint32_t bw_t, bw_s, bw_x, mark;
   BzlaBitVector *t_x;
   const BzlaBitVector *s, *t;
   const BzlaBvDomain *x;
-  BzlaMemMgr *mm;
+  BzlaBitVectorScratch *scratch;
 
   if (!bzla_is_inv_concat(bzla, pi)) return false;
 
-  mm = bzla->mm;
+  scratch = &bzla->bv_scratch;
   bzla_propinfo_set_result(bzla, pi, 0);
   pos_x = pi->pos_x;
   x     = pi->bvd[pos_x];
@@ -758,17 +772,19 @@ bzla_is_inv_concat_const(Bzla *bzla, BzlaPropInfo *pi)
   bw_s = bzla_bv_get_width(s);
   bw_x = bzla_bvdomain_get_width(x);
 
+  mark = bzla_bv_scratch_mark(scratch);
+  t_x  = bzla_bv_scratch_get(scratch, bw_x);
   if (pos_x == 0)
   {
-    t_x = bzla_bv_slice(mm, t, bw_t - 1, bw_s);
+    bzla_bv_slice_into(t_x, t, bw_t - 1, bw_s);
   }
   else
   {
-    t_x = bzla_bv_slice(mm, t, bw_x - 1, 0);
+    bzla_bv_slice_into(t_x, t, bw_x - 1, 0);
   }
 
-  res = bzla_bvdomain_check_fixed_bits(mm, x, t_x);
-  bzla_bv_free(mm, t_x);
+  res = bzla_bvdomain_check_fixed_bits(bzla->mm, x, t_x);
+  bzla_bv_scratch_release(scratch, mark);
   return res;
 }
 
@@ -815,10 +831,13 @@ bzla_is_inv_mul_const(Bzla *bzla, BzlaPropInfo *pi)
   BzlaBitVector *mod_inv_s, *x;
   BzlaMemMgr *mm;
   int32_t pos_x;
+  uint32_t mark;
   const BzlaBitVector *s, *t;
   const BzlaBvDomain *d_x;
+  BzlaBitVectorScratch *scratch;
 
-  mm = bzla->mm;
+  mm      = bzla->mm;
+  scratch = &bzla->bv_scratch;
   bzla_propinfo_set_result(bzla, pi, 0);
   pos_x = pi->pos_x;
   d_x   = pi->bvd[pos_x];
@@ -828,12 +847,13 @@ bzla_is_inv_mul_const(Bzla *bzla, BzlaPropInfo *pi)
 
   if (res && !bzla_bv_is_zero(s) && bzla_bvdomain_has_fixed_bits(mm, d_x))
   {
+    mark = bzla_bv_scratch_mark(scratch);
+    x    = bzla_bv_scratch_get(scratch, bzla_bv_get_width(s));
     /* d_x is constant */
     if (bzla_bvdomain_is_fixed(mm, d_x))
     {
-      x   = bzla_bv_mul(mm, d_x->lo, s);
+      bzla_bv_mul_into(x, d_x->lo, s);
       res = bzla_bv_compare(x, t) == 0;
-      bzla_bv_free(mm, x);
     }
     else
     {
@@ -843,13 +863,12 @@ bzla_is_inv_mul_const(Bzla *bzla, BzlaPropInfo *pi)
       if (lsb_s)
       {
         mod_inv_s = bzla_bv_mod_inverse(mm, s);
-        x         = bzla_bv_mul(mm, mod_inv_s, t);
-        res       = bzla_bvdomain_check_fixed_bits(mm, d_x, x);
+        bzla_bv_mul_into(x, mod_inv_s, t);
+        res = bzla_bvdomain_check_fixed_bits(mm, d_x, x);
         if (res)
         {
           bzla_propinfo_set_result(bzla, pi, bzla_bvdomain_new(mm, x, x));
         }
-        bzla_bv_free(mm, x);
         bzla_bv_free(mm, mod_inv_s);
       }
       /* s even */
@@ -860,51 +879,50 @@ bzla_is_inv_mul_const(Bzla *bzla, BzlaPropInfo *pi)
          * match corresponding constant bits of d_x, i.e.
          * mcb(d_x[bw - ctz(s) - 1:0], x'[bw - ctz(s) - 1:0]). */
 
-        BzlaBitVector *tmp_s, *tmp_t, *tmp_x, *x_lo_sliced, *x_hi_sliced;
+        BzlaBitVector *tmp_s, *tmp_t, *x_lo_sliced, *x_hi_sliced;
         BzlaBitVector *lo, *hi, *mask_x;
         BzlaBvDomain *d_tmp_x_sliced;
         uint32_t bw   = bzla_bv_get_width(s);
         uint32_t tz_s = bzla_bv_get_num_trailing_zeros(s);
         assert(tz_s <= bzla_bv_get_num_trailing_zeros(t));
 
-        tmp_s = bzla_bv_srl_uint64(mm, s, tz_s);
-        tmp_t = bzla_bv_srl_uint64(mm, t, tz_s);
+        tmp_s = bzla_bv_scratch_get(scratch, bw);
+        tmp_t = bzla_bv_scratch_get(scratch, bw);
+        bzla_bv_srl_uint64_into(tmp_s, s, tz_s);
+        bzla_bv_srl_uint64_into(tmp_t, t, tz_s);
 
         assert(bzla_bv_get_bit(tmp_s, 0) == 1);
 
         mod_inv_s = bzla_bv_mod_inverse(mm, tmp_s);
-        bzla_bv_free(mm, tmp_s);
-
-        tmp_x = bzla_bv_mul(mm, mod_inv_s, tmp_t);
-        bzla_bv_free(mm, tmp_t);
+        bzla_bv_mul_into(x, mod_inv_s, tmp_t);
         bzla_bv_free(mm, mod_inv_s);
 
-        /* Check if relevant bits of tmp_x match corresponding constant bits of
-         * d_x, i.e. mcb(d_x[bw - ctz(s) - 1:0], tmp_x[bw - ctz(s) - 1:0]). */
+        /* Check if relevant bits of x match corresponding constant bits of
+         * d_x, i.e. mcb(d_x[bw - ctz(s) - 1:0], x[bw - ctz(s) - 1:0]). */
         d_tmp_x_sliced = bzla_bvdomain_slice(mm, d_x, bw - tz_s - 1, 0);
-        mask_x         = bzla_bv_slice(mm, tmp_x, bw - tz_s - 1, 0);
+        mask_x         = bzla_bv_scratch_get(scratch, bw - tz_s);
+        bzla_bv_slice_into(mask_x, x, bw - tz_s - 1, 0);
         res = bzla_bvdomain_check_fixed_bits(mm, d_tmp_x_sliced, mask_x);
 
         if (res)
         {
-          /* Result domain is d_x[bw - 1:ctz(s)] o tmp_x[bw - ctz(s) - 1:0] */
-          x_lo_sliced = bzla_bv_slice(mm, d_x->lo, bw - 1, bw - tz_s);
-          x_hi_sliced = bzla_bv_slice(mm, d_x->hi, bw - 1, bw - tz_s);
-          lo          = bzla_bv_concat(mm, x_lo_sliced, mask_x);
-          hi          = bzla_bv_concat(mm, x_hi_sliced, mask_x);
+          /* Result domain is d_x[bw - 1:ctz(s)] o x[bw - ctz(s) - 1:0] */
+          x_lo_sliced = bzla_bv_scratch_get(scratch, tz_s);
+          x_hi_sliced = bzla_bv_scratch_get(scratch, tz_s);
+          lo          = bzla_bv_scratch_get(scratch, bw);
+          hi          = bzla_bv_scratch_get(scratch, bw);
+          bzla_bv_slice_into(x_lo_sliced, d_x->lo, bw - 1, bw - tz_s);
+          bzla_bv_slice_into(x_hi_sliced, d_x->hi, bw - 1, bw - tz_s);
+          bzla_bv_concat_into(lo, x_lo_sliced, mask_x);
+          bzla_bv_concat_into(hi, x_hi_sliced, mask_x);
 
           bzla_propinfo_set_result(bzla, pi, bzla_bvdomain_new(mm, lo, hi));
-          bzla_bv_free(mm, lo);
-          bzla_bv_free(mm, hi);
-          bzla_bv_free(mm, x_lo_sliced);
-          bzla_bv_free(mm, x_hi_sliced);
         }
 
         bzla_bvdomain_free(mm, d_tmp_x_sliced);
-        bzla_bv_free(mm, mask_x);
-        bzla_bv_free(mm, tmp_x);
       }
     }
+    bzla_bv_scratch_release(scratch, mark);
   }
   return res;
 }
@@ -950,33 +968,35 @@ is_inv_shift_const(Bzla *bzla, BzlaPropInfo *pi, BzlaBvShiftKind kind)
   assert(bzla);
   assert(pi);
 
-  uint32_t pos_x, bw, cnt_s, cnt_t;
+  uint32_t pos_x, bw, cnt_s, cnt_t, mark;
   bool res;
-  BzlaBitVector *shift_hi, *shift_lo, *and, * or ;
-  BzlaBitVector *bv, *min, *not_s = 0, *not_t = 0;
+  BzlaBitVector *shift_hi, *shift_lo, *bv, *min, *not_s, *not_t;
   BzlaBvDomainGenerator gen;
   BzlaMemMgr *mm;
-  BzlaBitVectorBinFun bv_fun                   = 0;
+  BzlaBitVectorBinIntoFun bv_fun               = 0;
   uint32_t (*count_fun)(const BzlaBitVector *) = 0;
   const BzlaBvDomain *x;
   const BzlaBitVector *s, *t;
+  BzlaBitVectorScratch *scratch;
 
-  pos_x = pi->pos_x;
-  mm    = bzla->mm;
-  x     = pi->bvd[pos_x];
-  s     = pi->bv[1 - pos_x];
-  t     = pi->target_value;
-  bw    = bzla_bv_get_width(s);
+  pos_x   = pi->pos_x;
+  mm      = bzla->mm;
+  scratch = &bzla->bv_scratch;
+  x       = pi->bvd[pos_x];
+  s       = pi->bv[1 - pos_x];
+  t       = pi->target_value;
+  bw      = bzla_bv_get_width(s);
+  mark    = bzla_bv_scratch_mark(scratch);
 
   if (kind == BZLA_BV_SHIFT_SLL)
   {
-    bv_fun    = bzla_bv_sll;
+    bv_fun    = bzla_bv_sll_into;
     count_fun = bzla_bv_get_num_trailing_zeros;
     res       = bzla_is_inv_sll(bzla, pi);
   }
   else if (kind == BZLA_BV_SHIFT_SRL)
   {
-    bv_fun    = bzla_bv_srl;
+    bv_fun    = bzla_bv_srl_into;
     count_fun = bzla_bv_get_num_leading_zeros;
     res       = bzla_is_inv_srl(bzla, pi);
   }
@@ -990,22 +1010,28 @@ is_inv_shift_const(Bzla *bzla, BzlaPropInfo *pi, BzlaBvShiftKind kind)
     {
       if (res && bzla_bv_get_bit(s, bw - 1) == 1)
       {
-        not_s = bzla_bv_not(mm, s);
-        not_t = bzla_bv_not(mm, t);
-        s     = not_s;
-        t     = not_t;
+        not_s = bzla_bv_scratch_get(scratch, bw);
+        not_t = bzla_bv_scratch_get(scratch, bw);
+        bzla_bv_not_into(not_s, s);
+        bzla_bv_not_into(not_t, t);
+        s = not_s;
+        t = not_t;
       }
 
-      bv_fun    = bzla_bv_srl;
+      bv_fun    = bzla_bv_srl_into;
       count_fun = bzla_bv_get_num_leading_zeros;
     }
     else
     {
-      bv_fun = bzla_bv_sra;
+      bv_fun = bzla_bv_sra_into;
     }
   }
 
-  if (!res) return false;
+  if (!res)
+  {
+    bzla_bv_scratch_release(scratch, mark);
+    return false;
+  }
 
   bzla_propinfo_set_result(bzla, pi, 0);
 
@@ -1013,28 +1039,27 @@ is_inv_shift_const(Bzla *bzla, BzlaPropInfo *pi, BzlaBvShiftKind kind)
   if (pos_x == 0)
   {
     assert(bv_fun);
-    shift_hi = bv_fun(mm, x->hi, s);
-    shift_lo = bv_fun(mm, x->lo, s);
-    and      = bzla_bv_and(mm, shift_hi, t);
-    or       = bzla_bv_or(mm, shift_lo, t);
-    res      = bzla_bv_compare(and, t) == 0 && bzla_bv_compare(or, t) == 0;
-    bzla_bv_free(mm, or);
-    bzla_bv_free(mm, and);
-    bzla_bv_free(mm, shift_lo);
-    bzla_bv_free(mm, shift_hi);
+    shift_hi = bzla_bv_scratch_get(scratch, bw);
+    shift_lo = bzla_bv_scratch_get(scratch, bw);
+    bv_fun(shift_hi, x->hi, s);
+    bv_fun(shift_lo, x->lo, s);
+    bzla_bv_and_into(shift_hi, shift_hi, t);
+    bzla_bv_or_into(shift_lo, shift_lo, t);
+    res = bzla_bv_compare(shift_hi, t) == 0
+          && bzla_bv_compare(shift_lo, t) == 0;
   }
   else
   {
     assert(pos_x == 1);
     if (bzla_bvdomain_is_fixed(mm, x))
     {
-      shift_lo = bv_fun(mm, s, x->lo);
-      res      = bzla_bv_compare(shift_lo, t) == 0;
+      shift_lo = bzla_bv_scratch_get(scratch, bw);
+      bv_fun(shift_lo, s, x->lo);
+      res = bzla_bv_compare(shift_lo, t) == 0;
       if (res)
       {
         bzla_propinfo_set_result(bzla, pi, bzla_bvdomain_new(mm, x->lo, x->lo));
       }
-      bzla_bv_free(mm, shift_lo);
     }
     else
     {
@@ -1045,7 +1070,8 @@ is_inv_shift_const(Bzla *bzla, BzlaPropInfo *pi, BzlaBvShiftKind kind)
 
       /* Minimum number of bits required to shift left (right) s to match
        * trailing (leading) zeroes/ones of t. */
-      min = bzla_bv_uint64_to_bv(mm, cnt_t - cnt_s, bzla_bv_get_width(s));
+      min = bzla_bv_scratch_get(scratch, bw);
+      bzla_bv_set_uint64(min, cnt_t - cnt_s);
       if (bzla_bv_is_zero(t))
       {
         res = bzla_bv_compare(x->hi, min) >= 0 || bzla_bv_is_zero(s);
@@ -1066,9 +1092,9 @@ is_inv_shift_const(Bzla *bzla, BzlaPropInfo *pi, BzlaBvShiftKind kind)
 #ifndef NDEBUG
         if (res)
         {
-          bv = bv_fun(mm, s, min);
+          bv = bzla_bv_scratch_get(scratch, bw);
+          bv_fun(bv, s, min);
           assert(bzla_bv_compare(bv, t) == 0);
-          bzla_bv_free(mm, bv);
         }
 #endif
         if (res)
@@ -1076,15 +1102,9 @@ is_inv_shift_const(Bzla *bzla, BzlaPropInfo *pi, BzlaBvShiftKind kind)
           bzla_propinfo_set_result(bzla, pi, bzla_bvdomain_new(mm, min, min));
         }
       }
-      bzla_bv_free(mm, min);
     }
   }
-  if (not_s)
-  {
-    assert(not_t);
-    bzla_bv_free(mm, not_s);
-    bzla_bv_free(mm, not_t);
-  }
+  bzla_bv_scratch_release(scratch, mark);
   assert(pos_x != 0 || pi->res_x == 0);
   return res;
 }
@@ -1120,35 +1140,42 @@ bzla_is_inv_udiv_const(Bzla *bzla, BzlaPropInfo *pi)
   assert(pi);
 
   bool res = true;
-  BzlaBitVector *tmp, *min, *max, *inc;
+  BzlaBitVector *tmp, *min, *max;
   BzlaMemMgr *mm;
   int32_t pos_x;
+  uint32_t bw, mark;
   const BzlaBitVector *s, *t;
   const BzlaBvDomain *x;
+  BzlaBitVectorScratch *scratch;
 
-  mm  = bzla->mm;
-  res = bzla_is_inv_udiv(bzla, pi);
+  mm      = bzla->mm;
+  scratch = &bzla->bv_scratch;
+  res     = bzla_is_inv_udiv(bzla, pi);
   bzla_propinfo_set_result(bzla, pi, 0);
   pos_x = pi->pos_x;
   x     = pi->bvd[pos_x];
   s     = pi->bv[1 - pos_x];
   t     = pi->target_value;
+  bw    = bzla_bv_get_width(s);
 
   if (res && bzla_bvdomain_has_fixed_bits(mm, x))
   {
+    mark = bzla_bv_scratch_mark(scratch);
+    tmp  = bzla_bv_scratch_get(scratch, bw);
+    min  = bzla_bv_scratch_get(scratch, bw);
+    max  = bzla_bv_scratch_get(scratch, bw);
     /* x is constant */
     if (bzla_bvdomain_is_fixed(mm, x))
     {
       if (pos_x == 0)
       {
-        tmp = bzla_bv_udiv(mm, x->lo, s);
+        bzla_bv_udiv_into(tmp, x->lo, s);
       }
       else
       {
-        tmp = bzla_bv_udiv(mm, s, x->lo);
+        bzla_bv_udiv_into(tmp, s, x->lo);
       }
       res = bzla_bv_compare(tmp, t) == 0;
-      bzla_bv_free(mm, tmp);
     }
     else
     {
@@ -1161,18 +1188,15 @@ bzla_is_inv_udiv_const(Bzla *bzla, BzlaPropInfo *pi)
         /* If s == 0, we can always find an inverse value for x. */
         else if (!bzla_bv_is_zero(s))
         {
-          min = bzla_bv_mul(mm, s, t);
-          max = bzla_bv_add(mm, min, s);
+          bzla_bv_mul_into(min, s, t);
+          bzla_bv_add_into(max, min, s);
           if (bzla_bv_compare(max, min) < 0)
           {
-            bzla_bv_free(mm, max);
-            max = bzla_bv_ones(mm, bzla_bv_get_width(x->lo));
+            bzla_bv_set_ones(max);
           }
           else
           {
-            tmp = bzla_bv_dec(mm, max);
-            bzla_bv_free(mm, max);
-            max = tmp;
+            bzla_bv_dec_into(max, max);
           }
 
           BzlaBvDomainGenerator dgen;
@@ -1184,47 +1208,46 @@ bzla_is_inv_udiv_const(Bzla *bzla, BzlaPropInfo *pi)
                 bzla_bvdomain_new(mm, bzla_bvdomain_gen_random(&dgen), max);
           }
           bzla_bvdomain_gen_delete(&dgen);
-          bzla_bv_free(mm, min);
-          bzla_bv_free(mm, max);
         }
       }
       else
       {
         assert(pos_x == 1);
-        uint32_t bw = bzla_bv_get_width(s);
 
         if (!bzla_bv_is_zero(s) || !bzla_bv_is_zero(t))
         {
-          tmp = bzla_bv_udiv(mm, s, x->hi);
+          bzla_bv_udiv_into(tmp, s, x->hi);
 
           if (bzla_bv_compare(tmp, t) > 0)
           {
             res = false;
           }
-          bzla_bv_free(mm, tmp);
 
           if (res)
           {
             if (bzla_bv_is_ones(t))
             {
-              min = bzla_bv_zero(mm, bw);
-              max = bzla_bv_is_ones(s) ? bzla_bv_one(mm, bw)
-                                       : bzla_bv_copy(mm, min);
+              bzla_bv_set_zero(min);
+              if (bzla_bv_is_ones(s))
+              {
+                bzla_bv_set_one(max);
+              }
+              else
+              {
+                bzla_bv_set_zero(max);
+              }
             }
             else if (bzla_bv_compare(s, t) == 0)
             {
-              min = bzla_bv_one(mm, bzla_bv_get_width(s));
-              max = bzla_bv_copy(mm, min);
+              bzla_bv_set_one(min);
+              bzla_bv_set_one(max);
             }
             else
             {
-              inc = bzla_bv_inc(mm, t);
-              tmp = bzla_bv_udiv(mm, s, inc);
-              bzla_bv_free(mm, inc);
-              min = bzla_bv_inc(mm, tmp);
-              bzla_bv_free(mm, tmp);
-
-              max = bzla_bv_udiv(mm, s, t);
+              bzla_bv_inc_into(tmp, t);
+              bzla_bv_udiv_into(tmp, s, tmp);
+              bzla_bv_inc_into(min, tmp);
+              bzla_bv_udiv_into(max, s, t);
             }
 
             BzlaBvDomainGenerator dgen;
@@ -1236,12 +1259,11 @@ bzla_is_inv_udiv_const(Bzla *bzla, BzlaPropInfo *pi)
                   bzla_bvdomain_new(mm, bzla_bvdomain_gen_random(&dgen), max);
             }
             bzla_bvdomain_gen_delete(&dgen);
-            bzla_bv_free(mm, min);
-            bzla_bv_free(mm, max);
           }
         }
       }
     }
+    bzla_bv_scratch_release(scratch, mark);
   }
 
   return res;
@@ -1411,32 +1433,43 @@ bzla_is_inv_urem_const(Bzla *bzla, BzlaPropInfo *pi)
   BzlaBitVector *rem;
   BzlaMemMgr *mm;
   int32_t pos_x;
+  uint32_t bw, mark;
   const BzlaBitVector *s, *t;
   const BzlaBvDomain *x;
+  BzlaBitVectorScratch *scratch;
 
-  mm  = bzla->mm;
-  res = bzla_is_inv_urem(bzla, pi);
+  mm      = bzla->mm;
+  scratch = &bzla->bv_scratch;
+  res     = bzla_is_inv_urem(bzla, pi);
   bzla_propinfo_set_result(bzla, pi, 0);
   pos_x = pi->pos_x;
   x     = pi->bvd[pos_x];
   s     = pi->bv[1 - pos_x];
   t     = pi->target_value;
+  bw    = bzla_bv_get_width(t);
 
   if (res && bzla_bvdomain_has_fixed_bits(mm, x))
   {
+    mark = bzla_bv_scratch_mark(scratch);
+    rem  = bzla_bv_scratch_get(scratch, bw);
     if (bzla_bvdomain_is_fixed(mm, x))
     {
-      rem = pos_x ? bzla_bv_urem(mm, s, x->lo) : bzla_bv_urem(mm, x->lo, s);
+      if (pos_x)
+      {
+        bzla_bv_urem_into(rem, s, x->lo);
+      }
+      else
+      {
+        bzla_bv_urem_into(rem, x->lo, s);
+      }
       res = bzla_bv_compare(rem, t) == 0;
-      bzla_bv_free(mm, rem);
     }
     else
     {
-      uint32_t bw;
       BzlaBitVector *n, *n_hi, *ones, *hi, *sub, *mul, *bv, *one;
 
-      bw   = bzla_bv_get_width(t);
-      ones = bzla_bv_ones(mm, bw);
+      ones = bzla_bv_scratch_get(scratch, bw);
+      bzla_bv_set_ones(ones);
       if (pos_x)
       {
         if (bzla_bv_compare(s, t) == 0)
@@ -1456,7 +1489,8 @@ bzla_is_inv_urem_const(Bzla *bzla, BzlaPropInfo *pi)
 
           assert(bzla_bv_compare(t, s) <= 0);
 
-          n = bzla_bv_sub(mm, s, t);
+          n = bzla_bv_scratch_get(scratch, bw);
+          bzla_bv_sub_into(n, s, t);
 
           /* Is (s - t) a solution?
            *
@@ -1468,7 +1502,8 @@ bzla_is_inv_urem_const(Bzla *bzla, BzlaPropInfo *pi)
           if (!res)
           {
             bv  = 0;
-            one = bzla_bv_one(mm, bw);
+            one = bzla_bv_scratch_get(scratch, bw);
+            bzla_bv_set_one(one);
             if (bzla_bv_is_zero(t)
                 && bzla_bvdomain_check_fixed_bits(mm, x, one))
             {
@@ -1488,16 +1523,13 @@ bzla_is_inv_urem_const(Bzla *bzla, BzlaPropInfo *pi)
                 bzla_propinfo_set_result(
                     bzla, pi, bzla_bvdomain_new(mm, bv, bv));
 #ifndef NDEBUG
-                BzlaBitVector *tmp = bzla_bv_urem(mm, s, bv);
-                assert(bzla_bv_compare(tmp, t) == 0);
-                bzla_bv_free(mm, tmp);
+                bzla_bv_urem_into(rem, s, bv);
+                assert(bzla_bv_compare(rem, t) == 0);
 #endif
                 bzla_bv_free(mm, bv);
               }
             }
-            bzla_bv_free(mm, one);
           }
-          bzla_bv_free(mm, n);
         }
       }
       else
@@ -1516,7 +1548,8 @@ bzla_is_inv_urem_const(Bzla *bzla, BzlaPropInfo *pi)
             /* simplest solution (0 <= res < s: res = t) does not apply, thus
              * x = s * n + t with n s.t. (s * n + t) does not overflow */
 
-            sub = bzla_bv_sub(mm, ones, s);
+            sub = bzla_bv_scratch_get(scratch, bw);
+            bzla_bv_sub_into(sub, ones, s);
             if (bzla_bv_compare(sub, t) < 0)
             {
               /* overflow for n = 1 -> only simplest solution possible, but
@@ -1525,34 +1558,30 @@ bzla_is_inv_urem_const(Bzla *bzla, BzlaPropInfo *pi)
             }
             else
             {
-              bzla_bv_free(mm, sub);
+              n_hi = bzla_bv_scratch_get(scratch, bw);
+              mul  = bzla_bv_scratch_get(scratch, bw);
+              hi   = bzla_bv_scratch_get(scratch, bw);
               /**
                * x = s * n + t, with n s.t. (s * n + t) does not overflow
                * -> n <= (~0 - t) / s (truncated)
                * -> ~0 - s * n >= t
                */
-              sub = bzla_bv_sub(mm, ones, t);
+              bzla_bv_sub_into(sub, ones, t);
               /* n_hi = (~0 - t) / s */
-              n_hi = bzla_bv_udiv(mm, sub, s);
+              bzla_bv_udiv_into(n_hi, sub, s);
               assert(!bzla_bv_is_zero(n_hi));
-              bzla_bv_free(mm, sub);
               /* ~0 - s * n_hi < t ? decrease n_hi until */
-              mul = bzla_bv_mul(mm, s, n_hi);
-              sub = bzla_bv_sub(mm, ones, mul);
+              bzla_bv_mul_into(mul, s, n_hi);
+              bzla_bv_sub_into(sub, ones, mul);
               while (bzla_bv_compare(sub, t) < 0)
               {
-                bv   = n_hi;
-                n_hi = bzla_bv_dec(mm, n_hi);
-                bzla_bv_free(mm, bv);
-                bzla_bv_free(mm, mul);
-                mul = bzla_bv_mul(mm, s, n_hi);
-                bzla_bv_free(mm, sub);
-                sub = bzla_bv_sub(mm, ones, mul);
+                bzla_bv_dec_into(n_hi, n_hi);
+                bzla_bv_mul_into(mul, s, n_hi);
+                bzla_bv_sub_into(sub, ones, mul);
               }
 
               /* hi = s * n_hi + t (upper bound for x) */
-              hi = bzla_bv_add(mm, mul, t);
-              bzla_bv_free(mm, mul);
+              bzla_bv_add_into(hi, mul, t);
               BzlaBvDomainGenerator gen;
               /* x->lo <= x <= hi */
               bzla_bvdomain_gen_init_range(
@@ -1562,27 +1591,22 @@ bzla_is_inv_urem_const(Bzla *bzla, BzlaPropInfo *pi)
               {
                 bv = bzla_bvdomain_gen_next(&gen);
                 assert(bzla_bvdomain_check_fixed_bits(mm, x, bv));
-                rem = bzla_bv_urem(mm, bv, s);
+                bzla_bv_urem_into(rem, bv, s);
                 if (bzla_bv_compare(rem, t) == 0)
                 {
                   res = true;
-                  bzla_bv_free(mm, rem);
                   bzla_propinfo_set_result(
                       bzla, pi, bzla_bvdomain_new(mm, bv, hi));
                   break;
                 }
-                bzla_bv_free(mm, rem);
               }
               bzla_bvdomain_gen_delete(&gen);
-              bzla_bv_free(mm, hi);
-              bzla_bv_free(mm, n_hi);
             }
-            bzla_bv_free(mm, sub);
           }
         }
       }
-      bzla_bv_free(mm, ones);
     }
+    bzla_bv_scratch_release(scratch, mark);
   }
   return res;
 }
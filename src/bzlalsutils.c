@@ -114,12 +114,19 @@ bzla_lsutils_update_cone(Bzla *bzla,
   BzlaHashTableData *d;
   BzlaNodePtrStack stack, cone;
   BzlaIntHashTable *cache;
-  BzlaBitVector *bv, *e[BZLA_NODE_MAX_CHILDREN], *ass;
+  BzlaBitVector *bv, *ass, *tmp;
+  const BzlaBitVector *e[BZLA_NODE_MAX_CHILDREN];
+  BzlaBitVectorPtrStack computed;
+  BzlaBitVectorScratch *scratch;
+  uint32_t mark;
   BzlaMemMgr *mm;
+  BzlaTermStore *store;
 
   start = delta = bzla_util_time_stamp();
 
-  mm = bzla->mm;
+  mm      = bzla->mm;
+  store   = bzla->term_store;
+  scratch = &bzla->bv_scratch;
 
 #ifndef NDEBUG
   BzlaPtrHashTableIterator pit;
@@ -195,12 +202,14 @@ bzla_lsutils_update_cone(Bzla *bzla,
       /* old assignment != new assignment */
       update_roots_table(bzla, roots, exp, ass);
     }
-    bzla_bv_free(mm, d->as_ptr);
-    d->as_ptr = bzla_bv_copy(mm, ass);
+    d->as_ptr = bzla_term_store_update_bv(store, d->as_ptr, ass);
     if ((d = bzla_hashint_map_get(bv_model, -exp->id)))
     {
-      bzla_bv_free(mm, d->as_ptr);
-      d->as_ptr = bzla_bv_not(mm, ass);
+      mark = bzla_bv_scratch_mark(scratch);
+      tmp  = bzla_bv_scratch_get(scratch, bzla_bv_get_width(ass));
+      bzla_bv_not_into(tmp, ass);
+      d->as_ptr = bzla_term_store_update_bv(store, d->as_ptr, tmp);
+      bzla_bv_scratch_release(scratch, mark);
     }
 
     /* update score */
@@ -227,16 +236,22 @@ bzla_lsutils_update_cone(Bzla *bzla,
 
   delta = bzla_util_time_stamp();
 
+  /* Values are computed into temporary bit-vectors. Model values are stored
+   * in the term store, bzla_term_store_update_bv reuses the old value of a
+   * node if it is not shared, hence usually no bit-vectors are allocated for
+   * nodes that already have a model value. */
+  BZLA_INIT_STACK(mm, computed);
   for (i = 0; i < BZLA_COUNT_STACK(cone); i++)
   {
     cur = BZLA_PEEK_STACK(cone, i);
 
     assert(bzla_node_is_regular(cur));
+    mark = bzla_bv_scratch_mark(scratch);
     for (j = 0; j < cur->arity; j++)
     {
       if (bzla_node_is_bv_const(cur->e[j]))
       {
-        e[j] = bzla_bv_copy(mm, bzla_node_bv_const_get_bits(cur->e[j]));
+        e[j] = bzla_node_bv_const_get_bits(cur->e[j]);
       }
       else
       {
@@ -244,36 +259,53 @@ bzla_lsutils_update_cone(Bzla *bzla,
         /* Note: generate model enabled branch for ite (and does not
          * generate model for nodes in the branch, hence !b may happen */
         if (!d)
-          e[j] = bzla_model_recursively_compute_assignment(
+        {
+          tmp = bzla_model_recursively_compute_assignment(
               bzla, bv_model, bzla->fun_model, cur->e[j]);
+          BZLA_PUSH_STACK(computed, tmp);
+          e[j] = tmp;
+        }
+        else if (bzla_node_is_inverted(cur->e[j]))
+        {
+          tmp = bzla_bv_scratch_get(scratch, bzla_bv_get_width(d->as_ptr));
+          bzla_bv_not_into(tmp, d->as_ptr);
+          e[j] = tmp;
+        }
         else
-          e[j] = bzla_node_is_inverted(cur->e[j]) ? bzla_bv_not(mm, d->as_ptr)
-                                                  : bzla_bv_copy(mm, d->as_ptr);
+        {
+          e[j] = d->as_ptr;
+        }
       }
     }
+    bv = bzla_bv_scratch_get(scratch, bzla_node_bv_get_width(bzla, cur));
     switch (cur->kind)
     {
-      case BZLA_BV_ADD_NODE: bv = bzla_bv_add(mm, e[0], e[1]); break;
-      case BZLA_BV_AND_NODE: bv = bzla_bv_and(mm, e[0], e[1]); break;
-      case BZLA_BV_EQ_NODE: bv = bzla_bv_eq(mm, e[0], e[1]); break;
-      case BZLA_BV_ULT_NODE: bv = bzla_bv_ult(mm, e[0], e[1]); break;
-      case BZLA_BV_SLL_NODE: bv = bzla_bv_sll(mm, e[0], e[1]); break;
-      case BZLA_BV_SLT_NODE: bv = bzla_bv_slt(mm, e[0], e[1]); break;
-      case BZLA_BV_SRL_NODE: bv = bzla_bv_srl(mm, e[0], e[1]); break;
-      case BZLA_BV_MUL_NODE: bv = bzla_bv_mul(mm, e[0], e[1]); break;
-      case BZLA_BV_UDIV_NODE: bv = bzla_bv_udiv(mm, e[0], e[1]); break;
-      case BZLA_BV_UREM_NODE: bv = bzla_bv_urem(mm, e[0], e[1]); break;
-      case BZLA_BV_CONCAT_NODE: bv = bzla_bv_concat(mm, e[0], e[1]); break;
+      case BZLA_BV_ADD_NODE: bzla_bv_add_into(bv, e[0], e[1]); break;
+      case BZLA_BV_AND_NODE: bzla_bv_and_into(bv, e[0], e[1]); break;
+      case BZLA_BV_EQ_NODE:
+        bzla_bv_set_uint64(bv, bzla_bv_compare(e[0], e[1]) == 0);
+        break;
+      case BZLA_BV_ULT_NODE:
+        bzla_bv_set_uint64(bv, bzla_bv_compare(e[0], e[1]) < 0);
+        break;
+      case BZLA_BV_SLL_NODE: bzla_bv_sll_into(bv, e[0], e[1]); break;
+      case BZLA_BV_SLT_NODE:
+        bzla_bv_set_uint64(bv, bzla_bv_signed_compare(e[0], e[1]) < 0);
+        break;
+      case BZLA_BV_SRL_NODE: bzla_bv_srl_into(bv, e[0], e[1]); break;
+      case BZLA_BV_MUL_NODE: bzla_bv_mul_into(bv, e[0], e[1]); break;
+      case BZLA_BV_UDIV_NODE: bzla_bv_udiv_into(bv, e[0], e[1]); break;
+      case BZLA_BV_UREM_NODE: bzla_bv_urem_into(bv, e[0], e[1]); break;
+      case BZLA_BV_CONCAT_NODE: bzla_bv_concat_into(bv, e[0], e[1]); break;
       case BZLA_BV_SLICE_NODE:
-        bv = bzla_bv_slice(mm,
+        bzla_bv_slice_into(bv,
                            e[0],
                            bzla_node_bv_slice_get_upper(cur),
                            bzla_node_bv_slice_get_lower(cur));
         break;
       default:
         assert(bzla_node_is_cond(cur));
-        bv = bzla_bv_is_true(e[0]) ? bzla_bv_copy(mm, e[1])
-                                   : bzla_bv_copy(mm, e[2]);
+        bzla_bv_set(bv, bzla_bv_is_true(e[0]) ? e[1] : e[2]);
     }
 
     /* update assignment */
@@ -298,22 +330,27 @@ bzla_lsutils_update_cone(Bzla *bzla,
     if (!d)
     {
       bzla_node_copy(bzla, cur);
-      bzla_hashint_map_add(bv_model, cur->id)->as_ptr = bv;
+      bzla_hashint_map_add(bv_model, cur->id)->as_ptr =
+          bzla_term_store_get_bv(store, bv);
     }
     else
     {
-      bzla_bv_free(mm, d->as_ptr);
-      d->as_ptr = bv;
+      d->as_ptr = bzla_term_store_update_bv(store, d->as_ptr, bv);
     }
 
     if ((d = bzla_hashint_map_get(bv_model, -cur->id)))
     {
-      bzla_bv_free(mm, d->as_ptr);
-      d->as_ptr = bzla_bv_not(mm, bv);
+      bzla_bv_not_into(bv, bv);
+      d->as_ptr = bzla_term_store_update_bv(store, d->as_ptr, bv);
     }
     /* cleanup */
-    for (j = 0; j < cur->arity; j++) bzla_bv_free(mm, e[j]);
+    bzla_bv_scratch_release(scratch, mark);
+    while (!BZLA_EMPTY_STACK(computed))
+    {
+      bzla_bv_free(mm, BZLA_POP_STACK(computed));
+    }
   }
+  BZLA_RELEASE_STACK(computed);
   *time_update_cone_model_gen += bzla_util_time_stamp() - delta;
 
   /* update score of cone ------------------------------------------------- */
@@ -23,6 +23,7 @@
 #include "bzlaconfig.h"
 #include "bzlacore.h"
 #include "bzlaexit.h"
+#include "bzlamainserver.h"
 #include "bzlaopt.h"
 #include "bzlaparse.h"
 #include "utils/bzlahashptr.h"
@@ -61,10 +62,14 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_AIGPROP_NPROPS]          = BITWUZLA_OPT_AIGPROP_NPROPS,
     [BZLA_OPT_AIGPROP_USE_BANDIT]      = BITWUZLA_OPT_AIGPROP_USE_BANDIT,
     [BZLA_OPT_AIGPROP_USE_RESTARTS]    = BITWUZLA_OPT_AIGPROP_USE_RESTARTS,
+    [BZLA_OPT_BMC_KIND]                = BITWUZLA_OPT_BMC_KIND,
+    [BZLA_OPT_BMC_KMAX]                = BITWUZLA_OPT_BMC_KMAX,
+    [BZLA_OPT_BW_REDUCE]               = BITWUZLA_OPT_BW_REDUCE,
     [BZLA_OPT_CHECK_MODEL]             = BITWUZLA_OPT_CHECK_MODEL,
     [BZLA_OPT_CHECK_UNCONSTRAINED]     = BITWUZLA_OPT_CHECK_UNCONSTRAINED,
     [BZLA_OPT_CHECK_UNSAT_ASSUMPTIONS] = BITWUZLA_OPT_CHECK_UNSAT_ASSUMPTIONS,
     [BZLA_OPT_DECLSORT_BV_WIDTH]       = BITWUZLA_OPT_DECLSORT_BV_WIDTH,
+    [BZLA_OPT_ITE_CHAINS]              = BITWUZLA_OPT_ITE_CHAINS,
     [BZLA_OPT_ENGINE]                  = BITWUZLA_OPT_ENGINE,
     [BZLA_OPT_EXIT_CODES]              = BITWUZLA_OPT_EXIT_CODES,
     [BZLA_OPT_FUN_DUAL_PROP]           = BITWUZLA_OPT_FUN_DUAL_PROP,
@@ -72,6 +77,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_FUN_EAGER_LEMMAS]        = BITWUZLA_OPT_FUN_EAGER_LEMMAS,
     [BZLA_OPT_FUN_JUST]                = BITWUZLA_OPT_FUN_JUST,
     [BZLA_OPT_FUN_JUST_HEURISTIC]      = BITWUZLA_OPT_FUN_JUST_HEURISTIC,
+    [BZLA_OPT_FUN_LAZY_CONSTRAINTS]    = BITWUZLA_OPT_FUN_LAZY_CONSTRAINTS,
     [BZLA_OPT_FUN_LAZY_SYNTHESIZE]     = BITWUZLA_OPT_FUN_LAZY_SYNTHESIZE,
     [BZLA_OPT_FUN_PREPROP]             = BITWUZLA_OPT_FUN_PREPROP,
     [BZLA_OPT_FUN_PRESLS]              = BITWUZLA_OPT_FUN_PRESLS,
@@ -83,6 +89,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_OUTPUT_FORMAT]           = BITWUZLA_OPT_OUTPUT_FORMAT,
     [BZLA_OPT_OUTPUT_NUMBER_FORMAT]    = BITWUZLA_OPT_OUTPUT_NUMBER_FORMAT,
     [BZLA_OPT_PARSE_INTERACTIVE]       = BITWUZLA_OPT_PARSE_INTERACTIVE,
+    [BZLA_OPT_PIPELINE]                = BITWUZLA_OPT_PIPELINE,
     [BZLA_OPT_PP_ACKERMANN]            = BITWUZLA_OPT_PP_ACKERMANN,
     [BZLA_OPT_PP_BETA_REDUCE]          = BITWUZLA_OPT_PP_BETA_REDUCE,
     [BZLA_OPT_PP_ELIMINATE_EXTRACTS]   = BITWUZLA_OPT_PP_ELIMINATE_EXTRACTS,
@@ -138,6 +145,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_QUANT_SYNTH_ITE_COMPLETE] = BITWUZLA_OPT_QUANT_SYNTH_ITE_COMPLETE,
     [BZLA_OPT_QUANT_SYNTH_LIMIT]        = BITWUZLA_OPT_QUANT_SYNTH_LIMIT,
     [BZLA_OPT_QUANT_SYNTH_QI]           = BITWUZLA_OPT_QUANT_SYNTH_QI,
+    [BZLA_OPT_QUANT_THREADS]            = BITWUZLA_OPT_QUANT_THREADS,
     [BZLA_OPT_RW_EXTRACT_ARITH]         = BITWUZLA_OPT_RW_EXTRACT_ARITH,
     [BZLA_OPT_RW_LEVEL]                 = BITWUZLA_OPT_RW_LEVEL,
     [BZLA_OPT_RW_NORMALIZE]             = BITWUZLA_OPT_RW_NORMALIZE,
@@ -199,6 +207,10 @@ enum BitwuzlaMainOption
   BZLAMAIN_OPT_DUMP_AAG,
   BZLAMAIN_OPT_DUMP_AIG,
   BZLAMAIN_OPT_DUMP_AIGER_MERGE,
+  BZLAMAIN_OPT_SERVER,
+  BZLAMAIN_OPT_SERVER_SOCKET,
+  BZLAMAIN_OPT_SERVER_THREADS,
+  BZLAMAIN_OPT_SERVER_TIMEOUT,
   /* this MUST be the last entry! */
   BZLAMAIN_OPT_NUM_OPTS,
 };
@@ -509,10 +521,58 @@ bzlamain_init_opts(BitwuzlaMainApp *app)
                     true,
                     BZLA_ARG_EXPECT_NONE,
                     "merge all roots of AIG [0]");
+  bzlamain_init_opt(app,
+                    BZLAMAIN_OPT_SERVER,
+                    true,
+                    true,
+                    "server",
+                    0,
+                    0,
+                    0,
+                    1,
+                    false,
+                    BZLA_ARG_EXPECT_NONE,
+                    "run as server, read SMT-LIB v2 sessions from stdin");
+  bzlamain_init_opt(app,
+                    BZLAMAIN_OPT_SERVER_SOCKET,
+                    true,
+                    false,
+                    "server-socket",
+                    0,
+                    0,
+                    0,
+                    0,
+                    false,
+                    BZLA_ARG_EXPECT_STR,
+                    "run as server, listen on given Unix domain socket");
+  bzlamain_init_opt(app,
+                    BZLAMAIN_OPT_SERVER_THREADS,
+                    true,
+                    false,
+                    "server-threads",
+                    0,
+                    0,
+                    0,
+                    UINT32_MAX,
+                    false,
+                    BZLA_ARG_EXPECT_INT,
+                    "number of server worker threads (0: number of cores)");
+  bzlamain_init_opt(app,
+                    BZLAMAIN_OPT_SERVER_TIMEOUT,
+                    true,
+                    false,
+                    "server-timeout",
+                    0,
+                    0,
+                    0,
+                    UINT32_MAX,
+                    false,
+                    BZLA_ARG_EXPECT_INT,
+                    "set time limit per server session in ms (0: none)");
 }
 
 static bool
-bzlamain_opt_has_str_arg(const char *opt, BzlaOpt *bzla_opts)
+bzlamain_opt_has_str_arg(const char *opt, const BzlaOpt *bzla_opts)
 {
   assert(opt);
 
@@ -638,7 +698,7 @@ get_opt_val_string(BzlaPtrHashTable *options, int32_t val)
 }
 
 static char *
-get_opt_vals_string(BzlaMemMgr *mm, BzlaOpt *bo)
+get_opt_vals_string(BzlaMemMgr *mm, const BzlaOpt *bo)
 {
   size_t i;
   char *s = 0;
@@ -916,7 +976,7 @@ print_help(BitwuzlaMainApp *app, bool include_expert_opts)
     if (!app->options[mo].general) continue;
     if (mo == BZLAMAIN_OPT_TIME || mo == BZLAMAIN_OPT_HEX
         || mo == BZLAMAIN_OPT_BTOR || mo == BZLAMAIN_OPT_BTOR2
-        || mo == BZLAMAIN_OPT_DUMP_BTOR)
+        || mo == BZLAMAIN_OPT_DUMP_BTOR || mo == BZLAMAIN_OPT_SERVER)
       fprintf(out, "\n");
     PRINT_MAIN_OPT(app, &app->options[mo]);
   }
@@ -1118,13 +1178,15 @@ bitwuzla_main(int32_t argc, char **argv)
   BzlaParsedInput *pin;
   BzlaParsedInputPtrStack infiles;
   BzlaOption bopt;
-  BzlaOpt *bo;
+  const BzlaOpt *bo;
   BitwuzlaMainOption bmopt;
   BzlaMainOpt *bmo;
   BzlaMemMgr *mm;
   Bzla *bzla;
   Bitwuzla *bitwuzla;
   BzlaPtrHashBucket *b;
+  BzlaMainServerOptions server_opts;
+  bool server;
 
   g_start_time_real = bzla_util_current_time();
 
@@ -1142,6 +1204,9 @@ bitwuzla_main(int32_t argc, char **argv)
   pmodel = 0;
   dump   = 0;
 
+  server = false;
+  memset(&server_opts, 0, sizeof(server_opts));
+
   BZLA_INIT_STACK(mm, opts);
   BZLA_INIT_STACK(mm, infiles);
 
@@ -1332,6 +1397,17 @@ bitwuzla_main(int32_t argc, char **argv)
           dump = BZLA_OUTPUT_FORMAT_AIGER_BINARY;
           goto SET_OUTPUT_FORMAT;
 
+        case BZLAMAIN_OPT_SERVER: server = true; break;
+
+        case BZLAMAIN_OPT_SERVER_SOCKET:
+          server                  = true;
+          server_opts.socket_path = po->valstr;
+          break;
+
+        case BZLAMAIN_OPT_SERVER_THREADS: server_opts.nthreads = po->val; break;
+
+        case BZLAMAIN_OPT_SERVER_TIMEOUT: server_opts.timeout = po->val; break;
+
         default:
           /* get rid of compiler warnings, should be unreachable */
           assert(bmopt == BZLAMAIN_OPT_NUM_OPTS);
@@ -1470,6 +1546,20 @@ bitwuzla_main(int32_t argc, char **argv)
 
   g_verbosity = bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_VERBOSITY);
 
+  /* in server mode, stdout is reserved for responses to requests from stdin,
+   * all other output (e.g., verbose messages) is redirected to stderr */
+  if (server && !server_opts.socket_path)
+  {
+    int32_t fd;
+    fflush(stdout);
+    if ((fd = dup(STDOUT_FILENO)) < 0 || !(server_opts.out = fdopen(fd, "w")))
+    {
+      bzlamain_error(g_app, "can not open server output stream");
+      goto DONE;
+    }
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+  }
+
   /* open output file */
   if (g_app->outfile_name)
   {
@@ -1517,9 +1607,31 @@ bitwuzla_main(int32_t argc, char **argv)
     bzlamain_msg("no time limit given");
 #endif
 
+  /* server mode */
+  if (server)
+  {
+    if (BZLA_COUNT_STACK(infiles) > 0)
+    {
+      bzlamain_error(g_app, "input file not supported in server mode");
+      goto DONE;
+    }
+    if (dump)
+    {
+      bzlamain_error(g_app, "dumping not supported in server mode");
+      goto DONE;
+    }
+    server_opts.verbosity = g_verbosity;
+    if (bzlamain_server_run(bitwuzla, &server_opts))
+      g_app->done = true;
+    else
+      g_app->err = BZLA_ERR_EXIT;
+    goto DONE;
+  }
+
   if (inc && g_verbosity) bzlamain_msg("starting incremental mode");
 
   /* parse */
+  bool parsed_btor2_mc;
   bool parsed_smt2 = false;
   val              = bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_INPUT_FORMAT);
   switch (val)
@@ -1569,6 +1681,10 @@ bitwuzla_main(int32_t argc, char **argv)
                                  &parsed_smt2);
   }
 
+  /* BTOR2 models with model checking extensions are checked (and results
+   * printed) while parsing */
+  parsed_btor2_mc = !parsed_smt2 && bzla->bzla_sat_bzla_called > 0;
+
   /* verbosity may have been increased via input (set-option) */
   g_verbosity = bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_VERBOSITY);
 
@@ -1603,7 +1719,7 @@ bitwuzla_main(int32_t argc, char **argv)
 
     if (g_verbosity) bzlamain_print_stats(bitwuzla);
 
-    if (pmodel && sat_res == BITWUZLA_SAT)
+    if (pmodel && sat_res == BITWUZLA_SAT && !parsed_btor2_mc)
     {
       assert(bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_PRODUCE_MODELS));
       format = bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_OUTPUT_FORMAT);
@@ -1653,7 +1769,8 @@ bitwuzla_main(int32_t argc, char **argv)
   }
 
   /* call sat (if not yet called) */
-  if (parse_res == BITWUZLA_UNKNOWN && !bzla_terminate(bzla) && !parsed_smt2)
+  if (parse_res == BITWUZLA_UNKNOWN && !bzla_terminate(bzla) && !parsed_smt2
+      && !parsed_btor2_mc)
   {
     sat_res = bitwuzla_check_sat(bitwuzla);
     print_sat_result(g_app, sat_res);
@@ -1679,7 +1796,7 @@ bitwuzla_main(int32_t argc, char **argv)
   }
 
   /* print model */
-  if (pmodel && sat_res == BITWUZLA_SAT)
+  if (pmodel && sat_res == BITWUZLA_SAT && !parsed_btor2_mc)
   {
     assert(bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_PRODUCE_MODELS));
     format = bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_OUTPUT_FORMAT);
@@ -1711,6 +1828,7 @@ DONE:
   else if (g_app->close_infile == 2)
     pclose(g_app->infile);
   if (g_app->close_outfile) fclose(g_app->outfile);
+  if (server_opts.out) fclose(server_opts.out);
 
   if (!bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_EXIT_CODES))
   {
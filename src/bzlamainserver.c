@@ -0,0 +1,797 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include "bzlamainserver.h"
+
+#include <assert.h>
+#include <ctype.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef BZLA_WINDOWS_BUILD
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#ifdef BZLA_HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+#include "bzlacore.h"
+#include "bzlaopt.h"
+#include "bzlatermstore.h"
+#include "utils/bzlaabort.h"
+#include "utils/bzlamem.h"
+#include "utils/bzlastack.h"
+#include "utils/bzlautil.h"
+
+/*------------------------------------------------------------------------*/
+
+Bzla *bitwuzla_get_bzla(Bitwuzla *bitwuzla);
+
+/*------------------------------------------------------------------------*/
+
+static void
+server_error(const char *msg, ...)
+{
+  assert(msg);
+
+  va_list list;
+  va_start(list, msg);
+  fputs("bitwuzla: ", stderr);
+  vfprintf(stderr, msg, list);
+  fprintf(stderr, "\n");
+  va_end(list);
+}
+
+#ifdef BZLA_WINDOWS_BUILD
+
+bool
+bzlamain_server_run(Bitwuzla *options, const BzlaMainServerOptions *opts)
+{
+  (void) options;
+  (void) opts;
+  server_error("server mode is not supported on this platform");
+  return false;
+}
+
+#else
+
+/*------------------------------------------------------------------------*/
+
+#ifdef BZLA_HAVE_PTHREADS
+#define BZLA_SERVER_LOCK(obj) pthread_mutex_lock(&(obj)->lock)
+#define BZLA_SERVER_UNLOCK(obj) pthread_mutex_unlock(&(obj)->lock)
+#else
+#define BZLA_SERVER_LOCK(obj) ((void) (obj))
+#define BZLA_SERVER_UNLOCK(obj) ((void) (obj))
+#endif
+
+typedef struct BzlaServer BzlaServer;
+typedef struct BzlaServerConn BzlaServerConn;
+typedef struct BzlaServerJob BzlaServerJob;
+typedef struct BzlaServerWorker BzlaServerWorker;
+
+/* A session submitted for solving. */
+struct BzlaServerJob
+{
+  BzlaServerConn *conn;
+  uint64_t id;
+  char *input;
+  size_t len;
+  uint32_t timeout;
+  BzlaServerJob *next;
+};
+
+/* A client connection, the source of requests and sink of responses. */
+struct BzlaServerConn
+{
+  BzlaServer *server;
+  FILE *in;
+  FILE *out;
+  uint32_t pending; /* number of submitted but not yet answered sessions */
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_mutex_t lock;
+  pthread_cond_t done;
+#endif
+};
+
+struct BzlaServerWorker
+{
+  BzlaServer *server;
+  uint32_t id;
+  Bitwuzla *bitwuzla;
+  uint64_t nsessions;
+  double deadline; /* wall clock deadline of the current session, 0 if none */
+  bool timed_out;
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_t thread;
+#endif
+};
+
+struct BzlaServer
+{
+  BzlaMemMgr *mm;
+  Bitwuzla *options; /* template instance, holds the session options */
+  BzlaTermStore *store;
+  uint32_t timeout;
+  uint32_t verbosity;
+  uint32_t nworkers;
+  BzlaServerWorker *workers;
+  BzlaServerJob *head; /* queue of unassigned sessions */
+  BzlaServerJob *tail;
+  bool shutdown;
+
+  struct
+  {
+    uint64_t sessions;
+    uint64_t sat;
+    uint64_t unsat;
+    uint64_t unknown;
+    uint64_t timeout;
+    uint64_t error;
+    double time;
+  } stats;
+
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_mutex_t lock;
+  pthread_cond_t work;
+#endif
+};
+
+/*------------------------------------------------------------------------*/
+
+static void
+server_msg(const char *msg, ...)
+{
+  assert(msg);
+
+  va_list list;
+  va_start(list, msg);
+  flockfile(stdout);
+  fputs("[bitwuzla>server] ", stdout);
+  vfprintf(stdout, msg, list);
+  fputc('\n', stdout);
+  fflush(stdout);
+  funlockfile(stdout);
+  va_end(list);
+}
+
+/*------------------------------------------------------------------------*/
+
+static BzlaServerConn *
+conn_new(BzlaServer *server, FILE *in, FILE *out)
+{
+  BzlaServerConn *res;
+
+  BZLA_SERVER_LOCK(server);
+  BZLA_CNEW(server->mm, res);
+  BZLA_SERVER_UNLOCK(server);
+  res->server = server;
+  res->in     = in;
+  res->out    = out;
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_mutex_init(&res->lock, 0);
+  pthread_cond_init(&res->done, 0);
+#endif
+  return res;
+}
+
+static void
+conn_delete(BzlaServerConn *conn)
+{
+  BzlaServer *server = conn->server;
+
+  assert(conn->pending == 0);
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_cond_destroy(&conn->done);
+  pthread_mutex_destroy(&conn->lock);
+#endif
+  BZLA_SERVER_LOCK(server);
+  BZLA_DELETE(server->mm, conn);
+  BZLA_SERVER_UNLOCK(server);
+}
+
+/* Write response of session 'id' to 'conn'. If 'job' is true, the response
+ * answers a submitted session. */
+static void
+respond(BzlaServerConn *conn,
+        uint64_t id,
+        const char *status,
+        uint64_t msec,
+        const char *output,
+        size_t size,
+        bool job)
+{
+  BZLA_SERVER_LOCK(conn);
+  fprintf(
+      conn->out, "%" PRIu64 " %s %" PRIu64 " %zu\n", id, status, msec, size);
+  fwrite(output, 1, size, conn->out);
+  fflush(conn->out);
+  if (job)
+  {
+    assert(conn->pending > 0);
+    conn->pending -= 1;
+#ifdef BZLA_HAVE_PTHREADS
+    if (conn->pending == 0) pthread_cond_signal(&conn->done);
+#endif
+  }
+  BZLA_SERVER_UNLOCK(conn);
+}
+
+/* Print 'msg' as SMT-LIB error response to 'out'. */
+static void
+print_error(FILE *out, const char *msg)
+{
+  fputs("(error \"", out);
+  for (; *msg; msg++)
+  {
+    if (*msg == '"') fputc('"', out);
+    fputc(*msg, out);
+  }
+  fputs("\")\n", out);
+}
+
+static void
+respond_error(BzlaServerConn *conn, uint64_t id, const char *msg)
+{
+  char *output = 0;
+  size_t size  = 0;
+  FILE *out;
+
+  out = open_memstream(&output, &size);
+  BZLA_ABORT(!out, "failed to create server output stream");
+  print_error(out, msg);
+  fclose(out);
+  respond(conn, id, "error", 0, output, size, false);
+  free(output);
+}
+
+/*------------------------------------------------------------------------*/
+
+static int32_t
+terminate_session(void *state)
+{
+  BzlaServerWorker *worker = (BzlaServerWorker *) state;
+
+  if (worker->timed_out) return 1;
+  if (worker->deadline > 0 && bzla_util_current_time() > worker->deadline)
+  {
+    worker->timed_out = true;
+    return 1;
+  }
+  return 0;
+}
+
+/* Set all options of 'bzla' that differ from the options of 'options'. */
+static void
+copy_options(Bzla *bzla, Bzla *options)
+{
+  BzlaOption o;
+  uint32_t val;
+
+  for (o = bzla_opt_first(options); bzla_opt_is_valid(options, o);
+       o = bzla_opt_next(options, o))
+  {
+    val = bzla_opt_get(options, o);
+    if (bzla_opt_get(bzla, o) != val) bzla_opt_set(bzla, o, val);
+  }
+}
+
+static void
+solve_session(BzlaServerWorker *worker, BzlaServerJob *job)
+{
+  BzlaServer *server = worker->server;
+  Bitwuzla *bitwuzla = worker->bitwuzla;
+  BitwuzlaResult res, status;
+  char *err_msg, *output;
+  const char *result;
+  size_t size;
+  uint64_t msec;
+  double start, time;
+  bool error;
+  FILE *in, *out;
+
+  start = bzla_util_current_time();
+
+  /* instances are kept alive between sessions and only reset, which keeps
+   * the memory of the instance and the shared term store warm */
+  if (worker->nsessions > 0) bitwuzla_reset(bitwuzla);
+  copy_options(bitwuzla_get_bzla(bitwuzla),
+               bitwuzla_get_bzla(server->options));
+  worker->deadline  = job->timeout ? start + job->timeout / 1000.0 : 0;
+  worker->timed_out = false;
+  bitwuzla_set_termination_callback(bitwuzla, terminate_session, worker);
+
+  output = 0;
+  size   = 0;
+  out    = open_memstream(&output, &size);
+  BZLA_ABORT(!out, "failed to create server output stream");
+
+  res     = BITWUZLA_UNKNOWN;
+  err_msg = 0;
+  if (job->len > 0)
+  {
+    in = fmemopen(job->input, job->len, "r");
+    BZLA_ABORT(!in, "failed to create server input stream");
+    res = bitwuzla_parse_format(
+        bitwuzla, "smt2", in, "<session>", out, &err_msg, &status);
+    fclose(in);
+  }
+
+  error = err_msg != 0;
+  if (error)
+  {
+    print_error(out, err_msg);
+    free(err_msg);
+    result = "error";
+  }
+  else if (worker->timed_out)
+  {
+    result = "timeout";
+  }
+  else
+  {
+    result = bitwuzla_result_to_string(res);
+  }
+  fclose(out);
+
+  time = bzla_util_current_time() - start;
+  msec = (uint64_t) (time * 1000);
+  worker->nsessions += 1;
+
+  if (server->verbosity)
+  {
+    server_msg("session %" PRIu64 ": %s in %.3f seconds (worker %u)",
+               job->id,
+               result,
+               time,
+               worker->id);
+  }
+  respond(job->conn, job->id, result, msec, output, size, true);
+  free(output);
+
+  BZLA_SERVER_LOCK(server);
+  server->stats.sessions += 1;
+  server->stats.time += time;
+  if (error)
+    server->stats.error += 1;
+  else if (worker->timed_out)
+    server->stats.timeout += 1;
+  else if (res == BITWUZLA_SAT)
+    server->stats.sat += 1;
+  else if (res == BITWUZLA_UNSAT)
+    server->stats.unsat += 1;
+  else
+    server->stats.unknown += 1;
+  BZLA_DELETEN(server->mm, job->input, job->len + 1);
+  BZLA_DELETE(server->mm, job);
+  BZLA_SERVER_UNLOCK(server);
+}
+
+/* Dequeue the next session, waits for a session if 'wait' is true.
+ * Returns 0 if there is no session (and the server is shut down). */
+static BzlaServerJob *
+next_job(BzlaServer *server, bool wait)
+{
+  BzlaServerJob *res;
+
+  (void) wait;
+  BZLA_SERVER_LOCK(server);
+#ifdef BZLA_HAVE_PTHREADS
+  while (wait && !server->head && !server->shutdown)
+  {
+    pthread_cond_wait(&server->work, &server->lock);
+  }
+#endif
+  res = server->head;
+  if (res)
+  {
+    server->head = res->next;
+    if (!server->head) server->tail = 0;
+  }
+  BZLA_SERVER_UNLOCK(server);
+  return res;
+}
+
+#ifdef BZLA_HAVE_PTHREADS
+static void *
+worker_thread(void *state)
+{
+  BzlaServerWorker *worker = (BzlaServerWorker *) state;
+  BzlaServerJob *job;
+
+  while ((job = next_job(worker->server, true)))
+  {
+    solve_session(worker, job);
+  }
+  return 0;
+}
+#endif
+
+static void
+submit(BzlaServerConn *conn,
+       uint64_t id,
+       const char *input,
+       size_t len,
+       uint32_t timeout)
+{
+  BzlaServer *server = conn->server;
+  BzlaServerJob *job;
+
+  BZLA_SERVER_LOCK(conn);
+  conn->pending += 1;
+  BZLA_SERVER_UNLOCK(conn);
+
+  BZLA_SERVER_LOCK(server);
+  BZLA_CNEW(server->mm, job);
+  job->conn    = conn;
+  job->id      = id;
+  job->len     = len;
+  job->timeout = timeout;
+  BZLA_NEWN(server->mm, job->input, len + 1);
+  if (len) memcpy(job->input, input, len);
+  job->input[len] = 0;
+  if (server->tail)
+    server->tail->next = job;
+  else
+    server->head = job;
+  server->tail = job;
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_cond_signal(&server->work);
+#endif
+  BZLA_SERVER_UNLOCK(server);
+
+#ifndef BZLA_HAVE_PTHREADS
+  /* no worker threads, solve session synchronously */
+  solve_session(&server->workers[0], next_job(server, false));
+#endif
+}
+
+/*------------------------------------------------------------------------*/
+
+/* Parse request header '<len> [<timeout>]'. */
+static bool
+parse_header(BzlaServer *server,
+             const char *line,
+             size_t *len,
+             uint32_t *timeout)
+{
+  unsigned long long val;
+  char *end;
+
+  if (!isdigit((unsigned char) line[0])) return false;
+  errno = 0;
+  val   = strtoull(line, &end, 10);
+  if (errno || val > SIZE_MAX) return false;
+  *len     = (size_t) val;
+  *timeout = server->timeout;
+  if (*end == ' ')
+  {
+    if (!isdigit((unsigned char) end[1])) return false;
+    val = strtoull(end + 1, &end, 10);
+    if (errno || val > UINT32_MAX) return false;
+    *timeout = (uint32_t) val;
+  }
+  if (*end == '\r') end++;
+  return *end == 0;
+}
+
+/* Read and submit requests from 'conn' until end of input, and wait until
+ * all submitted sessions have been answered. */
+static void
+serve(BzlaServerConn *conn)
+{
+  BzlaMemMgr *mm;
+  BzlaCharStack buf;
+  uint64_t id;
+  uint32_t timeout;
+  size_t i, len;
+  int32_t ch;
+
+  mm = bzla_mem_mgr_new();
+  BZLA_INIT_STACK(mm, buf);
+
+  for (id = 0;; id++)
+  {
+    BZLA_RESET_STACK(buf);
+    while ((ch = getc(conn->in)) != EOF && ch != '\n')
+    {
+      BZLA_PUSH_STACK(buf, ch);
+    }
+    if (ch == EOF && BZLA_EMPTY_STACK(buf)) break;
+    BZLA_PUSH_STACK(buf, 0);
+    if (!parse_header(conn->server, buf.start, &len, &timeout))
+    {
+      respond_error(conn, id, "invalid request header");
+      break;
+    }
+
+    BZLA_RESET_STACK(buf);
+    for (i = 0; i < len && (ch = getc(conn->in)) != EOF; i++)
+    {
+      BZLA_PUSH_STACK(buf, ch);
+    }
+    if (i < len)
+    {
+      respond_error(conn, id, "unexpected end of request");
+      break;
+    }
+    submit(conn, id, buf.start, len, timeout);
+  }
+
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_mutex_lock(&conn->lock);
+  while (conn->pending > 0) pthread_cond_wait(&conn->done, &conn->lock);
+  pthread_mutex_unlock(&conn->lock);
+#endif
+  assert(conn->pending == 0);
+
+  BZLA_RELEASE_STACK(buf);
+  bzla_mem_mgr_delete(mm);
+}
+
+static bool
+serve_stdio(BzlaServer *server, FILE *out)
+{
+  BzlaServerConn *conn;
+
+  conn = conn_new(server, stdin, out);
+  serve(conn);
+  conn_delete(conn);
+  return true;
+}
+
+static void *
+serve_socket_conn(void *state)
+{
+  BzlaServerConn *conn = (BzlaServerConn *) state;
+
+  serve(conn);
+  fclose(conn->in);
+  fclose(conn->out);
+  conn_delete(conn);
+  return 0;
+}
+
+static bool
+serve_socket(BzlaServer *server, const char *path)
+{
+  struct sockaddr_un addr;
+  struct stat st;
+  BzlaServerConn *conn;
+  int32_t fd, cfd, cfd_out;
+  FILE *in, *out;
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_t thread;
+#endif
+
+  if (strlen(path) >= sizeof(addr.sun_path))
+  {
+    server_error("socket path '%s' is too long", path);
+    return false;
+  }
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, path);
+
+  /* remove stale socket of a previous server */
+  if (!stat(path, &st) && S_ISSOCK(st.st_mode)) unlink(path);
+
+  fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0 || bind(fd, (struct sockaddr *) &addr, sizeof(addr))
+      || listen(fd, SOMAXCONN))
+  {
+    server_error("can not listen on '%s': %s", path, strerror(errno));
+    if (fd >= 0) close(fd);
+    return false;
+  }
+  /* clients closing their connection early must not kill the server */
+  signal(SIGPIPE, SIG_IGN);
+  if (server->verbosity) server_msg("listening on '%s'", path);
+
+  for (;;)
+  {
+    cfd = accept(fd, 0, 0);
+    if (cfd < 0)
+    {
+      if (errno == EINTR) continue;
+      server_error("can not accept connection: %s", strerror(errno));
+      break;
+    }
+    in  = fdopen(cfd, "r");
+    out = (cfd_out = dup(cfd)) >= 0 ? fdopen(cfd_out, "w") : 0;
+    if (!in || !out)
+    {
+      if (in)
+        fclose(in);
+      else
+        close(cfd);
+      if (out)
+        fclose(out);
+      else if (cfd_out >= 0)
+        close(cfd_out);
+      continue;
+    }
+    conn = conn_new(server, in, out);
+#ifdef BZLA_HAVE_PTHREADS
+    if (pthread_create(&thread, 0, serve_socket_conn, conn))
+    {
+      serve_socket_conn(conn);
+      continue;
+    }
+    pthread_detach(thread);
+#else
+    serve_socket_conn(conn);
+#endif
+  }
+
+  close(fd);
+  unlink(path);
+  return false;
+}
+
+/*------------------------------------------------------------------------*/
+
+static BzlaServer *
+server_new(Bitwuzla *options, const BzlaMainServerOptions *opts)
+{
+  BzlaServer *res;
+  BzlaMemMgr *mm;
+  BzlaServerWorker *worker;
+  uint32_t i;
+  long ncores;
+
+  mm = bzla_mem_mgr_new();
+  BZLA_CNEW(mm, res);
+  res->mm        = mm;
+  res->options   = options;
+  res->store     = bzla_term_store_new();
+  res->timeout   = opts->timeout;
+  res->verbosity = opts->verbosity;
+  res->nworkers  = opts->nthreads;
+  if (res->nworkers == 0)
+  {
+    ncores        = sysconf(_SC_NPROCESSORS_ONLN);
+    res->nworkers = ncores > 0 ? (uint32_t) ncores : 1;
+  }
+#ifndef BZLA_HAVE_PTHREADS
+  res->nworkers = 1;
+#else
+  pthread_mutex_init(&res->lock, 0);
+  pthread_cond_init(&res->work, 0);
+#endif
+
+  BZLA_CNEWN(mm, res->workers, res->nworkers);
+  for (i = 0; i < res->nworkers; i++)
+  {
+    worker           = &res->workers[i];
+    worker->server   = res;
+    worker->id       = i;
+    worker->bitwuzla = bitwuzla_new();
+    bzla_set_term_store(bitwuzla_get_bzla(worker->bitwuzla), res->store);
+#ifdef BZLA_HAVE_PTHREADS
+    BZLA_ABORT(pthread_create(&worker->thread, 0, worker_thread, worker),
+               "failed to create server worker thread");
+#endif
+  }
+  return res;
+}
+
+/* Stop worker threads after all queued sessions have been solved. */
+static void
+server_shutdown(BzlaServer *server)
+{
+  BZLA_SERVER_LOCK(server);
+  server->shutdown = true;
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_cond_broadcast(&server->work);
+#endif
+  BZLA_SERVER_UNLOCK(server);
+
+#ifdef BZLA_HAVE_PTHREADS
+  for (uint32_t i = 0; i < server->nworkers; i++)
+  {
+    pthread_join(server->workers[i].thread, 0);
+  }
+#endif
+}
+
+static void
+server_delete(BzlaServer *server)
+{
+  assert(server->shutdown);
+
+  BzlaMemMgr *mm;
+  uint32_t i;
+
+  mm = server->mm;
+  for (i = 0; i < server->nworkers; i++)
+  {
+    bitwuzla_delete(server->workers[i].bitwuzla);
+  }
+  bzla_term_store_delete(server->store);
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_cond_destroy(&server->work);
+  pthread_mutex_destroy(&server->lock);
+#endif
+  BZLA_DELETEN(mm, server->workers, server->nworkers);
+  BZLA_DELETE(mm, server);
+  bzla_mem_mgr_delete(mm);
+}
+
+static void
+print_stats(BzlaServer *server)
+{
+  BzlaTermStoreStats stats;
+  uint32_t i;
+
+  server_msg("%" PRIu64 " sessions, %" PRIu64 " sat, %" PRIu64
+             " unsat, %" PRIu64 " unknown, %" PRIu64 " timeout, %" PRIu64
+             " error",
+             server->stats.sessions,
+             server->stats.sat,
+             server->stats.unsat,
+             server->stats.unknown,
+             server->stats.timeout,
+             server->stats.error);
+  for (i = 0; i < server->nworkers; i++)
+  {
+    server_msg("worker %u: %" PRIu64 " sessions",
+               i,
+               server->workers[i].nsessions);
+  }
+  server_msg("%.3f seconds solving, %.3f seconds per session",
+             server->stats.time,
+             server->stats.sessions
+                 ? server->stats.time / server->stats.sessions
+                 : 0.0);
+  bzla_term_store_get_stats(server->store, &stats);
+  server_msg("term store: %" PRIu64 " bit-vectors, %" PRIu64
+             " hits, %" PRIu64 " misses",
+             stats.bvs,
+             stats.hits,
+             stats.misses);
+}
+
+bool
+bzlamain_server_run(Bitwuzla *options, const BzlaMainServerOptions *opts)
+{
+  assert(options);
+  assert(opts);
+
+  BzlaServer *server;
+  bool res;
+
+  server = server_new(options, opts);
+  if (server->verbosity)
+  {
+    server_msg("starting server with %u worker(s)", server->nworkers);
+  }
+
+  if (opts->socket_path)
+    res = serve_socket(server, opts->socket_path);
+  else
+    res = serve_stdio(server, opts->out);
+
+  server_shutdown(server);
+  if (server->verbosity) print_stats(server);
+  server_delete(server);
+  return res;
+}
+
+#endif
@@ -0,0 +1,59 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#ifndef BZLAMAINSERVER_H_INCLUDED
+#define BZLAMAINSERVER_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "api/c/bitwuzla.h"
+
+/*------------------------------------------------------------------------*/
+
+/* Server mode: solve a stream of independent SMT-LIB v2 scripts (sessions)
+ * with a pool of persistent solver instances.
+ *
+ * Requests are read either from stdin or from connections to a Unix domain
+ * socket. Each request is a header line followed by the script:
+ *
+ *   <len> [<timeout>]\n<len bytes of SMT-LIB v2>
+ *
+ * where <timeout> optionally overrides the default per-session time limit in
+ * milliseconds (0 for no limit). Sessions are numbered per connection in
+ * order of arrival, starting from 0. They are solved concurrently and answered
+ * in order of completion:
+ *
+ *   <id> <status> <msec> <len>\n<len bytes of solver output>
+ *
+ * where <status> is the result of the last satisfiability check of the session
+ * ('sat', 'unsat', 'unknown'), 'timeout' if the time limit was reached, or
+ * 'error' if the script could not be parsed.
+ *
+ * Worker instances are reset between sessions instead of being recreated and
+ * share one term store. */
+struct BzlaMainServerOptions
+{
+  const char *socket_path; /* Unix domain socket, 0 for stdin */
+  FILE *out;               /* response stream if reading from stdin */
+  uint32_t nthreads;       /* number of worker threads, 0 for number of cores */
+  uint32_t timeout;        /* per-session time limit in ms, 0 for none */
+  uint32_t verbosity;      /* print per-session and summary statistics */
+};
+
+typedef struct BzlaMainServerOptions BzlaMainServerOptions;
+
+/* Run server until end of input (stdin) or until the process is terminated
+ * (socket). The solver options of all sessions are initialized with the
+ * options of 'options'. Returns true on success. */
+bool bzlamain_server_run(Bitwuzla *options, const BzlaMainServerOptions *opts);
+
+#endif
@@ -43,7 +43,7 @@ bzla_model_delete_bv(Bzla *bzla, BzlaIntHashTable **bv_model)
   {
     bv  = (BzlaBitVector *) (*bv_model)->data[it.cur_pos].as_ptr;
     cur = bzla_node_get_by_id(bzla, bzla_iter_hashint_next(&it));
-    bzla_bv_free(bzla->mm, bv);
+    bzla_term_store_release_bv(bzla->term_store, bv);
     bzla_node_release(bzla, cur);
   }
   bzla_hashint_map_delete(*bv_model);
@@ -75,8 +75,8 @@ bzla_model_clone_bv(Bzla *bzla, BzlaIntHashTable *bv_model, bool inc_ref_cnt)
   BzlaIntHashTableIterator it;
   BzlaNode *exp;
 
-  res =
-      bzla_hashint_map_clone(bzla->mm, bv_model, bzla_clone_data_as_bv_ptr, 0);
+  res = bzla_hashint_map_clone(
+      bzla->mm, bv_model, bzla_clone_data_as_stored_bv_ptr, bzla->term_store);
 
   bzla_iter_hashint_init(&it, res);
   while (bzla_iter_hashint_has_next(&it))
@@ -105,7 +105,7 @@ bzla_model_add_to_bv(Bzla *bzla,
   assert(!bzla_hashint_map_contains(bv_model, bzla_node_real_addr(exp)->id));
   bzla_node_copy(bzla, exp);
   bzla_hashint_map_add(bv_model, bzla_node_real_addr(exp)->id)->as_ptr =
-      bzla_bv_copy(bzla->mm, assignment);
+      bzla_term_store_get_bv(bzla->term_store, assignment);
 }
 
 /*------------------------------------------------------------------------*/
@@ -123,12 +123,12 @@ bzla_model_remove_from_bv(Bzla *bzla, BzlaIntHashTable *bv_model, BzlaNode *exp)
   id = bzla_node_get_id(exp);
   assert(bzla_hashint_map_contains(bv_model, id));
   bzla_hashint_map_remove(bv_model, id, &d);
-  bzla_bv_free(bzla->mm, d.as_ptr);
+  bzla_term_store_release_bv(bzla->term_store, d.as_ptr);
   bzla_node_release(bzla, exp);
   if (bzla_hashint_map_contains(bv_model, -id))
   {
-    bzla_hashint_map_remove(bv_model, id, &d);
-    bzla_bv_free(bzla->mm, d.as_ptr);
+    bzla_hashint_map_remove(bv_model, -id, &d);
+    bzla_term_store_release_bv(bzla->term_store, d.as_ptr);
     bzla_node_release(bzla, exp);
   }
 }
@@ -167,7 +167,7 @@ add_to_fun_model(Bzla *bzla,
    * needs to be considered */
   if (bzla_hashptr_table_get(model, t)) return;
   b = bzla_hashptr_table_add(model, bzla_bv_copy_tuple(bzla->mm, t));
-  b->data.as_ptr = bzla_bv_copy(bzla->mm, value);
+  b->data.as_ptr = bzla_term_store_get_bv(bzla->term_store, value);
 }
 
 /*------------------------------------------------------------------------*/
@@ -854,7 +854,7 @@ bzla_model_get_bv_aux(Bzla *bzla,
   {
     /* we don't use add_to_bv_model in order to avoid redundant
      * hash table queries and copying/freeing of the resulting bv */
-    result = bzla_bv_not(bzla->mm, result);
+    result = bzla_term_store_get_not_bv(bzla->term_store, result);
     bzla_node_copy(bzla, exp);
     bzla_hashint_map_add(bv_model, bzla_node_get_id(exp))->as_ptr = result;
   }
@@ -900,7 +900,7 @@ delete_fun_model(Bzla *bzla, BzlaIntHashTable **fun_model)
       value = (BzlaBitVector *) it2.bucket->data.as_ptr;
       tup   = (BzlaBitVectorTuple *) bzla_iter_hashptr_next(&it2);
       bzla_bv_free_tuple(bzla->mm, tup);
-      bzla_bv_free(bzla->mm, value);
+      bzla_term_store_release_bv(bzla->term_store, value);
     }
     bzla_node_release(bzla, cur);
     bzla_hashptr_table_delete(t);
@@ -934,8 +934,10 @@ bzla_model_clone_fun(Bzla *bzla, BzlaIntHashTable *fun_model, bool inc_ref_cnt)
   BzlaIntHashTableIterator it;
   BzlaNode *exp;
 
-  res = bzla_hashint_map_clone(
-      bzla->mm, fun_model, bzla_clone_data_as_bv_ptr_htable, 0);
+  res = bzla_hashint_map_clone(bzla->mm,
+                               fun_model,
+                               bzla_clone_data_as_stored_bv_ptr_htable,
+                               bzla->term_store);
 
   bzla_iter_hashint_init(&it, res);
   while (bzla_iter_hashint_has_next(&it))
@@ -24,6 +24,7 @@
 #include "bzlaexp.h"
 #include "bzlafp.h"
 #include "bzlalog.h"
+#include "bzlapipeline.h"
 #include "bzlarewrite.h"
 #include "bzlarm.h"
 #include "utils/bzlaabort.h"
@@ -1092,20 +1093,20 @@ erase_local_data_exp(Bzla *bzla, BzlaNode *exp)
   assert(!exp->disconnected);
   assert(!bzla_node_is_invalid(exp));
 
-  BzlaMemMgr *mm;
   BzlaPtrHashTable *static_rho;
   BzlaPtrHashTableIterator it;
 
-  mm = bzla->mm;
   //  BZLALOG ("%s: %s", __FUNCTION__, bzla_util_node2string (exp));
 
   switch (exp->kind)
   {
     case BZLA_BV_CONST_NODE: {
-      bzla_bv_free(mm, bzla_node_bv_const_get_bits_ptr(exp));
+      bzla_term_store_release_bv(bzla->term_store,
+                                 bzla_node_bv_const_get_bits_ptr(exp));
       if (bzla_node_bv_const_get_invbits_ptr(exp))
       {
-        bzla_bv_free(mm, bzla_node_bv_const_get_invbits_ptr(exp));
+        bzla_term_store_release_bv(bzla->term_store,
+                                   bzla_node_bv_const_get_invbits_ptr(exp));
       }
       bzla_node_bv_const_set_bits(exp, 0);
       bzla_node_bv_const_set_invbits(exp, 0);
@@ -1152,7 +1153,9 @@ erase_local_data_exp(Bzla *bzla, BzlaNode *exp)
 
   if (exp->av)
   {
+    bzla_pipeline_lock(bzla);
     bzla_aigvec_release_delete(bzla->avmgr, exp->av);
+    bzla_pipeline_unlock(bzla);
     exp->av = 0;
   }
   exp->erased = 1;
@@ -1499,11 +1502,37 @@ bzla_node_bv_const_get_bits(BzlaNode *exp)
 {
   assert(exp);
   assert(bzla_node_is_bv_const(exp));
+
+  BzlaBitVector *res, *expected = 0;
+  BzlaBVConstNode *real_exp;
+  BzlaTermStore *store;
+
+  real_exp = (BzlaBVConstNode *) bzla_node_real_addr(exp);
   if (bzla_node_is_regular(exp))
   {
-    return bzla_node_bv_const_get_bits_ptr(exp);
+    return real_exp->bits;
   }
-  return bzla_node_bv_const_get_invbits_ptr(exp);
+
+  /* The inverted value is created on first use. Constants may be read
+   * concurrently by the background bit-blasting thread, hence it is
+   * published atomically. */
+  res = __atomic_load_n(&real_exp->invbits, __ATOMIC_ACQUIRE);
+  if (!res)
+  {
+    store = real_exp->bzla->term_store;
+    res   = bzla_term_store_get_not_bv(store, real_exp->bits);
+    if (!__atomic_compare_exchange_n(&real_exp->invbits,
+                                     &expected,
+                                     res,
+                                     false,
+                                     __ATOMIC_ACQ_REL,
+                                     __ATOMIC_ACQUIRE))
+    {
+      bzla_term_store_release_bv(store, res);
+      res = expected;
+    }
+  }
+  return res;
 }
 
 BzlaBitVector *
@@ -2375,8 +2404,7 @@ new_bv_const_exp_node(Bzla *bzla, BzlaBitVector *bits)
   bzla_node_set_sort_id((BzlaNode *) exp,
                         bzla_sort_bv(bzla, bzla_bv_get_width(bits)));
   setup_node_and_add_to_id_table(bzla, exp);
-  bzla_node_bv_const_set_bits((BzlaNode *) exp, bzla_bv_copy(bzla->mm, bits));
-  bzla_node_bv_const_set_invbits((BzlaNode *) exp, bzla_bv_not(bzla->mm, bits));
+  exp->bits = bzla_term_store_get_bv(bzla->term_store, bits);
   return (BzlaNode *) exp;
 }
 
@@ -2878,6 +2906,115 @@ create_exp(Bzla *bzla, BzlaNodeKind kind, uint32_t arity, BzlaNode *e[])
 
 /*------------------------------------------------------------------------*/
 
+/* Specialized version of find_bv_fp_exp for binary bit-vector nodes with
+ * precomputed hash value. */
+static inline BzlaNode **
+find_binary_bv_exp(
+    Bzla *bzla, BzlaNodeKind kind, BzlaNode *e0, BzlaNode *e1, uint32_t hash)
+{
+  BzlaNode *cur, **result;
+
+  result = bzla->nodes_unique_table.chains
+           + (hash & (bzla->nodes_unique_table.size - 1));
+  for (cur = *result; cur; result = &cur->next, cur = *result)
+  {
+    assert(bzla_node_is_regular(cur));
+    if (cur->kind != kind || cur->arity != 2) continue;
+    if (cur->e[0] == e0 && cur->e[1] == e1) break;
+    /* special case for bv eq; (= (bvnot a) b) == (= a (bvnot b)) */
+    if (kind == BZLA_BV_EQ_NODE && cur->e[0] == bzla_node_invert(e0)
+        && cur->e[1] == bzla_node_invert(e1))
+      break;
+  }
+  return result;
+}
+
+/* Specialized version of create_exp for binary bit-vector nodes, which make
+ * up the majority of created nodes. Children are expected to be simplified.
+ * The hash value is computed once, and the sort of the new node is derived
+ * from the kind without sort lookups (except for concats). */
+static inline BzlaNode *
+create_binary_bv_exp(Bzla *bzla, BzlaNodeKind kind, BzlaNode *e0, BzlaNode *e1)
+{
+  assert(bzla);
+  assert(kind == BZLA_BV_AND_NODE || kind == BZLA_BV_ADD_NODE
+         || kind == BZLA_BV_MUL_NODE || kind == BZLA_BV_ULT_NODE
+         || kind == BZLA_BV_SLT_NODE || kind == BZLA_BV_SLL_NODE
+         || kind == BZLA_BV_SRL_NODE || kind == BZLA_BV_UDIV_NODE
+         || kind == BZLA_BV_UREM_NODE || kind == BZLA_BV_EQ_NODE
+         || kind == BZLA_BV_CONCAT_NODE);
+  assert(bzla_simplify_exp(bzla, e0) == e0);
+  assert(bzla_simplify_exp(bzla, e1) == e1);
+
+  uint32_t hash;
+  BzlaNode **lookup, *exp, *simp;
+  BzlaSortId sort;
+
+  if (bzla_node_is_binary_commutative_bv_kind(kind)
+      && bzla_node_real_addr(e0)->id > bzla_node_real_addr(e1)->id
+      && bzla_opt_get(bzla, BZLA_OPT_RW_SORT_EXP))
+  {
+    BZLA_SWAP(BzlaNode *, e0, e1);
+  }
+
+  hash = hash_primes[0] * (uint32_t) bzla_node_real_addr(e0)->id
+         + hash_primes[1] * (uint32_t) bzla_node_real_addr(e1)->id;
+
+  lookup = find_binary_bv_exp(bzla, kind, e0, e1, hash);
+  if (!*lookup)
+  {
+    if (BZLA_FULL_UNIQUE_TABLE(bzla->nodes_unique_table))
+    {
+      enlarge_nodes_unique_table(bzla);
+      lookup = find_binary_bv_exp(bzla, kind, e0, e1, hash);
+    }
+
+    switch (kind)
+    {
+      case BZLA_BV_ULT_NODE:
+      case BZLA_BV_SLT_NODE:
+      case BZLA_BV_EQ_NODE:
+        sort = bzla_sort_copy(bzla, bzla_node_get_sort_id(bzla->true_exp));
+        break;
+      case BZLA_BV_CONCAT_NODE:
+        sort = bzla_sort_bv(bzla,
+                            bzla_node_bv_get_width(bzla, e0)
+                                + bzla_node_bv_get_width(bzla, e1));
+        break;
+      default: sort = bzla_sort_copy(bzla, bzla_node_get_sort_id(e0));
+    }
+
+    BZLA_CNEW(bzla->mm, exp);
+    set_kind(bzla, exp, kind);
+    exp->arity = 2;
+    exp->bytes = sizeof(*exp);
+    setup_node_and_add_to_id_table(bzla, exp);
+    bzla_node_set_sort_id(exp, sort);
+    connect_child_exp(bzla, exp, e0, 0);
+    connect_child_exp(bzla, exp, e1, 1);
+
+    *lookup = exp;
+    assert(bzla->nodes_unique_table.num_elements < INT32_MAX);
+    bzla->nodes_unique_table.num_elements++;
+    exp->unique = 1;
+  }
+  else
+  {
+    inc_exp_ref_counter(bzla, *lookup);
+  }
+  assert(bzla_node_is_regular(*lookup));
+  if (bzla_node_is_simplified(*lookup))
+  {
+    assert(bzla_opt_get(bzla, BZLA_OPT_PP_NONDESTR_SUBST));
+    simp = bzla_node_copy(bzla, bzla_node_get_simplified(bzla, *lookup));
+    bzla_node_release(bzla, *lookup);
+    return simp;
+  }
+  return *lookup;
+}
+
+/*------------------------------------------------------------------------*/
+
 BzlaNode *
 bzla_node_create_bv_const(Bzla *bzla, const BzlaBitVector *bits)
 {
@@ -3069,7 +3206,7 @@ bzla_node_create_eq(Bzla *bzla, BzlaNode *e0, BzlaNode *e1)
     sort = bzla_node_get_sort_id(e0);
     if (bzla_sort_is_bv(bzla, sort))
     {
-      kind = BZLA_BV_EQ_NODE;
+      return create_binary_bv_exp(bzla, BZLA_BV_EQ_NODE, e[0], e[1]);
     }
     else if (bzla_sort_is_rm(bzla, sort))
     {
@@ -3443,101 +3580,91 @@ bzla_node_create_bv_slice(Bzla *bzla,
 BzlaNode *
 bzla_node_create_bv_and(Bzla *bzla, BzlaNode *e0, BzlaNode *e1)
 {
-  BzlaNode *e[2];
-  e[0] = bzla_simplify_exp(bzla, e0);
-  e[1] = bzla_simplify_exp(bzla, e1);
-  assert(bzla_dbg_precond_regular_binary_bv_exp(bzla, e[0], e[1]));
-  return create_exp(bzla, BZLA_BV_AND_NODE, 2, e);
+  e0 = bzla_simplify_exp(bzla, e0);
+  e1 = bzla_simplify_exp(bzla, e1);
+  assert(bzla_dbg_precond_regular_binary_bv_exp(bzla, e0, e1));
+  return create_binary_bv_exp(bzla, BZLA_BV_AND_NODE, e0, e1);
 }
 
 BzlaNode *
 bzla_node_create_bv_add(Bzla *bzla, BzlaNode *e0, BzlaNode *e1)
 {
-  BzlaNode *e[2];
-  e[0] = bzla_simplify_exp(bzla, e0);
-  e[1] = bzla_simplify_exp(bzla, e1);
-  assert(bzla_dbg_precond_regular_binary_bv_exp(bzla, e[0], e[1]));
-  return create_exp(bzla, BZLA_BV_ADD_NODE, 2, e);
+  e0 = bzla_simplify_exp(bzla, e0);
+  e1 = bzla_simplify_exp(bzla, e1);
+  assert(bzla_dbg_precond_regular_binary_bv_exp(bzla, e0, e1));
+  return create_binary_bv_exp(bzla, BZLA_BV_ADD_NODE, e0, e1);
 }
 
 BzlaNode *
 bzla_node_create_bv_mul(Bzla *bzla, BzlaNode *e0, BzlaNode *e1)
 {
-  BzlaNode *e[2];
-  e[0] = bzla_simplify_exp(bzla, e0);
-  e[1] = bzla_simplify_exp(bzla, e1);
-  assert(bzla_dbg_precond_regular_binary_bv_exp(bzla, e[0], e[1]));
-  return create_exp(bzla, BZLA_BV_MUL_NODE, 2, e);
+  e0 = bzla_simplify_exp(bzla, e0);
+  e1 = bzla_simplify_exp(bzla, e1);
+  assert(bzla_dbg_precond_regular_binary_bv_exp(bzla, e0, e1));
+  return create_binary_bv_exp(bzla, BZLA_BV_MUL_NODE, e0, e1);
 }
 
 BzlaNode *
 bzla_node_create_bv_ult(Bzla *bzla, BzlaNode *e0, BzlaNode *e1)
 {
-  BzlaNode *e[2];
-  e[0] = bzla_simplify_exp(bzla, e0);
-  e[1] = bzla_simplify_exp(bzla, e1);
-  assert(bzla_dbg_precond_regular_binary_bv_exp(bzla, e[0], e[1]));
-  return create_exp(bzla, BZLA_BV_ULT_NODE, 2, e);
+  e0 = bzla_simplify_exp(bzla, e0);
+  e1 = bzla_simplify_exp(bzla, e1);
+  assert(bzla_dbg_precond_regular_binary_bv_exp(bzla, e0, e1));
+  return create_binary_bv_exp(bzla, BZLA_BV_ULT_NODE, e0, e1);
 }
 
 BzlaNode *
 bzla_node_create_bv_slt(Bzla *bzla, BzlaNode *e0, BzlaNode *e1)
 {
-  BzlaNode *e[2];
-  e[0] = bzla_simplify_exp(bzla, e0);
-  e[1] = bzla_simplify_exp(bzla, e1);
-  assert(bzla_dbg_precond_regular_binary_bv_exp(bzla, e[0], e[1]));
-  return create_exp(bzla, BZLA_BV_SLT_NODE, 2, e);
+  e0 = bzla_simplify_exp(bzla, e0);
+  e1 = bzla_simplify_exp(bzla, e1);
+  assert(bzla_dbg_precond_regular_binary_bv_exp(bzla, e0, e1));
+  return create_binary_bv_exp(bzla, BZLA_BV_SLT_NODE, e0, e1);
 }
 
 BzlaNode *
 bzla_node_create_bv_sll(Bzla *bzla, BzlaNode *e0, BzlaNode *e1)
 {
-  BzlaNode *e[2];
-  e[0] = bzla_simplify_exp(bzla, e0);
-  e[1] = bzla_simplify_exp(bzla, e1);
-  assert(bzla_dbg_precond_shift_exp(bzla, e[0], e[1]));
-  return create_exp(bzla, BZLA_BV_SLL_NODE, 2, e);
+  e0 = bzla_simplify_exp(bzla, e0);
+  e1 = bzla_simplify_exp(bzla, e1);
+  assert(bzla_dbg_precond_shift_exp(bzla, e0, e1));
+  return create_binary_bv_exp(bzla, BZLA_BV_SLL_NODE, e0, e1);
 }
 
 BzlaNode *
 bzla_node_create_bv_srl(Bzla *bzla, BzlaNode *e0, BzlaNode *e1)
 {
-  BzlaNode *e[2];
-  e[0] = bzla_simplify_exp(bzla, e0);
-  e[1] = bzla_simplify_exp(bzla, e1);
-  assert(bzla_dbg_precond_shift_exp(bzla, e[0], e[1]));
-  return create_exp(bzla, BZLA_BV_SRL_NODE, 2, e);
+  e0 = bzla_simplify_exp(bzla, e0);
+  e1 = bzla_simplify_exp(bzla, e1);
+  assert(bzla_dbg_precond_shift_exp(bzla, e0, e1));
+  return create_binary_bv_exp(bzla, BZLA_BV_SRL_NODE, e0, e1);
 }
 
 BzlaNode *
 bzla_node_create_bv_udiv(Bzla *bzla, BzlaNode *e0, BzlaNode *e1)
 {
-  BzlaNode *e[2];
-  e[0] = bzla_simplify_exp(bzla, e0);
-  e[1] = bzla_simplify_exp(bzla, e1);
-  assert(bzla_dbg_precond_regular_binary_bv_exp(bzla, e[0], e[1]));
-  return create_exp(bzla, BZLA_BV_UDIV_NODE, 2, e);
+  e0 = bzla_simplify_exp(bzla, e0);
+  e1 = bzla_simplify_exp(bzla, e1);
+  assert(bzla_dbg_precond_regular_binary_bv_exp(bzla, e0, e1));
+  return create_binary_bv_exp(bzla, BZLA_BV_UDIV_NODE, e0, e1);
 }
 
 BzlaNode *
 bzla_node_create_bv_urem(Bzla *bzla, BzlaNode *e0, BzlaNode *e1)
 {
-  BzlaNode *e[2];
-  e[0] = bzla_simplify_exp(bzla, e0);
-  e[1] = bzla_simplify_exp(bzla, e1);
-  assert(bzla_dbg_precond_regular_binary_bv_exp(bzla, e[0], e[1]));
-  return create_exp(bzla, BZLA_BV_UREM_NODE, 2, e);
+  e0 = bzla_simplify_exp(bzla, e0);
+  e1 = bzla_simplify_exp(bzla, e1);
+  assert(bzla_dbg_precond_regular_binary_bv_exp(bzla, e0, e1));
+  return create_binary_bv_exp(bzla, BZLA_BV_UREM_NODE, e0, e1);
 }
 
 BzlaNode *
 bzla_node_create_bv_concat(Bzla *bzla, BzlaNode *e0, BzlaNode *e1)
 {
-  BzlaNode *e[2];
-  e[0] = bzla_simplify_exp(bzla, e0);
-  e[1] = bzla_simplify_exp(bzla, e1);
-  assert(bzla_dbg_precond_concat_exp(bzla, e[0], e[1]));
-  return create_exp(bzla, BZLA_BV_CONCAT_NODE, 2, e);
+  e0 = bzla_simplify_exp(bzla, e0);
+  e1 = bzla_simplify_exp(bzla, e1);
+  assert(bzla_dbg_precond_concat_exp(bzla, e0, e1));
+  return create_binary_bv_exp(bzla, BZLA_BV_CONCAT_NODE, e0, e1);
 }
 
 #if 0
@@ -179,8 +179,8 @@ typedef struct BzlaUFNode BzlaUFNode;
 struct BzlaBVConstNode
 {
   BZLA_NODE_STRUCT;
-  BzlaBitVector *bits;
-  BzlaBitVector *invbits;
+  BzlaBitVector *bits;    /* stored in bzla->term_store */
+  BzlaBitVector *invbits; /* stored in bzla->term_store, created on demand */
 };
 typedef struct BzlaBVConstNode BzlaBVConstNode;
 
@@ -1243,6 +1243,7 @@ BzlaBitVector *bzla_node_bv_const_get_bits_ptr(BzlaNode *exp);
 /**
  * Get a pointer to 'invbits' of a bit-vector constant node.
  * This function is meant to only be used for manipulating this pointer.
+ * Returns 0 if 'invbits' has not been created yet.
  */
 BzlaBitVector *bzla_node_bv_const_get_invbits_ptr(BzlaNode *exp);
 
@@ -10,15 +10,19 @@
 
 #include "bzlaopt.h"
 
+#include <ctype.h>
 #include <limits.h>
+#ifdef BZLA_HAVE_PTHREADS
+#include <pthread.h>
+#endif
 
-#include "bzlaclone.h"
 #include "bzlacore.h"
 #include "bzlalog.h"
 #include "bzlamodel.h"
 #include "bzlaparse.h"
 #include "utils/bzlahashptr.h"
 #include "utils/bzlarng.h"
+#include "utils/bzlastack.h"
 #include "utils/bzlautil.h"
 
 /*------------------------------------------------------------------------*/
@@ -35,8 +39,73 @@ const char *const g_bzla_se_name[BZLA_SAT_ENGINE_MAX + 1] = {
 
 /*------------------------------------------------------------------------*/
 
+/* Option metadata (identifiers, descriptions, bounds, default values and enum
+ * value tables) is shared by all solver instances. It is initialized once on
+ * first use and never freed. Solver instances only store option values. */
+static struct
+{
+  BzlaMemMgr *mm;
+  BzlaOpt options[BZLA_OPT_NUM_OPTS];
+  BzlaPtrHashTable *str2opt;
+} g_opts;
+
+#ifdef BZLA_HAVE_PTHREADS
+static pthread_once_t g_opts_once = PTHREAD_ONCE_INIT;
+#else
+static bool g_opts_initialized = false;
+#endif
+
+#ifndef BZLA_WINDOWS_BUILD
+extern char **environ;
+#endif
+
+/*------------------------------------------------------------------------*/
+
+/* Check if any environment variable may override an option default value.
+ * Avoids looking up the environment variables of all options on instance
+ * creation in the common case. */
+static bool
+has_env_opts(void)
+{
+#ifndef BZLA_WINDOWS_BUILD
+  char **e;
+  for (e = environ; e && *e; e++)
+  {
+    if (!strncmp(*e, "BZLA", 4)) return true;
+  }
+  return false;
+#else
+  return true;
+#endif
+}
+
+/* Get name of environment variable that overrides the default value of
+ * option 'lng', e.g., BZLAMODELGEN for 'model-gen'. */
+static char *
+get_env_name(BzlaMemMgr *mm, const char *lng)
+{
+  BzlaCharStack uname;
+  char *res;
+  size_t i;
+
+  BZLA_INIT_STACK(mm, uname);
+  BZLA_PUSH_STACK(uname, 'B');
+  BZLA_PUSH_STACK(uname, 'Z');
+  BZLA_PUSH_STACK(uname, 'L');
+  BZLA_PUSH_STACK(uname, 'A');
+  for (i = 0; lng[i] != 0; i++)
+  {
+    if (lng[i] == '-' || lng[i] == '_' || lng[i] == ':') continue;
+    BZLA_PUSH_STACK(uname, toupper((int32_t) lng[i]));
+  }
+  BZLA_PUSH_STACK(uname, 0);
+  res = bzla_mem_strdup(mm, uname.start);
+  BZLA_RELEASE_STACK(uname);
+  return res;
+}
+
 static void
-init_opt(Bzla *bzla,
+init_opt(BzlaMemMgr *mm,
          BzlaOption opt,
          bool expert,
          bool isflag,
@@ -47,40 +116,29 @@ init_opt(Bzla *bzla,
          uint32_t max,
          char *desc)
 {
-  assert(bzla);
+  assert(mm);
   assert(opt >= 0 && opt < BZLA_OPT_NUM_OPTS);
   assert(lng);
   assert(max <= UINT32_MAX);
   assert(min <= val);
   assert(val <= max);
 
-  uint32_t v;
-  char *valstr;
-
-  assert(!bzla_hashptr_table_get(bzla->str2opt, lng));
+  BzlaOpt *o;
 
-  bzla->options[opt].expert   = expert;
-  bzla->options[opt].isflag   = isflag;
-  bzla->options[opt].shrt     = shrt;
-  bzla->options[opt].lng      = lng;
-  bzla->options[opt].val      = val;
-  bzla->options[opt].dflt     = val;
-  bzla->options[opt].min      = min;
-  bzla->options[opt].max      = max;
-  bzla->options[opt].desc     = desc;
+  assert(!bzla_hashptr_table_get(g_opts.str2opt, lng));
 
-  bzla_hashptr_table_add(bzla->str2opt, lng)->data.as_int = opt;
+  o         = &g_opts.options[opt];
+  o->expert = expert;
+  o->isflag = isflag;
+  o->shrt   = shrt;
+  o->lng    = lng;
+  o->env    = get_env_name(mm, lng);
+  o->dflt   = val;
+  o->min    = min;
+  o->max    = max;
+  o->desc   = desc;
 
-  if ((valstr = bzla_util_getenv_value(bzla->mm, lng)))
-  {
-    v = atoi(valstr);
-    if (v < min)
-      v = min;
-    else if (v > max)
-      v = max;
-    if (v == val) return;
-    bzla_opt_set(bzla, opt, v);
-  }
+  bzla_hashptr_table_add(g_opts.str2opt, lng)->data.as_int = opt;
 }
 
 static void
@@ -108,21 +166,19 @@ strcmpoptval(const char *a, const char *b)
   return strncmp(a, b, len_a);
 }
 
-void
-bzla_opt_init_opts(Bzla *bzla)
+static void
+init_shared_opts(void)
 {
-  assert(bzla);
-
   BzlaPtrHashTable *opts;
   BzlaMemMgr *mm;
 
-  mm = bzla->mm;
-  BZLA_CNEWN(mm, bzla->options, BZLA_OPT_NUM_OPTS);
-  bzla->str2opt = bzla_hashptr_table_new(
+  mm             = bzla_mem_mgr_new();
+  g_opts.mm      = mm;
+  g_opts.str2opt = bzla_hashptr_table_new(
       mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
 
   /* general options (all others are expert options) ----------------------- */
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PRODUCE_MODELS,
            false,
            true,
@@ -132,7 +188,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            2,
            "print model for satisfiable instances");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_INCREMENTAL,
            false,
            true,
@@ -142,7 +198,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "incremental usage");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PRODUCE_UNSAT_CORES,
            true,
            true,
@@ -152,7 +208,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "enable unsat cores");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_INPUT_FORMAT,
            false,
            false,
@@ -163,7 +219,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_INPUT_FORMAT_MAX,
            "input file format");
   opts = bzla_hashptr_table_new(
-      bzla->mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
+      mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
   add_opt_help(
       mm, opts, "none", BZLA_INPUT_FORMAT_NONE, "auto-detect input format");
   add_opt_help(
@@ -175,9 +231,9 @@ bzla_opt_init_opts(Bzla *bzla)
                "smt2",
                BZLA_INPUT_FORMAT_SMT2,
                "force SMT-LIB v2 input format");
-  bzla->options[BZLA_OPT_INPUT_FORMAT].options = opts;
+  g_opts.options[BZLA_OPT_INPUT_FORMAT].options = opts;
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_OUTPUT_NUMBER_FORMAT,
            false,
            false,
@@ -188,7 +244,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_OUTPUT_BASE_MAX,
            "output number format");
   opts = bzla_hashptr_table_new(
-      bzla->mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
+      mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
   add_opt_help(mm,
                opts,
                "bin",
@@ -204,9 +260,9 @@ bzla_opt_init_opts(Bzla *bzla)
                "dec",
                BZLA_OUTPUT_BASE_DEC,
                "print bit-vector values in decimal format");
-  bzla->options[BZLA_OPT_OUTPUT_NUMBER_FORMAT].options = opts;
+  g_opts.options[BZLA_OPT_OUTPUT_NUMBER_FORMAT].options = opts;
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_OUTPUT_FORMAT,
            false,
            false,
@@ -217,7 +273,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_OUTPUT_FORMAT_MAX,
            "output file format");
   opts = bzla_hashptr_table_new(
-      bzla->mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
+      mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
   add_opt_help(mm,
                opts,
                "none",
@@ -248,9 +304,9 @@ bzla_opt_init_opts(Bzla *bzla)
                "aigerbin",
                BZLA_OUTPUT_FORMAT_AIGER_BINARY,
                "use the AIGER binary format as output file format");
-  bzla->options[BZLA_OPT_OUTPUT_FORMAT].options = opts;
+  g_opts.options[BZLA_OPT_OUTPUT_FORMAT].options = opts;
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_ENGINE,
            false,
            false,
@@ -261,12 +317,17 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_ENGINE_MAX,
            "enable specific engine");
   opts = bzla_hashptr_table_new(
-      bzla->mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
+      mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
   add_opt_help(mm,
                opts,
                "aigprop",
                BZLA_ENGINE_AIGPROP,
                "use the propagation-based local search engine (QF_BV only)");
+  add_opt_help(mm,
+               opts,
+               "auto",
+               BZLA_ENGINE_AUTO,
+               "select engine and SAT solver based on formula features");
   add_opt_help(mm,
                opts,
                "fun",
@@ -288,9 +349,9 @@ bzla_opt_init_opts(Bzla *bzla)
                "quant",
                BZLA_ENGINE_QUANT,
                "use the quantifier engine (BV only)");
-  bzla->options[BZLA_OPT_ENGINE].options = opts;
+  g_opts.options[BZLA_OPT_ENGINE].options = opts;
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SAT_ENGINE,
            false,
            false,
@@ -301,7 +362,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_SAT_ENGINE_MAX,
            "enable specific SAT solver");
   opts = bzla_hashptr_table_new(
-      bzla->mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
+      mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
   add_opt_help(mm,
                opts,
                "cadical",
@@ -337,9 +398,9 @@ bzla_opt_init_opts(Bzla *bzla)
                "gimsatul",
                BZLA_SAT_ENGINE_GIMSATUL,
                "use gimsatul as back end SAT solver");
-  bzla->options[BZLA_OPT_SAT_ENGINE].options = opts;
+  g_opts.options[BZLA_OPT_SAT_ENGINE].options = opts;
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_AUTO_CLEANUP,
            false,
            true,
@@ -349,7 +410,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "auto clean up all memory allocated via API queries on exit");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PRETTY_PRINT,
            false,
            true,
@@ -359,7 +420,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "pretty print when dumping");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_EXIT_CODES,
            false,
            true,
@@ -369,7 +430,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "use exit codes for sat/unsat");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SEED,
            false,
            false,
@@ -379,7 +440,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            UINT32_MAX,
            "random number generator seed");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_VERBOSITY,
            false,
            true,
@@ -389,7 +450,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            BZLA_VERBOSITY_MAX,
            "increase verbosity");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_LOGLEVEL,
            false,
            true,
@@ -400,7 +461,7 @@ bzla_opt_init_opts(Bzla *bzla)
            UINT32_MAX,
            "increase loglevel");
   init_opt(
-      bzla,
+      mm,
       BZLA_OPT_PRINT_DIMACS,
       true,
       true,
@@ -412,7 +473,7 @@ bzla_opt_init_opts(Bzla *bzla)
       "Print CNF formula sent to SAT solver in DIMACS format and terminate.");
 
   /* rewriting / preprocessing (expert options) ----------------------------- */
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_RW_LEVEL,
            true,
            false,
@@ -422,7 +483,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            3,
            "rewrite level");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PP_SKELETON_PREPROC,
            true,
            true,
@@ -432,7 +493,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "propositional skeleton preprocessing");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PP_ACKERMANN,
            true,
            true,
@@ -442,7 +503,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "add ackermann constraints");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PP_BETA_REDUCE,
            true,
            false,
@@ -453,7 +514,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_BETA_REDUCE_MAX,
            "eagerly eliminate lambda expressions");
   opts = bzla_hashptr_table_new(
-      bzla->mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
+      mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
   add_opt_help(mm, opts, "none", BZLA_BETA_REDUCE_NONE, "do not beta-reduce");
   add_opt_help(
       mm, opts, "fun", BZLA_BETA_REDUCE_FUN, "only beta-reduce functions");
@@ -462,9 +523,9 @@ bzla_opt_init_opts(Bzla *bzla)
                "all",
                BZLA_BETA_REDUCE_ALL,
                "beta-reduce functions and array-writes");
-  bzla->options[BZLA_OPT_PP_BETA_REDUCE].options = opts;
+  g_opts.options[BZLA_OPT_PP_BETA_REDUCE].options = opts;
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PP_ELIMINATE_ITES,
            true,
            true,
@@ -474,7 +535,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "eliminate ITEs");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PP_ELIMINATE_EXTRACTS,
            true,
            true,
@@ -484,7 +545,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "eliminate slices on variables");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PP_VAR_SUBST,
            true,
            true,
@@ -494,7 +555,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "variable substitution");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PP_UNCONSTRAINED_OPTIMIZATION,
            true,
            true,
@@ -504,7 +565,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "unconstrained optimization");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PP_MERGE_LAMBDAS,
            true,
            true,
@@ -514,7 +575,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "merge lambda chains");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PP_EXTRACT_LAMBDAS,
            true,
            true,
@@ -524,7 +585,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "extract lambda terms");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_RW_NORMALIZE_ADD,
            true,
            true,
@@ -534,7 +595,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "normalize bit-vector addition operators (local)");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_RW_NORMALIZE,
            true,
            true,
@@ -544,7 +605,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "normalize bit-vector operators");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PP_NORMALIZE_ADD,
            true,
            true,
@@ -554,7 +615,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "normalize bit-vector addition operators (global)");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_RW_SIMPLIFY_CONSTRAINTS,
            true,
            true,
@@ -564,7 +625,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "simplify constraints on construction");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_RW_SORT_EXP,
            true,
            true,
@@ -574,7 +635,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "sort commutative expression nodes");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_RW_SORT_AIG,
            true,
            true,
@@ -584,7 +645,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "sort AIG nodes");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_RW_SORT_AIGVEC,
            true,
            true,
@@ -594,7 +655,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "sort AIG vectors");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PP_NONDESTR_SUBST,
            true,
            true,
@@ -604,7 +665,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "enable non-destructive term substitutions");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_RW_SLT,
            true,
            true,
@@ -614,7 +675,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "eliminate bit-vector slt nodes");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_RW_EXTRACT_ARITH,
            true,
            true,
@@ -626,7 +687,7 @@ bzla_opt_init_opts(Bzla *bzla)
            "propagate extracts over arithmetic bit-vector operators");
 
   /* FUN engine (expert options) -------------------------------------------- */
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_FUN_PREPROP,
            true,
            true,
@@ -637,7 +698,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "run prop engine as preprocessing within a sequential portfolio "
            "(QF_BV only)");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_FUN_PRESLS,
            true,
            true,
@@ -648,7 +709,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "run sls engine as preprocessing within a sequential portfolio "
            "(QF_BV only)");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_FUN_DUAL_PROP,
            true,
            true,
@@ -659,7 +720,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "dual propagation optimization");
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_FUN_DUAL_PROP_QSORT,
            true,
            false,
@@ -670,7 +731,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_DP_QSORT_MAX,
            "order in which to assume inputs in dual solver");
   opts = bzla_hashptr_table_new(
-      bzla->mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
+      mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
   add_opt_help(mm,
                opts,
                "just",
@@ -680,9 +741,9 @@ bzla_opt_init_opts(Bzla *bzla)
       mm, opts, "asc", BZLA_DP_QSORT_ASC, "use ascending (node id) order");
   add_opt_help(
       mm, opts, "desc", BZLA_DP_QSORT_DESC, "use descending (node id) order");
-  bzla->options[BZLA_OPT_FUN_DUAL_PROP_QSORT].options = opts;
+  g_opts.options[BZLA_OPT_FUN_DUAL_PROP_QSORT].options = opts;
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_FUN_JUST,
            true,
            true,
@@ -693,7 +754,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "justification optimization");
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_FUN_JUST_HEURISTIC,
            true,
            false,
@@ -704,7 +765,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_JUST_HEUR_MAX,
            "justification heuristic");
   opts = bzla_hashptr_table_new(
-      bzla->mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
+      mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
   add_opt_help(mm,
                opts,
                "left",
@@ -722,9 +783,9 @@ bzla_opt_init_opts(Bzla *bzla)
                BZLA_JUST_HEUR_BRANCH_MIN_DEP,
                "if there is a choice, "
                "choose branch with minimum depth");
-  bzla->options[BZLA_OPT_FUN_JUST_HEURISTIC].options = opts;
+  g_opts.options[BZLA_OPT_FUN_JUST_HEURISTIC].options = opts;
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_FUN_LAZY_SYNTHESIZE,
            true,
            true,
@@ -735,7 +796,19 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "lazily synthesize expressions");
 
-  init_opt(bzla,
+  init_opt(mm,
+           BZLA_OPT_FUN_LAZY_CONSTRAINTS,
+           true,
+           true,
+           "fun-lazy-constraints",
+           0,
+           0,
+           0,
+           1,
+           "lazily synthesize constraints starting from the cone of "
+           "influence of the assumptions");
+
+  init_opt(mm,
            BZLA_OPT_FUN_EAGER_LEMMAS,
            true,
            false,
@@ -746,7 +819,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_FUN_EAGER_LEMMAS_MAX,
            "eager lemma generation");
   opts = bzla_hashptr_table_new(
-      bzla->mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
+      mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
   add_opt_help(mm,
                opts,
                "none",
@@ -763,9 +836,9 @@ bzla_opt_init_opts(Bzla *bzla)
                "all",
                BZLA_FUN_EAGER_LEMMAS_ALL,
                "generate lemmas for all conflicts");
-  bzla->options[BZLA_OPT_FUN_EAGER_LEMMAS].options = opts;
+  g_opts.options[BZLA_OPT_FUN_EAGER_LEMMAS].options = opts;
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_FUN_STORE_LAMBDAS,
            true,
            true,
@@ -777,7 +850,7 @@ bzla_opt_init_opts(Bzla *bzla)
            "represent array store as lambda");
 
   /* SLS engine (expert options) -------------------------------------------- */
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_NFLIPS,
            true,
            false,
@@ -788,7 +861,7 @@ bzla_opt_init_opts(Bzla *bzla)
            UINT32_MAX,
            "number of bit-flips used as a limit for sls engine");
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_STRATEGY,
            true,
            false,
@@ -799,7 +872,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_SLS_STRAT_MAX,
            "move strategy for sls");
   opts = bzla_hashptr_table_new(
-      bzla->mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
+      mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
   add_opt_help(mm,
                opts,
                "best",
@@ -829,9 +902,9 @@ bzla_opt_init_opts(Bzla *bzla)
                BZLA_SLS_STRAT_ALWAYS_PROP,
                "always choose propagation move (and recover with SLS move in "
                "case of conflict)");
-  bzla->options[BZLA_OPT_SLS_STRATEGY].options = opts;
+  g_opts.options[BZLA_OPT_SLS_STRATEGY].options = opts;
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_JUST,
            true,
            true,
@@ -841,7 +914,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "justification optimization");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_MOVE_GW,
            true,
            true,
@@ -852,7 +925,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "select move by altering not only one "
            "but all candidate variables at once");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_MOVE_RANGE,
            true,
            true,
@@ -862,7 +935,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "try range-wise flips when selecting moves");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_MOVE_SEGMENT,
            true,
            true,
@@ -872,7 +945,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "try segment-wise flips when selecting moves");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_MOVE_RAND_WALK,
            true,
            true,
@@ -882,7 +955,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "do a random walk (with given probability)");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_PROB_MOVE_RAND_WALK,
            true,
            false,
@@ -893,7 +966,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_PROB_100,
            "probability for choosing random walks "
            "(interpreted as <n>/1000)");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_MOVE_RAND_ALL,
            true,
            true,
@@ -904,7 +977,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "randomize all candidate variables (instead of only one) "
            "if no neighbor with better score is found");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_MOVE_RAND_RANGE,
            true,
            true,
@@ -915,7 +988,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "randomize a range of bits of a randomly chosen candidate "
            "variable if neighbor with better score is found");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_MOVE_PROP,
            true,
            true,
@@ -926,7 +999,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "enable propagation moves (with given ratio of propagation "
            "to regular moves)");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_MOVE_PROP_NPROPS,
            true,
            false,
@@ -937,7 +1010,7 @@ bzla_opt_init_opts(Bzla *bzla)
            UINT32_MAX,
            "number of prop moves (moves are performed as <n>:m prop "
            "to sls moves");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_MOVE_PROP_NSLSS,
            true,
            false,
@@ -948,7 +1021,7 @@ bzla_opt_init_opts(Bzla *bzla)
            UINT32_MAX,
            "number of sls moves (moves are performed as m:<n> prop "
            "to sls moves");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_MOVE_PROP_FORCE_RW,
            true,
            true,
@@ -958,7 +1031,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "force random walk if propagation move fails");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_MOVE_INC_MOVE_TEST,
            true,
            true,
@@ -969,7 +1042,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "use prev. neighbor with better score as base for "
            "next move test");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_USE_RESTARTS,
            true,
            true,
@@ -979,7 +1052,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "use restarts");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SLS_USE_BANDIT,
            true,
            true,
@@ -991,7 +1064,7 @@ bzla_opt_init_opts(Bzla *bzla)
            "use bandit scheme for constraint selection");
 
   /* PROP engine (expert options) ------------------------------------------- */
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_NPROPS,
            true,
            false,
@@ -1001,7 +1074,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            UINT32_MAX,
            "number of propagation steps used as a limit for prop engine");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_NUPDATES,
            true,
            false,
@@ -1011,7 +1084,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            UINT32_MAX,
            "number of model value updates used as a limit for prop engine");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_ENTAILED,
            true,
            false,
@@ -1022,7 +1095,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_PROP_ENTAILED_MAX,
            "maintain and prioritize entailed propagations");
   opts = bzla_hashptr_table_new(
-      bzla->mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
+      mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
   add_opt_help(mm, opts, "off", BZLA_PROP_ENTAILED_OFF, "do not use strategy");
   add_opt_help(mm,
                opts,
@@ -1039,8 +1112,8 @@ bzla_opt_init_opts(Bzla *bzla)
                "last",
                BZLA_PROP_ENTAILED_LAST,
                "process only the last entailed propagation");
-  bzla->options[BZLA_OPT_PROP_ENTAILED].options = opts;
-  init_opt(bzla,
+  g_opts.options[BZLA_OPT_PROP_ENTAILED].options = opts;
+  init_opt(mm,
            BZLA_OPT_PROP_CONST_BITS,
            true,
            true,
@@ -1050,7 +1123,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "use constant bits propagation");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_CONST_DOMAINS,
            true,
            true,
@@ -1061,7 +1134,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "use domain propagators to determine constant bits");
 #if 0
-  init_opt (bzla,
+  init_opt (mm,
             BZLA_OPT_PROP_DOMAINS,
             true,
             true,
@@ -1072,7 +1145,7 @@ bzla_opt_init_opts(Bzla *bzla)
             1,
             "use domain propagators for inverse value computation");
 #endif
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_USE_RESTARTS,
            true,
            true,
@@ -1082,7 +1155,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "use restarts");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_USE_BANDIT,
            true,
            true,
@@ -1093,7 +1166,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "use bandit scheme for constraint selection");
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_PATH_SEL,
            true,
            false,
@@ -1104,7 +1177,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_PROP_PATH_SEL_MAX,
            "path selection mode");
   opts = bzla_hashptr_table_new(
-      bzla->mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
+      mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
   add_opt_help(mm,
                opts,
                "essential",
@@ -1115,9 +1188,9 @@ bzla_opt_init_opts(Bzla *bzla)
                "random",
                BZLA_PROP_PATH_SEL_RANDOM,
                "select path based on random inputs");
-  bzla->options[BZLA_OPT_PROP_PATH_SEL].options = opts;
+  g_opts.options[BZLA_OPT_PROP_PATH_SEL].options = opts;
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_PROB_USE_INV_VALUE,
            true,
            false,
@@ -1128,7 +1201,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_PROB_100,
            "probability for producing inverse rather than consistent values "
            "(interpreted as <n>/1000)");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_PROB_FALLBACK_RANDOM_VALUE,
            true,
            false,
@@ -1139,7 +1212,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_PROB_100,
            "probability for producing inverse rather than consistent values "
            "(interpreted as <n>/1000)");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_PROB_RANDOM_INPUT,
            true,
            false,
@@ -1150,7 +1223,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_PROB_100,
            "probability for selecting a random input instead of an essential "
            "input (interpreted as <n>/1000)");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_PROB_FLIP_COND,
            true,
            false,
@@ -1162,7 +1235,7 @@ bzla_opt_init_opts(Bzla *bzla)
            "probability for choosing to flip the condition (rather than "
            "choosing the enabled path) for ITE during path selection "
            "for prop moves (interpreted as <n>/1000)");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_PROB_FLIP_COND_CONST,
            true,
            false,
@@ -1175,7 +1248,7 @@ bzla_opt_init_opts(Bzla *bzla)
            "choosing the enabled path) for ITE during path selection "
            "for prop moves if either of the 'then' or 'else' branches "
            "is constant (interpreted as <n>/1000)");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_FLIP_COND_CONST_NPATHSEL,
            true,
            false,
@@ -1188,7 +1261,7 @@ bzla_opt_init_opts(Bzla *bzla)
            "the enabled branch) for ITE during path selection before "
            "decreasing or increasing the probability for flipping the "
            "condition if either the 'then' or 'else' branch is constant");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_FLIP_COND_CONST_DELTA,
            true,
            false,
@@ -1200,7 +1273,7 @@ bzla_opt_init_opts(Bzla *bzla)
            "delta by which the limit for how often to flip the condition "
            "(rather than choosing the enabled branch) for ITE during path "
            "is decreased or increased");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_PROB_SLICE_KEEP_DC,
            true,
            false,
@@ -1214,7 +1287,7 @@ bzla_opt_init_opts(Bzla *bzla)
            "(rather than fully randomizing all of them, "
            "for both inverse and consistent value selection) "
            "(interpreted as <n>/1000)");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_PROB_SLICE_FLIP,
            true,
            false,
@@ -1228,7 +1301,7 @@ bzla_opt_init_opts(Bzla *bzla)
            "(rather than fully randomizing all of them) as a result of "
            "inverse/consistent value selection "
            "(interpreted as <n>/1000)");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_PROB_EQ_FLIP,
            true,
            false,
@@ -1243,7 +1316,7 @@ bzla_opt_init_opts(Bzla *bzla)
            "(for both inverse and consistent value selection) "
            "(interpreted as <n>/1000)");
   init_opt(
-      bzla,
+      mm,
       BZLA_OPT_PROP_PROB_AND_FLIP,
       true,
       false,
@@ -1257,7 +1330,7 @@ bzla_opt_init_opts(Bzla *bzla)
       "(rather than fully randomizing all of them) in case of an and operation "
       "(for both inverse and consistent value selection) "
       "(interpreted as <n>/1000)");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_NO_MOVE_ON_CONFLICT,
            true,
            true,
@@ -1269,7 +1342,7 @@ bzla_opt_init_opts(Bzla *bzla)
            "do not perform a propagation move when encountering a conflict"
            "during inverse computation");
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_SKIP_NO_PROGRESS,
            true,
            true,
@@ -1280,7 +1353,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "abort propagation if no progress is made");
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_USE_INV_LT_CONCAT,
            true,
            true,
@@ -1291,7 +1364,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "use special inverse value functions for slt/ult over concats");
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_INFER_INEQ_BOUNDS,
            true,
            true,
@@ -1302,7 +1375,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "use special inverse value functions for slt/ult over concats");
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_SEXT,
            true,
            true,
@@ -1313,7 +1386,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "use sign_extend inverse value computation");
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_XOR,
            true,
            true,
@@ -1324,7 +1397,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "use xor inverse value computation");
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PROP_ASHR,
            true,
            true,
@@ -1336,7 +1409,7 @@ bzla_opt_init_opts(Bzla *bzla)
            "use ashr inverse value computation");
 
   /* AIGPROP engine (expert options) ---------------------------------------- */
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_AIGPROP_USE_RESTARTS,
            true,
            true,
@@ -1346,7 +1419,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "use restarts");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_AIGPROP_USE_BANDIT,
            true,
            true,
@@ -1356,7 +1429,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "use bandit scheme for constraint selection");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_AIGPROP_NPROPS,
            true,
            false,
@@ -1368,7 +1441,7 @@ bzla_opt_init_opts(Bzla *bzla)
            "number of propagation steps used as a limit for aigprop engine");
 
   /* QUANT engine (expert options) ------------------------------------------ */
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_QUANT_DER,
            true,
            true,
@@ -1378,7 +1451,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "apply destructive equality resolution");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_QUANT_CER,
            true,
            true,
@@ -1388,7 +1461,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "apply constructive equality resolution");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_QUANT_MINISCOPE,
            true,
            true,
@@ -1399,7 +1472,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "apply miniscoping");
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_QUANT_SYNTH,
            true,
            true,
@@ -1410,7 +1483,7 @@ bzla_opt_init_opts(Bzla *bzla)
            BZLA_QUANT_SYNTH_MAX,
            "synthesis mode for Skolem functions");
   opts = bzla_hashptr_table_new(
-      bzla->mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
+      mm, (BzlaHashPtr) bzla_hash_str, (BzlaCmpPtr) strcmpoptval);
   add_opt_help(mm,
                opts,
                "none",
@@ -1441,9 +1514,9 @@ bzla_opt_init_opts(Bzla *bzla)
                BZLA_QUANT_SYNTH_ELMR,
                "use enumerative learning modulo the given root constraints "
                "to synthesize skolem functions");
-  bzla->options[BZLA_OPT_QUANT_SYNTH].options = opts;
+  g_opts.options[BZLA_OPT_QUANT_SYNTH].options = opts;
 
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_QUANT_DUAL_SOLVER,
            true,
            true,
@@ -1453,7 +1526,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "dual solver");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_QUANT_SYNTH_LIMIT,
            true,
            false,
@@ -1463,7 +1536,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            UINT32_MAX,
            "number of checks for synthesizing terms");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_QUANT_SYNTH_ITE_COMPLETE,
            true,
            true,
@@ -1474,7 +1547,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "make base case of concrete model for ITE constant instead of "
            "undefined.");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_QUANT_SYNTH_QI,
            true,
            true,
@@ -1484,7 +1557,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "synthesize quantifier instantiations from counterexamples");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_QUANT_FIXSYNTH,
            true,
            true,
@@ -1494,9 +1567,19 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "update current model w.r.t. synthesized skolem function");
+  init_opt(mm,
+           BZLA_OPT_QUANT_THREADS,
+           true,
+           false,
+           "quant-threads",
+           0,
+           1,
+           1,
+           BZLA_QUANT_THREADS_MAX,
+           "number of threads for checking quantifier instantiations");
 
   /* other expert options --------------------------------------------------- */
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_AUTO_CLEANUP_INTERNAL,
            true,
            true,
@@ -1506,7 +1589,38 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "auto clean up all allocated memory on exit");
-  init_opt(bzla,
+  init_opt(mm,
+           BZLA_OPT_BMC_KIND,
+           true,
+           true,
+           "bmc-kind",
+           0,
+           0,
+           0,
+           1,
+           "prove bad properties of BTOR2 models unreachable via k-induction");
+  init_opt(mm,
+           BZLA_OPT_BMC_KMAX,
+           true,
+           false,
+           "bmc-kmax",
+           "kmax",
+           20,
+           0,
+           UINT32_MAX,
+           "maximum bound for bounded model checking of BTOR2 models");
+  init_opt(mm,
+           BZLA_OPT_BW_REDUCE,
+           true,
+           false,
+           "bw-reduce",
+           0,
+           0,
+           0,
+           UINT32_MAX,
+           "solve bit-width reduced abstractions with variables restricted to "
+           "given number of bits first (0: disable)");
+  init_opt(mm,
            BZLA_OPT_CHECK_UNSAT_ASSUMPTIONS,
            true,
            true,
@@ -1516,7 +1630,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "check if assumptions determined as unsat are indeed unsat");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_CHECK_MODEL,
            true,
            true,
@@ -1526,7 +1640,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "check model");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_CHECK_UNCONSTRAINED,
            true,
            true,
@@ -1536,7 +1650,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "check result when unconstrained optimization is enabled");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_PARSE_INTERACTIVE,
            true,
            true,
@@ -1546,7 +1660,18 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "interactive parse mode");
-  init_opt(bzla,
+  init_opt(mm,
+           BZLA_OPT_PIPELINE,
+           true,
+           true,
+           "pipeline",
+           0,
+           0,
+           0,
+           1,
+           "bit-blast assertions in a background thread while they are "
+           "asserted");
+  init_opt(mm,
            BZLA_OPT_LS_SHARE_SAT,
            true,
            true,
@@ -1557,7 +1682,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "share partial models determined via local search with "
            "bit-blasting engine");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SAT_ENGINE_LGL_FORK,
            true,
            true,
@@ -1567,7 +1692,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "fork lingeling");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SAT_ENGINE_CADICAL_FREEZE,
            true,
            true,
@@ -1577,7 +1702,7 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "use CaDiCaL's freeze/melt");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_SAT_ENGINE_N_THREADS,
            true,
            true,
@@ -1587,7 +1712,7 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            UINT32_MAX,
            "number of threads to use in the SAT solver");
-  init_opt(bzla,
+  init_opt(mm,
            BZLA_OPT_DECLSORT_BV_WIDTH,
            true,
            false,
@@ -1598,7 +1723,18 @@ bzla_opt_init_opts(Bzla *bzla)
            UINT32_MAX,
            "interpret sorts introduced with declare-sort as bit-vectors of "
            "given width");
-  init_opt(bzla,
+  init_opt(mm,
+           BZLA_OPT_ITE_CHAINS,
+           true,
+           false,
+           "ite-chains",
+           0,
+           4,
+           0,
+           UINT32_MAX,
+           "bit-blast ITE chains over a common selector with at least given "
+           "number of cases as multiplexer trees (0: disable)");
+  init_opt(mm,
            BZLA_OPT_SMT_COMP_MODE,
            true,
            true,
@@ -1610,22 +1746,47 @@ bzla_opt_init_opts(Bzla *bzla)
            "enable SMT-COMP mode");
 }
 
-static void
-clone_data_as_opt_help_ptr(BzlaMemMgr *mm,
-                           const void *map,
-                           BzlaHashTableData *data,
-                           BzlaHashTableData *cloned_data)
+void
+bzla_opt_init_opts(Bzla *bzla)
 {
-  assert(data);
-  assert(cloned_data);
-  (void) map;
+  assert(bzla);
 
-  BzlaOptHelp *cloned_hdata;
+  BzlaOption o;
+  const BzlaOpt *opt;
+  const char *valstr;
+  uint32_t v;
 
-  BZLA_NEW(mm, cloned_hdata);
-  cloned_hdata->val   = ((BzlaOptHelp *) data->as_ptr)->val;
-  cloned_hdata->msg   = ((BzlaOptHelp *) data->as_ptr)->msg;
-  cloned_data->as_ptr = cloned_hdata;
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_once(&g_opts_once, init_shared_opts);
+#else
+  if (!g_opts_initialized)
+  {
+    init_shared_opts();
+    g_opts_initialized = true;
+  }
+#endif
+  bzla->options = g_opts.options;
+  bzla->str2opt = g_opts.str2opt;
+
+  for (o = 0; o < BZLA_OPT_NUM_OPTS; o++)
+  {
+    bzla->optvals[o] = g_opts.options[o].dflt;
+  }
+
+  /* Default values may be overridden via environment variables. */
+  if (!has_env_opts()) return;
+  for (o = 0; o < BZLA_OPT_NUM_OPTS; o++)
+  {
+    opt = &g_opts.options[o];
+    if (!(valstr = getenv(opt->env))) continue;
+    v = atoi(valstr);
+    if (v < opt->min)
+      v = opt->min;
+    else if (v > opt->max)
+      v = opt->max;
+    if (v == opt->dflt) continue;
+    bzla_opt_set(bzla, o, v);
+  }
 }
 
 void
@@ -1635,34 +1796,13 @@ bzla_opt_clone_opts(Bzla *bzla, Bzla *clone)
 
   BzlaOption o;
 
-  if (bzla->options)
+  clone->options = bzla->options;
+  clone->str2opt = bzla->str2opt;
+  memcpy(clone->optvals, bzla->optvals, sizeof(bzla->optvals));
+  for (o = 0; o < BZLA_OPT_NUM_OPTS; o++)
   {
-    BZLA_CNEWN(clone->mm, clone->options, BZLA_OPT_NUM_OPTS);
-    for (o = bzla_opt_first(bzla); bzla_opt_is_valid(bzla, o);
-         o = bzla_opt_next(bzla, o))
-    {
-      memcpy(&clone->options[o], &bzla->options[o], sizeof(BzlaOpt));
-      if (bzla->options[o].valstr)
-        clone->options[o].valstr =
-            bzla_mem_strdup(clone->mm, bzla->options[o].valstr);
-      if (bzla->options[o].options)
-        clone->options[o].options =
-            bzla_hashptr_table_clone(clone->mm,
-                                     bzla->options[o].options,
-                                     bzla_clone_key_as_static_str,
-                                     clone_data_as_opt_help_ptr,
-                                     0,
-                                     0);
-    }
-  }
-  if (bzla->str2opt)
-  {
-    clone->str2opt = bzla_hashptr_table_clone(clone->mm,
-                                              bzla->str2opt,
-                                              bzla_clone_key_as_static_str,
-                                              bzla_clone_data_as_int,
-                                              0,
-                                              0);
+    if (bzla->optvalstrs[o])
+      clone->optvalstrs[o] = bzla_mem_strdup(clone->mm, bzla->optvalstrs[o]);
   }
 }
 
@@ -1672,35 +1812,17 @@ bzla_opt_delete_opts(Bzla *bzla)
   assert(bzla);
 
   BzlaOption o;
-  BzlaPtrHashTableIterator it;
 
-  if (bzla->options)
+  for (o = 0; o < BZLA_OPT_NUM_OPTS; o++)
   {
-    for (o = bzla_opt_first(bzla); bzla_opt_is_valid(bzla, o);
-         o = bzla_opt_next(bzla, o))
+    if (bzla->optvalstrs[o])
     {
-      if (bzla->options[o].valstr)
-      {
-        bzla_mem_freestr(bzla->mm, bzla->options[o].valstr);
-        bzla->options[o].valstr = 0;
-      }
-      if (bzla->options[o].options)
-      {
-        bzla_iter_hashptr_init(&it, bzla->options[o].options);
-        while (bzla_iter_hashptr_has_next(&it))
-          BZLA_DELETE(bzla->mm,
-                      (BzlaOptHelp *) bzla_iter_hashptr_next_data(&it)->as_ptr);
-        bzla_hashptr_table_delete(bzla->options[o].options);
-      }
+      bzla_mem_freestr(bzla->mm, bzla->optvalstrs[o]);
+      bzla->optvalstrs[o] = 0;
     }
-    BZLA_DELETEN(bzla->mm, bzla->options, BZLA_OPT_NUM_OPTS);
-    bzla->options = 0;
-  }
-  if (bzla->str2opt)
-  {
-    bzla_hashptr_table_delete(bzla->str2opt);
-    bzla->str2opt = 0;
   }
+  bzla->options = 0;
+  bzla->str2opt = 0;
 }
 
 bool
@@ -1717,7 +1839,7 @@ bzla_opt_get(const Bzla *bzla, const BzlaOption opt)
   assert(bzla);
   assert(bzla_opt_is_valid(bzla, opt));
 
-  return bzla->options[opt].val;
+  return bzla->optvals[opt];
 }
 
 uint32_t
@@ -1780,7 +1902,7 @@ bzla_opt_get_valstr(const Bzla *bzla, const BzlaOption opt)
   assert(bzla);
   assert(bzla_opt_is_valid(bzla, opt));
 
-  return (const char *) bzla->options[opt].valstr;
+  return (const char *) bzla->optvalstrs[opt];
 }
 
 void
@@ -1789,15 +1911,16 @@ bzla_opt_set(Bzla *bzla, const BzlaOption opt, uint32_t val)
   assert(bzla);
   assert(bzla_opt_is_valid(bzla, opt));
 
-  BzlaOpt *o;
+  const BzlaOpt *o;
   uint32_t oldval;
 
   o      = &bzla->options[opt];
-  oldval = o->val;
+  oldval = bzla->optvals[opt];
 
   if (opt == BZLA_OPT_SEED)
   {
-    bzla_rng_init(bzla->rng, val);
+    /* RNG is not created yet if seed is set via environment variable */
+    if (bzla->rng) bzla_rng_init(bzla->rng, val);
   }
   else if (opt == BZLA_OPT_ENGINE)
   {
@@ -1910,7 +2033,7 @@ bzla_opt_set(Bzla *bzla, const BzlaOption opt, uint32_t val)
 
   if (val > o->max) val = o->max;
   if (val < o->min) val = o->min;
-  o->val = val;
+  bzla->optvals[opt] = val;
 }
 
 void
@@ -1920,7 +2043,8 @@ bzla_opt_set_str(Bzla *bzla, const BzlaOption opt, const char *str)
   assert(bzla_opt_is_valid(bzla, opt));
   assert(opt == BZLA_OPT_SAT_ENGINE);
 
-  bzla->options[opt].valstr = bzla_mem_strdup(bzla->mm, str);
+  if (bzla->optvalstrs[opt]) bzla_mem_freestr(bzla->mm, bzla->optvalstrs[opt]);
+  bzla->optvalstrs[opt] = bzla_mem_strdup(bzla->mm, str);
 }
 
 bool
@@ -71,6 +71,7 @@ enum BzlaOption
   BZLA_OPT_FUN_JUST,
   BZLA_OPT_FUN_JUST_HEURISTIC,
   BZLA_OPT_FUN_LAZY_SYNTHESIZE,
+  BZLA_OPT_FUN_LAZY_CONSTRAINTS,
   BZLA_OPT_FUN_EAGER_LEMMAS,
   BZLA_OPT_FUN_STORE_LAMBDAS,
 
@@ -142,15 +143,21 @@ enum BzlaOption
   BZLA_OPT_QUANT_SYNTH_ITE_COMPLETE,
   BZLA_OPT_QUANT_SYNTH_LIMIT,
   BZLA_OPT_QUANT_SYNTH_QI,
+  BZLA_OPT_QUANT_THREADS,
 
   /* Other expert options */
   BZLA_OPT_AUTO_CLEANUP_INTERNAL,
+  BZLA_OPT_BMC_KIND,
+  BZLA_OPT_BMC_KMAX,
+  BZLA_OPT_BW_REDUCE,
   BZLA_OPT_CHECK_MODEL,
   BZLA_OPT_CHECK_UNCONSTRAINED,
   BZLA_OPT_CHECK_UNSAT_ASSUMPTIONS,
   BZLA_OPT_DECLSORT_BV_WIDTH,
+  BZLA_OPT_ITE_CHAINS,
   BZLA_OPT_LS_SHARE_SAT,
   BZLA_OPT_PARSE_INTERACTIVE,
+  BZLA_OPT_PIPELINE,
   BZLA_OPT_SAT_ENGINE_CADICAL_FREEZE,
   BZLA_OPT_SAT_ENGINE_LGL_FORK,
   BZLA_OPT_SAT_ENGINE_N_THREADS,
@@ -190,6 +197,7 @@ enum BzlaOptEngine
   BZLA_ENGINE_PROP,
   BZLA_ENGINE_AIGPROP,
   BZLA_ENGINE_QUANT,
+  BZLA_ENGINE_AUTO,
 };
 typedef enum BzlaOptEngine BzlaOptEngine;
 
@@ -300,18 +308,19 @@ typedef enum BzlaOptBetaReduceMode BzlaOptBetaReduceMode;
 
 /* --------------------------------------------------------------------- */
 
+/* Option metadata, shared by all solver instances (option values are stored
+ * per instance in Bzla::optvals and Bzla::optvalstrs). */
 struct BzlaOpt
 {
   bool expert;               /* expert option? */
   bool isflag;               /* flag? */
   const char *shrt;          /* short option identifier (may be 0) */
   const char *lng;           /* long option identifier */
+  const char *env;           /* environment variable overriding dflt */
   const char *desc;          /* description */
-  uint32_t val;              /* value */
   uint32_t dflt;             /* default value */
   uint32_t min;              /* min value */
   uint32_t max;              /* max value */
-  char *valstr;              /* optional option string value */
   BzlaPtrHashTable *options; /* maps option CL value strings to enum values */
 };
 typedef struct BzlaOpt BzlaOpt;
@@ -366,7 +375,7 @@ typedef struct BzlaOptHelp BzlaOptHelp;
 extern const char *const g_bzla_se_name[BZLA_SAT_ENGINE_MAX + 1];
 
 #define BZLA_ENGINE_MIN BZLA_ENGINE_FUN
-#define BZLA_ENGINE_MAX BZLA_ENGINE_QUANT
+#define BZLA_ENGINE_MAX BZLA_ENGINE_AUTO
 #define BZLA_ENGINE_DFLT BZLA_ENGINE_FUN
 
 #define BZLA_INPUT_FORMAT_MIN BZLA_INPUT_FORMAT_NONE
@@ -403,6 +412,8 @@ extern const char *const g_bzla_se_name[BZLA_SAT_ENGINE_MAX + 1];
 #define BZLA_QUANT_SYNTH_MAX BZLA_QUANT_SYNTH_ELMR
 #define BZLA_QUANT_SYNTH_DFLT BZLA_QUANT_SYNTH_ELMR
 
+#define BZLA_QUANT_THREADS_MAX 64
+
 #define BZLA_FUN_EAGER_LEMMAS_MIN BZLA_FUN_EAGER_LEMMAS_NONE
 #define BZLA_FUN_EAGER_LEMMAS_MAX BZLA_FUN_EAGER_LEMMAS_ALL
 #define BZLA_FUN_EAGER_LEMMAS_DFLT BZLA_FUN_EAGER_LEMMAS_CONF
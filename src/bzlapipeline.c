@@ -0,0 +1,358 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include "bzlapipeline.h"
+
+#include <assert.h>
+#include <stdbool.h>
+
+#ifdef BZLA_HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+#include "bzlaaigvec.h"
+#include "bzlacore.h"
+#include "bzlanode.h"
+#include "bzlasat.h"
+#include "utils/bzlaabort.h"
+#include "utils/bzlahashint.h"
+#include "utils/bzlamem.h"
+#include "utils/bzlastack.h"
+#include "utils/bzlautil.h"
+
+/*------------------------------------------------------------------------*/
+
+#ifdef BZLA_HAVE_PTHREADS
+
+struct BzlaPipeline
+{
+  Bzla *bzla;
+  /* Queued formulas, entries [0, next) are processed. References are
+   * released on synchronization. */
+  BzlaNodePtrStack queue;
+  uint32_t next;
+  bool busy;
+  bool stop;
+  /* Ids of nodes with a cone that can be processed in the background
+   * (worker only). */
+  BzlaIntHashTable *supported;
+  pthread_t thread;
+  /* Protects 'queue', 'next', 'busy' and 'stop'. */
+  pthread_mutex_t queue_lock;
+  pthread_cond_t queue_cond;
+  pthread_cond_t idle_cond;
+  /* Held by the worker while processing a formula. */
+  pthread_mutex_t lock;
+};
+
+/*------------------------------------------------------------------------*/
+
+/* Check if the cone of 'root' is a pure bit-vector formula. Word-blasting
+ * floating-point terms creates new nodes, and the function solver tracks
+ * which applies and function equalities are encoded, hence these are
+ * bit-blasted during solving as usual. */
+static bool
+is_supported(BzlaPipeline *pipeline, BzlaNode *root)
+{
+  bool res;
+  uint32_t i;
+  Bzla *bzla;
+  BzlaNode *cur;
+  BzlaNodePtrStack visit, visited;
+  BzlaIntHashTable *cache;
+
+  bzla = pipeline->bzla;
+  res  = true;
+  BZLA_INIT_STACK(bzla->mm, visit);
+  BZLA_INIT_STACK(bzla->mm, visited);
+  cache = bzla_hashint_table_new(bzla->mm);
+  BZLA_PUSH_STACK(visit, root);
+  while (!BZLA_EMPTY_STACK(visit))
+  {
+    cur = bzla_node_real_addr(BZLA_POP_STACK(visit));
+    if (bzla_hashint_table_contains(pipeline->supported, cur->id)
+        || bzla_hashint_table_contains(cache, cur->id))
+    {
+      continue;
+    }
+    if (bzla_node_is_simplified(cur) || cur->parameterized
+        || bzla_node_is_fun(cur) || bzla_node_is_apply(cur)
+        || bzla_node_is_fun_eq(cur) || bzla_node_is_quantifier(cur)
+        || bzla_node_is_fp(bzla, cur) || bzla_node_is_rm(bzla, cur))
+    {
+      res = false;
+      break;
+    }
+    /* note: 'av' of function nodes is 'rho', check kind first */
+    if (bzla_node_is_synth(cur)) continue;
+    bzla_hashint_table_add(cache, cur->id);
+    BZLA_PUSH_STACK(visited, cur);
+    for (i = 0; i < cur->arity; i++) BZLA_PUSH_STACK(visit, cur->e[i]);
+  }
+  /* Only cache on success, the cone may still contain unsupported nodes. */
+  if (res)
+  {
+    for (i = 0; i < BZLA_COUNT_STACK(visited); i++)
+    {
+      bzla_hashint_table_add(pipeline->supported,
+                             BZLA_PEEK_STACK(visited, i)->id);
+    }
+  }
+  bzla_hashint_table_delete(cache);
+  BZLA_RELEASE_STACK(visited);
+  BZLA_RELEASE_STACK(visit);
+  return res;
+}
+
+static void
+process(BzlaPipeline *pipeline, BzlaNode *root)
+{
+  Bzla *bzla;
+  BzlaNode *real_root;
+
+  bzla      = pipeline->bzla;
+  real_root = bzla_node_real_addr(root);
+
+  if (bzla_node_is_synth(real_root)) return;
+  if (!is_supported(pipeline, real_root))
+  {
+    bzla->stats.pipeline_skipped++;
+    return;
+  }
+
+  bzla_synthesize_exp(bzla, real_root, 0);
+  /* In incremental mode, the SAT solver is already initialized and the
+   * formula can be encoded right away. */
+  if (bzla_sat_is_initialized(bzla_get_sat_mgr(bzla)))
+  {
+    bzla_aigvec_to_sat_tseitin(bzla->avmgr, real_root->av);
+  }
+  bzla->stats.pipeline_synthesized++;
+}
+
+static void *
+run(void *data)
+{
+  BzlaNode *root;
+  BzlaPipeline *pipeline;
+
+  pipeline = (BzlaPipeline *) data;
+
+  pthread_mutex_lock(&pipeline->queue_lock);
+  for (;;)
+  {
+    while (!pipeline->stop
+           && pipeline->next == BZLA_COUNT_STACK(pipeline->queue))
+    {
+      pipeline->busy = false;
+      pthread_cond_broadcast(&pipeline->idle_cond);
+      pthread_cond_wait(&pipeline->queue_cond, &pipeline->queue_lock);
+    }
+    if (pipeline->stop) break;
+    pipeline->busy = true;
+    root           = BZLA_PEEK_STACK(pipeline->queue, pipeline->next);
+    pthread_mutex_unlock(&pipeline->queue_lock);
+
+    pthread_mutex_lock(&pipeline->lock);
+    process(pipeline, root);
+    pthread_mutex_unlock(&pipeline->lock);
+
+    pthread_mutex_lock(&pipeline->queue_lock);
+    pipeline->next++;
+  }
+  pipeline->busy = false;
+  pthread_cond_broadcast(&pipeline->idle_cond);
+  pthread_mutex_unlock(&pipeline->queue_lock);
+  return 0;
+}
+
+static BzlaPipeline *
+new_pipeline(Bzla *bzla)
+{
+  BzlaPipeline *res;
+
+  BZLA_CNEW(bzla->mm, res);
+  res->bzla = bzla;
+  BZLA_INIT_STACK(bzla->mm, res->queue);
+  res->supported = bzla_hashint_table_new(bzla->mm);
+  pthread_mutex_init(&res->queue_lock, 0);
+  pthread_mutex_init(&res->lock, 0);
+  pthread_cond_init(&res->queue_cond, 0);
+  pthread_cond_init(&res->idle_cond, 0);
+  /* Allocation statistics are updated by both threads from now on. */
+  bzla_mem_mgr_set_shared(bzla->mm);
+  BZLA_ABORT(pthread_create(&res->thread, 0, run, res),
+             "failed to create bit-blasting thread");
+  return res;
+}
+
+/* Release queued formulas. Must only be called while the worker is idle or
+ * stopped, and without holding any lock since releasing synthesized nodes
+ * acquires the pipeline lock. */
+static void
+release_queue(BzlaPipeline *pipeline)
+{
+  Bzla *bzla;
+  BzlaNodePtrStack queue;
+
+  bzla = pipeline->bzla;
+
+  pthread_mutex_lock(&pipeline->queue_lock);
+  assert(!pipeline->busy);
+  queue = pipeline->queue;
+  BZLA_INIT_STACK(bzla->mm, pipeline->queue);
+  pipeline->next = 0;
+  pthread_mutex_unlock(&pipeline->queue_lock);
+
+  while (!BZLA_EMPTY_STACK(queue))
+  {
+    bzla_node_release(bzla, BZLA_POP_STACK(queue));
+  }
+  BZLA_RELEASE_STACK(queue);
+
+  /* Nodes may be simplified before the next formula is queued. */
+  bzla_hashint_table_delete(pipeline->supported);
+  pipeline->supported = bzla_hashint_table_new(bzla->mm);
+}
+
+/*------------------------------------------------------------------------*/
+
+void
+bzla_pipeline_push(Bzla *bzla, BzlaNode *exp)
+{
+  assert(bzla);
+  assert(exp);
+  assert(bzla_node_bv_get_width(bzla, exp) == 1);
+
+  BzlaPipeline *pipeline;
+
+  if (!bzla_opt_get(bzla, BZLA_OPT_PIPELINE)) return;
+  if (bzla_opt_get(bzla, BZLA_OPT_ENGINE) != BZLA_ENGINE_FUN) return;
+
+  /* Note: 'exp' may be synthesized concurrently, don't check here.
+   *       Asserted formulas are simplified to true by bzla_simplify_exp,
+   *       only resolve substitutions. */
+  exp = bzla_node_get_simplified(bzla, exp);
+  if (bzla_node_is_bv_const(exp)) return;
+
+  if (!bzla->pipeline) bzla->pipeline = new_pipeline(bzla);
+  pipeline = bzla->pipeline;
+
+  pthread_mutex_lock(&pipeline->queue_lock);
+  BZLA_PUSH_STACK(pipeline->queue, bzla_node_copy(bzla, exp));
+  pipeline->busy = true;
+  pthread_cond_signal(&pipeline->queue_cond);
+  pthread_mutex_unlock(&pipeline->queue_lock);
+}
+
+void
+bzla_pipeline_sync(Bzla *bzla)
+{
+  assert(bzla);
+
+  double start;
+  BzlaPipeline *pipeline;
+
+  pipeline = bzla->pipeline;
+  if (!pipeline) return;
+
+  start = bzla_util_time_stamp();
+  pthread_mutex_lock(&pipeline->queue_lock);
+  while (pipeline->busy)
+  {
+    pthread_cond_wait(&pipeline->idle_cond, &pipeline->queue_lock);
+  }
+  pthread_mutex_unlock(&pipeline->queue_lock);
+  release_queue(pipeline);
+  bzla->time.pipeline_sync += bzla_util_time_stamp() - start;
+}
+
+void
+bzla_pipeline_delete(Bzla *bzla)
+{
+  assert(bzla);
+
+  BzlaPipeline *pipeline;
+
+  pipeline = bzla->pipeline;
+  if (!pipeline) return;
+
+  pthread_mutex_lock(&pipeline->queue_lock);
+  pipeline->stop = true;
+  pthread_cond_signal(&pipeline->queue_cond);
+  pthread_mutex_unlock(&pipeline->queue_lock);
+  pthread_join(pipeline->thread, 0);
+
+  /* Reset first, releasing nodes must not acquire the pipeline lock. */
+  bzla->pipeline = 0;
+  release_queue(pipeline);
+
+  BZLA_RELEASE_STACK(pipeline->queue);
+  bzla_hashint_table_delete(pipeline->supported);
+  pthread_mutex_destroy(&pipeline->queue_lock);
+  pthread_mutex_destroy(&pipeline->lock);
+  pthread_cond_destroy(&pipeline->queue_cond);
+  pthread_cond_destroy(&pipeline->idle_cond);
+  BZLA_DELETE(bzla->mm, pipeline);
+}
+
+void
+bzla_pipeline_lock(Bzla *bzla)
+{
+  assert(bzla);
+  if (bzla->pipeline) pthread_mutex_lock(&bzla->pipeline->lock);
+}
+
+void
+bzla_pipeline_unlock(Bzla *bzla)
+{
+  assert(bzla);
+  if (bzla->pipeline) pthread_mutex_unlock(&bzla->pipeline->lock);
+}
+
+#else
+
+struct BzlaPipeline
+{
+  int32_t unused;
+};
+
+void
+bzla_pipeline_push(Bzla *bzla, BzlaNode *exp)
+{
+  (void) bzla;
+  (void) exp;
+}
+
+void
+bzla_pipeline_sync(Bzla *bzla)
+{
+  (void) bzla;
+}
+
+void
+bzla_pipeline_delete(Bzla *bzla)
+{
+  (void) bzla;
+}
+
+void
+bzla_pipeline_lock(Bzla *bzla)
+{
+  (void) bzla;
+}
+
+void
+bzla_pipeline_unlock(Bzla *bzla)
+{
+  (void) bzla;
+}
+
+#endif
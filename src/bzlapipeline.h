@@ -0,0 +1,57 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#ifndef BZLAPIPELINE_H_INCLUDED
+#define BZLAPIPELINE_H_INCLUDED
+
+#include "bzlacore.h"
+
+/*------------------------------------------------------------------------*/
+
+/* Background bit-blasting of assertions (option BZLA_OPT_PIPELINE).
+ *
+ * Asserted formulas are queued and bit-blasted into AIGs by a worker thread
+ * while the client keeps constructing terms. If the SAT solver is already
+ * initialized (incremental mode), the worker also encodes the AIGs into CNF.
+ * Satisfiability checks wait for the queue to drain first and find the
+ * formulas already synthesized.
+ *
+ * The worker only reads the node DAG and owns the AIG layer while the queue
+ * is not empty. Client operations that touch the AIG layer (deleting
+ * synthesized nodes) or may relocate data read by the worker (creating
+ * sorts) acquire the pipeline lock. All other operations (solving, model
+ * queries, pushing and popping, setting options, ...) must call
+ * bzla_pipeline_sync first.
+ *
+ * Only pure bit-vector formulas are processed in the background (no
+ * functions, arrays, floating-point terms or quantifiers), and only if the
+ * engine is BZLA_ENGINE_FUN. ITE chains are not detected in pipelined mode
+ * (detection depends on the number of parents of a node, which changes
+ * concurrently). */
+
+typedef struct BzlaPipeline BzlaPipeline;
+
+/* Queue formula 'exp' for background bit-blasting. Starts the worker thread
+ * on first use. Does nothing if background bit-blasting is not supported
+ * (no pthreads) or not applicable. */
+void bzla_pipeline_push(Bzla *bzla, BzlaNode *exp);
+
+/* Wait until all queued formulas are bit-blasted. */
+void bzla_pipeline_sync(Bzla *bzla);
+
+/* Stop the worker thread and release all queued formulas. */
+void bzla_pipeline_delete(Bzla *bzla);
+
+/* Acquire and release exclusive access to the AIG layer and to data read by
+ * the worker. No-op if the pipeline is not active. */
+void bzla_pipeline_lock(Bzla *bzla);
+void bzla_pipeline_unlock(Bzla *bzla);
+
+#endif
@@ -1904,7 +1904,7 @@ bzla_proputils_cons_mul(Bzla *bzla, BzlaPropInfo *pi)
   check_cons_dbg(bzla, pi, true);
 #endif
   uint32_t r, bw, ctz_res, ctz_t;
-  BzlaBitVector *res, *tmp;
+  BzlaBitVector *res;
   BzlaMemMgr *mm;
   const BzlaBitVector *t;
 
@@ -1939,21 +1939,11 @@ bzla_proputils_cons_mul(Bzla *bzla, BzlaPropInfo *pi)
         res = bzla_bv_zero(mm, bw);
         bzla_bv_set_bit(res, bzla_rng_pick_rand(bzla->rng, 0, ctz_t - 1), 1);
       }
-      /* choose res as t / 2^n with prob 0.1
-       * (note: bw not necessarily power of 2 -> do not use srl) */
+      /* choose res as t / 2^n with prob 0.1 */
       else if (bzla_rng_pick_with_prob(bzla->rng, 100))
       {
-        bzla_bv_free(mm, res);
-        if ((r = bzla_rng_pick_rand(bzla->rng, 0, ctz_t)))
-        {
-          tmp = bzla_bv_slice(mm, t, bw - 1, r);
-          res = bzla_bv_uext(mm, tmp, r);
-          bzla_bv_free(mm, tmp);
-        }
-        else
-        {
-          res = bzla_bv_copy(mm, t);
-        }
+        r = bzla_rng_pick_rand(bzla->rng, 0, ctz_t);
+        bzla_bv_srl_uint64_into(res, t, r);
       }
       /* choose random value with ctz(t) >= ctz(res) with prob 0.8 */
       else
@@ -1974,17 +1964,23 @@ bzla_proputils_cons_udiv(Bzla *bzla, BzlaPropInfo *pi)
 #ifndef NDEBUG
   check_cons_dbg(bzla, pi, true);
 #endif
-  uint32_t bw;
+  uint32_t bw, mark;
   BzlaBitVector *res, *tmp, *y, *offset, *max, *zero, *one, *ones;
   BzlaMemMgr *mm;
   const BzlaBitVector *t;
-
-  mm   = bzla->mm;
-  t    = pi->target_value;
-  bw   = bzla_bv_get_width(t);
-  zero = bzla_bv_zero(mm, bw);
-  one  = bzla_bv_one(mm, bw);
-  ones = bzla_bv_ones(mm, bw);
+  BzlaBitVectorScratch *scratch;
+
+  mm      = bzla->mm;
+  scratch = &bzla->bv_scratch;
+  t       = pi->target_value;
+  bw      = bzla_bv_get_width(t);
+  mark    = bzla_bv_scratch_mark(scratch);
+  zero    = bzla_bv_scratch_get(scratch, bw);
+  one     = bzla_bv_scratch_get(scratch, bw);
+  ones    = bzla_bv_scratch_get(scratch, bw);
+  tmp     = bzla_bv_scratch_get(scratch, bw);
+  bzla_bv_set_one(one);
+  bzla_bv_set_ones(ones);
 
   record_cons_stats(bzla, &BZLA_PROP_SOLVER(bzla)->stats.cons_udiv);
 
@@ -1999,10 +1995,8 @@ bzla_proputils_cons_udiv(Bzla *bzla, BzlaPropInfo *pi)
       res = bzla_bv_new_random_range(mm, bzla->rng, bw, one, ones);
       while (bzla_bv_is_umulo(mm, res, t))
       {
-        tmp = bzla_bv_sub(mm, res, one);
-        bzla_bv_free(mm, res);
-        res = bzla_bv_new_random_range(mm, bzla->rng, bw, one, tmp);
-        bzla_bv_free(mm, tmp);
+        bzla_bv_dec_into(tmp, res);
+        bzla_bv_set_random_range(res, bzla->rng, one, tmp);
       }
     }
   }
@@ -2011,9 +2005,8 @@ bzla_proputils_cons_udiv(Bzla *bzla, BzlaPropInfo *pi)
     if (bzla_bv_is_zero(t))
     {
       /* t = 0: res < 1...1 */
-      tmp = bzla_bv_dec(mm, ones);
+      bzla_bv_dec_into(tmp, ones);
       res = bzla_bv_new_random_range(mm, bzla->rng, bw, zero, tmp);
-      bzla_bv_free(mm, tmp);
     }
     else if (!bzla_bv_compare(t, ones))
     {
@@ -2027,44 +2020,35 @@ bzla_proputils_cons_udiv(Bzla *bzla, BzlaPropInfo *pi)
        * and
        *   offset \in [0, min(y - 1, ones - y * t)].
        */
-      max = bzla_bv_udiv(mm, ones, t);
-      y   = bzla_bv_new_random_range(mm, bzla->rng, bw, one, max);
-      bzla_bv_free(mm, max);
+      max    = bzla_bv_scratch_get(scratch, bw);
+      y      = bzla_bv_scratch_get(scratch, bw);
+      offset = bzla_bv_scratch_get(scratch, bw);
+      bzla_bv_udiv_into(max, ones, t);
+      bzla_bv_set_random_range(y, bzla->rng, one, max);
 
       assert(!bzla_bv_is_umulo(mm, y, t));
-      res = bzla_bv_mul(mm, y, t);
+      res = bzla_bv_new(mm, bw);
+      bzla_bv_mul_into(res, y, t);
 
-      tmp = bzla_bv_sub(mm, ones, res);
-      max = bzla_bv_dec(mm, y);
-      bzla_bv_free(mm, y);
+      bzla_bv_sub_into(tmp, ones, res);
+      bzla_bv_dec_into(max, y);
 
       /* Make sure that adding the offset to (y * t) does not overflow. The
        * maximum value of the offset is the minimum of (y - 1, ones - (y * t)).
        */
       if (bzla_bv_compare(tmp, max) < 0)
       {
-        bzla_bv_free(mm, max);
-        max = tmp;
-      }
-      else
-      {
-        bzla_bv_free(mm, tmp);
+        bzla_bv_set(max, tmp);
       }
       /* Compute offset for adding to res. */
-      offset = bzla_bv_new_random_range(mm, bzla->rng, bw, zero, max);
-      bzla_bv_free(mm, max);
+      bzla_bv_set_random_range(offset, bzla->rng, zero, max);
 
       assert(!bzla_bv_is_uaddo(mm, res, offset));
-      tmp = bzla_bv_add(mm, res, offset);
-      bzla_bv_free(mm, res);
-      bzla_bv_free(mm, offset);
-      res = tmp;
+      bzla_bv_add_into(res, res, offset);
     }
   }
 
-  bzla_bv_free(mm, one);
-  bzla_bv_free(mm, zero);
-  bzla_bv_free(mm, ones);
+  bzla_bv_scratch_release(scratch, mark);
   return res;
 }
 
@@ -2074,16 +2058,18 @@ bzla_proputils_cons_urem(Bzla *bzla, BzlaPropInfo *pi)
 #ifndef NDEBUG
   check_cons_dbg(bzla, pi, true);
 #endif
-  uint32_t bw;
+  uint32_t bw, mark;
   BzlaBitVector *res, *ones, *tmp, *max, *min;
   BzlaMemMgr *mm;
   const BzlaBitVector *t;
+  BzlaBitVectorScratch *scratch;
 
   record_cons_stats(bzla, &BZLA_PROP_SOLVER(bzla)->stats.cons_urem);
 
-  mm = bzla->mm;
-  t  = pi->target_value;
-  bw = bzla_bv_get_width(t);
+  mm      = bzla->mm;
+  scratch = &bzla->bv_scratch;
+  t       = pi->target_value;
+  bw      = bzla_bv_get_width(t);
 
   if (pi->pos_x)
   {
@@ -2100,11 +2086,13 @@ bzla_proputils_cons_urem(Bzla *bzla, BzlaPropInfo *pi)
     else
     {
       /* else res > t */
-      ones = bzla_bv_ones(mm, bw);
-      tmp  = bzla_bv_inc(mm, t);
-      res  = bzla_bv_new_random_range(mm, bzla->rng, bw, tmp, ones);
-      bzla_bv_free(mm, tmp);
-      bzla_bv_free(mm, ones);
+      mark = bzla_bv_scratch_mark(scratch);
+      ones = bzla_bv_scratch_get(scratch, bw);
+      tmp  = bzla_bv_scratch_get(scratch, bw);
+      bzla_bv_set_ones(ones);
+      bzla_bv_inc_into(tmp, t);
+      res = bzla_bv_new_random_range(mm, bzla->rng, bw, tmp, ones);
+      bzla_bv_scratch_release(scratch, mark);
     }
   }
   else
@@ -2123,22 +2111,21 @@ bzla_proputils_cons_urem(Bzla *bzla, BzlaPropInfo *pi)
     {
       /* else res >= t:
        * pick s > t such that x = s + t does not overflow -> t < s < ones - t */
-      ones = bzla_bv_ones(mm, bw);
-      max  = bzla_bv_sub(mm, ones, t);
-      min  = bzla_bv_inc(mm, t);
+      mark = bzla_bv_scratch_mark(scratch);
+      max  = bzla_bv_scratch_get(scratch, bw);
+      min  = bzla_bv_scratch_get(scratch, bw);
+      bzla_bv_not_into(max, t); /* ones - t */
+      bzla_bv_inc_into(min, t);
       if (bzla_bv_compare(min, max) > 0)
       {
         res = bzla_bv_copy(mm, t);
       }
       else
       {
-        tmp = bzla_bv_new_random_range(mm, bzla->rng, bw, min, max);
-        res = bzla_bv_add(mm, tmp, t);
-        bzla_bv_free(mm, tmp);
+        res = bzla_bv_new_random_range(mm, bzla->rng, bw, min, max);
+        bzla_bv_add_into(res, res, t);
       }
-      bzla_bv_free(mm, min);
-      bzla_bv_free(mm, max);
-      bzla_bv_free(mm, ones);
+      bzla_bv_scratch_release(scratch, mark);
     }
   }
   return res;
@@ -3241,9 +3228,9 @@ bzla_proputils_inv_and(Bzla *bzla, BzlaPropInfo *pi)
 #ifndef NDEBUG
   check_inv_dbg(bzla, pi, bzla_is_inv_and, bzla_is_inv_and_const, true);
 #endif
-  uint32_t i, bw;
+  uint32_t i, bw, mark;
   int32_t bit_and, bit_e;
-  BzlaBitVector *res, *tmp1, *tmp2, *mask;
+  BzlaBitVector *res, *tmp;
   BzlaMemMgr *mm;
   BzlaUIntStack dcbits;
   bool b;
@@ -3302,16 +3289,14 @@ bzla_proputils_inv_and(Bzla *bzla, BzlaPropInfo *pi)
   {
     /* res = (t & s) | (~s & rand) */
     bw   = bzla_bv_get_width(t);
-    tmp1 = bzla_bv_new_random(mm, bzla->rng, bw);
-    mask = bzla_bv_not(mm, s);
-    tmp2 = bzla_bv_and(mm, tmp1, mask);
-    bzla_bv_free(mm, mask);
-    bzla_bv_free(mm, tmp1);
-
-    tmp1 = bzla_bv_and(mm, t, s);
-    res  = bzla_bv_or(mm, tmp1, tmp2);
-    bzla_bv_free(mm, tmp1);
-    bzla_bv_free(mm, tmp2);
+    mark = bzla_bv_scratch_mark(&bzla->bv_scratch);
+    tmp  = bzla_bv_scratch_get(&bzla->bv_scratch, bw);
+    res  = bzla_bv_new_random(mm, bzla->rng, bw);
+    bzla_bv_not_into(tmp, s);
+    bzla_bv_and_into(res, res, tmp);
+    bzla_bv_and_into(tmp, t, s);
+    bzla_bv_or_into(res, tmp, res);
+    bzla_bv_scratch_release(&bzla->bv_scratch, mark);
   }
 
 #ifndef NDEBUG
@@ -5053,12 +5038,14 @@ bzla_proputils_inv_mul(Bzla *bzla, BzlaPropInfo *pi)
   check_inv_dbg(bzla, pi, bzla_is_inv_mul, bzla_is_inv_mul_const, true);
 #endif
   int32_t lsb_s, ispow2_s;
-  uint32_t i, j, bw;
-  BzlaBitVector *res, *inv, *tmp, *tmp2;
+  uint32_t i, j, bw, mark;
+  BzlaBitVector *res, *tmp;
   BzlaMemMgr *mm;
   const BzlaBitVector *s, *t;
+  BzlaBitVectorScratch *scratch;
 
-  mm = bzla->mm;
+  mm      = bzla->mm;
+  scratch = &bzla->bv_scratch;
 
   record_inv_stats(bzla, &BZLA_PROP_SOLVER(bzla)->stats.inv_mul);
 
@@ -5112,9 +5099,8 @@ bzla_proputils_inv_mul(Bzla *bzla, BzlaPropInfo *pi)
      * ---------------------------------------------------------------------- */
     if (lsb_s)
     {
-      inv = bzla_bv_mod_inverse(mm, s);
-      res = bzla_bv_mul(mm, inv, t);
-      bzla_bv_free(mm, inv);
+      res = bzla_bv_mod_inverse(mm, s);
+      bzla_bv_mul_into(res, res, t);
     }
     /* ----------------------------------------------------------------------
      * s even
@@ -5140,16 +5126,11 @@ bzla_proputils_inv_mul(Bzla *bzla, BzlaPropInfo *pi)
         /* CONFLICT: number of 0-LSBs in t < n (for s = 2^n) */
         assert(i >= (uint32_t) ispow2_s);
 
-        /**
-         * res = t >> n with all bits shifted in set randomly
-         * (note: bw is not necessarily power of 2 -> do not use srl)
-         */
-        tmp = bzla_bv_slice(mm, t, bw - 1, ispow2_s);
-        res = bzla_bv_uext(mm, tmp, ispow2_s);
-        assert(bzla_bv_get_width(res) == bw);
+        /* res = t >> n with all bits shifted in set randomly */
+        res = bzla_bv_new(mm, bw);
+        bzla_bv_srl_uint64_into(res, t, ispow2_s);
         for (i = 0; i < (uint32_t) ispow2_s; i++)
           bzla_bv_set_bit(res, bw - 1 - i, bzla_rng_pick_rand(bzla->rng, 0, 1));
-        bzla_bv_free(mm, tmp);
       }
       else
       {
@@ -5167,28 +5148,19 @@ bzla_proputils_inv_mul(Bzla *bzla, BzlaPropInfo *pi)
 
         /**
          * c' = t >> n (with all bits shifted in set randomly)
-         * (note: bw is not necessarily power of 2 -> do not use srl)
          * -> res = c' * m^-1 (with m^-1 the mod inverse of m, m odd)
          */
-        tmp = bzla_bv_slice(mm, t, bw - 1, j);
-        res = bzla_bv_uext(mm, tmp, j);
-        assert(bzla_bv_get_width(res) == bw);
-        bzla_bv_free(mm, tmp);
-
-        tmp  = bzla_bv_slice(mm, s, bw - 1, j);
-        tmp2 = bzla_bv_uext(mm, tmp, j);
-        assert(bzla_bv_get_width(tmp2) == bw);
-        assert(bzla_bv_get_bit(tmp2, 0));
-        inv = bzla_bv_mod_inverse(mm, tmp2);
-        bzla_bv_free(mm, tmp);
-        bzla_bv_free(mm, tmp2);
-        tmp = res;
-        res = bzla_bv_mul(mm, tmp, inv);
+        mark = bzla_bv_scratch_mark(scratch);
+        tmp  = bzla_bv_scratch_get(scratch, bw);
+        bzla_bv_srl_uint64_into(tmp, s, j);
+        assert(bzla_bv_get_bit(tmp, 0));
+        res = bzla_bv_mod_inverse(mm, tmp);
+        bzla_bv_srl_uint64_into(tmp, t, j);
+        bzla_bv_mul_into(res, tmp, res);
         /* choose one of all possible values */
         for (i = 0; i < j; i++)
           bzla_bv_set_bit(res, bw - 1 - i, bzla_rng_pick_rand(bzla->rng, 0, 1));
-        bzla_bv_free(mm, tmp);
-        bzla_bv_free(mm, inv);
+        bzla_bv_scratch_release(scratch, mark);
       }
     }
   }
@@ -5210,13 +5182,15 @@ bzla_proputils_inv_udiv(Bzla *bzla, BzlaPropInfo *pi)
   check_inv_dbg(bzla, pi, bzla_is_inv_udiv, bzla_is_inv_udiv_const, true);
 #endif
   int32_t pos_x;
-  uint32_t bw;
+  uint32_t bw, mark;
   BzlaBitVector *res, *lo, *up, *one, *ones, *tmp;
   BzlaMemMgr *mm;
   BzlaRNG *rng;
   const BzlaBitVector *s, *t;
+  BzlaBitVectorScratch *scratch;
 
-  mm = bzla->mm;
+  mm      = bzla->mm;
+  scratch = &bzla->bv_scratch;
 
   record_inv_stats(bzla, &BZLA_PROP_SOLVER(bzla)->stats.inv_udiv);
 
@@ -5226,8 +5200,14 @@ bzla_proputils_inv_udiv(Bzla *bzla, BzlaPropInfo *pi)
   t     = pi->target_value;
   bw    = bzla_bv_get_width(s);
 
-  one  = bzla_bv_one(mm, bw);
-  ones = bzla_bv_ones(mm, bw); /* 2^bw - 1 */
+  mark = bzla_bv_scratch_mark(scratch);
+  one  = bzla_bv_scratch_get(scratch, bw);
+  ones = bzla_bv_scratch_get(scratch, bw);
+  tmp  = bzla_bv_scratch_get(scratch, bw);
+  lo   = bzla_bv_scratch_get(scratch, bw);
+  up   = bzla_bv_scratch_get(scratch, bw);
+  bzla_bv_set_one(one);
+  bzla_bv_set_ones(ones); /* 2^bw - 1 */
 
   res = 0;
 
@@ -5275,9 +5255,8 @@ bzla_proputils_inv_udiv(Bzla *bzla, BzlaPropInfo *pi)
         assert(bzla_bv_compare(s, ones)); /* CONFLICT: s = ~0  and t = 0 */
 
         /* t = 0 and 0 < s < 2^bw - 1 -> choose random x > s */
-        tmp = bzla_bv_inc(mm, s);
+        bzla_bv_inc_into(tmp, s);
         res = bzla_bv_new_random_range(mm, rng, bw, tmp, ones);
-        bzla_bv_free(mm, tmp);
       }
     }
     else
@@ -5288,10 +5267,9 @@ bzla_proputils_inv_udiv(Bzla *bzla, BzlaPropInfo *pi)
        * if t is a divisor of s, choose x = s / t
        * with prob = 0.5 and a s s.t. s / x = t otherwise
        */
-      tmp = bzla_bv_urem(mm, s, t);
+      bzla_bv_urem_into(tmp, s, t);
       if (bzla_bv_is_zero(tmp) && bzla_rng_pick_with_prob(rng, 500))
       {
-        bzla_bv_free(mm, tmp);
         res = bzla_bv_udiv(mm, s, t);
       }
       else
@@ -5305,21 +5283,15 @@ bzla_proputils_inv_udiv(Bzla *bzla, BzlaPropInfo *pi)
          * up = s / t
          * lo = s / (t + 1) + 1
          * if lo > up -> conflict */
-        bzla_bv_free(mm, tmp);
-        up  = bzla_bv_udiv(mm, s, t); /* upper bound */
-        tmp = bzla_bv_inc(mm, t);
-        lo  = bzla_bv_udiv(mm, s, tmp); /* lower bound (excl.) */
-        bzla_bv_free(mm, tmp);
-        tmp = lo;
-        lo  = bzla_bv_inc(mm, tmp); /* lower bound (incl.) */
-        bzla_bv_free(mm, tmp);
+        bzla_bv_udiv_into(up, s, t); /* upper bound */
+        bzla_bv_inc_into(tmp, t);
+        bzla_bv_udiv_into(lo, s, tmp); /* lower bound (excl.) */
+        bzla_bv_inc_into(lo, lo);      /* lower bound (incl.) */
 
         assert(bzla_bv_compare(lo, up) <= 0); /* CONFLICT: lo > up */
 
         /* choose lo <= x <= up */
         res = bzla_bv_new_random_range(mm, rng, bw, lo, up);
-        bzla_bv_free(mm, lo);
-        bzla_bv_free(mm, up);
       }
     }
   }
@@ -5374,33 +5346,25 @@ bzla_proputils_inv_udiv(Bzla *bzla, BzlaPropInfo *pi)
          *      if s * (t + 1) does not overflow
          *      else 2^bw - 1
          * lo = s * t */
-        lo  = bzla_bv_mul(mm, s, t);
-        tmp = bzla_bv_inc(mm, t);
+        bzla_bv_mul_into(lo, s, t);
+        bzla_bv_inc_into(tmp, t);
         if (bzla_bv_is_umulo(mm, s, tmp))
         {
-          bzla_bv_free(mm, tmp);
-          up = bzla_bv_copy(mm, ones);
+          bzla_bv_set_ones(up);
         }
         else
         {
-          up = bzla_bv_mul(mm, s, tmp);
-          bzla_bv_free(mm, tmp);
-          tmp = bzla_bv_dec(mm, up);
-          bzla_bv_free(mm, up);
-          up = tmp;
+          bzla_bv_mul_into(up, s, tmp);
+          bzla_bv_dec_into(up, up);
         }
 
         res = bzla_bv_new_random_range(
             mm, bzla->rng, bzla_bv_get_width(s), lo, up);
-
-        bzla_bv_free(mm, up);
-        bzla_bv_free(mm, lo);
       }
     }
   }
 
-  bzla_bv_free(mm, ones);
-  bzla_bv_free(mm, one);
+  bzla_bv_scratch_release(scratch, mark);
 #ifndef NDEBUG
   check_result_binary_dbg(bzla, bzla_bv_udiv, pi, res, "/");
 #endif
@@ -5417,13 +5381,15 @@ bzla_proputils_inv_urem(Bzla *bzla, BzlaPropInfo *pi)
 #ifndef NDEBUG
   check_inv_dbg(bzla, pi, bzla_is_inv_urem, bzla_is_inv_urem_const, true);
 #endif
-  uint32_t bw, cnt;
+  uint32_t bw, cnt, mark;
   int32_t cmp, pos_x;
   BzlaBitVector *res, *ones, *tmp, *tmp2, *one, *n, *mul, *n_hi, *sub;
   BzlaMemMgr *mm;
   const BzlaBitVector *s, *t;
+  BzlaBitVectorScratch *scratch;
 
-  mm = bzla->mm;
+  mm      = bzla->mm;
+  scratch = &bzla->bv_scratch;
 
   record_inv_stats(bzla, &BZLA_PROP_SOLVER(bzla)->stats.inv_urem);
 
@@ -5432,8 +5398,17 @@ bzla_proputils_inv_urem(Bzla *bzla, BzlaPropInfo *pi)
   t     = pi->target_value;
   bw    = bzla_bv_get_width(t);
 
-  ones = bzla_bv_ones(mm, bw); /* 2^bw - 1 */
-  one  = bzla_bv_one(mm, bw);
+  mark = bzla_bv_scratch_mark(scratch);
+  ones = bzla_bv_scratch_get(scratch, bw);
+  one  = bzla_bv_scratch_get(scratch, bw);
+  tmp  = bzla_bv_scratch_get(scratch, bw);
+  tmp2 = bzla_bv_scratch_get(scratch, bw);
+  n    = bzla_bv_scratch_get(scratch, bw);
+  mul  = bzla_bv_scratch_get(scratch, bw);
+  n_hi = bzla_bv_scratch_get(scratch, bw);
+  sub  = bzla_bv_scratch_get(scratch, bw);
+  bzla_bv_set_ones(ones); /* 2^bw - 1 */
+  bzla_bv_set_one(one);
 
   res = 0;
 
@@ -5473,9 +5448,8 @@ bzla_proputils_inv_urem(Bzla *bzla, BzlaPropInfo *pi)
         else
         {
           /* t < res <= 2^bw - 1 */
-          tmp = bzla_bv_add(mm, t, one);
+          bzla_bv_inc_into(tmp, t);
           res = bzla_bv_new_random_range(mm, bzla->rng, bw, tmp, ones);
-          bzla_bv_free(mm, tmp);
         }
       }
       else
@@ -5487,13 +5461,12 @@ bzla_proputils_inv_urem(Bzla *bzla, BzlaPropInfo *pi)
 #ifndef NDEBUG
         if (!bzla_bv_is_zero(t))
         {
-          tmp = bzla_bv_dec(mm, s);
+          bzla_bv_dec_into(tmp, s);
           /* CONFLICT: t = s - 1 -> s % x = s - 1 -> not possible if t > 0 */
           assert(bzla_bv_compare(t, tmp));
-          bzla_bv_free(mm, tmp);
         }
 #endif
-        sub = bzla_bv_sub(mm, s, t);
+        bzla_bv_sub_into(sub, s, t);
         assert(bzla_bv_compare(sub, t) > 0); /* CONFLICT: s - t <= t */
 
         /**
@@ -5514,7 +5487,7 @@ bzla_proputils_inv_urem(Bzla *bzla, BzlaPropInfo *pi)
           if (bzla_bv_is_zero(t))
           {
             /* t = 0 -> 1 <= n <= s */
-            n_hi = bzla_bv_copy(mm, s);
+            bzla_bv_set(n_hi, s);
           }
           else
           {
@@ -5523,7 +5496,7 @@ bzla_proputils_inv_urem(Bzla *bzla, BzlaPropInfo *pi)
              * -> (s - t) / n > t
              * -> (s - t) / t > n
              */
-            bzla_bv_udiv_urem(mm, sub, t, &tmp2, &tmp);
+            bzla_bv_udiv_urem_into(tmp2, tmp, sub, t);
             if (bzla_bv_is_zero(tmp))
             {
               /**
@@ -5531,8 +5504,7 @@ bzla_proputils_inv_urem(Bzla *bzla, BzlaPropInfo *pi)
                * the EXclusive upper bound, the inclusive upper bound is:
                *   n_hi = (s - t) / t - 1
                */
-              n_hi = bzla_bv_sub(mm, tmp2, one);
-              bzla_bv_free(mm, tmp2);
+              bzla_bv_dec_into(n_hi, tmp2);
             }
             else
             {
@@ -5541,9 +5513,8 @@ bzla_proputils_inv_urem(Bzla *bzla, BzlaPropInfo *pi)
                * the INclusive upper bound:
                *   n_hi = (s - t) / t
                */
-              n_hi = tmp2;
+              bzla_bv_set(n_hi, tmp2);
             }
-            bzla_bv_free(mm, tmp);
           }
 
           if (bzla_bv_is_zero(n_hi))
@@ -5557,14 +5528,12 @@ bzla_proputils_inv_urem(Bzla *bzla, BzlaPropInfo *pi)
              * choose 1 <= n <= n_hi randomly
              * s.t (s - t) % n = 0
              */
-            n   = bzla_bv_new_random_range(mm, bzla->rng, bw, one, n_hi);
-            tmp = bzla_bv_urem(mm, sub, n);
+            bzla_bv_set_random_range(n, bzla->rng, one, n_hi);
+            bzla_bv_urem_into(tmp, sub, n);
             for (cnt = 0; cnt < bw && !bzla_bv_is_zero(tmp); cnt++)
             {
-              bzla_bv_free(mm, n);
-              bzla_bv_free(mm, tmp);
-              n   = bzla_bv_new_random_range(mm, bzla->rng, bw, one, n_hi);
-              tmp = bzla_bv_urem(mm, sub, n);
+              bzla_bv_set_random_range(n, bzla->rng, one, n_hi);
+              bzla_bv_urem_into(tmp, sub, n);
             }
 
             if (bzla_bv_is_zero(tmp))
@@ -5577,13 +5546,8 @@ bzla_proputils_inv_urem(Bzla *bzla, BzlaPropInfo *pi)
               /* fallback: n = 1 */
               res = bzla_bv_copy(mm, sub);
             }
-
-            bzla_bv_free(mm, n);
-            bzla_bv_free(mm, tmp);
           }
-          bzla_bv_free(mm, n_hi);
         }
-        bzla_bv_free(mm, sub);
       }
     }
   }
@@ -5633,60 +5597,45 @@ bzla_proputils_inv_urem(Bzla *bzla, BzlaPropInfo *pi)
          * x = s * n + t,
          * with n s.t. (s * n + t) does not overflow
          */
-        tmp2 = bzla_bv_sub(mm, ones, s);
+        bzla_bv_sub_into(tmp2, ones, s);
 
         /* overflow for n = 1 -> only simplest solution possible */
         if (bzla_bv_compare(tmp2, t) < 0)
         {
-          bzla_bv_free(mm, tmp2);
           goto BVUREM_EQ_0;
         }
         else
         {
-          bzla_bv_free(mm, tmp2);
-
-          tmp = bzla_bv_copy(mm, ones);
-          n   = bzla_bv_new_random_range(mm, bzla->rng, bw, one, tmp);
+          bzla_bv_set(tmp, ones);
+          bzla_bv_set_random_range(n, bzla->rng, one, tmp);
 
           while (bzla_bv_is_umulo(mm, s, n))
           {
-            bzla_bv_free(mm, tmp);
-            tmp = bzla_bv_sub(mm, n, one);
-            bzla_bv_free(mm, n);
-            n = bzla_bv_new_random_range(mm, bzla->rng, bw, one, tmp);
+            bzla_bv_dec_into(tmp, n);
+            bzla_bv_set_random_range(n, bzla->rng, one, tmp);
           }
 
-          mul  = bzla_bv_mul(mm, s, n);
-          tmp2 = bzla_bv_sub(mm, ones, mul);
+          bzla_bv_mul_into(mul, s, n);
+          bzla_bv_sub_into(tmp2, ones, mul);
 
           /* choose n s.t. addition in s * n + t does not overflow */
           while (bzla_bv_compare(tmp2, t) < 0)
           {
-            bzla_bv_free(mm, tmp);
-            tmp = bzla_bv_dec(mm, n);
-            bzla_bv_free(mm, n);
-            n = bzla_bv_new_random_range(mm, bzla->rng, bw, one, tmp);
-            bzla_bv_free(mm, mul);
-            bzla_bv_free(mm, tmp2);
-            mul  = bzla_bv_mul(mm, s, n);
-            tmp2 = bzla_bv_sub(mm, ones, mul);
+            bzla_bv_dec_into(tmp, n);
+            bzla_bv_set_random_range(n, bzla->rng, one, tmp);
+            bzla_bv_mul_into(mul, s, n);
+            bzla_bv_sub_into(tmp2, ones, mul);
           }
 
           res = bzla_bv_add(mm, mul, t);
           assert(bzla_bv_compare(res, mul) >= 0);
           assert(bzla_bv_compare(res, t) >= 0);
-
-          bzla_bv_free(mm, tmp);
-          bzla_bv_free(mm, tmp2);
-          bzla_bv_free(mm, mul);
-          bzla_bv_free(mm, n);
         }
       }
     }
   }
 
-  bzla_bv_free(mm, one);
-  bzla_bv_free(mm, ones);
+  bzla_bv_scratch_release(scratch, mark);
 
 #ifndef NDEBUG
   check_result_binary_dbg(bzla, bzla_bv_urem, pi, res, "%");
@@ -7594,8 +7543,16 @@ bzla_proputils_select_move_prop(Bzla *bzla,
             assert(bzla_bvdomain_is_fixed_bit_true(d, k));
           else if (bzla_aig_is_false(real_cur->av->aigs[j]))
             assert(bzla_bvdomain_is_fixed_bit_false(d, k));
-          else
-            assert(!bzla_bvdomain_is_fixed_bit(d, k));
+          else if (bzla_bvdomain_is_fixed_bit(d, k))
+          {
+            /* fixed on the top level by the SAT solver */
+            int32_t id = bzla_aig_get_cnf_id(bzla_get_aig_mgr(bzla),
+                                             real_cur->av->aigs[j]);
+            assert(id);
+            assert(bzla_sat_fixed(bzla_get_sat_mgr(bzla), id)
+                   == (bzla_bvdomain_is_fixed_bit_true(d, k) ? 1 : -1));
+            (void) id;
+          }
         }
       }
     }
@@ -7618,9 +7575,7 @@ bzla_proputils_select_move_prop(Bzla *bzla,
 
       if (bzla_node_is_inverted(cur))
       {
-        tmp  = bv_t;
-        bv_t = bzla_bv_not(bzla->mm, tmp);
-        bzla_bv_free(bzla->mm, tmp);
+        bzla_bv_not_into(bv_t, bv_t);
       }
 
       /* Reset propagation info struct. */
@@ -7935,6 +7890,8 @@ bzla_proputils_select_move_prop(Bzla *bzla,
   bzla_bv_free(bzla->mm, bv_t);
 
 DONE:
+  /* all temporary bit-vectors are released */
+  assert(bzla_bv_scratch_mark(&bzla->bv_scratch) == 0);
 #ifndef NBZLALOG
   if (bzla->slv->kind == BZLA_PROP_SOLVER_KIND)
   {
@@ -19,6 +19,7 @@
 #include "bzlaexp.h"
 #include "bzlafp.h"
 #include "bzlalog.h"
+#include "bzlatrace.h"
 #include "utils/bzlahashint.h"
 #include "utils/bzlahashptr.h"
 #include "utils/bzlamem.h"
@@ -119,13 +120,19 @@
 #endif
 //{fprintf (stderr, "apply: %s (%s)\n", #rw_rule, __FUNCTION__);
 
-#define BZLA_START_REWRITE_TIMER \
-  double timer_start = (bzla->rec_rw_calls == 0 ? bzla_util_time_stamp() : 0)
+#define BZLA_START_REWRITE_TIMER                                       \
+  double timer_start = 0;                                              \
+  if (bzla->rec_rw_calls == 0)                                         \
+  {                                                                    \
+    BZLA_TRACE1(rewrite_start, bzla->nodes_unique_table.num_elements); \
+    timer_start = bzla_util_time_stamp();                              \
+  }
 
-#define BZLA_STOP_REWRITE_TIMER                                 \
-  if (bzla->rec_rw_calls == 0)                                  \
-  {                                                             \
-    bzla->time.rewrite += bzla_util_time_stamp() - timer_start; \
+#define BZLA_STOP_REWRITE_TIMER                                       \
+  if (bzla->rec_rw_calls == 0)                                        \
+  {                                                                   \
+    bzla->time.rewrite += bzla_util_time_stamp() - timer_start;       \
+    BZLA_TRACE1(rewrite_done, bzla->nodes_unique_table.num_elements); \
   }
 
 /* -------------------------------------------------------------------------- */
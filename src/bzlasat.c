@@ -17,6 +17,7 @@
 
 #include "bzlaconfig.h"
 #include "bzlacore.h"
+#include "bzlatrace.h"
 #include "sat/bzlacadical.h"
 #include "sat/bzlacms.h"
 #include "sat/bzlagimsatul.h"
@@ -117,6 +118,12 @@ melt(BzlaSATMgr *smgr, int32_t lit)
   // TODO: else case warning?
 }
 
+static inline void
+phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  if (smgr->api.phase) smgr->api.phase(smgr, lit);
+}
+
 static inline int32_t
 repr(BzlaSATMgr *smgr, int32_t lit)
 {
@@ -412,8 +419,10 @@ bzla_sat_check_sat(BzlaSATMgr *smgr, int32_t limit)
   assert(!smgr->satcalls || smgr->inc_required);
   smgr->satcalls++;
   setterm(smgr);
+  BZLA_TRACE2(sat_start, smgr->maxvar, smgr->clauses);
   sat_res = sat(smgr, limit);
   smgr->sat_time += bzla_util_time_stamp() - start;
+  BZLA_TRACE2(sat_done, sat_res, smgr->clauses);
   switch (sat_res)
   {
     case 10: res = BZLA_RESULT_SAT; break;
@@ -465,6 +474,15 @@ bzla_sat_fixed(BzlaSATMgr *smgr, int32_t lit)
   return res;
 }
 
+void
+bzla_sat_phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  assert(smgr != NULL);
+  assert(smgr->initialized);
+  assert(abs(lit) <= smgr->maxvar);
+  phase(smgr, lit);
+}
+
 /*------------------------------------------------------------------------*/
 
 void
@@ -708,6 +726,13 @@ dimacs_printer_melt(BzlaSATMgr *smgr, int32_t lit)
   melt(wrapped_smgr, lit);
 }
 
+static void
+dimacs_printer_phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  BzlaCnfPrinter *printer = (BzlaCnfPrinter *) smgr->solver;
+  phase(printer->smgr, lit);
+}
+
 /*------------------------------------------------------------------------*/
 
 /* The DIMACS printer is a SAT manager that wraps the currently configured SAT
@@ -739,6 +764,7 @@ enable_dimacs_printer(BzlaSATMgr *smgr)
   smgr->api.inc_max_var      = dimacs_printer_inc_max_var;
   smgr->api.init             = dimacs_printer_init;
   smgr->api.melt             = dimacs_printer_melt;
+  smgr->api.phase            = dimacs_printer_phase;
   smgr->api.repr             = dimacs_printer_repr;
   smgr->api.reset            = dimacs_printer_reset;
   smgr->api.sat              = dimacs_printer_sat;
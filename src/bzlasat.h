@@ -66,6 +66,7 @@ struct BzlaSATMgr
     int32_t (*inc_max_var)(BzlaSATMgr *);
     void *(*init)(BzlaSATMgr *); /* required */
     void (*melt)(BzlaSATMgr *, int32_t);
+    void (*phase)(BzlaSATMgr *, int32_t);
     int32_t (*repr)(BzlaSATMgr *, int32_t);
     void (*reset)(BzlaSATMgr *);           /* required */
     int32_t (*sat)(BzlaSATMgr *, int32_t); /* required */
@@ -174,6 +175,11 @@ int32_t bzla_sat_repr(BzlaSATMgr *smgr, int32_t lit);
  */
 int32_t bzla_sat_fixed(BzlaSATMgr *smgr, int32_t lit);
 
+/* Sets the initial decision phase of the variable of 'lit' to the value
+ * that satisfies 'lit' (ignored if not supported by the SAT solver).
+ */
+void bzla_sat_phase(BzlaSATMgr *smgr, int32_t lit);
+
 /* Resets the status of the SAT solver. */
 void bzla_sat_reset(BzlaSATMgr *smgr);
 
@@ -72,7 +72,7 @@ get_assignment_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
   if (aig == BZLA_AIG_TRUE) return 1;
   if (aig == BZLA_AIG_FALSE) return -1;
   /* initialize don't care bits with false */
-  if (!bzla_hashint_map_contains(aprop->model, BZLA_REAL_ADDR_AIG(aig)->id))
+  if (!bzla_hashint_map_contains(aprop->model, bzla_aig_get_index(aig)))
     return BZLA_IS_INVERTED_AIG(aig) ? 1 : -1;
   return bzla_aigprop_get_assignment_aig(aprop, aig);
 }
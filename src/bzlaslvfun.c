@@ -23,6 +23,7 @@
 #include "bzlaprintmodel.h"
 #include "bzlaslvprop.h"
 #include "bzlaslvsls.h"
+#include "bzlatrace.h"
 #include "preprocess/bzlapreprocess.h"
 #include "utils/bzlaabort.h"
 #include "utils/bzlahash.h"
@@ -2289,6 +2290,7 @@ check_and_resolve_conflicts(Bzla *bzla,
   found_conflicts = false;
   mm              = bzla->mm;
   slv             = BZLA_FUN_SOLVER(bzla);
+  BZLA_TRACE1(lemmas_start, slv->stats.refinement_iterations);
   cleanup_table   = bzla_hashptr_table_new(mm,
                                          (BzlaHashPtr) bzla_node_hash_by_id,
                                          (BzlaCmpPtr) bzla_node_compare_by_id);
@@ -2415,6 +2417,7 @@ check_and_resolve_conflicts(Bzla *bzla,
   BZLA_RELEASE_STACK(top_applies);
   bzla_hashint_table_delete(apply_search_cache);
   slv->time.check_consistency += bzla_util_time_stamp() - start;
+  BZLA_TRACE1(lemmas_done, BZLA_COUNT_STACK(slv->cur_lemmas));
 }
 
 static void
@@ -2639,6 +2642,262 @@ check_sat_prels(BzlaFunSolver *slv, BzlaSolver **ls_slv)
   return result;
 }
 
+/* Initialize the decision phases of the CNF variables of all synthesized
+ * bit-vector variables with their values in the model of the prop/sls engine
+ * (in bzla->bv_model) in order to continue from the local search assignment
+ * when bit-blasting. */
+static void
+set_sat_phases_from_ls_model(BzlaFunSolver *slv)
+{
+  assert(slv);
+
+  uint32_t i, width;
+  int32_t id;
+  BzlaNode *var;
+  BzlaAIGVec *av;
+  BzlaHashTableData *d;
+  BzlaPtrHashTableIterator it;
+  const BzlaBitVector *bv;
+  BzlaAIGMgr *amgr;
+  BzlaSATMgr *smgr;
+  Bzla *bzla;
+
+  bzla = slv->bzla;
+  amgr = bzla_get_aig_mgr(bzla);
+  smgr = bzla_get_sat_mgr(bzla);
+  if (!bzla->bv_model || !bzla_sat_is_initialized(smgr)) return;
+
+  bzla_iter_hashptr_init(&it, bzla->bv_vars);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    var = bzla_iter_hashptr_next(&it);
+    assert(bzla_node_is_regular(var));
+    if (!bzla_node_is_bv_var(var) || !bzla_node_is_synth(var)) continue;
+    if (!(d = bzla_hashint_map_get(bzla->bv_model, var->id))) continue;
+
+    bv    = d->as_ptr;
+    av    = var->av;
+    width = av->width;
+    assert(bzla_bv_get_width(bv) == width);
+    for (i = 0; i < width; i++)
+    {
+      if (bzla_aig_is_const(av->aigs[i])) continue;
+      if (!(id = bzla_aig_get_cnf_id(amgr, av->aigs[i]))) continue;
+      bzla_sat_phase(smgr, bzla_bv_get_bit(bv, width - 1 - i) ? id : -id);
+      slv->stats.prels_phases++;
+    }
+  }
+}
+
+/* Returns true if constraints can be synthesized lazily, i.e., if the formula
+ * is checked under assumptions and contains only bit-vector terms. */
+static bool
+use_lazy_constraints(Bzla *bzla)
+{
+  assert(bzla);
+
+  BzlaNode *cur;
+  BzlaPtrHashTableIterator it;
+
+  if (!bzla_opt_get(bzla, BZLA_OPT_FUN_LAZY_CONSTRAINTS)
+      || bzla_opt_get(bzla, BZLA_OPT_PRINT_DIMACS)
+      || bzla->assumptions->count == 0 || bzla->ufs->count > 0
+      || bzla->lambdas->count > 0 || bzla->feqs->count > 0
+      || bzla->quantifiers->count > 0)
+  {
+    return false;
+  }
+
+  /* FP and RM inputs are always synthesized, see
+   * bzla_process_unsynthesized_constraints */
+  bzla_iter_hashptr_init(&it, bzla->inputs);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    cur = bzla_node_get_simplified(bzla, bzla_iter_hashptr_next(&it));
+    if (bzla_node_is_fp(bzla, cur) || bzla_node_is_rm(bzla, cur)) return false;
+  }
+  return true;
+}
+
+/* Collect the ids of all bit-vector variables in the cones of the
+ * assumptions. */
+static void
+collect_assumption_vars(Bzla *bzla, BzlaIntHashTable *vars)
+{
+  assert(bzla);
+  assert(vars);
+
+  uint32_t i;
+  BzlaNode *cur;
+  BzlaNodePtrStack visit;
+  BzlaIntHashTable *cache;
+  BzlaPtrHashTableIterator it;
+  BzlaMemMgr *mm;
+
+  mm    = bzla->mm;
+  cache = bzla_hashint_table_new(mm);
+  BZLA_INIT_STACK(mm, visit);
+
+  bzla_iter_hashptr_init(&it, bzla->assumptions);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    cur = bzla_iter_hashptr_next(&it);
+    BZLA_PUSH_STACK(visit, bzla_node_get_simplified(bzla, cur));
+  }
+
+  while (!BZLA_EMPTY_STACK(visit))
+  {
+    cur = bzla_node_real_addr(BZLA_POP_STACK(visit));
+    if (bzla_hashint_table_contains(cache, cur->id)) continue;
+    bzla_hashint_table_add(cache, cur->id);
+
+    if (bzla_node_is_bv_var(cur)) bzla_hashint_table_add(vars, cur->id);
+    for (i = 0; i < cur->arity; i++) BZLA_PUSH_STACK(visit, cur->e[i]);
+  }
+
+  BZLA_RELEASE_STACK(visit);
+  bzla_hashint_table_delete(cache);
+}
+
+/* Returns true if the cone of 'root' contains any of the variables in 'vars'.
+ * The result for each visited node is cached in 'cache' (1: no, 2: yes). */
+static bool
+shares_vars(Bzla *bzla,
+            BzlaNode *root,
+            BzlaIntHashTable *vars,
+            BzlaIntHashTable *cache)
+{
+  assert(bzla);
+  assert(root);
+  assert(vars);
+  assert(cache);
+
+  uint32_t i;
+  bool res;
+  BzlaNode *cur;
+  BzlaNodePtrStack visit;
+  BzlaHashTableData *d;
+
+  BZLA_INIT_STACK(bzla->mm, visit);
+  BZLA_PUSH_STACK(visit, root);
+  while (!BZLA_EMPTY_STACK(visit))
+  {
+    cur = bzla_node_real_addr(BZLA_POP_STACK(visit));
+    d   = bzla_hashint_map_get(cache, cur->id);
+    if (!d)
+    {
+      bzla_hashint_map_add(cache, cur->id);
+      BZLA_PUSH_STACK(visit, cur);
+      for (i = 0; i < cur->arity; i++) BZLA_PUSH_STACK(visit, cur->e[i]);
+    }
+    else if (d->as_int == 0)
+    {
+      res = bzla_hashint_table_contains(vars, cur->id);
+      for (i = 0; i < cur->arity && !res; i++)
+      {
+        res = bzla_hashint_map_get(cache, bzla_node_real_addr(cur->e[i])->id)
+                  ->as_int
+              == 2;
+      }
+      d->as_int = res ? 2 : 1;
+    }
+  }
+  BZLA_RELEASE_STACK(visit);
+
+  d = bzla_hashint_map_get(cache, bzla_node_real_addr(root)->id);
+  assert(d);
+  return d->as_int == 2;
+}
+
+/* Check the bit-vector skeleton while synthesizing constraints on demand.
+ * Initially, only constraints that share variables with the assumptions are
+ * synthesized. If the SAT solver finds a model, the remaining unsynthesized
+ * constraints are evaluated under this model and the violated ones are
+ * synthesized before the next SAT call. The result is only satisfiable if
+ * the model satisfies all constraints. */
+static BzlaSolverResult
+sat_lazy_constraints(BzlaFunSolver *slv)
+{
+  assert(slv);
+
+  uint32_t i;
+  BzlaSolverResult result;
+  BzlaNode *cur;
+  BzlaNodePtrStack synth;
+  BzlaIntHashTable *vars, *cache, *bv_model, *fun_model;
+  BzlaPtrHashTable *uc;
+  BzlaPtrHashTableIterator it;
+  BzlaBitVector *bv;
+  BzlaMemMgr *mm;
+  Bzla *bzla;
+
+  bzla = slv->bzla;
+  mm   = bzla->mm;
+  uc   = bzla->unsynthesized_constraints;
+
+  BZLA_INIT_STACK(mm, synth);
+
+  /* select constraints in the cone of influence of the assumptions */
+  vars  = bzla_hashint_table_new(mm);
+  cache = bzla_hashint_map_new(mm);
+  collect_assumption_vars(bzla, vars);
+  bzla_iter_hashptr_init(&it, uc);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    cur = bzla_iter_hashptr_next(&it);
+    if (shares_vars(bzla, cur, vars, cache)) BZLA_PUSH_STACK(synth, cur);
+  }
+  bzla_hashint_map_delete(cache);
+  bzla_hashint_table_delete(vars);
+
+  while (true)
+  {
+    for (i = 0; i < BZLA_COUNT_STACK(synth); i++)
+    {
+      bzla_synthesize_constraint(bzla, BZLA_PEEK_STACK(synth, i));
+      if (bzla->found_constraint_false)
+      {
+        result = BZLA_RESULT_UNSAT;
+        goto DONE;
+      }
+    }
+    slv->stats.lazy_constraints_synthesized += BZLA_COUNT_STACK(synth);
+    BZLA_RESET_STACK(synth);
+
+    result = timed_sat_sat(bzla, slv->sat_limit);
+    slv->stats.lazy_constraints_rounds++;
+    if (result != BZLA_RESULT_SAT || uc->count == 0) break;
+
+    /* collect constraints violated by the current model */
+    bv_model = 0;
+    bzla_model_init_bv(bzla, &bv_model);
+    fun_model = bzla_hashint_map_new(mm);
+    bzla_iter_hashptr_init(&it, uc);
+    while (bzla_iter_hashptr_has_next(&it))
+    {
+      cur = bzla_iter_hashptr_next(&it);
+      bv  = bzla_model_recursively_compute_assignment(
+          bzla, bv_model, fun_model, cur);
+      if (bzla_bv_is_false(bv)) BZLA_PUSH_STACK(synth, cur);
+      bzla_bv_free(mm, bv);
+    }
+    bzla_hashint_map_delete(fun_model);
+    bzla_model_delete_bv(bzla, &bv_model);
+
+    if (BZLA_EMPTY_STACK(synth)) break;
+    BZLALOG(
+        1, "synthesize %u violated constraint(s)", BZLA_COUNT_STACK(synth));
+
+    /* assumptions are only valid for a single SAT call */
+    bzla_add_again_assumptions(bzla);
+  }
+
+DONE:
+  slv->stats.lazy_constraints_skipped = uc->count;
+  BZLA_RELEASE_STACK(synth);
+  return result;
+}
+
 static BzlaSolverResult
 sat_fun_solver(BzlaFunSolver *slv)
 {
@@ -2648,7 +2907,7 @@ sat_fun_solver(BzlaFunSolver *slv)
   assert(slv->bzla->slv == (BzlaSolver *) slv);
 
   uint32_t i;
-  bool opt_prels, opt_prop_const_bits;
+  bool opt_prels, opt_prop_const_bits, opt_lazy_constraints, ls_phases;
   BzlaSolverResult result;
   Bzla *bzla, *clone;
   BzlaNode *clone_root, *lemma;
@@ -2687,6 +2946,8 @@ sat_fun_solver(BzlaFunSolver *slv)
 
   if (bzla->feqs->count > 0) add_function_inequality_constraints(bzla);
 
+  opt_lazy_constraints = !opt_prels && use_lazy_constraints(bzla);
+
   /* initialize dual prop clone */
   if (bzla_opt_get(bzla, BZLA_OPT_FUN_DUAL_PROP))
   {
@@ -2705,7 +2966,8 @@ sat_fun_solver(BzlaFunSolver *slv)
 
   while (true)
   {
-    result = BZLA_RESULT_UNKNOWN;
+    result    = BZLA_RESULT_UNKNOWN;
+    ls_phases = false;
 
     if (bzla_terminate(bzla)
         || (slv->lod_limit > -1
@@ -2728,7 +2990,8 @@ sat_fun_solver(BzlaFunSolver *slv)
         assert(bzla_dbg_check_all_hash_tables_proxy_free(bzla));
         assert(bzla_dbg_check_all_hash_tables_simp_free(bzla));
       }
-      result = check_sat_prels(slv, &ls_slv);
+      result    = check_sat_prels(slv, &ls_slv);
+      ls_phases = result == BZLA_RESULT_UNKNOWN && !bzla_terminate(bzla);
     }
 
     if (result == BZLA_RESULT_UNKNOWN)
@@ -2737,18 +3000,28 @@ sat_fun_solver(BzlaFunSolver *slv)
        * synthesized. */
       bzla_add_again_assumptions(bzla);
 
-      bzla_process_unsynthesized_constraints(bzla);
-      if (bzla->found_constraint_false)
+      if (opt_lazy_constraints)
       {
-        result = BZLA_RESULT_UNSAT;
-        break;
+        result = sat_lazy_constraints(slv);
       }
-      assert(bzla->unsynthesized_constraints->count == 0);
-      assert(bzla_dbg_check_all_hash_tables_proxy_free(bzla));
-      assert(bzla_dbg_check_all_hash_tables_simp_free(bzla));
+      else
+      {
+        bzla_process_unsynthesized_constraints(bzla);
+        if (bzla->found_constraint_false)
+        {
+          result = BZLA_RESULT_UNSAT;
+          break;
+        }
+        assert(bzla->unsynthesized_constraints->count == 0);
+        assert(bzla_dbg_check_all_hash_tables_proxy_free(bzla));
+        assert(bzla_dbg_check_all_hash_tables_simp_free(bzla));
 
-      /* make SAT call on bv skeleton */
-      result = timed_sat_sat(bzla, slv->sat_limit);
+        /* start from the assignment of the local search engine */
+        if (ls_phases) set_sat_phases_from_ls_model(slv);
+
+        /* make SAT call on bv skeleton */
+        result = timed_sat_sat(bzla, slv->sat_limit);
+      }
 
       /* Initialize new bit vector model, which will be constructed while
        * consistency checking. This also deletes the model from the previous
@@ -2883,6 +3156,25 @@ print_stats_fun_solver(BzlaFunSolver *slv)
              1,
              "%7d assignments shared with bit-blasting engine",
              slv->stats.prels_shared);
+    BZLA_MSG(bzla->msg,
+             1,
+             "%7lld SAT phases initialized from local search model",
+             slv->stats.prels_phases);
+  }
+
+  if (bzla_opt_get(bzla, BZLA_OPT_FUN_LAZY_CONSTRAINTS))
+  {
+    BZLA_MSG(bzla->msg, 1, "");
+    BZLA_MSG(bzla->msg, 1, "lazy constraints statistics:");
+    BZLA_MSG(bzla->msg, 1, "%7d SAT calls", slv->stats.lazy_constraints_rounds);
+    BZLA_MSG(bzla->msg,
+             1,
+             "%7lld constraints synthesized",
+             slv->stats.lazy_constraints_synthesized);
+    BZLA_MSG(bzla->msg,
+             1,
+             "%7d constraints not synthesized in last call",
+             slv->stats.lazy_constraints_skipped);
   }
 
   if (bzla->ufs->count || bzla->lambdas->count)
@@ -55,6 +55,15 @@ struct BzlaFunSolver
 
     /* number of assignments shared from local search engine */
     uint32_t prels_shared;
+    /* number of SAT phases initialized from local search model */
+    uint_least64_t prels_phases;
+
+    /* number of SAT calls and constraints synthesized with lazy
+     * synthesis of constraints */
+    uint32_t lazy_constraints_rounds;
+    uint_least64_t lazy_constraints_synthesized;
+    /* number of constraints not synthesized in the last sat call */
+    uint32_t lazy_constraints_skipped;
 
     uint_least64_t eval_exp_calls;
     uint_least64_t propagations;
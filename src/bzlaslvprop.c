@@ -315,7 +315,8 @@ clone_prop_solver(Bzla *clone, BzlaPropSolver *slv, BzlaNodeMap *exp_map)
   res->roots = bzla_hashint_map_clone(clone->mm, slv->roots, 0, 0);
   res->score =
       bzla_hashint_map_clone(clone->mm, slv->score, bzla_clone_data_as_dbl, 0);
-  // TODO clone const_bits
+  res->domains = bzla_hashint_map_clone(
+      clone->mm, slv->domains, bzla_clone_data_as_bvdomain_ptr, 0);
 
   bzla_proputils_clone_prop_info_stack(
       clone->mm, &slv->toprop, &res->toprop, exp_map);
@@ -366,6 +367,7 @@ bzla_prop_solver_init_domains(Bzla *bzla,
   assert(root);
 
   uint32_t i, bw, idx;
+  int32_t id, val;
   BzlaNode *cur, *real_cur;
   BzlaNodePtrStack visit;
   BzlaIntHashTable *cache;
@@ -373,11 +375,19 @@ bzla_prop_solver_init_domains(Bzla *bzla,
   BzlaMemMgr *mm;
   BzlaAIGVec *av;
   BzlaBvDomain *domain, *invdomain;
+  BzlaAIGMgr *amgr;
+  BzlaSATMgr *smgr;
   bool opt_prop_const_bits;
 
   mm                  = bzla->mm;
+  amgr                = bzla_get_aig_mgr(bzla);
   opt_prop_const_bits = bzla_opt_get(bzla, BZLA_OPT_PROP_CONST_BITS) != 0;
 
+  /* If used as preprocessing of the fun engine, bits may have been fixed on
+   * the top level by the SAT solver in previous (incremental) calls. */
+  smgr = bzla_get_sat_mgr(bzla);
+  if (!bzla_sat_is_initialized(smgr) || !smgr->satcalls) smgr = 0;
+
   cache = bzla_hashint_map_new(mm);
   BZLA_INIT_STACK(mm, visit);
 
@@ -434,6 +444,14 @@ bzla_prop_solver_init_domains(Bzla *bzla,
                 invdomain, idx, bzla_aig_is_false(av->aigs[i]));
             BZLA_PROP_SOLVER(bzla)->stats.fixed_bits++;
           }
+          else if (smgr && (id = bzla_aig_get_cnf_id(amgr, av->aigs[i]))
+                   && (val = bzla_sat_fixed(smgr, id)))
+          {
+            bzla_bvdomain_fix_bit(domain, idx, val > 0);
+            bzla_bvdomain_fix_bit(invdomain, idx, val < 0);
+            BZLA_PROP_SOLVER(bzla)->stats.fixed_bits++;
+            BZLA_PROP_SOLVER(bzla)->stats.fixed_bits_sat++;
+          }
         }
         BZLA_PROP_SOLVER(bzla)->stats.total_bits += bw;
       }
@@ -1057,6 +1075,10 @@ print_stats_prop_solver(BzlaPropSolver *slv)
              slv->stats.fixed_bits,
              slv->stats.total_bits,
              (double) slv->stats.fixed_bits / slv->stats.total_bits * 100);
+    BZLA_MSG(bzla->msg,
+             1,
+             "fixed bits (SAT solver): %zu",
+             slv->stats.fixed_bits_sat);
   }
 
   if (bzla_opt_get(bzla, BZLA_OPT_PROP_CONST_DOMAINS))
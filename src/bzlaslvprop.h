@@ -127,6 +127,7 @@ struct BzlaPropSolver
 
     /* constant bit information */
     uint64_t fixed_bits;
+    uint64_t fixed_bits_sat; /* fixed by the SAT solver of the fun engine */
     uint64_t total_bits;
     uint64_t updated_domains;
     uint64_t updated_domains_children;
@@ -26,6 +26,7 @@
 #include "utils/bzlaabort.h"
 #include "utils/bzlahashint.h"
 #include "utils/bzlanodeiter.h"
+#include "utils/bzlaunionfind.h"
 #include "utils/bzlautil.h"
 
 #ifdef BZLA_HAVE_PTHREADS
@@ -50,6 +51,14 @@ struct BzlaQuantStats
     uint32_t synthesize_model_const;
     uint32_t synthesize_model_term;
     uint32_t synthesize_model_none;
+
+    /* instantiations added to the exists solver */
+    uint32_t instantiations;
+    uint32_t duplicate_instantiations;
+
+    /* checks of the instantiated formula split among worker threads */
+    uint32_t parallel_checks;
+    uint32_t parallel_parts;
   } stats;
 
   struct
@@ -66,6 +75,22 @@ struct BzlaQuantStats
 
 typedef struct BzlaQuantStats BzlaQuantStats;
 
+#ifdef BZLA_HAVE_PTHREADS
+/* Worker for checking a part of the instantiated formula of the forall solver
+ * in parallel. */
+struct BzlaQuantWorker
+{
+  Bzla *bzla;                 /* solver for checking the part */
+  BzlaNodeMap *uvars;         /* fresh bv vars of the forall solver map to
+                                 fresh bv vars of 'bzla' */
+  BzlaNodePtrStack conjuncts; /* conjuncts of the part (forall solver) */
+  BzlaSolverResult result;
+  pthread_t thread;
+};
+
+typedef struct BzlaQuantWorker BzlaQuantWorker;
+#endif
+
 struct BzlaGroundSolvers
 {
   Bzla *forall; /* solver for checking the model */
@@ -90,6 +115,8 @@ struct BzlaGroundSolvers
   BzlaNodeMap *exists_ufs;   /* UFs (non-skolem constants), map to UFs
                                 of forall solver */
   BzlaNodeMap *exists_cur_qi;
+  BzlaPtrHashTable *exists_insts; /* instantiations added to the exists
+                                     solver (hash-consed) */
   BzlaSolverResult result;
 
   BzlaQuantStats statistics;
@@ -97,17 +124,40 @@ struct BzlaGroundSolvers
 #ifdef BZLA_HAVE_PTHREADS
   bool *found_result;
   pthread_mutex_t *found_result_mutex;
+
+  BzlaQuantWorker *workers; /* workers for checking the forall formula */
+  uint32_t num_workers;
 #endif
 };
 
 typedef struct BzlaGroundSolvers BzlaGroundSolvers;
 
+/* Ground solvers for a set of asserted and assumed formulas. The ground
+ * solvers keep their refinements, counter examples and synthesized model
+ * across check-sat calls on the same set of formulas. */
+struct BzlaQuantFrame
+{
+  BzlaNodePtrStack roots;   /* formulas, sorted by id */
+  BzlaGroundSolvers *gslv;  /* two ground solver instances */
+  BzlaGroundSolvers *dgslv; /* two ground solver instances for dual */
+  BzlaSolverResult result;
+};
+
+typedef struct BzlaQuantFrame BzlaQuantFrame;
+
+BZLA_DECLARE_STACK(BzlaQuantFramePtr, BzlaQuantFrame *);
+
 struct BzlaQuantSolver
 {
   BZLA_SOLVER_STRUCT;
 
-  BzlaGroundSolvers *gslv;  /* two ground solver instances */
-  BzlaGroundSolvers *dgslv; /* two ground solver instances for dual */
+  BzlaGroundSolvers *gslv;  /* ground solvers of the current frame */
+  BzlaGroundSolvers *dgslv; /* ground solvers for dual of current frame */
+
+  BzlaNodePtrStack roots; /* asserted formulas */
+  /* Frames of previous check-sat calls, the roots of each frame are a
+   * superset of the roots of the frames below (incremental mode). */
+  BzlaQuantFramePtrStack frames;
 };
 
 typedef struct BzlaQuantSolver BzlaQuantSolver;
@@ -605,6 +655,82 @@ collect_consts(Bzla *bzla, BzlaNode *root, BzlaNodePtrStack *consts)
   bzla_hashint_table_delete(cache);
 }
 
+#ifdef BZLA_HAVE_PTHREADS
+static int32_t
+worker_terminate(void *state)
+{
+  BzlaGroundSolvers *gslv = state;
+  return bzla_terminate(gslv->forall);
+}
+
+static void
+init_workers(BzlaGroundSolvers *gslv, uint32_t num_workers)
+{
+  assert(!gslv->workers);
+  assert(num_workers > 1);
+
+  uint32_t i, width;
+  BzlaNode *var_fs, *var;
+  BzlaFunSolver *fslv;
+  BzlaQuantWorker *w;
+  BzlaNodeMapIterator it;
+  BzlaMemMgr *mm;
+  BzlaSortId sort;
+
+  mm = gslv->forall->mm;
+  BZLA_CNEWN(mm, gslv->workers, num_workers);
+  gslv->num_workers = num_workers;
+
+  for (i = 0; i < num_workers; i++)
+  {
+    w         = &gslv->workers[i];
+    w->result = BZLA_RESULT_UNKNOWN;
+    w->bzla   = bzla_new();
+    bzla_opt_delete_opts(w->bzla);
+    bzla_opt_clone_opts(gslv->forall, w->bzla);
+    bzla_set_msg_prefix(w->bzla, "forall_worker");
+
+    fslv                = (BzlaFunSolver *) bzla_new_fun_solver(w->bzla);
+    fslv->assume_lemmas = true;
+    w->bzla->slv        = (BzlaSolver *) fslv;
+    bzla_set_term(w->bzla, worker_terminate, gslv);
+
+    /* universal vars are shared by all parts of the formula and are
+     * required for combining the counter examples of the workers */
+    w->uvars = bzla_nodemap_new(gslv->forall);
+    bzla_iter_nodemap_init(&it, gslv->forall_uvars);
+    while (bzla_iter_nodemap_has_next(&it))
+    {
+      var_fs = it.it.bucket->data.as_ptr;
+      (void) bzla_iter_nodemap_next(&it);
+      width = bzla_node_bv_get_width(gslv->forall, var_fs);
+      sort  = bzla_sort_bv(w->bzla, width);
+      var   = bzla_exp_var(w->bzla, sort, 0);
+      bzla_sort_release(w->bzla, sort);
+      bzla_nodemap_map(w->uvars, var_fs, var);
+      bzla_node_release(w->bzla, var);
+    }
+    BZLA_INIT_STACK(mm, w->conjuncts);
+  }
+}
+
+static void
+delete_workers(BzlaGroundSolvers *gslv)
+{
+  uint32_t i;
+  BzlaQuantWorker *w;
+
+  for (i = 0; i < gslv->num_workers; i++)
+  {
+    w = &gslv->workers[i];
+    BZLA_RELEASE_STACK(w->conjuncts);
+    bzla_nodemap_delete(w->uvars);
+    bzla_delete(w->bzla);
+  }
+  BZLA_DELETEN(gslv->forall->mm, gslv->workers, gslv->num_workers);
+}
+#endif
+
 static BzlaGroundSolvers *
 setup_solvers(BzlaQuantSolver *slv,
               BzlaNode *root,
@@ -731,6 +857,7 @@ setup_solvers(BzlaQuantSolver *slv,
   res->exists->slv  = bzla_new_fun_solver(res->exists);
   res->exists_evars = bzla_nodemap_new(res->exists);
   res->exists_ufs   = bzla_nodemap_new(res->exists);
+  res->exists_insts = bzla_hashptr_table_new(res->exists->mm, 0, 0);
 
   /* map evars of exists solver to evars of forall solver */
   bzla_iter_hashptr_init(&it, res->forall->exists_vars);
@@ -782,6 +909,15 @@ setup_solvers(BzlaQuantSolver *slv,
   }
   bzla_hashptr_table_delete(forall_ufs);
 
+#ifdef BZLA_HAVE_PTHREADS
+  uint32_t num_threads;
+  num_threads = bzla_opt_get(bzla, BZLA_OPT_QUANT_THREADS);
+  if (num_threads > 1 && res->forall_uvars->table->count > 0)
+  {
+    init_workers(res, num_threads);
+  }
+#endif
+
   return res;
 }
 
@@ -791,9 +927,19 @@ delete_ground_solvers(BzlaQuantSolver *slv, BzlaGroundSolvers *gslv)
   BzlaPtrHashTableIterator it;
   BzlaBitVectorTuple *ce;
 
+#ifdef BZLA_HAVE_PTHREADS
+  if (gslv->workers) delete_workers(gslv);
+#endif
+
   /* delete exists solver */
   bzla_nodemap_delete(gslv->exists_evars);
   bzla_nodemap_delete(gslv->exists_ufs);
+  bzla_iter_hashptr_init(&it, gslv->exists_insts);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    bzla_node_release(gslv->exists, bzla_iter_hashptr_next(&it));
+  }
+  bzla_hashptr_table_delete(gslv->exists_insts);
 
   /* delete forall solver */
   delete_model(gslv);
@@ -821,6 +967,22 @@ delete_ground_solvers(BzlaQuantSolver *slv, BzlaGroundSolvers *gslv)
   BZLA_DELETE(slv->bzla->mm, gslv);
 }
 
+static void
+delete_frame(BzlaQuantSolver *slv, BzlaQuantFrame *frame)
+{
+  Bzla *bzla;
+
+  bzla = slv->bzla;
+  delete_ground_solvers(slv, frame->gslv);
+  if (frame->dgslv) delete_ground_solvers(slv, frame->dgslv);
+  while (!BZLA_EMPTY_STACK(frame->roots))
+  {
+    bzla_node_release(bzla, BZLA_POP_STACK(frame->roots));
+  }
+  BZLA_RELEASE_STACK(frame->roots);
+  BZLA_DELETE(bzla->mm, frame);
+}
+
 static BzlaNode *
 build_refinement(Bzla *bzla, BzlaNode *root, BzlaNodeMap *map)
 {
@@ -961,6 +1123,23 @@ instantiate_args(Bzla *bzla, BzlaNode *args, BzlaNodeMap *map)
   return res;
 }
 
+/* Add instantiation 'inst' to the exists solver. Instantiations are
+ * hash-consed, an instantiation that was already added in a previous
+ * iteration is skipped. */
+static void
+add_instantiation(BzlaGroundSolvers *gslv, BzlaNode *inst)
+{
+  if (bzla_hashptr_table_get(gslv->exists_insts, inst))
+  {
+    gslv->statistics.stats.duplicate_instantiations++;
+    return;
+  }
+  bzla_hashptr_table_add(gslv->exists_insts,
+                         bzla_node_copy(gslv->exists, inst));
+  gslv->statistics.stats.instantiations++;
+  bzla_assert_exp(gslv->exists, inst);
+}
+
 static void
 refine_exists_solver(BzlaGroundSolvers *gslv, BzlaNodeMap *evar_map)
 {
@@ -1059,7 +1238,7 @@ refine_exists_solver(BzlaGroundSolvers *gslv, BzlaNodeMap *evar_map)
   bzla_hashptr_table_add(gslv->forall_ces, ce)->data.as_ptr = evar_tup;
   gslv->forall_last_ce                                      = ce;
 
-  bzla_assert_exp(e_solver, res);
+  add_instantiation(gslv, res);
   bzla_node_release(e_solver, res);
 }
 
@@ -1175,8 +1354,16 @@ delete_quant_solver(BzlaQuantSolver *slv)
 
   Bzla *bzla;
   bzla = slv->bzla;
-  delete_ground_solvers(slv, slv->gslv);
-  if (slv->dgslv) delete_ground_solvers(slv, slv->dgslv);
+  while (!BZLA_EMPTY_STACK(slv->frames))
+  {
+    delete_frame(slv, BZLA_POP_STACK(slv->frames));
+  }
+  BZLA_RELEASE_STACK(slv->frames);
+  while (!BZLA_EMPTY_STACK(slv->roots))
+  {
+    bzla_node_release(bzla, BZLA_POP_STACK(slv->roots));
+  }
+  BZLA_RELEASE_STACK(slv->roots);
   BZLA_DELETE(bzla->mm, slv);
   bzla->slv = 0;
 }
@@ -2209,7 +2396,7 @@ synthesize_quant_inst(BzlaGroundSolvers *gslv)
         }
 #endif
     result = build_quant_inst_refinement(gslv, map);
-    bzla_assert_exp(e_solver, result);
+    add_instantiation(gslv, result);
     bzla_node_release(e_solver, result);
   }
 
@@ -2229,6 +2416,287 @@ synthesize_quant_inst(BzlaGroundSolvers *gslv)
   BZLA_RELEASE_STACK(value_out);
 }
 
+#ifdef BZLA_HAVE_PTHREADS
+static void *
+worker_check(void *state)
+{
+  BzlaQuantWorker *w;
+
+  w         = state;
+  w->result = bzla_check_sat(w->bzla, -1, -1);
+  return NULL;
+}
+
+/* Split the instantiated formula 'g' into parts for the workers. Top-level
+ * conjuncts that share universal variables are assigned to the same worker.
+ * 'owner' maps universal vars to the worker of their part. Returns the number
+ * of workers with a non-empty part. */
+static uint32_t
+split_formula(BzlaGroundSolvers *gslv, BzlaNode *g, BzlaIntHashTable *owner)
+{
+  int32_t id;
+  uint32_t i, num_groups;
+  BzlaNode *cur, *real_cur, *rep, *var_fs;
+  BzlaNodePtrStack visit, conjuncts;
+  BzlaIntHashTable *cache, *uvars, *reps, *groups;
+  BzlaHashTableData *d;
+  BzlaNodeMapIterator it;
+  BzlaUnionFind *ufind;
+  BzlaMemMgr *mm;
+
+  mm = gslv->forall->mm;
+  BZLA_INIT_STACK(mm, visit);
+  BZLA_INIT_STACK(mm, conjuncts);
+
+  /* collect top-level conjuncts */
+  cache = bzla_hashint_table_new(mm);
+  BZLA_PUSH_STACK(visit, g);
+  while (!BZLA_EMPTY_STACK(visit))
+  {
+    cur = BZLA_POP_STACK(visit);
+    id  = bzla_node_get_id(cur);
+    if (bzla_hashint_table_contains(cache, id)) continue;
+    bzla_hashint_table_add(cache, id);
+    if (bzla_node_is_regular(cur) && bzla_node_is_bv_and(cur))
+    {
+      BZLA_PUSH_STACK(visit, cur->e[1]);
+      BZLA_PUSH_STACK(visit, cur->e[0]);
+    }
+    else
+    {
+      BZLA_PUSH_STACK(conjuncts, cur);
+    }
+  }
+  bzla_hashint_table_delete(cache);
+
+  uvars = bzla_hashint_table_new(mm);
+  bzla_iter_nodemap_init(&it, gslv->forall_uvars);
+  while (bzla_iter_nodemap_has_next(&it))
+  {
+    var_fs = it.it.bucket->data.as_ptr;
+    (void) bzla_iter_nodemap_next(&it);
+    bzla_hashint_table_add(uvars, var_fs->id);
+  }
+
+  /* merge universal vars that occur in the same conjunct, 'reps' maps each
+   * node to one of the universal vars below (if any) */
+  ufind = bzla_ufind_new(mm);
+  reps  = bzla_hashint_map_new(mm);
+  for (i = 0; i < BZLA_COUNT_STACK(conjuncts); i++)
+  {
+    BZLA_PUSH_STACK(visit, BZLA_PEEK_STACK(conjuncts, i));
+  }
+  while (!BZLA_EMPTY_STACK(visit))
+  {
+    real_cur = bzla_node_real_addr(BZLA_POP_STACK(visit));
+    d        = bzla_hashint_map_get(reps, real_cur->id);
+    if (!d)
+    {
+      bzla_hashint_map_add(reps, real_cur->id);
+      BZLA_PUSH_STACK(visit, real_cur);
+      for (i = 0; i < real_cur->arity; i++)
+        BZLA_PUSH_STACK(visit, real_cur->e[i]);
+    }
+    else if (bzla_hashint_table_contains(uvars, real_cur->id))
+    {
+      bzla_ufind_add(ufind, real_cur);
+      d->as_ptr = real_cur;
+    }
+    else
+    {
+      for (i = 0; i < real_cur->arity; i++)
+      {
+        id  = bzla_node_real_addr(real_cur->e[i])->id;
+        rep = bzla_hashint_map_get(reps, id)->as_ptr;
+        if (!rep) continue;
+        if (d->as_ptr)
+          bzla_ufind_merge(ufind, d->as_ptr, rep);
+        else
+          d->as_ptr = rep;
+      }
+    }
+  }
+
+  /* assign groups of conjuncts to workers */
+  num_groups = 0;
+  groups     = bzla_hashint_map_new(mm);
+  for (i = 0; i < BZLA_COUNT_STACK(conjuncts); i++)
+  {
+    cur = BZLA_PEEK_STACK(conjuncts, i);
+    rep = bzla_hashint_map_get(reps, bzla_node_real_addr(cur)->id)->as_ptr;
+    if (rep)
+    {
+      rep = bzla_ufind_get_repr(ufind, rep);
+      d   = bzla_hashint_map_get(groups, rep->id);
+      if (!d)
+      {
+        d         = bzla_hashint_map_add(groups, rep->id);
+        d->as_int = num_groups++ % gslv->num_workers;
+      }
+      id = d->as_int;
+    }
+    else
+    {
+      /* conjunct without universal vars */
+      id = num_groups++ % gslv->num_workers;
+    }
+    BZLA_PUSH_STACK(gslv->workers[id].conjuncts, cur);
+  }
+
+  if (num_groups > 1)
+  {
+    bzla_iter_nodemap_init(&it, gslv->forall_uvars);
+    while (bzla_iter_nodemap_has_next(&it))
+    {
+      var_fs = it.it.bucket->data.as_ptr;
+      (void) bzla_iter_nodemap_next(&it);
+      if (!bzla_hashint_map_contains(reps, var_fs->id)) continue;
+      rep = bzla_ufind_get_repr(ufind, var_fs);
+      d   = bzla_hashint_map_get(groups, rep->id);
+      assert(d);
+      bzla_hashint_map_add(owner, var_fs->id)->as_int = d->as_int;
+    }
+  }
+  else
+  {
+    BZLA_RESET_STACK(gslv->workers[0].conjuncts);
+  }
+
+  bzla_hashint_map_delete(groups);
+  bzla_hashint_map_delete(reps);
+  bzla_hashint_table_delete(uvars);
+  bzla_ufind_delete(ufind);
+  BZLA_RELEASE_STACK(visit);
+  BZLA_RELEASE_STACK(conjuncts);
+
+  return num_groups < gslv->num_workers ? num_groups : gslv->num_workers;
+}
+
+/* Check the negation of the instantiated formula 'g' with the workers if 'g'
+ * can be split into independent parts. If the parts of some workers are
+ * violated, their counter examples are combined and the universal vars of
+ * the forall solver are fixed accordingly when checking 'g'. Returns false
+ * if 'g' can not be split. */
+static bool
+check_parallel(BzlaGroundSolvers *gslv, BzlaNode *g, BzlaSolverResult *res)
+{
+  uint32_t i, j, num_parts;
+  BzlaNode *part, *tmp, *var_fs, *var, *c, *eq;
+  BzlaQuantWorker *w;
+  BzlaIntHashTable *owner;
+  BzlaHashTableData *d;
+  BzlaNodeMap *map;
+  BzlaNodeMapIterator it;
+  const BzlaBitVector *bv;
+  BzlaSolverResult r;
+  Bzla *forall;
+
+  forall    = gslv->forall;
+  owner     = bzla_hashint_map_new(forall->mm);
+  num_parts = split_formula(gslv, g, owner);
+  if (num_parts < 2)
+  {
+    bzla_hashint_map_delete(owner);
+    return false;
+  }
+
+  for (i = 0; i < num_parts; i++)
+  {
+    w = &gslv->workers[i];
+    assert(!BZLA_EMPTY_STACK(w->conjuncts));
+    part = bzla_node_copy(forall, BZLA_PEEK_STACK(w->conjuncts, 0));
+    for (j = 1; j < BZLA_COUNT_STACK(w->conjuncts); j++)
+    {
+      tmp = bzla_exp_bv_and(forall, part, BZLA_PEEK_STACK(w->conjuncts, j));
+      bzla_node_release(forall, part);
+      part = tmp;
+    }
+    BZLA_RESET_STACK(w->conjuncts);
+
+    map = bzla_nodemap_new(forall);
+    bzla_iter_nodemap_init(&it, w->uvars);
+    while (bzla_iter_nodemap_has_next(&it))
+    {
+      var = it.it.bucket->data.as_ptr;
+      bzla_nodemap_map(map, bzla_iter_nodemap_next(&it), var);
+    }
+    tmp = bzla_clone_recursively_rebuild_exp(
+        forall, w->bzla, part, map, bzla_opt_get(w->bzla, BZLA_OPT_RW_LEVEL));
+    bzla_assume_exp(w->bzla, bzla_node_invert(tmp));
+    bzla_node_release(w->bzla, tmp);
+    bzla_nodemap_delete(map);
+    bzla_node_release(forall, part);
+  }
+
+  for (i = 0; i < num_parts; i++)
+  {
+    w = &gslv->workers[i];
+    pthread_create(&w->thread, 0, worker_check, w);
+  }
+  for (i = 0; i < num_parts; i++)
+  {
+    pthread_join(gslv->workers[i].thread, 0);
+  }
+  gslv->statistics.stats.parallel_checks++;
+  gslv->statistics.stats.parallel_parts += num_parts;
+
+  r = BZLA_RESULT_UNSAT;
+  for (i = 0; i < num_parts; i++)
+  {
+    w = &gslv->workers[i];
+    if (w->result == BZLA_RESULT_SAT)
+    {
+      r = BZLA_RESULT_SAT;
+      w->bzla->slv->api.generate_model(w->bzla->slv, false, false);
+    }
+    else if (w->result == BZLA_RESULT_UNKNOWN && r == BZLA_RESULT_UNSAT)
+    {
+      r = BZLA_RESULT_UNKNOWN;
+    }
+  }
+
+  /* all parts hold, or the workers were terminated */
+  if (r != BZLA_RESULT_SAT)
+  {
+    bzla_hashint_map_delete(owner);
+    *res = r;
+    return true;
+  }
+
+  /* fix universal vars to the counter examples of the violated parts */
+  bzla_iter_nodemap_init(&it, gslv->forall_uvars);
+  while (bzla_iter_nodemap_has_next(&it))
+  {
+    var_fs = it.it.bucket->data.as_ptr;
+    (void) bzla_iter_nodemap_next(&it);
+    d = bzla_hashint_map_get(owner, var_fs->id);
+    if (!d) continue;
+    w = &gslv->workers[d->as_int];
+    if (w->result != BZLA_RESULT_SAT) continue;
+    var = bzla_nodemap_mapped(w->uvars, var_fs);
+    bv  = bzla_model_get_bv(w->bzla, bzla_simplify_exp(w->bzla, var));
+    c   = bzla_exp_bv_const(forall, (BzlaBitVector *) bv);
+    eq  = bzla_exp_eq(forall, var_fs, c);
+    bzla_assume_exp(forall, eq);
+    bzla_node_release(forall, eq);
+    bzla_node_release(forall, c);
+  }
+  bzla_hashint_map_delete(owner);
+
+  bzla_assume_exp(forall, bzla_node_invert(g));
+  r = bzla_check_sat(forall, -1, -1);
+  if (r == BZLA_RESULT_UNSAT)
+  {
+    /* the counter examples of the parts are not consistent, e.g., if the
+     * parts share skolem constants */
+    bzla_assume_exp(forall, bzla_node_invert(g));
+    r = bzla_check_sat(forall, -1, -1);
+  }
+  *res = r;
+  return true;
+}
+#endif
+
 static BzlaSolverResult
 find_model(BzlaGroundSolvers *gslv, bool skip_exists)
 {
@@ -2277,6 +2745,11 @@ find_model(BzlaGroundSolvers *gslv, bool skip_exists)
     gslv->forall_synth_model = synth_model;
     gslv->statistics.time.synth += time_stamp() - start;
   }
+  else
+  {
+    /* check model synthesized in a previous call first (incremental) */
+    synth_model = gslv->forall_synth_model;
+  }
 
   start = time_stamp();
   if (evar_map)
@@ -2299,11 +2772,15 @@ find_model(BzlaGroundSolvers *gslv, bool skip_exists)
     goto DONE;
   }
 
-  bzla_assume_exp(gslv->forall, bzla_node_invert(g));
-
   /* query forall solver */
   start = time_stamp();
-  r     = bzla_check_sat(gslv->forall, -1, -1);
+#ifdef BZLA_HAVE_PTHREADS
+  if (!gslv->workers || !check_parallel(gslv, g, &r))
+#endif
+  {
+    bzla_assume_exp(gslv->forall, bzla_node_invert(g));
+    r = bzla_check_sat(gslv->forall, -1, -1);
+  }
   update_formula(gslv);
   assert(!bzla_node_is_proxy(gslv->forall_formula));
   gslv->statistics.time.f_solver += time_stamp() - start;
@@ -2401,6 +2878,12 @@ run_parallel(BzlaGroundSolvers *gslv, BzlaGroundSolvers *dgslv)
   pthread_join(thread_orig, 0);
   pthread_join(thread_dual, 0);
 
+  /* ground solvers are kept for subsequent calls in incremental mode */
+  bzla_set_term(gslv->forall, 0, 0);
+  bzla_set_term(gslv->exists, 0, 0);
+  bzla_set_term(dgslv->forall, 0, 0);
+  bzla_set_term(dgslv->exists, 0, 0);
+
   if (gslv->result != BZLA_RESULT_UNKNOWN)
   {
     res = gslv->result;
@@ -2454,6 +2937,117 @@ simplify(Bzla *bzla, BzlaNode *g)
   return g;
 }
 
+static int32_t
+compare_roots(const void *p, const void *q)
+{
+  return bzla_node_compare_by_id(*(BzlaNode **) p, *(BzlaNode **) q);
+}
+
+static void
+add_root(Bzla *bzla,
+         BzlaNodePtrStack *roots,
+         BzlaIntHashTable *cache,
+         BzlaNode *root)
+{
+  if (bzla_hashint_table_contains(cache, bzla_node_get_id(root))) return;
+  bzla_hashint_table_add(cache, bzla_node_get_id(root));
+  BZLA_ABORT(bzla_node_real_addr(root)->lambda_below
+                 || bzla_node_real_addr(root)->apply_below,
+             "quantifiers with functions not supported yet");
+  BZLA_PUSH_STACK(*roots, bzla_node_copy(bzla, root));
+}
+
+/* Collect the asserted and assumed formulas of the current call, sorted by id.
+ * Asserted formulas are removed from the constraint tables and kept by the
+ * solver since they are permanent. In incremental mode, assertions of context
+ * levels > 0 are assumptions. */
+static void
+collect_roots(BzlaQuantSolver *slv, BzlaNodePtrStack *roots)
+{
+  uint32_t i;
+  BzlaNode *cur;
+  BzlaPtrHashTableIterator it;
+  BzlaIntHashTable *cache;
+  Bzla *bzla;
+
+  bzla = slv->bzla;
+  assert(bzla->synthesized_constraints->count == 0);
+  assert(bzla->embedded_constraints->count == 0);
+  assert(bzla->varsubst_constraints->count == 0);
+
+  bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    cur = bzla_iter_hashptr_next(&it);
+    BZLA_PUSH_STACK(slv->roots, cur);
+    bzla_node_real_addr(cur)->constraint = 0;
+    bzla_hashptr_table_remove(bzla->unsynthesized_constraints, cur, 0, 0);
+  }
+
+  cache = bzla_hashint_table_new(bzla->mm);
+  for (i = 0; i < BZLA_COUNT_STACK(slv->roots); i++)
+  {
+    cur = bzla_node_get_simplified(bzla, BZLA_PEEK_STACK(slv->roots, i));
+    add_root(bzla, roots, cache, cur);
+  }
+  bzla_iter_hashptr_init(&it, bzla->assumptions);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    cur = bzla_simplify_exp(bzla, bzla_iter_hashptr_next(&it));
+    add_root(bzla, roots, cache, cur);
+  }
+  bzla_hashint_table_delete(cache);
+  qsort(roots->start,
+        BZLA_COUNT_STACK(*roots),
+        sizeof(BzlaNode *),
+        compare_roots);
+}
+
+/* Returns true if all formulas in 'roots0' occur in 'roots1'. */
+static bool
+is_subset_roots(BzlaNodePtrStack *roots0, BzlaNodePtrStack *roots1)
+{
+  uint32_t i, j;
+  BzlaNode *cur;
+
+  for (i = 0, j = 0; i < BZLA_COUNT_STACK(*roots0); i++, j++)
+  {
+    cur = BZLA_PEEK_STACK(*roots0, i);
+    while (j < BZLA_COUNT_STACK(*roots1)
+           && bzla_node_compare_by_id(BZLA_PEEK_STACK(*roots1, j), cur) < 0)
+    {
+      j++;
+    }
+    if (j == BZLA_COUNT_STACK(*roots1) || BZLA_PEEK_STACK(*roots1, j) != cur)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static BzlaQuantFrame *
+new_frame(BzlaQuantSolver *slv, BzlaNodePtrStack *roots)
+{
+  BzlaQuantFrame *frame;
+  BzlaNode *g;
+  Bzla *bzla;
+
+  bzla = slv->bzla;
+  BZLA_CNEW(bzla->mm, frame);
+  frame->roots  = *roots;
+  frame->result = BZLA_RESULT_UNKNOWN;
+
+  /* make sure that all quantifiers occur in the correct phase */
+  g = bzla_normalize_quantifiers_roots(
+      bzla, roots->start, BZLA_COUNT_STACK(*roots));
+  g = simplify(bzla, g);
+
+  frame->gslv = setup_solvers(slv, g, false, "forall", "exists");
+  bzla_node_release(bzla, g);
+  return frame;
+}
+
 static BzlaSolverResult
 sat_quant_solver(BzlaQuantSolver *slv)
 {
@@ -2464,29 +3058,72 @@ sat_quant_solver(BzlaQuantSolver *slv)
 
   bool skip_exists = true;
   BzlaSolverResult res;
-  BzlaNode *g;
+  BzlaNodePtrStack roots;
+  BzlaQuantFrame *frame;
+  Bzla *bzla;
 
-  BZLA_ABORT(bzla_opt_get(slv->bzla, BZLA_OPT_INCREMENTAL),
-             "incremental mode not supported for BV");
+  bzla = slv->bzla;
+  BZLA_INIT_STACK(bzla->mm, roots);
+  collect_roots(slv, &roots);
 
-  /* make sure that all quantifiers occur in the correct phase */
-  g = bzla_normalize_quantifiers(slv->bzla);
-  g = simplify(slv->bzla, g);
+  /* Delete the ground solvers of previous calls on formulas that are not
+   * asserted or assumed anymore (popped context levels, assumptions). The
+   * refinements of the remaining frames are implied by the current formula. */
+  while (!BZLA_EMPTY_STACK(slv->frames)
+         && !is_subset_roots(&BZLA_TOP_STACK(slv->frames)->roots, &roots))
+  {
+    delete_frame(slv, BZLA_POP_STACK(slv->frames));
+  }
+
+  frame = BZLA_EMPTY_STACK(slv->frames) ? 0 : BZLA_TOP_STACK(slv->frames);
+  if (frame
+      && (frame->result == BZLA_RESULT_UNSAT
+          || BZLA_COUNT_STACK(frame->roots) == BZLA_COUNT_STACK(roots)))
+  {
+    /* Either a subset of the current formula is unsatisfiable or the formula
+     * did not change since the last call. */
+    while (!BZLA_EMPTY_STACK(roots))
+    {
+      bzla_node_release(bzla, BZLA_POP_STACK(roots));
+    }
+    BZLA_RELEASE_STACK(roots);
+    BZLA_MSG(bzla->msg,
+             1,
+             "reuse ground solvers of previous call on %u formulas",
+             BZLA_COUNT_STACK(frame->roots));
+  }
+  else
+  {
+    frame = new_frame(slv, &roots);
+    BZLA_PUSH_STACK(slv->frames, frame);
+  }
+  slv->gslv  = frame->gslv;
+  slv->dgslv = frame->dgslv;
 
-  slv->gslv = setup_solvers(slv, g, false, "forall", "exists");
-  bzla_node_release(slv->bzla, g);
+  if (frame->result != BZLA_RESULT_UNKNOWN)
+  {
+    res = frame->result;
+    goto DONE;
+  }
 
 #ifdef BZLA_HAVE_PTHREADS
   bool opt_dual_solver;
-  opt_dual_solver = bzla_opt_get(slv->bzla, BZLA_OPT_QUANT_DUAL_SOLVER) == 1;
+  opt_dual_solver = bzla_opt_get(bzla, BZLA_OPT_QUANT_DUAL_SOLVER) == 1;
 
   /* disable dual solver if UFs are present in the formula */
   if (slv->gslv->exists_ufs->table->count > 0) opt_dual_solver = false;
 
   if (opt_dual_solver)
   {
-    slv->dgslv = setup_solvers(
-        slv, slv->gslv->forall_formula, true, "dual_forall", "dual_exists");
+    if (!frame->dgslv)
+    {
+      frame->dgslv = setup_solvers(slv,
+                                   slv->gslv->forall_formula,
+                                   true,
+                                   "dual_forall",
+                                   "dual_exists");
+      slv->dgslv   = frame->dgslv;
+    }
     res = run_parallel(slv->gslv, slv->dgslv);
   }
   else
@@ -2500,7 +3137,9 @@ sat_quant_solver(BzlaQuantSolver *slv)
     }
     slv->gslv->result = res;
   }
-  slv->bzla->last_sat_result = res;
+  frame->result = res;
+DONE:
+  bzla->last_sat_result = res;
   return res;
 }
 
@@ -2523,6 +3162,35 @@ generate_model_quant_solver(BzlaQuantSolver *slv,
   // TODO (ma): not supported for now (needs more general model infrastructure)
 }
 
+static void
+print_inst_stats(Bzla *bzla, BzlaGroundSolvers *gslv, const char *prefix)
+{
+  double time;
+
+  time = gslv->statistics.time.refine + gslv->statistics.time.qinst;
+  BZLA_MSG(bzla->msg,
+           1,
+           "cegqi %sinstantiations: %u (%.1f/s)",
+           prefix,
+           gslv->statistics.stats.instantiations,
+           time > 0 ? gslv->statistics.stats.instantiations / time : 0);
+  BZLA_MSG(bzla->msg,
+           1,
+           "cegqi %sduplicate instantiations skipped: %u",
+           prefix,
+           gslv->statistics.stats.duplicate_instantiations);
+  if (gslv->statistics.stats.parallel_checks)
+  {
+    BZLA_MSG(bzla->msg,
+             1,
+             "cegqi %sparallel checks: %u (%.1f parts on average)",
+             prefix,
+             gslv->statistics.stats.parallel_checks,
+             (double) gslv->statistics.stats.parallel_parts
+                 / gslv->statistics.stats.parallel_checks);
+  }
+}
+
 static void
 print_stats_quant_solver(BzlaQuantSolver *slv)
 {
@@ -2541,6 +3209,7 @@ print_stats_quant_solver(BzlaQuantSolver *slv)
            1,
            "cegqi solver failed refinements: %u",
            slv->gslv->statistics.stats.failed_refinements);
+  print_inst_stats(slv->bzla, slv->gslv, "");
   if (slv->gslv->result == BZLA_RESULT_SAT
       || slv->gslv->result == BZLA_RESULT_UNKNOWN)
   {
@@ -2571,6 +3240,7 @@ print_stats_quant_solver(BzlaQuantSolver *slv)
              1,
              "cegqi dual solver failed refinements: %u",
              slv->dgslv->statistics.stats.failed_refinements);
+    print_inst_stats(slv->bzla, slv->dgslv, "dual ");
     if (slv->dgslv->result == BZLA_RESULT_SAT
         || slv->dgslv->result == BZLA_RESULT_UNKNOWN)
     {
@@ -2719,6 +3389,9 @@ bzla_new_quantifier_solver(Bzla *bzla)
       (BzlaSolverPrintTimeStats) print_time_stats_quant_solver;
   slv->api.print_model = (BzlaSolverPrintModel) print_model_quant_solver;
 
+  BZLA_INIT_STACK(bzla->mm, slv->roots);
+  BZLA_INIT_STACK(bzla->mm, slv->frames);
+
   BZLA_MSG(bzla->msg, 1, "enabled quant engine");
 
   return (BzlaSolver *) slv;
@@ -1361,6 +1361,8 @@ clone_sls_solver(Bzla *clone, BzlaSLSSolver *slv, BzlaNodeMap *exp_map)
   res->roots = bzla_hashint_map_clone(clone->mm, slv->roots, 0, 0);
   res->score =
       bzla_hashint_map_clone(clone->mm, slv->score, bzla_clone_data_as_dbl, 0);
+  res->domains = bzla_hashint_map_clone(
+      clone->mm, slv->domains, bzla_clone_data_as_bvdomain_ptr, 0);
 
   BZLA_INIT_STACK(clone->mm, res->moves);
   assert(BZLA_SIZE_STACK(slv->moves) || !BZLA_COUNT_STACK(slv->moves));
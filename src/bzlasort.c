@@ -16,6 +16,7 @@
 
 #include "bzlacore.h"
 #include "bzlanode.h"
+#include "bzlapipeline.h"
 #include "utils/bzlaabort.h"
 #include "utils/bzlautil.h"
 
@@ -383,7 +384,17 @@ create_sort(Bzla *bzla, BzlaSortUniqueTable *table, BzlaSort *pattern)
   }
   assert(res->kind);
   res->id = BZLA_COUNT_STACK(table->id2sort);
-  BZLA_PUSH_STACK(table->id2sort, res);
+  /* sorts are looked up while bit-blasting in the background */
+  if (BZLA_FULL_STACK(table->id2sort))
+  {
+    bzla_pipeline_lock(bzla);
+    BZLA_PUSH_STACK(table->id2sort, res);
+    bzla_pipeline_unlock(bzla);
+  }
+  else
+  {
+    BZLA_PUSH_STACK(table->id2sort, res);
+  }
   assert(BZLA_COUNT_STACK(table->id2sort) == res->id + 1);
   assert(BZLA_PEEK_STACK(table->id2sort, res->id) == res);
 
@@ -0,0 +1,371 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include "bzlatermstore.h"
+
+#include <assert.h>
+#include <stdbool.h>
+
+#ifdef BZLA_HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+#include "utils/bzlaabort.h"
+#include "utils/bzlamem.h"
+
+/*------------------------------------------------------------------------*/
+
+#define BZLA_TERM_STORE_MIN_SIZE 16
+
+struct BzlaTermStoreEntry
+{
+  BzlaBitVector *bv; /* 0 if entry is empty */
+  uint32_t hash;
+  uint32_t refs;
+};
+
+typedef struct BzlaTermStoreEntry BzlaTermStoreEntry;
+
+struct BzlaTermStore
+{
+  BzlaMemMgr *mm;
+  uint32_t refs;
+  /* Stored bit-vectors, open addressing with linear probing. Entries are
+   * removed by shifting back subsequent entries, no tombstones are needed.
+   * Updating a value thus never allocates if the old value is not shared. */
+  BzlaTermStoreEntry *entries;
+  uint32_t size; /* power of two or 0 */
+  uint32_t count;
+  uint64_t hits;
+  uint64_t misses;
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_mutex_t lock;
+#endif
+};
+
+/*------------------------------------------------------------------------*/
+
+static void
+lock(BzlaTermStore *store)
+{
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_mutex_lock(&store->lock);
+#else
+  (void) store;
+#endif
+}
+
+static void
+unlock(BzlaTermStore *store)
+{
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_mutex_unlock(&store->lock);
+#else
+  (void) store;
+#endif
+}
+
+/* Get position of the entry equal to 'bv', or of the empty entry where 'bv'
+ * has to be inserted. */
+static uint32_t
+find_pos(BzlaTermStore *store, const BzlaBitVector *bv, uint32_t hash)
+{
+  assert(store->size > store->count);
+
+  uint32_t pos, mask;
+  BzlaTermStoreEntry *e;
+
+  mask = store->size - 1;
+  for (pos = hash & mask;; pos = (pos + 1) & mask)
+  {
+    e = store->entries + pos;
+    if (!e->bv) break;
+    if (e->hash == hash && bzla_bv_compare(e->bv, bv) == 0) break;
+  }
+  return pos;
+}
+
+/* Get position of the entry that holds stored bit-vector 'bv'. */
+static uint32_t
+find_stored_pos(BzlaTermStore *store, const BzlaBitVector *bv)
+{
+  uint32_t pos;
+
+  pos = find_pos(store, bv, bzla_bv_hash(bv));
+  assert(store->entries[pos].bv == bv);
+  return pos;
+}
+
+static void
+enlarge(BzlaTermStore *store)
+{
+  uint32_t i, pos, size, mask;
+  BzlaTermStoreEntry *entries;
+
+  size = store->size ? 2 * store->size : BZLA_TERM_STORE_MIN_SIZE;
+  mask = size - 1;
+  BZLA_CNEWN(store->mm, entries, size);
+  for (i = 0; i < store->size; i++)
+  {
+    if (!store->entries[i].bv) continue;
+    pos = store->entries[i].hash & mask;
+    while (entries[pos].bv) pos = (pos + 1) & mask;
+    entries[pos] = store->entries[i];
+  }
+  BZLA_DELETEN(store->mm, store->entries, store->size);
+  store->entries = entries;
+  store->size    = size;
+}
+
+/* Insert 'bv', which is not stored yet, with reference count 1. */
+static void
+insert(BzlaTermStore *store, BzlaBitVector *bv, uint32_t hash)
+{
+  uint32_t pos;
+
+  if (2 * (store->count + 1) > store->size) enlarge(store);
+  pos = find_pos(store, bv, hash);
+  assert(!store->entries[pos].bv);
+  store->entries[pos].bv   = bv;
+  store->entries[pos].hash = hash;
+  store->entries[pos].refs = 1;
+  store->count += 1;
+}
+
+/* Remove entry at 'pos' and shift back subsequent entries of the same
+ * cluster that would otherwise not be found anymore. */
+static void
+remove_pos(BzlaTermStore *store, uint32_t pos)
+{
+  uint32_t i, j, k, mask;
+
+  mask                   = store->size - 1;
+  store->entries[pos].bv = 0;
+  store->count -= 1;
+  for (i = pos, j = (pos + 1) & mask; store->entries[j].bv;
+       j = (j + 1) & mask)
+  {
+    k = store->entries[j].hash & mask;
+    /* entry at 'j' may stay if its home position 'k' lies cyclically in
+     * (i, j] */
+    if (i <= j ? (i < k && k <= j) : (i < k || k <= j)) continue;
+    store->entries[i]    = store->entries[j];
+    store->entries[j].bv = 0;
+    i                    = j;
+  }
+}
+
+/* Decrement the reference count of the entry at 'pos', delete the stored
+ * bit-vector if it is not referenced anymore. */
+static void
+release_pos(BzlaTermStore *store, uint32_t pos)
+{
+  BzlaBitVector *bv;
+
+  assert(store->entries[pos].refs > 0);
+  if (--store->entries[pos].refs > 0) return;
+  bv = store->entries[pos].bv;
+  remove_pos(store, pos);
+  bzla_bv_free(store->mm, bv);
+}
+
+/* Lookup 'bv' and increment its reference count. If 'bv' is not stored yet
+ * and 'owned' is true, 'bv' is added to the store, else a copy of 'bv'.
+ * If 'bv' is owned and already stored, it is freed. */
+static BzlaBitVector *
+get_bv(BzlaTermStore *store, BzlaBitVector *bv, bool owned)
+{
+  uint32_t pos, hash;
+
+  hash = bzla_bv_hash(bv);
+  if (store->size)
+  {
+    pos = find_pos(store, bv, hash);
+    if (store->entries[pos].bv)
+    {
+      store->hits += 1;
+      store->entries[pos].refs += 1;
+      if (owned) bzla_bv_free(store->mm, bv);
+      return store->entries[pos].bv;
+    }
+  }
+  store->misses += 1;
+  if (!owned) bv = bzla_bv_copy(store->mm, bv);
+  insert(store, bv, hash);
+  return bv;
+}
+
+/*------------------------------------------------------------------------*/
+
+BzlaTermStore *
+bzla_term_store_new(void)
+{
+  BzlaMemMgr *mm;
+  BzlaTermStore *res;
+
+  mm = bzla_mem_mgr_new();
+  BZLA_CNEW(mm, res);
+  res->mm   = mm;
+  res->refs = 1;
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_mutex_init(&res->lock, 0);
+#endif
+  return res;
+}
+
+BzlaTermStore *
+bzla_term_store_copy(BzlaTermStore *store)
+{
+  assert(store);
+
+  lock(store);
+  assert(store->refs > 0);
+  store->refs += 1;
+  unlock(store);
+  return store;
+}
+
+void
+bzla_term_store_delete(BzlaTermStore *store)
+{
+  assert(store);
+
+  BzlaMemMgr *mm;
+  uint32_t refs;
+
+  lock(store);
+  assert(store->refs > 0);
+  refs = --store->refs;
+  unlock(store);
+  if (refs > 0) return;
+
+  BZLA_ABORT(store->count > 0,
+             "term store deleted with %u bit-vectors still in use",
+             store->count);
+  mm = store->mm;
+  BZLA_DELETEN(mm, store->entries, store->size);
+#ifdef BZLA_HAVE_PTHREADS
+  pthread_mutex_destroy(&store->lock);
+#endif
+  BZLA_DELETE(mm, store);
+  bzla_mem_mgr_delete(mm);
+}
+
+BzlaBitVector *
+bzla_term_store_get_bv(BzlaTermStore *store, const BzlaBitVector *bv)
+{
+  assert(store);
+  assert(bv);
+
+  BzlaBitVector *res;
+
+  lock(store);
+  res = get_bv(store, (BzlaBitVector *) bv, false);
+  unlock(store);
+  return res;
+}
+
+BzlaBitVector *
+bzla_term_store_get_not_bv(BzlaTermStore *store, const BzlaBitVector *bv)
+{
+  assert(store);
+  assert(bv);
+
+  BzlaBitVector *res;
+
+  lock(store);
+  res = get_bv(store, bzla_bv_not(store->mm, bv), true);
+  unlock(store);
+  return res;
+}
+
+BzlaBitVector *
+bzla_term_store_update_bv(BzlaTermStore *store,
+                          BzlaBitVector *old,
+                          const BzlaBitVector *bv)
+{
+  assert(store);
+  assert(old);
+  assert(bv);
+  assert(bzla_bv_get_width(old) == bzla_bv_get_width(bv));
+
+  uint32_t pos, old_pos, hash;
+  BzlaBitVector *res;
+
+  /* stored bit-vectors are immutable, 'old' can be read without lock */
+  if (bzla_bv_compare(old, bv) == 0) return old;
+
+  lock(store);
+  old_pos = find_stored_pos(store, old);
+  hash    = bzla_bv_hash(bv);
+  pos     = find_pos(store, bv, hash);
+  if (store->entries[pos].bv)
+  {
+    store->hits += 1;
+    store->entries[pos].refs += 1;
+    res = store->entries[pos].bv;
+    release_pos(store, old_pos);
+  }
+  else if (store->entries[old_pos].refs == 1)
+  {
+    store->misses += 1;
+    remove_pos(store, old_pos);
+    bzla_bv_set(old, bv);
+    insert(store, old, hash);
+    res = old;
+  }
+  else
+  {
+    store->misses += 1;
+    store->entries[old_pos].refs -= 1;
+    res = bzla_bv_copy(store->mm, bv);
+    insert(store, res, hash);
+  }
+  unlock(store);
+  return res;
+}
+
+void
+bzla_term_store_release_bv(BzlaTermStore *store, BzlaBitVector *bv)
+{
+  assert(store);
+  assert(bv);
+
+  lock(store);
+  release_pos(store, find_stored_pos(store, bv));
+  unlock(store);
+}
+
+void
+bzla_term_store_get_stats(BzlaTermStore *store, BzlaTermStoreStats *stats)
+{
+  assert(store);
+  assert(stats);
+
+  uint32_t i;
+  BzlaTermStoreEntry *e;
+
+  lock(store);
+  stats->bvs    = store->count;
+  stats->hits   = store->hits;
+  stats->misses = store->misses;
+  stats->refs   = 0;
+  stats->bytes  = store->mm->allocated;
+  stats->saved  = 0;
+  stats->allocs = store->mm->num_allocs;
+  for (i = 0; i < store->size; i++)
+  {
+    e = store->entries + i;
+    if (!e->bv) continue;
+    stats->refs += e->refs;
+    stats->saved += (e->refs - 1) * bzla_bv_size(e->bv);
+  }
+  unlock(store);
+}
@@ -0,0 +1,84 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#ifndef BZLATERMSTORE_H_INCLUDED
+#define BZLATERMSTORE_H_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bzlabv.h"
+
+/*------------------------------------------------------------------------*/
+
+/* A term store holds hash-consed, immutable term payloads (the values of
+ * bit-vector constants and model values) with reference counting. Every
+ * solver instance owns a term store, which can be replaced by a store that
+ * is shared between independent solver instances. The store is reference
+ * counted, every attached instance holds one reference. All functions are
+ * thread-safe, i.e., instances that share a store may be used concurrently
+ * from different threads.
+ *
+ * Note: Nodes themselves are not shared, they embed solver specific data
+ *       (parent lists, AIG vectors, simplification proxies) and are still
+ *       created per instance. */
+typedef struct BzlaTermStore BzlaTermStore;
+
+struct BzlaTermStoreStats
+{
+  uint64_t bvs;    /* Number of distinct bit-vectors in the store. */
+  uint64_t hits;   /* Number of lookups that returned a stored bit-vector. */
+  uint64_t misses; /* Number of lookups that added a new bit-vector. */
+  uint64_t refs;   /* Number of references to stored bit-vectors. */
+  size_t bytes;    /* Number of bytes allocated by the store. */
+  size_t saved;    /* Number of bytes (see bzla_bv_size) saved by sharing. */
+  uint64_t allocs; /* Number of allocations by the store. */
+};
+
+typedef struct BzlaTermStoreStats BzlaTermStoreStats;
+
+/*------------------------------------------------------------------------*/
+
+/* Create new term store with reference count 1. */
+BzlaTermStore *bzla_term_store_new(void);
+
+/* Increment the reference count of given term store. */
+BzlaTermStore *bzla_term_store_copy(BzlaTermStore *store);
+
+/* Decrement the reference count of given term store, delete if zero.
+ * All bit-vectors must have been released before the store is deleted. */
+void bzla_term_store_delete(BzlaTermStore *store);
+
+/* Get the unique stored bit-vector equal to 'bv' and increment its reference
+ * count. The returned bit-vector is owned by the store and must not be
+ * modified or freed, use bzla_term_store_release_bv to release it. */
+BzlaBitVector *bzla_term_store_get_bv(BzlaTermStore *store,
+                                      const BzlaBitVector *bv);
+
+/* Get the unique stored bit-vector equal to the bit-wise negation of 'bv' and
+ * increment its reference count. */
+BzlaBitVector *bzla_term_store_get_not_bv(BzlaTermStore *store,
+                                          const BzlaBitVector *bv);
+
+/* Replace stored bit-vector 'old' by the stored bit-vector equal to 'bv'.
+ * Releases 'old' and returns a referenced bit-vector. If 'old' is not
+ * referenced elsewhere, its memory is reused for the new value. Both
+ * bit-vectors must have the same width. */
+BzlaBitVector *bzla_term_store_update_bv(BzlaTermStore *store,
+                                         BzlaBitVector *old,
+                                         const BzlaBitVector *bv);
+
+/* Release a bit-vector previously obtained from the store. */
+void bzla_term_store_release_bv(BzlaTermStore *store, BzlaBitVector *bv);
+
+/* Get statistics of given term store. */
+void bzla_term_store_get_stats(BzlaTermStore *store, BzlaTermStoreStats *stats);
+
+#endif
@@ -0,0 +1,79 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#ifndef BZLATRACE_H_INCLUDED
+#define BZLATRACE_H_INCLUDED
+
+/*------------------------------------------------------------------------*/
+
+/* Static tracepoints (USDT) for profiling hot solver phases.
+ *
+ * Enabled with -DTRACING=ON (or configure.sh --tracing), which requires
+ * <sys/sdt.h> (systemtap-sdt-dev). Every probe site compiles to a single nop
+ * and only records its arguments while a tracer (perf, bpftrace, systemtap)
+ * is attached. Without TRACING, all probes expand to nothing.
+ *
+ * All probes live in provider 'bitwuzla' and come in <phase>_start and
+ * <phase>_done pairs (see contrib/bzlatrace2folded.py):
+ *
+ *   simplify_start    (num nodes)
+ *   simplify_done     (num nodes, num rounds)
+ *   pp_<pass>_start   (num nodes)
+ *   pp_<pass>_done    (num nodes)
+ *   rewrite_start     (num nodes)
+ *   rewrite_done      (num nodes)
+ *   beta_start        (mode, node id)
+ *   beta_done         (mode, result id)
+ *   synth_start       (node id, num CNF clauses)
+ *   synth_done        (num visited nodes, num CNF clauses)
+ *   sat_start         (num CNF vars, num CNF clauses)
+ *   sat_done          (result, num CNF clauses)
+ *   lemmas_start      (refinement iteration)
+ *   lemmas_done       (num lemmas)
+ */
+
+/*------------------------------------------------------------------------*/
+#ifdef BZLA_USE_USDT
+/*------------------------------------------------------------------------*/
+
+#include <sys/sdt.h>
+
+#define BZLA_TRACE(name) DTRACE_PROBE(bitwuzla, name)
+#define BZLA_TRACE1(name, a) DTRACE_PROBE1(bitwuzla, name, a)
+#define BZLA_TRACE2(name, a, b) DTRACE_PROBE2(bitwuzla, name, a, b)
+
+/*------------------------------------------------------------------------*/
+#else
+/*------------------------------------------------------------------------*/
+
+#define BZLA_TRACE(name) \
+  do                     \
+  {                      \
+  } while (0)
+#define BZLA_TRACE1(name, a) \
+  do                         \
+  {                          \
+  } while (0)
+#define BZLA_TRACE2(name, a, b) \
+  do                            \
+  {                             \
+  } while (0)
+
+/*------------------------------------------------------------------------*/
+#endif
+/*------------------------------------------------------------------------*/
+
+/* Preprocessing pass probes, 'pass' is a plain identifier. */
+#define BZLA_TRACE_PP_START(pass, bzla) \
+  BZLA_TRACE1(pp_##pass##_start, (bzla)->nodes_unique_table.num_elements)
+#define BZLA_TRACE_PP_DONE(pass, bzla) \
+  BZLA_TRACE1(pp_##pass##_done, (bzla)->nodes_unique_table.num_elements)
+
+#endif
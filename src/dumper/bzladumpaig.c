@@ -15,27 +15,28 @@
 #include "utils/bzlanodeiter.h"
 #include "utils/bzlautil.h"
 
-static uint32_t
-aiger_encode_aig(BzlaPtrHashTable *table, BzlaAIG *aig)
+/* Returns the AIGER literal of 'aig', 'map' maps AIG ids to AIGER variable
+ * indices. Constants are encoded as 0 (false) and 1 (true) in both. */
+static inline uint32_t
+aiger_encode_aig(const uint32_t *map, BzlaAIG *aig)
 {
-  BzlaPtrHashBucket *b;
-  BzlaAIG *real_aig;
-  uint32_t res;
-
-  if (aig == BZLA_AIG_FALSE) return 0;
-
-  if (aig == BZLA_AIG_TRUE) return 1;
-
-  real_aig = BZLA_REAL_ADDR_AIG(aig);
-
-  b = bzla_hashptr_table_get(table, real_aig);
-  assert(b);
-
-  res = 2 * (uint32_t) b->data.as_int;
+  if (bzla_aig_is_const(aig)) return BZLA_AIG_GET_LIT(aig);
+  return 2 * map[bzla_aig_get_index(aig)] + BZLA_IS_INVERTED_AIG(aig);
+}
 
-  if (BZLA_IS_INVERTED_AIG(aig)) res ^= 1;
+static void
+aiger_put_delta(FILE *file, uint32_t delta)
+{
+  unsigned char ch;
 
-  return res;
+  while (delta & ~0x7f)
+  {
+    ch = (delta & 0x7f) | 0x80;
+    putc(ch, file);
+    delta >>= 7;
+  }
+  ch = delta;
+  putc(ch, file);
 }
 
 void
@@ -195,276 +196,223 @@ bzla_dumpaig_dump(Bzla *bzla, bool is_binary, FILE *output, bool merge_roots)
   BZLA_RELEASE_STACK(nodes);
 }
 
-void
-bzla_dumpaig_dump_seq(BzlaAIGMgr *amgr,
-                      bool is_binary,
-                      FILE *file,
-                      int32_t naigs,
-                      BzlaAIG **aigs,
-                      int32_t nregs,
-                      BzlaAIG **regs,
-                      BzlaAIG **nexts,
-                      BzlaPtrHashTable *backannotation)
+/* Collects the AIG variables and AND gates in the cones of 'roots' into
+ * 'inputs' and 'ands'. AIGs are numbered in the order in which they are
+ * finished by a left-to-right depth-first traversal, i.e., AND gates are
+ * collected after their children. Marks all collected AIGs, AIGs already
+ * marked (e.g. latches) are skipped. */
+static void
+collect_cone(BzlaAIGMgr *amgr,
+             BzlaAIG **roots,
+             int32_t nroots,
+             BzlaUIntStack *inputs,
+             BzlaUIntStack *ands)
 {
-  uint32_t aig_id, left_id, right_id, tmp, delta;
-  BzlaPtrHashTable *table, *latches;
-  BzlaAIG *aig, *left, *right;
-  BzlaPtrHashBucket *p, *b;
-  int32_t M, I, L, O, A, i, l;
-  BzlaAIGPtrStack stack;
-  unsigned char ch;
-  BzlaMemMgr *mm;
-
-  assert(naigs >= 0);
-
-  mm = amgr->bzla->mm;
-
-  table   = bzla_hashptr_table_new(mm, 0, 0);
-  latches = bzla_hashptr_table_new(mm, 0, 0);
+  int32_t i;
+  uint32_t id, cur;
+  BzlaUIntStack visit;
 
-  /* First add latches and inputs to hash tables.
-   */
-  for (i = nregs - 1; i >= 0; i--)
+  BZLA_INIT_STACK(amgr->bzla->mm, visit);
+  for (i = nroots - 1; i >= 0; i--)
   {
-    aig = regs[i];
-    assert(!bzla_aig_is_const(aig));
-    assert(!bzla_hashptr_table_get(latches, aig));
-    bzla_hashptr_table_add(latches, aig);
+    if (bzla_aig_is_const(roots[i])) continue;
+    BZLA_PUSH_STACK(visit, 2 * bzla_aig_get_index(roots[i]));
   }
 
-  BZLA_INIT_STACK(mm, stack);
-  for (i = naigs - 1; i >= 0; i--)
-  {
-    aig = aigs[i];
-    if (!bzla_aig_is_const(aig)) BZLA_PUSH_STACK(stack, aig);
-  }
-  for (i = nregs - 1; i >= 0; i--)
+  /* Entries on the visit stack are ids shifted by one, the lowest bit is set
+   * if all children of the AND gate have been collected. */
+  while (!BZLA_EMPTY_STACK(visit))
   {
-    aig = nexts[i];
-    if (!bzla_aig_is_const(aig)) BZLA_PUSH_STACK(stack, aig);
-  }
-
-  M = 0;
-
-  while (!BZLA_EMPTY_STACK(stack))
-  {
-    aig = BZLA_POP_STACK(stack);
-
-  CONTINUE_WITHOUT_POP:
-
-    assert(!bzla_aig_is_const(aig));
-    aig = BZLA_REAL_ADDR_AIG(aig);
-
-    if (aig->mark) continue;
-
-    aig->mark = 1;
+    cur = BZLA_POP_STACK(visit);
+    id  = cur >> 1;
 
-    if (bzla_aig_is_var(aig))
+    if (cur & 1)
     {
-      if (bzla_hashptr_table_get(latches, aig)) continue;
-
-      p              = bzla_hashptr_table_add(table, aig);
-      p->data.as_int = ++M;
-      assert(M > 0);
+      BZLA_PUSH_STACK(*ands, id);
+      continue;
     }
-    else
-    {
-      assert(bzla_aig_is_and(aig));
-
-      right = bzla_aig_get_right_child(amgr, aig);
-      BZLA_PUSH_STACK(stack, right);
 
-      aig = bzla_aig_get_left_child(amgr, aig);
-      goto CONTINUE_WITHOUT_POP;
-    }
-  }
+    if (amgr->mark[id]) continue;
+    amgr->mark[id] = 1;
 
-  for (i = 0; i < nregs; i++)
-  {
-    aig = regs[i];
-    assert(!bzla_aig_is_const(aig));
-    assert(bzla_hashptr_table_get(latches, aig));
-    assert(!bzla_hashptr_table_get(table, aig));
-    p              = bzla_hashptr_table_add(table, aig);
-    p->data.as_int = ++M;
-    assert(M > 0);
-  }
-
-  L = nregs;
-  assert(L <= M);
-  I = M - L;
-
-  /* Then start adding AND gates in postfix order.
-   */
-  assert(BZLA_EMPTY_STACK(stack));
-  for (i = nregs - 1; i >= 0; i--)
-  {
-    aig = nexts[i];
-    if (!bzla_aig_is_const(aig)) BZLA_PUSH_STACK(stack, aig);
-  }
-  for (i = naigs - 1; i >= 0; i--)
-  {
-    aig = aigs[i];
-    if (!bzla_aig_is_const(aig)) BZLA_PUSH_STACK(stack, aig);
-  }
-
-  while (!BZLA_EMPTY_STACK(stack))
-  {
-    aig = BZLA_POP_STACK(stack);
-
-    if (aig)
+    if (!amgr->children[2 * id])
     {
-    CONTINUE_WITH_NON_ZERO_AIG:
-
-      assert(!bzla_aig_is_const(aig));
-      aig = BZLA_REAL_ADDR_AIG(aig);
-
-      if (!aig->mark) continue;
-
-      aig->mark = 0;
-
-      if (bzla_aig_is_var(aig)) continue;
-
-      BZLA_PUSH_STACK(stack, aig);
-      BZLA_PUSH_STACK(stack, 0);
-
-      right = bzla_aig_get_right_child(amgr, aig);
-      BZLA_PUSH_STACK(stack, right);
-
-      aig = bzla_aig_get_left_child(amgr, aig);
-      goto CONTINUE_WITH_NON_ZERO_AIG;
+      BZLA_PUSH_STACK(*inputs, id);
+      continue;
     }
-    else
-    {
-      assert(!BZLA_EMPTY_STACK(stack));
-
-      aig = BZLA_POP_STACK(stack);
-      assert(aig);
-      assert(!aig->mark);
 
-      assert(aig);
-      assert(BZLA_REAL_ADDR_AIG(aig) == aig);
-      assert(bzla_aig_is_and(aig));
-
-      p              = bzla_hashptr_table_add(table, aig);
-      p->data.as_int = ++M;
-      assert(M > 0);
-    }
+    BZLA_PUSH_STACK(visit, 2 * id + 1);
+    if (amgr->children[2 * id + 1] > 1)
+      BZLA_PUSH_STACK(visit,
+                      2 * BZLA_AIG_LIT_GET_ID(amgr->children[2 * id + 1]));
+    if (amgr->children[2 * id] > 1)
+      BZLA_PUSH_STACK(visit, 2 * BZLA_AIG_LIT_GET_ID(amgr->children[2 * id]));
   }
+  BZLA_RELEASE_STACK(visit);
+}
 
-  A = M - I - L;
-
-  BZLA_RELEASE_STACK(stack);
+static void
+dump_seq_aux(BzlaAIGMgr *amgr,
+             bool is_binary,
+             FILE *file,
+             int32_t naigs,
+             BzlaAIG **aigs,
+             int32_t nregs,
+             BzlaAIG **regs,
+             BzlaAIG **nexts,
+             BzlaPtrHashTable *backannotation,
+             BzlaAIGPtrStack *input_aigs)
+{
+  uint32_t id, lhs, rhs0, rhs1, M, I, L, O, A, *map;
+  BzlaUIntStack inputs, ands;
+  BzlaPtrHashBucket *b;
+  BzlaMemMgr *mm;
+  BzlaAIG *aig;
+  size_t j;
+  int32_t i;
 
-  O = naigs;
+  assert(naigs >= 0);
+  assert(nregs >= 0);
 
-  fprintf(file, "a%cg %d %d %d %d %d\n", is_binary ? 'i' : 'a', M, I, L, O, A);
+  mm = amgr->bzla->mm;
 
-  /* Only need to print inputs in non binary mode.
-   */
-  i = 0;
-  for (p = table->first; p; p = p->next)
+  /* AIGER variable indices are stored in a flat array indexed by AIG id.
+   * Latches are marked upfront such that they are not collected as inputs. */
+  BZLA_CNEWN(mm, map, amgr->num_ids);
+  for (i = 0; i < nregs; i++)
   {
-    aig = p->key;
+    assert(!bzla_aig_is_const(regs[i]));
+    assert(bzla_aig_is_var(amgr, regs[i]));
+    assert(!amgr->mark[bzla_aig_get_index(regs[i])]);
+    amgr->mark[bzla_aig_get_index(regs[i])] = 1;
+  }
 
-    assert(aig);
-    assert(!BZLA_IS_INVERTED_AIG(aig));
+  BZLA_INIT_STACK(mm, inputs);
+  BZLA_INIT_STACK(mm, ands);
+  collect_cone(amgr, aigs, naigs, &inputs, &ands);
+  collect_cone(amgr, nexts, nregs, &inputs, &ands);
 
-    if (!bzla_aig_is_var(aig)) break;
+  I = BZLA_COUNT_STACK(inputs);
+  L = nregs;
+  O = naigs;
+  A = BZLA_COUNT_STACK(ands);
+  M = I + L + A;
 
-    if (bzla_hashptr_table_get(latches, aig)) continue;
+  /* Inputs first, then latches, then AND gates in the order in which they
+   * were collected, which is topological. */
+  for (j = 0; j < I; j++) map[BZLA_PEEK_STACK(inputs, j)] = j + 1;
+  for (i = 0; i < nregs; i++) map[bzla_aig_get_index(regs[i])] = I + i + 1;
+  for (j = 0; j < A; j++) map[BZLA_PEEK_STACK(ands, j)] = I + L + j + 1;
 
-    if (!is_binary) fprintf(file, "%d\n", 2 * p->data.as_int);
+  fprintf(file, "a%cg %u %u %u %u %u\n", is_binary ? 'i' : 'a', M, I, L, O, A);
 
-    i++;
+  /* Only need to print inputs in non binary mode. */
+  if (!is_binary)
+  {
+    for (j = 0; j < I; j++) fprintf(file, "%u\n", 2 * ((uint32_t) j + 1));
   }
 
-  /* Now the latches aka regs.
-   */
+  /* Now the latches aka regs. */
   for (i = 0; i < nregs; i++)
   {
-    if (!is_binary) fprintf(file, "%u ", aiger_encode_aig(table, regs[i]));
-
-    fprintf(file, "%u\n", aiger_encode_aig(table, nexts[i]));
+    if (!is_binary) fprintf(file, "%u ", aiger_encode_aig(map, regs[i]));
+    fprintf(file, "%u\n", aiger_encode_aig(map, nexts[i]));
   }
 
-  /* Then the outputs ...
-   */
+  /* Then the outputs ... */
   for (i = 0; i < naigs; i++)
-    fprintf(file, "%u\n", aiger_encode_aig(table, aigs[i]));
+    fprintf(file, "%u\n", aiger_encode_aig(map, aigs[i]));
 
-  /* And finally all the AND gates.
-   */
-  while (p)
+  /* And finally all the AND gates, streamed directly from the AIG store. */
+  for (j = 0; j < A; j++)
   {
-    aig = p->key;
-
-    assert(aig);
-    assert(!BZLA_IS_INVERTED_AIG(aig));
-    assert(bzla_aig_is_and(aig));
+    id   = BZLA_PEEK_STACK(ands, j);
+    lhs  = 2 * map[id];
+    rhs0 = aiger_encode_aig(map, BZLA_AIG_FROM_LIT(amgr->children[2 * id]));
+    rhs1 = aiger_encode_aig(map, BZLA_AIG_FROM_LIT(amgr->children[2 * id + 1]));
 
-    left  = bzla_aig_get_left_child(amgr, aig);
-    right = bzla_aig_get_right_child(amgr, aig);
+    if (rhs0 < rhs1) BZLA_SWAP(uint32_t, rhs0, rhs1);
 
-    aig_id   = 2 * (uint32_t) p->data.as_int;
-    left_id  = aiger_encode_aig(table, left);
-    right_id = aiger_encode_aig(table, right);
-
-    if (left_id < right_id) BZLA_SWAP(int32_t, left_id, right_id);
-
-    assert(aig_id > left_id);
-    assert(left_id >= right_id); /* strict ? */
+    assert(lhs > rhs0);
+    assert(rhs0 >= rhs1);
 
     if (is_binary)
     {
-      for (i = 0; i < 2; i++)
-      {
-        delta = i ? left_id - right_id : aig_id - left_id;
-        tmp   = delta;
-
-        while (tmp & ~0x7f)
-        {
-          ch = tmp & 0x7f;
-          ch |= 0x80;
-
-          putc(ch, file);
-          tmp >>= 7;
-        }
-
-        ch = tmp;
-        putc(ch, file);
-      }
+      aiger_put_delta(file, lhs - rhs0);
+      aiger_put_delta(file, rhs0 - rhs1);
     }
     else
-      fprintf(file, "%u %u %u\n", aig_id, left_id, right_id);
-
-    p = p->next;
+      fprintf(file, "%u %u %u\n", lhs, rhs0, rhs1);
   }
 
-  /* If we have back annotation add a symbol table.
-   */
-  i = l = 0;
+  /* If we have back annotation add a symbol table. */
   if (backannotation)
   {
-    for (p = table->first; p; p = p->next)
+    for (j = 0; j < I; j++)
     {
-      aig = p->key;
-      if (!bzla_aig_is_var(aig)) break;
-
-      b = bzla_hashptr_table_get(backannotation, aig);
-
+      aig = BZLA_AIG_FROM_LIT(2 * BZLA_PEEK_STACK(inputs, j));
+      b   = bzla_hashptr_table_get(backannotation, aig);
       if (!b) continue;
-
-      assert(b->key == aig);
       assert(b->data.as_str);
-      //	  assert (p->data.as_int == i + l + 1);
-      if (bzla_hashptr_table_get(latches, aig))
-        fprintf(file, "l%d %s\n", l++, b->data.as_str);
-      else
-        fprintf(file, "i%d %s\n", i++, b->data.as_str);
+      fprintf(file, "i%zu %s\n", j, b->data.as_str);
+    }
+    for (i = 0; i < nregs; i++)
+    {
+      b = bzla_hashptr_table_get(backannotation, BZLA_REAL_ADDR_AIG(regs[i]));
+      if (!b) continue;
+      assert(b->data.as_str);
+      fprintf(file, "l%d %s\n", i, b->data.as_str);
     }
   }
 
-  bzla_hashptr_table_delete(table);
-  bzla_hashptr_table_delete(latches);
+  if (input_aigs)
+  {
+    for (j = 0; j < I; j++)
+      BZLA_PUSH_STACK(*input_aigs,
+                      BZLA_AIG_FROM_LIT(2 * BZLA_PEEK_STACK(inputs, j)));
+  }
+
+  /* Reset marks. */
+  for (j = 0; j < I; j++) amgr->mark[BZLA_PEEK_STACK(inputs, j)] = 0;
+  for (j = 0; j < A; j++) amgr->mark[BZLA_PEEK_STACK(ands, j)] = 0;
+  for (i = 0; i < nregs; i++) amgr->mark[bzla_aig_get_index(regs[i])] = 0;
+
+  BZLA_RELEASE_STACK(inputs);
+  BZLA_RELEASE_STACK(ands);
+  BZLA_DELETEN(mm, map, amgr->num_ids);
+}
+
+void
+bzla_dumpaig_dump_seq(BzlaAIGMgr *amgr,
+                      bool is_binary,
+                      FILE *file,
+                      int32_t naigs,
+                      BzlaAIG **aigs,
+                      int32_t nregs,
+                      BzlaAIG **regs,
+                      BzlaAIG **nexts,
+                      BzlaPtrHashTable *backannotation)
+{
+  dump_seq_aux(amgr,
+               is_binary,
+               file,
+               naigs,
+               aigs,
+               nregs,
+               regs,
+               nexts,
+               backannotation,
+               0);
+}
+
+void
+bzla_dumpaig_dump_roots(BzlaAIGMgr *amgr,
+                        bool is_binary,
+                        FILE *file,
+                        int32_t naigs,
+                        BzlaAIG **aigs,
+                        BzlaAIGPtrStack *inputs)
+{
+  assert(inputs);
+  dump_seq_aux(amgr, is_binary, file, naigs, aigs, 0, 0, 0, 0, inputs);
 }
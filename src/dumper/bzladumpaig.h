@@ -34,6 +34,15 @@ void bzla_dumpaig_dump_seq(BzlaAIGMgr* amgr,
                            BzlaAIG** nexts,
                            BzlaPtrHashTable* back_annotation);
 
+/* Dumps combinational AIGER model with outputs 'aigs' to file and pushes the
+ * AIG variables in the order of the AIGER inputs onto 'inputs'. */
+void bzla_dumpaig_dump_roots(BzlaAIGMgr* amgr,
+                             bool is_binary,
+                             FILE* output,
+                             int32_t naigs,
+                             BzlaAIG** aigs,
+                             BzlaAIGPtrStack* inputs);
+
 /* Dumps AIGs in AIGER format to file. */
 void bzla_dumpaig_dump(Bzla* bzla,
                        bool is_binary,
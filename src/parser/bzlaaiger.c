@@ -0,0 +1,311 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include "parser/bzlaaiger.h"
+
+#include <ctype.h>
+
+#include "bzlacore.h"
+#include "utils/bzlastack.h"
+
+/*------------------------------------------------------------------------*/
+
+enum BzlaAIGERVarKind
+{
+  BZLA_AIGER_VAR_UNDEF = 0,
+  BZLA_AIGER_VAR_AND,
+  BZLA_AIGER_VAR_VISITING,
+  BZLA_AIGER_VAR_DONE,
+};
+
+typedef enum BzlaAIGERVarKind BzlaAIGERVarKind;
+
+typedef struct BzlaAIGERReader
+{
+  BzlaAIGMgr *amgr;
+  FILE *file;
+  uint32_t maxvar;
+  uint32_t *children; /* 2 child literals per AND gate variable */
+  uint8_t *kind;      /* BzlaAIGERVarKind per variable */
+  BzlaAIG **aigs;     /* constructed AIG per variable */
+} BzlaAIGERReader;
+
+/*------------------------------------------------------------------------*/
+
+static const char *
+read_uint(BzlaAIGERReader *reader, uint32_t *res, int32_t delim)
+{
+  int32_t ch;
+  uint64_t val;
+
+  ch = getc(reader->file);
+  if (!isdigit(ch)) return "expected unsigned integer";
+  val = ch - '0';
+  while (isdigit(ch = getc(reader->file)))
+  {
+    val = 10 * val + (ch - '0');
+    if (val > UINT32_MAX) return "unsigned integer too large";
+  }
+  if (ch != delim) return delim == ' ' ? "expected space" : "expected new line";
+  *res = (uint32_t) val;
+  return 0;
+}
+
+static const char *
+read_lit(BzlaAIGERReader *reader, uint32_t *res, int32_t delim)
+{
+  const char *err;
+
+  if ((err = read_uint(reader, res, delim))) return err;
+  if ((*res >> 1) > reader->maxvar) return "literal exceeds maximum variable";
+  return 0;
+}
+
+static const char *
+read_delta(BzlaAIGERReader *reader, uint32_t *res)
+{
+  int32_t ch;
+  uint32_t val, shift;
+
+  val   = 0;
+  shift = 0;
+  do
+  {
+    ch = getc(reader->file);
+    if (ch == EOF) return "unexpected end of file in AND gate section";
+    if (shift > 28 || (shift == 28 && (ch & 0x70)))
+      return "invalid binary delta encoding";
+    val |= (uint32_t)(ch & 0x7f) << shift;
+    shift += 7;
+  } while (ch & 0x80);
+  *res = val;
+  return 0;
+}
+
+static const char *
+define_and(BzlaAIGERReader *reader, uint32_t lhs, uint32_t rhs0, uint32_t rhs1)
+{
+  uint32_t var = lhs >> 1;
+
+  if (lhs & 1) return "AND gate with negated left-hand side";
+  if (!var || var > reader->maxvar)
+    return "invalid left-hand side of AND gate";
+  if (reader->kind[var] != BZLA_AIGER_VAR_UNDEF)
+    return "variable defined twice";
+  reader->kind[var]             = BZLA_AIGER_VAR_AND;
+  reader->children[2 * var]     = rhs0;
+  reader->children[2 * var + 1] = rhs1;
+  return 0;
+}
+
+static BzlaAIG *
+lit2aig(BzlaAIGERReader *reader, uint32_t lit)
+{
+  BzlaAIG *res = reader->aigs[lit >> 1];
+  assert(reader->kind[lit >> 1] == BZLA_AIGER_VAR_DONE);
+  return (lit & 1) ? BZLA_INVERT_AIG(res) : res;
+}
+
+/* Constructs the AIG of literal 'lit', children are constructed first by an
+ * iterative depth-first traversal. */
+static const char *
+build_lit(BzlaAIGERReader *reader, BzlaUIntStack *stack, uint32_t lit)
+{
+  uint32_t var, l, r;
+
+  assert(BZLA_EMPTY_STACK(*stack));
+
+  BZLA_PUSH_STACK(*stack, lit >> 1);
+  while (!BZLA_EMPTY_STACK(*stack))
+  {
+    var = BZLA_TOP_STACK(*stack);
+    switch (reader->kind[var])
+    {
+      case BZLA_AIGER_VAR_DONE: BZLA_POP_STACK(*stack); break;
+
+      case BZLA_AIGER_VAR_AND:
+        reader->kind[var] = BZLA_AIGER_VAR_VISITING;
+        l                 = reader->children[2 * var] >> 1;
+        r                 = reader->children[2 * var + 1] >> 1;
+        if (reader->kind[l] != BZLA_AIGER_VAR_DONE)
+          BZLA_PUSH_STACK(*stack, l);
+        if (reader->kind[r] != BZLA_AIGER_VAR_DONE)
+          BZLA_PUSH_STACK(*stack, r);
+        break;
+
+      case BZLA_AIGER_VAR_VISITING:
+        l = reader->children[2 * var] >> 1;
+        r = reader->children[2 * var + 1] >> 1;
+        if (reader->kind[l] != BZLA_AIGER_VAR_DONE
+            || reader->kind[r] != BZLA_AIGER_VAR_DONE)
+        {
+          BZLA_RESET_STACK(*stack);
+          return "cyclic AND gate definition";
+        }
+        reader->aigs[var] =
+            bzla_aig_and(reader->amgr,
+                         lit2aig(reader, reader->children[2 * var]),
+                         lit2aig(reader, reader->children[2 * var + 1]));
+        reader->kind[var] = BZLA_AIGER_VAR_DONE;
+        BZLA_POP_STACK(*stack);
+        break;
+
+      default:
+        assert(reader->kind[var] == BZLA_AIGER_VAR_UNDEF);
+        BZLA_RESET_STACK(*stack);
+        return "undefined literal";
+    }
+  }
+  return 0;
+}
+
+/*------------------------------------------------------------------------*/
+
+const char *
+bzla_aiger_import(BzlaAIGMgr *amgr,
+                  FILE *file,
+                  uint32_t ninputs,
+                  BzlaAIG **inputs,
+                  BzlaAIGPtrStack *outputs)
+{
+  assert(amgr);
+  assert(file);
+  assert(!ninputs || inputs);
+  assert(outputs);
+
+  BzlaAIGERReader reader;
+  BzlaUIntStack out_lits, stack;
+  BzlaAIGPtrStack res;
+  BzlaMemMgr *mm;
+  const char *err;
+  bool is_binary;
+  uint32_t M, I, L, O, A, i, lit, lhs, rhs0, rhs1, delta;
+  int32_t ch;
+
+  mm  = amgr->bzla->mm;
+  err = 0;
+
+  BZLA_CLR(&reader);
+  reader.amgr = amgr;
+  reader.file = file;
+
+  if (getc(file) != 'a') return "invalid header";
+  ch = getc(file);
+  if (ch != 'a' && ch != 'i') return "invalid header";
+  is_binary = ch == 'i';
+  if (getc(file) != 'g' || getc(file) != ' ') return "invalid header";
+
+  reader.maxvar = UINT32_MAX >> 1;
+  if ((err = read_uint(&reader, &M, ' ')) || (err = read_uint(&reader, &I, ' '))
+      || (err = read_uint(&reader, &L, ' '))
+      || (err = read_uint(&reader, &O, ' '))
+      || (err = read_uint(&reader, &A, '\n')))
+    return err;
+
+  if (L) return "latches are not supported";
+  if (I != ninputs) return "unexpected number of inputs";
+  if (M < I || M - I < A || (is_binary && M != I + A))
+    return "invalid maximum variable index";
+
+  reader.maxvar = M;
+  BZLA_CNEWN(mm, reader.children, 2 * ((size_t) M + 1));
+  BZLA_CNEWN(mm, reader.kind, (size_t) M + 1);
+  BZLA_CNEWN(mm, reader.aigs, (size_t) M + 1);
+  BZLA_INIT_STACK(mm, out_lits);
+  BZLA_INIT_STACK(mm, stack);
+  BZLA_INIT_STACK(mm, res);
+
+  /* variable 0 is constant false */
+  reader.kind[0] = BZLA_AIGER_VAR_DONE;
+  reader.aigs[0] = BZLA_AIG_FALSE;
+
+  for (i = 0; i < I; i++)
+  {
+    lit = 2 * (i + 1);
+    if (!is_binary)
+    {
+      if ((err = read_lit(&reader, &lit, '\n'))) goto DONE;
+      if ((lit & 1) || lit < 2)
+      {
+        err = "invalid input literal";
+        goto DONE;
+      }
+      if (reader.kind[lit >> 1] != BZLA_AIGER_VAR_UNDEF)
+      {
+        err = "variable defined twice";
+        goto DONE;
+      }
+    }
+    reader.kind[lit >> 1] = BZLA_AIGER_VAR_DONE;
+    reader.aigs[lit >> 1] = bzla_aig_copy(amgr, inputs[i]);
+  }
+
+  for (i = 0; i < O; i++)
+  {
+    if ((err = read_lit(&reader, &lit, '\n'))) goto DONE;
+    BZLA_PUSH_STACK(out_lits, lit);
+  }
+
+  for (i = 0; i < A; i++)
+  {
+    if (is_binary)
+    {
+      lhs = 2 * (I + i + 1);
+      if ((err = read_delta(&reader, &delta))) goto DONE;
+      if (!delta || delta > lhs)
+      {
+        err = "invalid binary delta encoding";
+        goto DONE;
+      }
+      rhs0 = lhs - delta;
+      if ((err = read_delta(&reader, &delta))) goto DONE;
+      if (delta > rhs0)
+      {
+        err = "invalid binary delta encoding";
+        goto DONE;
+      }
+      rhs1 = rhs0 - delta;
+    }
+    else if ((err = read_lit(&reader, &lhs, ' '))
+             || (err = read_lit(&reader, &rhs0, ' '))
+             || (err = read_lit(&reader, &rhs1, '\n')))
+    {
+      goto DONE;
+    }
+    if ((err = define_and(&reader, lhs, rhs0, rhs1))) goto DONE;
+  }
+
+  /* Symbol table and comments are ignored. */
+
+  for (i = 0; i < O; i++)
+  {
+    lit = BZLA_PEEK_STACK(out_lits, i);
+    if ((err = build_lit(&reader, &stack, lit))) goto DONE;
+    BZLA_PUSH_STACK(res, bzla_aig_copy(amgr, lit2aig(&reader, lit)));
+  }
+
+  for (i = 0; i < O; i++) BZLA_PUSH_STACK(*outputs, BZLA_PEEK_STACK(res, i));
+  BZLA_RESET_STACK(res);
+
+DONE:
+  while (!BZLA_EMPTY_STACK(res)) bzla_aig_release(amgr, BZLA_POP_STACK(res));
+  for (i = 1; i <= M; i++)
+  {
+    if (reader.kind[i] == BZLA_AIGER_VAR_DONE)
+      bzla_aig_release(amgr, reader.aigs[i]);
+  }
+  BZLA_RELEASE_STACK(res);
+  BZLA_RELEASE_STACK(stack);
+  BZLA_RELEASE_STACK(out_lits);
+  BZLA_DELETEN(mm, reader.aigs, (size_t) M + 1);
+  BZLA_DELETEN(mm, reader.kind, (size_t) M + 1);
+  BZLA_DELETEN(mm, reader.children, 2 * ((size_t) M + 1));
+  return err;
+}
@@ -0,0 +1,30 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#ifndef BZLAAIGER_H_INCLUDED
+#define BZLAAIGER_H_INCLUDED
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "bzlaaig.h"
+
+/* Reads a combinational AIGER model in ascii or binary format from 'file' and
+ * constructs its outputs in 'amgr'. The i-th AIGER input is mapped to
+ * 'inputs[i]', the number of inputs of the model must be 'ninputs'. The
+ * outputs are pushed onto 'outputs' in order (the caller has to release
+ * them). Returns an error message on failure and 0 otherwise. */
+const char* bzla_aiger_import(BzlaAIGMgr* amgr,
+                              FILE* file,
+                              uint32_t ninputs,
+                              BzlaAIG** inputs,
+                              BzlaAIGPtrStack* outputs);
+
+#endif
@@ -63,6 +63,407 @@ perr_btor2(BzlaBTOR2Parser *parser, uint64_t lineno, const char *fmt, ...)
 
 /*------------------------------------------------------------------------*/
 
+/* Get the term for (possibly negated) argument id 'arg' from 'nodemap'. */
+static const BitwuzlaTerm *
+get_arg(BzlaBTOR2Parser *parser, BzlaIntHashTable *nodemap, int64_t arg)
+{
+  const BitwuzlaTerm *res;
+
+  res = bzla_hashint_map_get(nodemap, arg < 0 ? -arg : arg)->as_ptr;
+  assert(res);
+  if (arg < 0)
+  {
+    res = bitwuzla_mk_term1(parser->bitwuzla, BITWUZLA_KIND_BV_NOT, res);
+  }
+  return res;
+}
+
+/* Collect the arguments of 'line' from 'nodemap' in 'e'. */
+static void
+get_args(BzlaBTOR2Parser *parser,
+         BzlaIntHashTable *nodemap,
+         Btor2Line *line,
+         const BitwuzlaTerm *e[])
+{
+  uint32_t i;
+
+  for (i = 0; i < line->nargs; i++)
+  {
+    assert(bzla_hashint_map_contains(
+        nodemap, line->args[i] < 0 ? -line->args[i] : line->args[i]));
+    e[i] = get_arg(parser, nodemap, line->args[i]);
+  }
+}
+
+/* Create the term of a combinational line 'line' with arguments 'e' and sort
+ * 'sort'. Returns 0 if an error occurred. */
+static const BitwuzlaTerm *
+mk_term(BzlaBTOR2Parser *parser,
+        Btor2Line *line,
+        const BitwuzlaTerm *e[],
+        const BitwuzlaSort *sort)
+{
+  BzlaMemMgr *mm;
+  Bitwuzla *bitwuzla;
+  const BitwuzlaTerm *term;
+
+  mm       = parser->mm;
+  bitwuzla = parser->bitwuzla;
+  term     = 0;
+
+  switch (line->tag)
+  {
+    case BTOR2_TAG_add:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_ADD, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_and:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_AND, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_concat:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_CONCAT, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_const:
+      assert(line->nargs == 0);
+      assert(line->constant);
+      if (!bzla_util_check_bin_to_bv(
+              mm, line->constant, line->sort.bitvec.width))
+      {
+        perr_btor2(parser,
+                   line->id,
+                   "invalid 'const' %sort of bw %u",
+                   line->constant,
+                   line->sort.bitvec.width);
+        return 0;
+      }
+      term = bitwuzla_mk_bv_value(
+          bitwuzla, sort, line->constant, BITWUZLA_BV_BASE_BIN);
+      break;
+
+    case BTOR2_TAG_constd:
+      assert(line->nargs == 0);
+      assert(line->constant);
+      if (!bzla_util_check_dec_to_bv(
+              mm, line->constant, line->sort.bitvec.width))
+      {
+        perr_btor2(parser,
+                   line->id,
+                   "invalid 'constd' %sort of bw %u",
+                   line->constant,
+                   line->sort.bitvec.width);
+        return 0;
+      }
+      term = bitwuzla_mk_bv_value(
+          bitwuzla, sort, line->constant, BITWUZLA_BV_BASE_DEC);
+      break;
+
+    case BTOR2_TAG_consth:
+      assert(line->nargs == 0);
+      assert(line->constant);
+      if (!bzla_util_check_hex_to_bv(
+              mm, line->constant, line->sort.bitvec.width))
+      {
+        perr_btor2(parser,
+                   line->id,
+                   "invalid 'consth' %sort of bw %u",
+                   line->constant,
+                   line->sort.bitvec.width);
+        return 0;
+      }
+      term = bitwuzla_mk_bv_value(
+          bitwuzla, sort, line->constant, BITWUZLA_BV_BASE_HEX);
+      break;
+
+    case BTOR2_TAG_dec:
+      assert(line->nargs == 1);
+      term = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_DEC, e[0]);
+      break;
+
+    case BTOR2_TAG_eq:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_EQUAL, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_iff:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_IFF, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_implies:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_IMPLIES, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_inc:
+      assert(line->nargs == 1);
+      term = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_INC, e[0]);
+      break;
+
+    case BTOR2_TAG_ite:
+      assert(line->nargs == 3);
+      term = bitwuzla_mk_term3(bitwuzla, BITWUZLA_KIND_ITE, e[0], e[1], e[2]);
+      break;
+
+    case BTOR2_TAG_mul:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_MUL, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_nand:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_NAND, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_neq:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_DISTINCT, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_neg:
+      assert(line->nargs == 1);
+      term = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_NEG, e[0]);
+      break;
+
+    case BTOR2_TAG_nor:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_NOR, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_not:
+      assert(line->nargs == 1);
+      term = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_NOT, e[0]);
+      break;
+
+    case BTOR2_TAG_one:
+      assert(line->nargs == 0);
+      term = bitwuzla_mk_bv_one(bitwuzla, sort);
+      break;
+
+    case BTOR2_TAG_ones:
+      assert(line->nargs == 0);
+      term = bitwuzla_mk_bv_ones(bitwuzla, sort);
+      break;
+
+    case BTOR2_TAG_or:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_OR, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_read:
+      assert(line->nargs == 2);
+      term =
+          bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_ARRAY_SELECT, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_redand:
+      assert(line->nargs == 1);
+      term = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_REDAND, e[0]);
+      break;
+
+    case BTOR2_TAG_redor:
+      assert(line->nargs == 1);
+      term = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_REDOR, e[0]);
+      break;
+
+    case BTOR2_TAG_redxor:
+      assert(line->nargs == 1);
+      term = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_REDXOR, e[0]);
+      break;
+
+    case BTOR2_TAG_rol:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_ROL, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_ror:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_ROR, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_saddo:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(
+          bitwuzla, BITWUZLA_KIND_BV_SADD_OVERFLOW, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_sdiv:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SDIV, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_sdivo:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(
+          bitwuzla, BITWUZLA_KIND_BV_SDIV_OVERFLOW, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_sext:
+      assert(line->nargs == 1);
+      term = bitwuzla_mk_term1_indexed1(
+          bitwuzla, BITWUZLA_KIND_BV_SIGN_EXTEND, e[0], line->args[1]);
+      break;
+
+    case BTOR2_TAG_sgt:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SGT, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_sgte:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SGE, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_slice:
+      assert(line->nargs == 1);
+      term = bitwuzla_mk_term1_indexed2(bitwuzla,
+                                        BITWUZLA_KIND_BV_EXTRACT,
+                                        e[0],
+                                        line->args[1],
+                                        line->args[2]);
+      break;
+
+    case BTOR2_TAG_sll:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SHL, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_slt:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SLT, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_slte:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SLE, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_smod:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SMOD, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_smulo:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(
+          bitwuzla, BITWUZLA_KIND_BV_SMUL_OVERFLOW, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_sra:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_ASHR, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_srem:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SREM, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_srl:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SHR, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_ssubo:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(
+          bitwuzla, BITWUZLA_KIND_BV_SSUB_OVERFLOW, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_sub:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SUB, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_uaddo:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(
+          bitwuzla, BITWUZLA_KIND_BV_UADD_OVERFLOW, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_udiv:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_UDIV, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_uext:
+      assert(line->nargs == 1);
+      term = bitwuzla_mk_term1_indexed1(
+          bitwuzla, BITWUZLA_KIND_BV_ZERO_EXTEND, e[0], line->args[1]);
+      break;
+
+    case BTOR2_TAG_ugt:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_UGT, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_ugte:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_UGE, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_ult:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_ULT, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_ulte:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_ULE, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_umulo:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(
+          bitwuzla, BITWUZLA_KIND_BV_UMUL_OVERFLOW, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_urem:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_UREM, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_usubo:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(
+          bitwuzla, BITWUZLA_KIND_BV_USUB_OVERFLOW, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_write:
+      assert(line->nargs == 3);
+      term = bitwuzla_mk_term3(
+          bitwuzla, BITWUZLA_KIND_ARRAY_STORE, e[0], e[1], e[2]);
+      break;
+
+    case BTOR2_TAG_xnor:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_XNOR, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_xor:
+      assert(line->nargs == 2);
+      term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_XOR, e[0], e[1]);
+      break;
+
+    case BTOR2_TAG_zero:
+      assert(line->nargs == 0);
+      term = bitwuzla_mk_bv_zero(bitwuzla, sort);
+      break;
+
+    default:
+      /* Non-combinational lines are handled by the caller. */
+      assert(false);
+  }
+  assert(!sort || bitwuzla_term_get_sort(term) == sort);
+  return term;
+}
+
+/*------------------------------------------------------------------------*/
+
 static BzlaBTOR2Parser *
 new_btor2_parser(Bitwuzla *bitwuzla)
 {
@@ -91,6 +492,338 @@ delete_btor2_parser(BzlaBTOR2Parser *parser)
   bzla_mem_mgr_delete(mm);
 }
 
+/*------------------------------------------------------------------------*/
+/* Bounded model checking and k-induction.                                */
+/*------------------------------------------------------------------------*/
+
+/* A BTOR2 model with model checking extensions (a transition system). */
+struct BzlaBTOR2Model
+{
+  BzlaBTOR2Parser *parser;
+  BzlaIntHashTable *sortmap; /* maps sort ids to sorts */
+  BzlaIntHashTable *next;    /* maps state ids to next lines */
+  BzlaVoidPtrStack states;   /* state lines (in order of declaration) */
+  BzlaVoidPtrStack inputs;   /* input lines (in order of declaration) */
+  BzlaVoidPtrStack bads;     /* bad lines (in order of declaration) */
+  /* Unrolled frames, each maps line ids to the terms of the frame. The first
+   * frame of the base case is restricted to the initial states, the first
+   * frame of the induction step is an arbitrary state. */
+  BzlaVoidPtrStack base;
+  BzlaVoidPtrStack step;
+};
+
+typedef struct BzlaBTOR2Model BzlaBTOR2Model;
+
+static void
+init_btor2_model(BzlaBTOR2Model *model,
+                 BzlaBTOR2Parser *parser,
+                 BzlaIntHashTable *sortmap)
+{
+  BzlaMemMgr *mm = parser->mm;
+
+  BZLA_CLR(model);
+  model->parser  = parser;
+  model->sortmap = sortmap;
+  model->next    = bzla_hashint_map_new(mm);
+  BZLA_INIT_STACK(mm, model->states);
+  BZLA_INIT_STACK(mm, model->inputs);
+  BZLA_INIT_STACK(mm, model->bads);
+  BZLA_INIT_STACK(mm, model->base);
+  BZLA_INIT_STACK(mm, model->step);
+}
+
+static void
+delete_frames(BzlaVoidPtrStack *frames)
+{
+  while (!BZLA_EMPTY_STACK(*frames))
+  {
+    bzla_hashint_map_delete(BZLA_POP_STACK(*frames));
+  }
+  BZLA_RELEASE_STACK(*frames);
+}
+
+static void
+delete_btor2_model(BzlaBTOR2Model *model)
+{
+  bzla_hashint_map_delete(model->next);
+  BZLA_RELEASE_STACK(model->states);
+  BZLA_RELEASE_STACK(model->inputs);
+  BZLA_RELEASE_STACK(model->bads);
+  delete_frames(&model->base);
+  delete_frames(&model->step);
+}
+
+/* Unroll the transition relation once, i.e., create the terms of the next
+ * frame in 'frames'. States are defined by the terms of their next functions
+ * in the previous frame (no fresh variables and no equalities are
+ * introduced), terms that do not depend on states or inputs are shared
+ * between frames. Returns 0 if an error occurred. */
+static BzlaIntHashTable *
+unroll(BzlaBTOR2Model *model, BzlaVoidPtrStack *frames, bool is_base)
+{
+  uint32_t k;
+  Btor2LineIterator lit;
+  Btor2Line *line, *next;
+  BzlaIntHashTable *frame, *prev;
+  BzlaHashTableData *d;
+  const BitwuzlaTerm *e[3], *term, *init;
+  const BitwuzlaSort *sort;
+
+  BzlaBTOR2Parser *parser = model->parser;
+  Bitwuzla *bitwuzla      = parser->bitwuzla;
+
+  k     = BZLA_COUNT_STACK(*frames);
+  prev  = k ? BZLA_PEEK_STACK(*frames, k - 1) : 0;
+  frame = bzla_hashint_map_new(parser->mm);
+  BZLA_PUSH_STACK(*frames, frame);
+
+  lit = btor2parser_iter_init(parser->bfr);
+  while ((line = btor2parser_iter_next(&lit)))
+  {
+    if (line->tag == BTOR2_TAG_sort) continue;
+
+    term = 0;
+    sort = 0;
+    if (line->sort.id)
+    {
+      sort = bzla_hashint_map_get(model->sortmap, line->sort.id)->as_ptr;
+    }
+    get_args(parser, frame, line, e);
+
+    switch (line->tag)
+    {
+      case BTOR2_TAG_state:
+        d = bzla_hashint_map_get(model->next, line->id);
+        if (prev && d)
+        {
+          next = d->as_ptr;
+          term = get_arg(parser, prev, next->args[1]);
+        }
+        else
+        {
+          term = bitwuzla_mk_const(bitwuzla, sort, 0);
+        }
+        break;
+
+      case BTOR2_TAG_input:
+        term = bitwuzla_mk_const(bitwuzla, sort, 0);
+        break;
+
+      case BTOR2_TAG_init:
+        if (k == 0 && is_base)
+        {
+          init = e[1];
+          if (bitwuzla_term_is_array(e[0]) && !bitwuzla_term_is_array(init))
+          {
+            init = bitwuzla_mk_const_array(
+                bitwuzla, bitwuzla_term_get_sort(e[0]), init);
+          }
+          bitwuzla_assert(
+              bitwuzla,
+              bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_EQUAL, e[0], init));
+        }
+        break;
+
+      case BTOR2_TAG_constraint: bitwuzla_assert(bitwuzla, e[0]); break;
+
+      case BTOR2_TAG_bad: term = e[0]; break;
+
+      case BTOR2_TAG_next:
+      case BTOR2_TAG_output: break;
+
+      default:
+        term = mk_term(parser, line, e, sort);
+        if (parser->error) return 0;
+    }
+
+    if (term)
+    {
+      bzla_hashint_map_add(frame, line->id)->as_ptr = (BitwuzlaTerm *) term;
+    }
+  }
+  return frame;
+}
+
+/* Get the term of bad property 'i' in frame 'frame'. */
+static const BitwuzlaTerm *
+get_bad(BzlaBTOR2Model *model, BzlaIntHashTable *frame, uint32_t i)
+{
+  Btor2Line *bad = BZLA_PEEK_STACK(model->bads, i);
+  return bzla_hashint_map_get(frame, bad->id)->as_ptr;
+}
+
+static void
+print_witness_values(BzlaBTOR2Model *model,
+                     BzlaVoidPtrStack *lines,
+                     BzlaIntHashTable *frame,
+                     char kind,
+                     uint32_t k,
+                     FILE *outfile)
+{
+  uint32_t i;
+  Btor2Line *line;
+  const BitwuzlaTerm *term;
+
+  Bitwuzla *bitwuzla = model->parser->bitwuzla;
+
+  for (i = 0; i < BZLA_COUNT_STACK(*lines); i++)
+  {
+    line = BZLA_PEEK_STACK(*lines, i);
+    term = bzla_hashint_map_get(frame, line->id)->as_ptr;
+    /* Values of arrays are not supported. */
+    if (bitwuzla_term_is_array(term)) continue;
+    fprintf(outfile, "%u %s", i, bitwuzla_get_bv_value(bitwuzla, term));
+    if (line->symbol) fprintf(outfile, " %s%c%u", line->symbol, kind, k);
+    fputc('\n', outfile);
+  }
+}
+
+/* Print witness for bad property 'bad' reached in frame 'k' in BTOR2 witness
+ * format. The values of states and inputs are only printed if model
+ * generation is enabled. */
+static void
+print_witness(BzlaBTOR2Model *model, uint32_t bad, uint32_t k, FILE *outfile)
+{
+  uint32_t i;
+  BzlaIntHashTable *frame;
+
+  Bitwuzla *bitwuzla = model->parser->bitwuzla;
+
+  fprintf(outfile, "sat\nb%u\n", bad);
+  if (bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_PRODUCE_MODELS))
+  {
+    fputs("#0\n", outfile);
+    frame = BZLA_PEEK_STACK(model->base, 0);
+    print_witness_values(model, &model->states, frame, '#', 0, outfile);
+    for (i = 0; i <= k; i++)
+    {
+      fprintf(outfile, "@%u\n", i);
+      frame = BZLA_PEEK_STACK(model->base, i);
+      print_witness_values(model, &model->inputs, frame, '@', i, outfile);
+    }
+  }
+  fputs(".\n", outfile);
+}
+
+/* Check the induction step for bound 'k', i.e., whether a bad state is
+ * reachable in frame 'k' from an arbitrary state without visiting a bad
+ * state in the frames before. */
+static BitwuzlaResult
+check_step(BzlaBTOR2Model *model, uint32_t k)
+{
+  uint32_t i, j, nbads;
+  BzlaIntHashTable *frame;
+  const BitwuzlaTerm *bad, *any;
+
+  Bitwuzla *bitwuzla = model->parser->bitwuzla;
+
+  nbads = BZLA_COUNT_STACK(model->bads);
+  for (j = 0; j <= k; j++)
+  {
+    frame = BZLA_PEEK_STACK(model->step, j);
+    any   = 0;
+    for (i = 0; i < nbads; i++)
+    {
+      bad = get_bad(model, frame, i);
+      if (j < k)
+      {
+        bitwuzla_assume(bitwuzla,
+                        bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_NOT, bad));
+      }
+      else
+      {
+        any = any ? bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_OR, any, bad)
+                  : bad;
+      }
+    }
+    if (any) bitwuzla_assume(bitwuzla, any);
+  }
+  return bitwuzla_check_sat(bitwuzla);
+}
+
+/* Check the bad properties of given model via bounded model checking up to
+ * bound BITWUZLA_OPT_BMC_KMAX, and optionally prove that they are
+ * unreachable via k-induction. Frames are unrolled incrementally and bad
+ * properties are checked via assumptions, which allows to reuse the
+ * bit-blasted frames and the SAT solver across bounds. */
+static BitwuzlaResult
+check_btor2_model(BzlaBTOR2Model *model, FILE *outfile)
+{
+  uint32_t i, k, kmax, nbads;
+  bool kind;
+  BzlaIntHashTable *frame;
+  BitwuzlaResult res;
+
+  BzlaBTOR2Parser *parser = model->parser;
+  Bitwuzla *bitwuzla      = parser->bitwuzla;
+  BzlaMsg *msg            = bitwuzla_get_bzla_msg(bitwuzla);
+
+  if (!bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_INCREMENTAL))
+  {
+    if (bitwuzla_get_option(bitwuzla,
+                            BITWUZLA_OPT_PP_UNCONSTRAINED_OPTIMIZATION))
+    {
+      perr_btor2(parser,
+                 0,
+                 "model checking requires incremental solving, which is "
+                 "incompatible with unconstrained optimization");
+      return BITWUZLA_UNKNOWN;
+    }
+    bitwuzla_set_option(bitwuzla, BITWUZLA_OPT_INCREMENTAL, 1);
+  }
+
+  kmax  = bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_BMC_KMAX);
+  kind  = bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_BMC_KIND);
+  nbads = BZLA_COUNT_STACK(model->bads);
+  res   = BITWUZLA_UNKNOWN;
+
+  BZLA_MSG(msg,
+           1,
+           "checking %u bad properties up to bound %u%s",
+           nbads,
+           kmax,
+           kind ? " with k-induction" : "");
+
+  for (k = 0; nbads > 0 && k <= kmax; k++)
+  {
+    BZLA_MSG(msg, 1, "checking bound %u", k);
+
+    /* base case */
+    if (!(frame = unroll(model, &model->base, true))) return BITWUZLA_UNKNOWN;
+    for (i = 0; i < nbads; i++)
+    {
+      bitwuzla_assume(bitwuzla, get_bad(model, frame, i));
+      res = bitwuzla_check_sat(bitwuzla);
+      if (res == BITWUZLA_SAT)
+      {
+        BZLA_MSG(msg, 1, "bad property %u reachable at bound %u", i, k);
+        print_witness(model, i, k, outfile);
+        return res;
+      }
+      if (res == BITWUZLA_UNKNOWN) goto DONE;
+    }
+
+    /* induction step */
+    if (kind)
+    {
+      if (!unroll(model, &model->step, false)) return BITWUZLA_UNKNOWN;
+      res = check_step(model, k);
+      if (res == BITWUZLA_UNSAT)
+      {
+        BZLA_MSG(msg, 1, "all bad properties unreachable (k = %u)", k);
+        goto DONE;
+      }
+    }
+    res = BITWUZLA_UNKNOWN;
+  }
+  if (nbads == 0) res = BITWUZLA_UNSAT;
+DONE:
+  fputs(res == BITWUZLA_UNSAT ? "unsat\n" : "unknown\n", outfile);
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
 static const char *
 parse_btor2_parser(BzlaBTOR2Parser *parser,
                    BzlaIntStack *prefix,
@@ -103,20 +836,17 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
   assert(infile);
   assert(infile_name);
   (void) prefix;
-  (void) outfile;
 
-  uint32_t i;
-  int64_t j, signed_arg, unsigned_arg;
+  int64_t j;
   Btor2LineIterator lit;
   Btor2Line *line;
   BzlaIntHashTable *sortmap;
   BzlaIntHashTable *nodemap;
-  BzlaIntHashTableIterator it;
-  const BitwuzlaTerm *e[3], *term, *tmp;
+  const BitwuzlaTerm *e[3], *term;
   const BitwuzlaSort *sort, *sort_index, *sort_elem;
-  BzlaMemMgr *mm;
   BzlaMsg *msg;
-  bool found_arrays, found_lambdas;
+  BzlaBTOR2Model model;
+  bool found_arrays, found_lambdas, is_model;
 
   Bitwuzla *bitwuzla = parser->bitwuzla;
 
@@ -126,10 +856,9 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
 
   BZLA_CLR(res);
 
-  mm = parser->mm;
-
   found_arrays  = false;
   found_lambdas = false;
+  is_model      = false;
 
   nodemap = 0;
   sortmap = 0;
@@ -146,13 +875,28 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
 
   if (!btor2parser_read_lines(parser->bfr, infile))
   {
-    parser->error = bzla_mem_strdup(mm, btor2parser_error(parser->bfr));
+    parser->error = bzla_mem_strdup(parser->mm, btor2parser_error(parser->bfr));
     assert(parser->error);
     goto DONE;
   }
 
-  sortmap = bzla_hashint_map_new(mm);
-  nodemap = bzla_hashint_map_new(mm);
+  /* Inputs with model checking extensions are checked via bounded model
+   * checking after parsing. */
+  lit = btor2parser_iter_init(parser->bfr);
+  while ((line = btor2parser_iter_next(&lit)))
+  {
+    if (line->tag == BTOR2_TAG_bad || line->tag == BTOR2_TAG_fair
+        || line->tag == BTOR2_TAG_init || line->tag == BTOR2_TAG_justice
+        || line->tag == BTOR2_TAG_next || line->tag == BTOR2_TAG_state)
+    {
+      is_model = true;
+      break;
+    }
+  }
+
+  sortmap = bzla_hashint_map_new(parser->mm);
+  nodemap = bzla_hashint_map_new(parser->mm);
+  init_btor2_model(&model, parser, sortmap);
 
   lit = btor2parser_iter_init(parser->bfr);
   while ((line = btor2parser_iter_next(&lit)))
@@ -187,121 +931,48 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
       assert(sort);
     }
 
-    /* arguments -----------------------------------------------------------  */
+    /* model checking extensions -------------------------------------------  */
 
-    for (i = 0; i < line->nargs; i++)
+    if (is_model)
     {
-      signed_arg   = line->args[i];
-      unsigned_arg = signed_arg < 0 ? -signed_arg : signed_arg;
-      assert(bzla_hashint_map_contains(nodemap, unsigned_arg));
-      tmp = bzla_hashint_map_get(nodemap, unsigned_arg)->as_ptr;
-      if (signed_arg < 0)
-      {
-        e[i] = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_NOT, tmp);
-      }
-      else
+      switch (line->tag)
       {
-        e[i] = tmp;
-      }
-      assert(e[i]);
-    }
-
-    switch (line->tag)
-    {
-      case BTOR2_TAG_add:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_ADD, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_and:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_AND, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_concat:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_CONCAT, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_const:
-        assert(line->nargs == 0);
-        assert(line->constant);
-        if (!bzla_util_check_bin_to_bv(
-                mm, line->constant, line->sort.bitvec.width))
-        {
+        case BTOR2_TAG_fair:
+        case BTOR2_TAG_justice:
           perr_btor2(parser,
                      line->id,
-                     "invalid 'const' %sort of bw %u",
-                     line->constant,
-                     line->sort.bitvec.width);
+                     "fairness and justice properties not supported by "
+                     "bitwuzla, try btormc instead");
           goto DONE;
-        }
-        term = bitwuzla_mk_bv_value(
-            bitwuzla, sort, line->constant, BITWUZLA_BV_BASE_BIN);
-        break;
 
-      case BTOR2_TAG_constd:
-        assert(line->nargs == 0);
-        assert(line->constant);
-        if (!bzla_util_check_dec_to_bv(
-                mm, line->constant, line->sort.bitvec.width))
-        {
-          perr_btor2(parser,
-                     line->id,
-                     "invalid 'constd' %sort of bw %u",
-                     line->constant,
-                     line->sort.bitvec.width);
-          goto DONE;
-        }
-        term = bitwuzla_mk_bv_value(
-            bitwuzla, sort, line->constant, BITWUZLA_BV_BASE_DEC);
-        break;
+        case BTOR2_TAG_bad: BZLA_PUSH_STACK(model.bads, line); break;
 
-      case BTOR2_TAG_consth:
-        assert(line->nargs == 0);
-        assert(line->constant);
-        if (!bzla_util_check_hex_to_bv(
-                mm, line->constant, line->sort.bitvec.width))
-        {
-          perr_btor2(parser,
-                     line->id,
-                     "invalid 'consth' %sort of bw %u",
-                     line->constant,
-                     line->sort.bitvec.width);
-          goto DONE;
-        }
-        term = bitwuzla_mk_bv_value(
-            bitwuzla, sort, line->constant, BITWUZLA_BV_BASE_HEX);
-        break;
+        case BTOR2_TAG_input: BZLA_PUSH_STACK(model.inputs, line); break;
 
-      case BTOR2_TAG_constraint:
-        assert(line->nargs == 1);
-        bitwuzla_assert(bitwuzla, e[0]);
-        break;
+        case BTOR2_TAG_next:
+          bzla_hashint_map_add(model.next, line->args[0])->as_ptr = line;
+          break;
 
-      case BTOR2_TAG_dec:
-        assert(line->nargs == 1);
-        term = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_DEC, e[0]);
-        break;
+        case BTOR2_TAG_state:
+          if (bitwuzla_sort_is_array(sort)) found_arrays = true;
+          BZLA_PUSH_STACK(model.states, line);
+          break;
 
-      case BTOR2_TAG_eq:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_EQUAL, e[0], e[1]);
-        break;
+        default: break;
+      }
+      /* Terms are created per frame when unrolling the model. */
+      if (line->tag != BTOR2_TAG_sort) continue;
+    }
 
-      case BTOR2_TAG_iff:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_IFF, e[0], e[1]);
-        break;
+    /* arguments -----------------------------------------------------------  */
 
-      case BTOR2_TAG_implies:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_IMPLIES, e[0], e[1]);
-        break;
+    get_args(parser, nodemap, line, e);
 
-      case BTOR2_TAG_inc:
+    switch (line->tag)
+    {
+      case BTOR2_TAG_constraint:
         assert(line->nargs == 1);
-        term = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_INC, e[0]);
+        bitwuzla_assert(bitwuzla, e[0]);
         break;
 
       case BTOR2_TAG_input:
@@ -314,145 +985,8 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
         bitwuzla_set_bzla_id(bitwuzla, term, line->id);
         break;
 
-      case BTOR2_TAG_ite:
-        assert(line->nargs == 3);
-        term = bitwuzla_mk_term3(bitwuzla, BITWUZLA_KIND_ITE, e[0], e[1], e[2]);
-        break;
-
-      case BTOR2_TAG_mul:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_MUL, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_nand:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_NAND, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_neq:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_DISTINCT, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_neg:
-        assert(line->nargs == 1);
-        term = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_NEG, e[0]);
-        break;
-
-      case BTOR2_TAG_nor:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_NOR, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_not:
-        assert(line->nargs == 1);
-        term = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_NOT, e[0]);
-        break;
-
-      case BTOR2_TAG_one:
-        assert(line->nargs == 0);
-        term = bitwuzla_mk_bv_one(bitwuzla, sort);
-        break;
-
-      case BTOR2_TAG_ones:
-        assert(line->nargs == 0);
-        term = bitwuzla_mk_bv_ones(bitwuzla, sort);
-        break;
-
-      case BTOR2_TAG_or:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_OR, e[0], e[1]);
-        break;
-
       case BTOR2_TAG_output: bitwuzla_add_output(bitwuzla, e[0]); break;
 
-      case BTOR2_TAG_read:
-        assert(line->nargs == 2);
-        term =
-            bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_ARRAY_SELECT, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_redand:
-        assert(line->nargs == 1);
-        term = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_REDAND, e[0]);
-        break;
-
-      case BTOR2_TAG_redor:
-        assert(line->nargs == 1);
-        term = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_REDOR, e[0]);
-        break;
-
-      case BTOR2_TAG_redxor:
-        assert(line->nargs == 1);
-        term = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_REDXOR, e[0]);
-        break;
-
-      case BTOR2_TAG_rol:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_ROL, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_ror:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_ROR, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_saddo:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(
-            bitwuzla, BITWUZLA_KIND_BV_SADD_OVERFLOW, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_sdiv:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SDIV, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_sdivo:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(
-            bitwuzla, BITWUZLA_KIND_BV_SDIV_OVERFLOW, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_sext:
-        assert(line->nargs == 1);
-        term = bitwuzla_mk_term1_indexed1(
-            bitwuzla, BITWUZLA_KIND_BV_SIGN_EXTEND, e[0], line->args[1]);
-        break;
-
-      case BTOR2_TAG_sgt:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SGT, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_sgte:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SGE, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_slice:
-        assert(line->nargs == 1);
-        term = bitwuzla_mk_term1_indexed2(bitwuzla,
-                                          BITWUZLA_KIND_BV_EXTRACT,
-                                          e[0],
-                                          line->args[1],
-                                          line->args[2]);
-        break;
-
-      case BTOR2_TAG_sll:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SHL, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_slt:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SLT, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_slte:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SLE, e[0], e[1]);
-        break;
 
       case BTOR2_TAG_sort:
         if (line->sort.tag == BTOR2_TAG_SORT_bitvec)
@@ -496,127 +1030,10 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
         bzla_hashint_map_add(sortmap, line->id)->as_ptr = (BitwuzlaSort *) sort;
         break;
 
-      case BTOR2_TAG_smod:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SMOD, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_smulo:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(
-            bitwuzla, BITWUZLA_KIND_BV_SMUL_OVERFLOW, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_sra:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_ASHR, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_srem:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SREM, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_srl:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SHR, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_ssubo:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(
-            bitwuzla, BITWUZLA_KIND_BV_SSUB_OVERFLOW, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_sub:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SUB, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_uaddo:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(
-            bitwuzla, BITWUZLA_KIND_BV_UADD_OVERFLOW, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_udiv:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_UDIV, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_uext:
-        assert(line->nargs == 1);
-        term = bitwuzla_mk_term1_indexed1(
-            bitwuzla, BITWUZLA_KIND_BV_ZERO_EXTEND, e[0], line->args[1]);
-        break;
-
-      case BTOR2_TAG_ugt:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_UGT, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_ugte:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_UGE, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_ult:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_ULT, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_ulte:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_ULE, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_umulo:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(
-            bitwuzla, BITWUZLA_KIND_BV_UMUL_OVERFLOW, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_urem:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_UREM, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_usubo:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(
-            bitwuzla, BITWUZLA_KIND_BV_USUB_OVERFLOW, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_write:
-        assert(line->nargs == 3);
-        term = bitwuzla_mk_term3(
-            bitwuzla, BITWUZLA_KIND_ARRAY_STORE, e[0], e[1], e[2]);
-        break;
-
-      case BTOR2_TAG_xnor:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_XNOR, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_xor:
-        assert(line->nargs == 2);
-        term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_XOR, e[0], e[1]);
-        break;
-
-      case BTOR2_TAG_zero:
-        assert(line->nargs == 0);
-        term = bitwuzla_mk_bv_zero(bitwuzla, sort);
-        break;
 
       default:
-        assert(line->tag == BTOR2_TAG_bad || line->tag == BTOR2_TAG_fair
-               || line->tag == BTOR2_TAG_init || line->tag == BTOR2_TAG_justice
-               || line->tag == BTOR2_TAG_next || line->tag == BTOR2_TAG_state);
-        perr_btor2(parser,
-                   line->id,
-                   "model checking extensions not supported by bitwuzla, try "
-                   "btormc instead");
-        goto DONE;
+        term = mk_term(parser, line, e, sort);
+        if (parser->error) goto DONE;
     }
 
     assert(!sort || !term || bitwuzla_term_get_sort(term) == sort);
@@ -626,20 +1043,19 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
       bzla_hashint_map_add(nodemap, line->id)->as_ptr = (BitwuzlaTerm *) term;
     }
   }
+
+  if (is_model)
+  {
+    res->result = check_btor2_model(&model, outfile);
+  }
 DONE:
   if (nodemap)
   {
-    bzla_iter_hashint_init(&it, nodemap);
-    while (bzla_iter_hashint_has_next(&it))
-    {
-      j    = it.cur_pos;
-      term = bzla_iter_hashint_next_data(&it)->as_ptr;
-    }
     bzla_hashint_map_delete(nodemap);
   }
   if (sortmap)
   {
-    bzla_iter_hashint_init(&it, sortmap);
+    delete_btor2_model(&model);
     bzla_hashint_map_delete(sortmap);
   }
   if (res)
@@ -126,11 +126,10 @@ bzla_eliminate_slices_on_bv_vars(Bzla *bzla)
   BZLA_INIT_STACK(mm, vars);
   for (b_var = bzla->bv_vars->first; b_var != NULL; b_var = b_var->next)
   {
+    /* skip variables that have already been split */
     if (b_var->data.flag) continue;
     var = (BzlaNode *) b_var->key;
     BZLA_PUSH_STACK(vars, var);
-    /* mark as processed, required for non-destructive substiution */
-    b_var->data.flag = true;
   }
 
   while (!BZLA_EMPTY_STACK(vars))
@@ -306,8 +305,17 @@ bzla_eliminate_slices_on_bv_vars(Bzla *bzla)
     BZLA_DELETEN(mm, sorted_slices, slices->count);
     bzla_hashptr_table_delete(slices);
 
+    /* Mark as processed, required for non-destructive substitution.
+     * Variables without slices are not marked in order to eliminate slices
+     * on them that are introduced by later assertions (incremental mode). */
+    b_var = bzla_hashptr_table_get(bzla->bv_vars, var);
+    assert(b_var);
+    b_var->data.flag = true;
+
     count++;
     bzla->stats.eliminated_slices++;
+    /* Note: 'result' is a concatenation of fresh variables, hence this is a
+     *       definitional equality which is valid on all context levels. */
     temp = bzla_exp_eq(bzla, var, result);
     bzla_assert_exp(bzla, temp);
     bzla_node_release(bzla, temp);
@@ -669,3 +669,18 @@ bzla_normalize_quantifiers(Bzla *bzla)
   BZLA_RELEASE_STACK(roots);
   return result;
 }
+
+BzlaNode *
+bzla_normalize_quantifiers_roots(Bzla *bzla,
+                                 BzlaNode *roots[],
+                                 uint32_t num_roots)
+{
+  assert(bzla);
+  assert(roots || num_roots == 0);
+
+  if (num_roots == 0)
+  {
+    return bzla_exp_true(bzla);
+  }
+  return normalize_quantifiers(bzla, roots, num_roots);
+}
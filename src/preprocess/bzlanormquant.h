@@ -18,6 +18,12 @@ BzlaNode* bzla_normalize_quantifiers_node(Bzla* bzla, BzlaNode* root);
 
 BzlaNode* bzla_normalize_quantifiers(Bzla* bzla);
 
+/* Normalize the conjunction of 'roots' (which are not removed from the
+ * constraint tables). */
+BzlaNode* bzla_normalize_quantifiers_roots(Bzla* bzla,
+                                           BzlaNode* roots[],
+                                           uint32_t num_roots);
+
 #if 0
 /* negates 'root' and inverts all quantifiers under 'root'. */
 BzlaNode * bzla_invert_quantifiers (Bzla * bzla, BzlaNode * root,
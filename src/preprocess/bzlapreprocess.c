@@ -15,6 +15,7 @@
 #include "bzlaexp.h"
 #include "bzlalog.h"
 #include "bzlasubst.h"
+#include "bzlatrace.h"
 #include "preprocess/bzlaack.h"
 #include "preprocess/bzlader.h"
 #include "preprocess/bzlaelimapplies.h"
@@ -47,6 +48,7 @@ bzla_simplify(Bzla *bzla)
 
   rounds = 0;
   start  = bzla_util_time_stamp();
+  BZLA_TRACE1(simplify_start, bzla->nodes_unique_table.num_elements);
 
   if (bzla->valid_assignments) bzla_reset_incremental_usage(bzla);
 
@@ -78,7 +80,9 @@ bzla_simplify(Bzla *bzla)
     {
       if (bzla_opt_get(bzla, BZLA_OPT_PP_VAR_SUBST))
       {
+        BZLA_TRACE_PP_START(varsubst, bzla);
         bzla_substitute_var_exps(bzla);
+        BZLA_TRACE_PP_DONE(varsubst, bzla);
 
         if (bzla->inconsistent)
         {
@@ -92,7 +96,9 @@ bzla_simplify(Bzla *bzla)
 
       while (bzla->embedded_constraints->count)
       {
+        BZLA_TRACE_PP_START(embed, bzla);
         bzla_process_embedded_constraints(bzla);
+        BZLA_TRACE_PP_DONE(embed, bzla);
 
         if (bzla->inconsistent)
         {
@@ -105,11 +111,14 @@ bzla_simplify(Bzla *bzla)
       if (bzla->varsubst_constraints->count) continue;
     }
 
+    /* Slices are eliminated via definitional equalities over fresh variables,
+     * which are valid on all context levels (incremental mode). */
     if (bzla_opt_get(bzla, BZLA_OPT_PP_ELIMINATE_EXTRACTS)
-        && bzla_opt_get(bzla, BZLA_OPT_RW_LEVEL) > 2
-        && !bzla_opt_get(bzla, BZLA_OPT_INCREMENTAL))
+        && bzla_opt_get(bzla, BZLA_OPT_RW_LEVEL) > 2)
     {
+      BZLA_TRACE_PP_START(elimslices, bzla);
       bzla_eliminate_slices_on_bv_vars(bzla);
+      BZLA_TRACE_PP_DONE(elimslices, bzla);
       if (bzla->inconsistent)
       {
         BZLALOG(1, "formula inconsistent after slice elimination");
@@ -122,13 +131,18 @@ bzla_simplify(Bzla *bzla)
     }
 
 #ifndef BZLA_DO_NOT_PROCESS_SKELETON
+    /* Only considers the permanent (level 0) constraints, assertions on
+     * context levels > 0 are handled as assumptions. The derived top level
+     * literals are thus valid on all context levels (incremental mode). */
     if (bzla_opt_get(bzla, BZLA_OPT_RW_LEVEL) > 2
         && bzla_opt_get(bzla, BZLA_OPT_PP_SKELETON_PREPROC))
     {
       skelrounds++;
       if (skelrounds <= 1)  // TODO only one?
       {
+        BZLA_TRACE_PP_START(skeleton, bzla);
         bzla_process_skeleton(bzla);
+        BZLA_TRACE_PP_DONE(skeleton, bzla);
         if (bzla->inconsistent)
         {
           BZLALOG(1, "formula inconsistent after skeleton preprocessing");
@@ -150,7 +164,9 @@ bzla_simplify(Bzla *bzla)
         && !bzla_opt_get(bzla, BZLA_OPT_INCREMENTAL)
         && !bzla_opt_get(bzla, BZLA_OPT_PRODUCE_MODELS))
     {
+      BZLA_TRACE_PP_START(unconstrained, bzla);
       bzla_optimize_unconstrained(bzla);
+      BZLA_TRACE_PP_DONE(unconstrained, bzla);
       if (bzla->inconsistent)
       {
         BZLALOG(1, "formula inconsistent after skeleton preprocessing");
@@ -163,11 +179,19 @@ bzla_simplify(Bzla *bzla)
 
     if (bzla_opt_get(bzla, BZLA_OPT_RW_LEVEL) > 2
         && bzla_opt_get(bzla, BZLA_OPT_PP_EXTRACT_LAMBDAS))
+    {
+      BZLA_TRACE_PP_START(extract, bzla);
       bzla_extract_lambdas(bzla);
+      BZLA_TRACE_PP_DONE(extract, bzla);
+    }
 
     if (bzla_opt_get(bzla, BZLA_OPT_RW_LEVEL) > 2
         && bzla_opt_get(bzla, BZLA_OPT_PP_MERGE_LAMBDAS))
+    {
+      BZLA_TRACE_PP_START(merge, bzla);
       bzla_merge_lambdas(bzla);
+      BZLA_TRACE_PP_DONE(merge, bzla);
+    }
 
     if (bzla->varsubst_constraints->count || bzla->embedded_constraints->count)
       continue;
@@ -176,30 +200,45 @@ bzla_simplify(Bzla *bzla)
     if (bzla_opt_get(bzla, BZLA_OPT_PP_BETA_REDUCE))
     {
       /* If no UFs or function equalities are present, we eagerly eliminate all
-       * remaining lambdas. */
+       * remaining lambdas. In incremental mode, this is restored when the
+       * current context level is popped. */
       if (bzla->ufs->count == 0 && bzla->feqs->count == 0
-          && !bzla_opt_get(bzla, BZLA_OPT_INCREMENTAL))
+          && bzla_opt_get(bzla, BZLA_OPT_PP_BETA_REDUCE)
+                 != BZLA_BETA_REDUCE_ALL)
       {
         BZLA_MSG(bzla->msg,
                  1,
                  "no UFs or function equalities, enable beta-reduction=all");
-        bzla_opt_set(bzla, BZLA_OPT_PP_BETA_REDUCE, BZLA_BETA_REDUCE_ALL);
+        bzla_set_opt_scoped(
+            bzla, BZLA_OPT_PP_BETA_REDUCE, BZLA_BETA_REDUCE_ALL);
       }
+      BZLA_TRACE_PP_START(elimapplies, bzla);
       bzla_eliminate_applies(bzla);
+      BZLA_TRACE_PP_DONE(elimapplies, bzla);
     }
 
     if (bzla_opt_get(bzla, BZLA_OPT_PP_ELIMINATE_ITES))
     {
+      BZLA_TRACE_PP_START(elimites, bzla);
       bzla_eliminate_ites(bzla);
+      BZLA_TRACE_PP_DONE(elimites, bzla);
     }
 
     /* add ackermann constraints for all uninterpreted functions */
     if (bzla_opt_get(bzla, BZLA_OPT_PP_ACKERMANN))
+    {
+      BZLA_TRACE_PP_START(ackermann, bzla);
       bzla_add_ackermann_constraints(bzla);
+      BZLA_TRACE_PP_DONE(ackermann, bzla);
+    }
 
     if (bzla_opt_get(bzla, BZLA_OPT_RW_LEVEL) > 2
         && bzla_opt_get(bzla, BZLA_OPT_PP_NORMALIZE_ADD))
+    {
+      BZLA_TRACE_PP_START(normadd, bzla);
       bzla_normalize_adds(bzla);
+      BZLA_TRACE_PP_DONE(normadd, bzla);
+    }
 
   } while (bzla->varsubst_constraints->count
            || bzla->embedded_constraints->count);
@@ -207,6 +246,7 @@ bzla_simplify(Bzla *bzla)
 DONE:
   delta = bzla_util_time_stamp() - start;
   bzla->time.simplify += delta;
+  BZLA_TRACE2(simplify_done, bzla->nodes_unique_table.num_elements, rounds);
   BZLA_MSG(bzla->msg, 1, "%u rewriting rounds in %.1f seconds", rounds, delta);
 
   if (bzla->inconsistent)
@@ -14,76 +14,175 @@
 #include "bzladbg.h"
 #include "bzlalog.h"
 #include "bzlasubst.h"
+#include "utils/bzlahashint.h"
 #include "utils/bzlahashptr.h"
+#include "utils/bzlaunionfind.h"
 #include "utils/bzlautil.h"
 
+static bool
+is_subst_leaf(BzlaNode *exp)
+{
+  assert(bzla_node_is_regular(exp));
+  return bzla_node_is_bv_const(exp) || bzla_node_is_var(exp)
+         || bzla_node_is_rm_const(exp) || bzla_node_is_fp_const(exp)
+         || bzla_node_is_param(exp) || bzla_node_is_uf(exp);
+}
+
+static bool
+is_var_subst(BzlaNode *left, BzlaNode *right)
+{
+  assert(bzla_node_is_regular(left));
+  assert(bzla_node_is_var(left) || bzla_node_is_uf(left));
+  (void) left;
+  return bzla_node_is_regular(right)
+         && (bzla_node_is_var(right) || bzla_node_is_uf(right));
+}
+
+static void
+add_subst(Bzla *bzla, BzlaPtrHashTable *substs, BzlaNode *left, BzlaNode *right)
+{
+  assert(!bzla_hashptr_table_get(substs, left));
+  bzla_hashptr_table_add(substs, bzla_node_copy(bzla, left))->data.as_ptr =
+      bzla_node_copy(bzla, right);
+}
+
+/* Merge variables that are substituted by variables into equivalence classes
+ * and substitute each variable of a class with the root of the class, i.e.,
+ * the only variable of the class without a variable substitution. A chain of
+ * substitutions x_n -> ... -> x_2 -> x_1 thus becomes x_i -> x_1 for all
+ * i > 1. Since every variable has at most one substitution, the root is
+ * unique and exactly the substituted variables of the class are substituted.
+ * If a class has no root (cyclic substitutions), its representative is used
+ * instead. Other substitutions are copied as they are. */
+static BzlaPtrHashTable *
+substitute_merge_vars(Bzla *bzla, BzlaPtrHashTable *substs)
+{
+  BzlaPtrHashTable *res;
+  BzlaPtrHashTableIterator it;
+  BzlaPtrHashBucket *b;
+  BzlaUnionFind *ufind;
+  BzlaIntHashTable *roots;
+  BzlaHashTableData *d;
+  BzlaNode *left, *right, *root, *cur;
+  uint32_t i;
+
+  ufind = bzla_ufind_new(bzla->mm);
+  roots = bzla_hashint_map_new(bzla->mm);
+  res   = bzla_hashptr_table_new(bzla->mm,
+                               (BzlaHashPtr) bzla_node_hash_by_id,
+                               (BzlaCmpPtr) bzla_node_compare_by_id);
+
+  bzla_iter_hashptr_init(&it, substs);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    right = it.bucket->data.as_ptr;
+    left  = bzla_iter_hashptr_next(&it);
+    if (is_var_subst(left, right)) bzla_ufind_merge(ufind, left, right);
+  }
+
+  /* map representatives to the roots of their classes */
+  bzla_iter_hashptr_init(&it, substs);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    right = it.bucket->data.as_ptr;
+    left  = bzla_iter_hashptr_next(&it);
+    if (!is_var_subst(left, right)) continue;
+    b = bzla_hashptr_table_get(substs, right);
+    if (b && is_var_subst(right, b->data.as_ptr)) continue;
+    cur = bzla_ufind_get_repr(ufind, right);
+    d   = bzla_hashint_map_get(roots, cur->id);
+    if (!d) d = bzla_hashint_map_add(roots, cur->id);
+    assert(!d->as_ptr || d->as_ptr == right);
+    d->as_ptr = right;
+  }
+
+  /* substitute class members with the root of their class */
+  bzla_iter_hashptr_init(&it, substs);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    right = it.bucket->data.as_ptr;
+    left  = bzla_iter_hashptr_next(&it);
+    if (!is_var_subst(left, right))
+    {
+      add_subst(bzla, res, left, right);
+      continue;
+    }
+    for (i = 0; i < 2; i++)
+    {
+      cur  = i == 0 ? left : right;
+      root = bzla_ufind_get_repr(ufind, cur);
+      d    = bzla_hashint_map_get(roots, root->id);
+      if (d) root = d->as_ptr;
+      if (root != cur && !bzla_hashptr_table_get(res, cur))
+      {
+        add_subst(bzla, res, cur, root);
+      }
+    }
+  }
+
+  bzla_hashint_map_delete(roots);
+  bzla_ufind_delete(ufind);
+  return res;
+}
+
+/* Remove cyclic substitutions. Substituted variables are numbered in
+ * post-order of a DFS over the substitution graph, which follows the children
+ * of terms and the substitutions of variables. A substitution x -> t is kept
+ * if all substituted variables in t have a lower number than x, i.e., the
+ * kept substitutions are topologically ordered and thus acyclic. Both passes
+ * visit every node at most once. */
 static void
 substitute_remove_cycles(Bzla *bzla, BzlaPtrHashTable *substs)
 {
-  BzlaPtrHashTable *order;
-  BzlaNode *cur, *left, *right, *child;
-  BzlaPtrHashBucket *b, *b_temp;
+  BzlaIntHashTable *order, *max;
+  BzlaNode *cur, *left, *right;
+  BzlaPtrHashBucket *b;
   BzlaPtrHashTableIterator it;
-  int32_t order_num, val, max;
+  BzlaHashTableData *d;
+  int32_t order_num, val;
   uint32_t i;
-  BzlaNodePtrStack stack;
+  BzlaNodePtrStack stack, cyclic;
   BzlaMemMgr *mm;
-  BzlaIntHashTable *mark;
-  BzlaHashTableData *d;
 
   mm        = bzla->mm;
   order_num = 1;
-  order     = bzla_hashptr_table_new(mm,
-                                 (BzlaHashPtr) bzla_node_hash_by_id,
-                                 (BzlaCmpPtr) bzla_node_compare_by_id);
-  mark      = bzla_hashint_table_new(mm);
+  order     = bzla_hashint_map_new(mm);
+  max       = bzla_hashint_map_new(mm);
 
   BZLA_INIT_STACK(mm, stack);
+  BZLA_INIT_STACK(mm, cyclic);
 
-  /* we search for cyclic substitution dependencies
-   * and map the substitutions to an ordering number */
+  /* number substituted variables in post-order, non-substituted leaves and
+   * terms are mapped to 0 */
   bzla_iter_hashptr_init(&it, substs);
   while (bzla_iter_hashptr_has_next(&it))
   {
-    cur = bzla_iter_hashptr_next(&it);
-    assert(bzla_node_is_regular(cur));
-    assert(bzla_node_is_var(cur) || bzla_node_is_uf(cur));
-    BZLA_PUSH_STACK(stack, cur);
+    BZLA_PUSH_STACK(stack, bzla_iter_hashptr_next(&it));
 
     while (!BZLA_EMPTY_STACK(stack))
     {
-      cur = bzla_node_real_addr(BZLA_POP_STACK(stack));
+      cur = BZLA_POP_STACK(stack);
 
       if (!cur)
       {
-        cur = BZLA_POP_STACK(stack); /* left */
-        assert(bzla_node_is_regular(cur));
-        assert(bzla_node_is_var(cur) || bzla_node_is_uf(cur));
-        assert(!bzla_hashptr_table_get(order, cur));
-        bzla_hashptr_table_add(order, cur)->data.as_int = order_num++;
+        cur = BZLA_POP_STACK(stack);
+        assert(bzla_hashptr_table_get(substs, cur));
+        bzla_hashint_map_get(order, cur->id)->as_int = order_num++;
         continue;
       }
-      /* visited (DFS) */
-      if (bzla_hashint_table_contains(mark, cur->id)) continue;
 
-      bzla_hashint_table_add(mark, cur->id);
+      cur = bzla_node_real_addr(cur);
+      if (bzla_hashint_map_contains(order, cur->id)) continue;
+      bzla_hashint_map_add(order, cur->id);
 
-      if (bzla_node_is_bv_const(cur) || bzla_node_is_var(cur)
-          || bzla_node_is_rm_const(cur) || bzla_node_is_fp_const(cur)
-          || bzla_node_is_param(cur) || bzla_node_is_uf(cur))
+      if (is_subst_leaf(cur))
       {
-        b_temp = bzla_hashptr_table_get(substs, cur);
-        if (b_temp)
+        b = bzla_hashptr_table_get(substs, cur);
+        if (b)
         {
-          BZLA_PUSH_STACK(stack, cur); /* left  */
+          BZLA_PUSH_STACK(stack, cur);
           BZLA_PUSH_STACK(stack, 0);
-          BZLA_PUSH_STACK(stack, /* right */
-                          (BzlaNode *) b_temp->data.as_ptr);
-        }
-        else
-        {
-          assert(!bzla_hashptr_table_get(order, cur));
-          bzla_hashptr_table_add(order, cur)->data.as_int = 0;
+          BZLA_PUSH_STACK(stack, (BzlaNode *) b->data.as_ptr);
         }
       }
       else
@@ -96,93 +195,62 @@ substitute_remove_cycles(Bzla *bzla, BzlaPtrHashTable *substs)
     }
   }
 
-  bzla_hashint_table_delete(mark);
-  mark = bzla_hashint_map_new(mm);
-
-  /* we look for cycles */
+  /* compute the maximum number of substituted variables in the right hand
+   * sides, and collect cyclic substitutions */
   bzla_iter_hashptr_init(&it, substs);
   while (bzla_iter_hashptr_has_next(&it))
   {
-    b   = it.bucket;
-    cur = bzla_iter_hashptr_next(&it);
-    assert(bzla_node_is_regular(cur));
-    assert(bzla_node_is_var(cur) || bzla_node_is_uf(cur));
-    BZLA_PUSH_STACK(stack, (BzlaNode *) b->data.as_ptr);
-
-    /* we assume that there are no direct cycles as a result of occurrence
-     * check */
+    right = it.bucket->data.as_ptr;
+    left  = bzla_iter_hashptr_next(&it);
+    BZLA_PUSH_STACK(stack, right);
+
     while (!BZLA_EMPTY_STACK(stack))
     {
       cur = bzla_node_real_addr(BZLA_POP_STACK(stack));
-      d   = bzla_hashint_map_get(mark, cur->id);
+      d   = bzla_hashint_map_get(max, cur->id);
 
-      if (d && d->as_int == 1) /* cur has max order of its children */
-        continue;
+      if (d && d->as_int >= 0) continue;
 
-      if (bzla_node_is_bv_const(cur) || bzla_node_is_var(cur)
-          || bzla_node_is_rm_const(cur) || bzla_node_is_fp_const(cur)
-          || bzla_node_is_param(cur) || bzla_node_is_uf(cur))
+      if (is_subst_leaf(cur))
       {
-        assert(bzla_hashptr_table_get(order, cur));
-        continue;
+        assert(!d);
+        assert(bzla_hashint_map_contains(order, cur->id));
+        bzla_hashint_map_add(max, cur->id)->as_int =
+            bzla_hashint_map_get(order, cur->id)->as_int;
       }
-
-      assert(cur->arity >= 1);
-      assert(cur->arity <= BZLA_NODE_MAX_CHILDREN);
-
-      if (!d)
+      else if (!d)
       {
-        bzla_hashint_map_add(mark, cur->id);
+        bzla_hashint_map_add(max, cur->id)->as_int = -1;
         BZLA_PUSH_STACK(stack, cur);
         for (i = 1; i <= cur->arity; i++)
           BZLA_PUSH_STACK(stack, cur->e[cur->arity - i]);
       }
-      else /* cur is visited, its children are visited */
+      else
       {
-        /* compute maximum of children */
-        assert(d->as_int == 0);
-        d->as_int = 1;
-        max       = 0;
-        for (i = 1; i <= cur->arity; i++)
+        val = 0;
+        for (i = 0; i < cur->arity; i++)
         {
-          child  = bzla_node_real_addr(cur->e[cur->arity - i]);
-          b_temp = bzla_hashptr_table_get(order, child);
-          assert(b_temp);
-          val = b_temp->data.as_int;
-          assert(val >= 0);
-          max = BZLA_MAX_UTIL(max, val);
+          val = BZLA_MAX_UTIL(
+              val,
+              bzla_hashint_map_get(max, bzla_node_real_addr(cur->e[i])->id)
+                  ->as_int);
         }
-        bzla_hashptr_table_add(order, cur)->data.as_int = max;
+        d->as_int = val;
       }
     }
-  }
-  bzla_hashint_map_delete(mark);
 
-  assert(BZLA_EMPTY_STACK(stack));
-  /* we eliminate cyclic substitutions, and reset mark flags */
-  bzla_iter_hashptr_init(&it, substs);
-  while (bzla_iter_hashptr_has_next(&it))
-  {
-    right = (BzlaNode *) it.bucket->data.as_ptr;
-    assert(right);
-    left = bzla_iter_hashptr_next(&it);
-    assert(bzla_node_is_regular(left));
-    assert(bzla_node_is_var(left) || bzla_node_is_uf(left));
-    b_temp = bzla_hashptr_table_get(order, left);
-    assert(b_temp);
-    order_num = b_temp->data.as_int;
-    b_temp    = bzla_hashptr_table_get(order, bzla_node_real_addr(right));
-    assert(b_temp);
-    max = b_temp->data.as_int;
-    assert(order_num != max);
+    val = bzla_hashint_map_get(max, bzla_node_real_addr(right)->id)->as_int;
     /* found cycle */
-    if (max > order_num) BZLA_PUSH_STACK(stack, left);
+    if (val >= bzla_hashint_map_get(order, left->id)->as_int)
+    {
+      BZLA_PUSH_STACK(cyclic, left);
+    }
   }
 
   /* we delete cyclic substitutions */
-  while (!BZLA_EMPTY_STACK(stack))
+  while (!BZLA_EMPTY_STACK(cyclic))
   {
-    left = BZLA_POP_STACK(stack);
+    left = BZLA_POP_STACK(cyclic);
     assert(bzla_node_is_regular(left));
     assert(bzla_node_is_var(left) || bzla_node_is_uf(left));
     right = (BzlaNode *) bzla_hashptr_table_get(substs, left)->data.as_ptr;
@@ -196,7 +264,9 @@ substitute_remove_cycles(Bzla *bzla, BzlaPtrHashTable *substs)
     bzla_node_release(bzla, right);
   }
 
-  bzla_hashptr_table_delete(order);
+  bzla_hashint_map_delete(max);
+  bzla_hashint_map_delete(order);
+  BZLA_RELEASE_STACK(cyclic);
   BZLA_RELEASE_STACK(stack);
 }
 
@@ -205,7 +275,7 @@ bzla_substitute_var_exps(Bzla *bzla)
 {
   assert(bzla);
 
-  BzlaPtrHashTable *varsubst_constraints, *substs;
+  BzlaPtrHashTable *varsubst_constraints, *substs, *merged;
   BzlaNode *cur, *simp, *left, *right, *simp_right;
   BzlaPtrHashBucket *b;
   BzlaPtrHashTableIterator it;
@@ -261,6 +331,17 @@ bzla_substitute_var_exps(Bzla *bzla)
 
     BZLALOG(1, "start variable substitution");
 
+    /* collapse chains of variable substitutions */
+    merged = substitute_merge_vars(bzla, substs);
+    bzla_iter_hashptr_init(&it, substs);
+    while (bzla_iter_hashptr_has_next(&it))
+    {
+      bzla_node_release(bzla, it.bucket->data.as_ptr);
+      bzla_node_release(bzla, bzla_iter_hashptr_next(&it));
+    }
+    bzla_hashptr_table_delete(substs);
+    substs = merged;
+
     /* remove cycles from substitution table 'substs' */
     substitute_remove_cycles(bzla, substs);
 
@@ -114,6 +114,20 @@ melt(BzlaSATMgr *smgr, int32_t lit)
 
 /*------------------------------------------------------------------------*/
 
+static int32_t
+fixed(BzlaSATMgr *smgr, int32_t lit)
+{
+  return ccadical_fixed(smgr->solver, lit);
+}
+
+static void
+phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  ccadical_phase(smgr->solver, lit);
+}
+
+/*------------------------------------------------------------------------*/
+
 bool
 bzla_sat_enable_cadical(BzlaSATMgr *smgr)
 {
@@ -130,10 +144,11 @@ bzla_sat_enable_cadical(BzlaSATMgr *smgr)
   smgr->api.deref            = deref;
   smgr->api.enable_verbosity = enable_verbosity;
   smgr->api.failed           = failed;
-  smgr->api.fixed            = 0;
+  smgr->api.fixed            = fixed;
   smgr->api.inc_max_var      = 0;
   smgr->api.init             = init;
   smgr->api.melt             = 0;
+  smgr->api.phase            = phase;
   smgr->api.repr             = 0;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
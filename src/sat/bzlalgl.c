@@ -263,6 +263,13 @@ fixed(BzlaSATMgr *smgr, int32_t lit)
   return lglfixed(blgl->lgl, lit);
 }
 
+static void
+phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  BzlaLGL *blgl = smgr->solver;
+  lglsetphase(blgl->lgl, lit);
+}
+
 static void *
 clone(Bzla *bzla, BzlaSATMgr *smgr)
 {
@@ -321,6 +328,7 @@ bzla_sat_enable_lingeling(BzlaSATMgr *smgr)
   smgr->api.inc_max_var      = inc_max_var;
   smgr->api.init             = init;
   smgr->api.melt             = melt;
+  smgr->api.phase            = phase;
   smgr->api.repr             = repr;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
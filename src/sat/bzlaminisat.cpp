@@ -125,6 +125,13 @@ class BzlaMiniSAT : public SimpSolver
     return res;
   }
 
+  void phase(int32_t lit)
+  {
+    Lit l = import(lit);
+    /* user polarity is the sign of the decision literal */
+    setPolarity(var(l), lbool(sign(l)));
+  }
+
   int32_t deref(int32_t lit)
   {
     if (nomodel) return fixed(lit);
@@ -203,6 +210,13 @@ failed(BzlaSATMgr* smgr, int32_t lit)
   return solver->failed(lit);
 }
 
+static void
+phase(BzlaSATMgr* smgr, int32_t lit)
+{
+  BzlaMiniSAT* solver = (BzlaMiniSAT*) smgr->solver;
+  solver->phase(lit);
+}
+
 static void
 enable_verbosity(BzlaSATMgr* smgr, int32_t level)
 {
@@ -249,6 +263,7 @@ bzla_sat_enable_minisat(BzlaSATMgr* smgr)
   smgr->api.fixed            = fixed;
   smgr->api.inc_max_var      = inc_max_var;
   smgr->api.init             = init;
+  smgr->api.phase            = phase;
   smgr->api.repr             = 0;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
@@ -97,6 +97,18 @@ fixed(BzlaSATMgr *smgr, int32_t lit)
   return picosat_deref_toplevel(smgr->solver, lit);
 }
 
+static void
+phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  picosat_set_default_phase_lit(smgr->solver, lit, 1);
+}
+
+static void
+setterm(BzlaSATMgr *smgr)
+{
+  picosat_set_interrupt(smgr->solver, smgr->term.state, smgr->term.fun);
+}
+
 /*------------------------------------------------------------------------*/
 
 static void
@@ -133,11 +145,13 @@ bzla_sat_enable_picosat(BzlaSATMgr *smgr)
   smgr->api.inc_max_var      = inc_max_var;
   smgr->api.init             = init;
   smgr->api.melt             = 0;
+  smgr->api.phase            = phase;
   smgr->api.repr             = 0;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
   smgr->api.set_output       = set_output;
   smgr->api.set_prefix       = set_prefix;
+  smgr->api.setterm          = setterm;
   smgr->api.stats            = stats;
   return true;
 }
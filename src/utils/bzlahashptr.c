@@ -65,7 +65,8 @@ bzla_hashptr_table_new(BzlaMemMgr *mm, BzlaHashPtr hash, BzlaCmpPtr cmp)
   res->hash = hash ? hash : bzla_hash_ptr;
   res->cmp  = cmp ? cmp : bzla_compare_ptr;
 
-  bzla_enlarge_ptr_hash_table(res);
+  /* The bucket array is allocated on first insertion since many tables (e.g.,
+   * per solver instance) are never used. */
 
   return res;
 }
@@ -133,7 +134,7 @@ bzla_hashptr_table_get(BzlaPtrHashTable *p2iht, const void *key)
   BzlaPtrHashBucket *res, **p, *b;
   uint32_t i, h;
 
-  assert(p2iht->size > 0);
+  if (!p2iht->size) return 0;
 
   res = 0;
   h   = p2iht->hash(key);
@@ -20,17 +20,48 @@
 
 /*------------------------------------------------------------------------*/
 
-#define ADJUST()                                                            \
-  do                                                                        \
-  {                                                                         \
-    if (mm->maxallocated < mm->allocated) mm->maxallocated = mm->allocated; \
+/* Counters are updated atomically if the memory manager is shared between
+ * threads (see bzla_mem_mgr_set_shared). Maximum values are approximate in
+ * that case. */
+#if defined(__GNUC__) || defined(__clang__)
+#define INC(field, size)                                        \
+  do                                                            \
+  {                                                             \
+    if (mm->shared)                                             \
+      __atomic_add_fetch(&mm->field, (size), __ATOMIC_RELAXED); \
+    else                                                        \
+      mm->field += (size);                                      \
+  } while (0)
+#define DEC(field, size)                                        \
+  do                                                            \
+  {                                                             \
+    if (mm->shared)                                             \
+      __atomic_sub_fetch(&mm->field, (size), __ATOMIC_RELAXED); \
+    else                                                        \
+      mm->field -= (size);                                      \
+  } while (0)
+#define GET(field) __atomic_load_n(&mm->field, __ATOMIC_RELAXED)
+#define SET(field, val) __atomic_store_n(&mm->field, (val), __ATOMIC_RELAXED)
+#else
+#define INC(field, size) mm->field += (size)
+#define DEC(field, size) mm->field -= (size)
+#define GET(field) mm->field
+#define SET(field, val) mm->field = (val)
+#endif
+
+#define ADJUST()                                                     \
+  do                                                                 \
+  {                                                                  \
+    size_t allocated = GET(allocated);                               \
+    if (GET(maxallocated) < allocated) SET(maxallocated, allocated); \
   } while (0)
 
-#define SAT_ADJUST()                              \
-  do                                              \
-  {                                               \
-    if (mm->sat_maxallocated < mm->sat_allocated) \
-      mm->sat_maxallocated = mm->sat_allocated;   \
+#define SAT_ADJUST()                       \
+  do                                       \
+  {                                        \
+    size_t allocated = GET(sat_allocated); \
+    if (GET(sat_maxallocated) < allocated) \
+      SET(sat_maxallocated, allocated);    \
   } while (0)
 
 /*------------------------------------------------------------------------*/
@@ -62,9 +93,18 @@ bzla_mem_mgr_new(void)
   mm->maxallocated     = 0;
   mm->sat_allocated    = 0;
   mm->sat_maxallocated = 0;
+  mm->num_allocs       = 0;
+  mm->shared           = false;
   return mm;
 }
 
+void
+bzla_mem_mgr_set_shared(BzlaMemMgr *mm)
+{
+  assert(mm);
+  mm->shared = true;
+}
+
 void *
 bzla_mem_malloc(BzlaMemMgr *mm, size_t size)
 {
@@ -73,7 +113,8 @@ bzla_mem_malloc(BzlaMemMgr *mm, size_t size)
   assert(mm);
   result = malloc(size);
   BZLA_ABORT(!result, "out of memory in 'bzla_mem_malloc'");
-  mm->allocated += size;
+  INC(allocated, size);
+  INC(num_allocs, 1);
   ADJUST();
   BZLA_LOG_MEM("%p malloc %10ld\n", result, size);
   return result;
@@ -87,7 +128,7 @@ bzla_mem_sat_malloc(BzlaMemMgr *mm, size_t size)
   assert(mm);
   result = malloc(size);
   BZLA_ABORT(!result, "out of memory in 'bzla_mem_sat_malloc'");
-  mm->sat_allocated += size;
+  INC(sat_allocated, size);
   SAT_ADJUST();
   return result;
 }
@@ -102,8 +143,8 @@ bzla_mem_realloc(BzlaMemMgr *mm, void *p, size_t old_size, size_t new_size)
   BZLA_LOG_MEM("%p free   %10ld (realloc)\n", p, old_size);
   result = realloc(p, new_size);
   BZLA_ABORT(!result, "out of memory in 'bzla_mem_realloc'");
-  mm->allocated -= old_size;
-  mm->allocated += new_size;
+  DEC(allocated, old_size);
+  INC(allocated, new_size);
   ADJUST();
   BZLA_LOG_MEM("%p malloc %10ld (realloc)\n", result, new_size);
   return result;
@@ -118,8 +159,8 @@ bzla_mem_sat_realloc(BzlaMemMgr *mm, void *p, size_t old_size, size_t new_size)
   assert(mm->sat_allocated >= old_size);
   result = realloc(p, new_size);
   BZLA_ABORT(!result, "out of memory in 'bzla_mem_sat_realloc'");
-  mm->sat_allocated -= old_size;
-  mm->sat_allocated += new_size;
+  DEC(sat_allocated, old_size);
+  INC(sat_allocated, new_size);
   SAT_ADJUST();
   return result;
 }
@@ -132,7 +173,8 @@ bzla_mem_calloc(BzlaMemMgr *mm, size_t nobj, size_t size)
   assert(mm);
   result = calloc(nobj, size);
   BZLA_ABORT(!result, "out of memory in 'bzla_mem_calloc'");
-  mm->allocated += bytes;
+  INC(allocated, bytes);
+  INC(num_allocs, 1);
   ADJUST();
   BZLA_LOG_MEM("%p malloc %10ld (calloc)\n", result, bytes);
   return result;
@@ -144,7 +186,7 @@ bzla_mem_free(BzlaMemMgr *mm, void *p, size_t freed)
   assert(mm);
   assert(!p == !freed);
   assert(mm->allocated >= freed);
-  mm->allocated -= freed;
+  DEC(allocated, freed);
   BZLA_LOG_MEM("%p free   %10ld\n", p, freed);
   free(p);
 }
@@ -153,7 +195,7 @@ void
 bzla_mem_sat_free(BzlaMemMgr *mm, void *p, size_t freed)
 {
   assert(mm);
-  if (p) mm->sat_allocated -= freed;
+  if (p) DEC(sat_allocated, freed);
   free(p);
 }
 
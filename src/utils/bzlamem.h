@@ -12,6 +12,7 @@
 #define BZLAMEM_H_INCLUDED
 
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -73,6 +74,8 @@ struct BzlaMemMgr
   size_t maxallocated;
   size_t sat_allocated;
   size_t sat_maxallocated;
+  size_t num_allocs; /* number of (non-SAT) malloc/calloc calls */
+  bool shared; /* accessed by more than one thread? */
 };
 
 typedef struct BzlaMemMgr BzlaMemMgr;
@@ -81,6 +84,10 @@ typedef struct BzlaMemMgr BzlaMemMgr;
 
 BzlaMemMgr *bzla_mem_mgr_new(void);
 
+/* Update memory statistics atomically from now on (the memory manager is
+ * used by more than one thread). */
+void bzla_mem_mgr_set_shared(BzlaMemMgr *mm);
+
 void bzla_mem_mgr_delete(BzlaMemMgr *mm);
 
 void *bzla_mem_sat_malloc(BzlaMemMgr *mm, size_t size);
@@ -20,8 +20,8 @@ bzla_optparse_parse(BzlaMemMgr *mm,
                     char **argv,
                     BzlaParsedOptPtrStack *opts,
                     BzlaParsedInputPtrStack *infiles,
-                    BzlaOpt *bzla_opts,
-                    bool (*has_str_arg)(const char *, BzlaOpt *))
+                    const BzlaOpt *bzla_opts,
+                    bool (*has_str_arg)(const char *, const BzlaOpt *))
 {
   assert(mm);
   assert(argc);
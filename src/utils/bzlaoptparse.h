@@ -96,7 +96,7 @@ void bzla_optparse_parse(BzlaMemMgr *mm,
                          char **argv,
                          BzlaParsedOptPtrStack *opts,
                          BzlaParsedInputPtrStack *infiles,
-                         BzlaOpt *bzla_options,
-                         bool (*has_str_arg)(const char *, BzlaOpt *));
+                         const BzlaOpt *bzla_options,
+                         bool (*has_str_arg)(const char *, const BzlaOpt *));
 
 #endif
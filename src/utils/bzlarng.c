@@ -53,14 +53,28 @@ bzla_rng_init(BzlaRNG* rng, uint32_t seed)
   {
     assert(rng->gmp_state);
     gmp_randclear(*((gmp_randstate_t*) rng->gmp_state));
+    rng->is_init = false;
   }
-  else
+  rng->gmp_seed = bzla_rng_rand(rng);
+}
+
+void*
+bzla_rng_get_gmp_state(BzlaRNG* rng)
+{
+  assert(rng);
+  assert(rng->mm);
+
+  if (!rng->is_init)
   {
-    rng->gmp_state = bzla_mem_malloc(rng->mm, sizeof(gmp_randstate_t));
+    if (!rng->gmp_state)
+    {
+      rng->gmp_state = bzla_mem_malloc(rng->mm, sizeof(gmp_randstate_t));
+    }
+    rng->is_init = true;
+    gmp_randinit_mt(*((gmp_randstate_t*) rng->gmp_state));
+    gmp_randseed_ui(*((gmp_randstate_t*) rng->gmp_state), rng->gmp_seed);
   }
-  rng->is_init = true;
-  gmp_randinit_mt(*((gmp_randstate_t*) rng->gmp_state));
-  gmp_randseed_ui(*((gmp_randstate_t*) rng->gmp_state), bzla_rng_rand(rng));
+  return rng->gmp_state;
 }
 
 BzlaRNG*
@@ -75,10 +89,14 @@ bzla_rng_clone(BzlaRNG* rng, BzlaMemMgr* mm)
 void
 bzla_rng_delete(BzlaRNG* rng)
 {
-  (void) rng;
-  assert(rng->gmp_state);
-  gmp_randclear(*((gmp_randstate_t*) rng->gmp_state));
-  bzla_mem_free(rng->mm, rng->gmp_state, sizeof(gmp_randstate_t));
+  if (rng->is_init)
+  {
+    gmp_randclear(*((gmp_randstate_t*) rng->gmp_state));
+  }
+  if (rng->gmp_state)
+  {
+    bzla_mem_free(rng->mm, rng->gmp_state, sizeof(gmp_randstate_t));
+  }
   rng->gmp_state = 0;
   rng->is_init   = false;
   BZLA_DELETE(rng->mm, rng);
@@ -21,6 +21,10 @@ struct BzlaRNG
   uint32_t z, w;
   BzlaMemMgr* mm;
   uint32_t seed;
+  /* Seed of the GMP RNG, which is initialized on first use only (seeding the
+   * Mersenne Twister is much more expensive than creating a solver instance,
+   * and most instances never pick random bit-vectors). */
+  uint32_t gmp_seed;
   bool is_init;
   /* This is a bit ugly, but a workaround to not include gmp.h in this header
    * (including the GMP header causes compilation problems with gtest). */
@@ -33,19 +37,25 @@ typedef struct BzlaRNG BzlaRNG;
  * Create and initialize a new RNG object.
  *
  * Note: Always use this function to create an RNG object!
- *       If compiled with GMP, RNG object *must* be zero initialized, else
- *       member is_init and gmp_state contain garbage, which leads to invalid
- *       frees of the gmp_state. This function guarantees this.
+ *       The RNG object *must* be zero initialized, else member is_init and
+ *       gmp_state contain garbage, which leads to invalid frees of the
+ *       gmp_state. This function guarantees this.
  */
 BzlaRNG* bzla_rng_new(BzlaMemMgr* mm, uint32_t seed);
 
 /**
- * Initialize RNG with given seed. If compiled with GMP, this additionally
- * initializes the state of the GMP RNG, thus calling this function is in
- * that case mandatory.
+ * Initialize RNG with given seed. This additionally resets the state of the
+ * GMP RNG, which is (re)initialized with a seed derived from 'seed' on its
+ * next use.
  */
 void bzla_rng_init(BzlaRNG* rng, uint32_t seed);
 
+/**
+ * Get the state of the GMP RNG (a pointer to a gmp_randstate_t).
+ * Initializes the GMP RNG on first use.
+ */
+void* bzla_rng_get_gmp_state(BzlaRNG* rng);
+
 /**
  * Initialize given RNG clone when cloning.
  * This does nothing when not compiled with GMP but must be called when cloning
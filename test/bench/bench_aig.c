@@ -0,0 +1,99 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+/* Measure memory per AIG and the time to construct and Tseitin encode large
+ * AIGs. Builds 'n' multipliers of width 'w' over fresh AIG vector variables,
+ * which are hash-consed and encoded through the AIG manager of a solver
+ * instance. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "bzlaaigvec.h"
+#include "bzlacore.h"
+#include "bzlasat.h"
+#include "utils/bzlastack.h"
+
+BZLA_DECLARE_STACK(BzlaAIGVecPtr, BzlaAIGVec *);
+
+static double
+get_time(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static void
+bench_mul(uint32_t n, uint32_t w)
+{
+  uint32_t i;
+  size_t bytes;
+  double start, build, encode;
+  uint_least64_t num_aigs;
+  Bzla *bzla;
+  BzlaAIGMgr *amgr;
+  BzlaAIGVecMgr *avmgr;
+  BzlaAIGVec *a, *b;
+  BzlaAIGVecPtrStack avs;
+
+  bzla  = bzla_new();
+  avmgr = bzla->avmgr;
+  amgr  = avmgr->amgr;
+  BZLA_INIT_STACK(bzla->mm, avs);
+
+  bytes = bzla->mm->allocated;
+  start = get_time();
+  for (i = 0; i < n; i++)
+  {
+    a = bzla_aigvec_var(avmgr, w);
+    b = bzla_aigvec_var(avmgr, w);
+    BZLA_PUSH_STACK(avs, bzla_aigvec_mul(avmgr, a, b));
+    BZLA_PUSH_STACK(avs, a);
+    BZLA_PUSH_STACK(avs, b);
+  }
+  build    = get_time() - start;
+  bytes    = bzla->mm->allocated - bytes;
+  num_aigs = amgr->cur_num_aigs + amgr->cur_num_aig_vars;
+
+  bzla_sat_enable_solver(amgr->smgr);
+  bzla_sat_init(amgr->smgr);
+  start = get_time();
+  for (i = 0; i < BZLA_COUNT_STACK(avs); i++)
+  {
+    bzla_aigvec_to_sat_tseitin(avmgr, BZLA_PEEK_STACK(avs, i));
+  }
+  encode = get_time() - start;
+
+  printf("%u x mul%u: %9llu AIGs, %6.2f bytes/AIG, ",
+         n,
+         w,
+         (unsigned long long) num_aigs,
+         (double) bytes / num_aigs);
+  printf("build %8.2f ms, encode %8.2f ms\n", build * 1e3, encode * 1e3);
+
+  while (!BZLA_EMPTY_STACK(avs))
+  {
+    bzla_aigvec_release_delete(avmgr, BZLA_POP_STACK(avs));
+  }
+  BZLA_RELEASE_STACK(avs);
+  bzla_delete(bzla);
+}
+
+int32_t
+main(int32_t argc, char **argv)
+{
+  uint32_t n = argc > 1 ? (uint32_t) atoi(argv[1]) : 20;
+  uint32_t w = argc > 2 ? (uint32_t) atoi(argv[2]) : 64;
+
+  bench_mul(n, w);
+  return 0;
+}
@@ -0,0 +1,148 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+/* Measure term construction throughput. Creates 'n' random binary Boolean
+ * and bit-vector terms of width 'w' over 16 variables, first as new nodes and
+ * then again as lookups of existing nodes, without and with rewriting. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "bzlacore.h"
+#include "bzlaexp.h"
+
+#define BENCH_EXP_NUM_VARS 16
+
+static double
+get_time(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static uint32_t
+next_rand(uint32_t *seed)
+{
+  *seed = *seed * 1664525u + 1013904223u;
+  return *seed >> 8;
+}
+
+/* Create 'n' terms, terms[0..n) must be initialized with the variables. */
+static void
+create_terms(Bzla *bzla, BzlaNode **bv, BzlaNode **bools, uint32_t n)
+{
+  uint32_t i, seed = 42;
+  BzlaNode *a, *b, *p, *q;
+
+  for (i = BENCH_EXP_NUM_VARS; i < n; i++)
+  {
+    a = bv[next_rand(&seed) % i];
+    b = bv[next_rand(&seed) % i];
+    p = bools[next_rand(&seed) % i];
+    q = bools[next_rand(&seed) % i];
+    switch (next_rand(&seed) % 4)
+    {
+      case 0: bv[i] = bzla_exp_bv_and(bzla, a, b); break;
+      case 1: bv[i] = bzla_exp_bv_add(bzla, a, b); break;
+      case 2: bv[i] = bzla_exp_bv_mul(bzla, a, b); break;
+      default: bv[i] = bzla_exp_bv_and(bzla, bzla_node_invert(a), b);
+    }
+    switch (next_rand(&seed) % 4)
+    {
+      case 0: bools[i] = bzla_exp_bv_and(bzla, p, q); break;
+      case 1: bools[i] = bzla_exp_bv_and(bzla, bzla_node_invert(p), q); break;
+      case 2: bools[i] = bzla_exp_eq(bzla, a, b); break;
+      default: bools[i] = bzla_exp_bv_ult(bzla, a, b);
+    }
+  }
+}
+
+static void
+release_terms(Bzla *bzla, BzlaNode **bv, BzlaNode **bools, uint32_t n)
+{
+  uint32_t i;
+
+  for (i = BENCH_EXP_NUM_VARS; i < n; i++)
+  {
+    bzla_node_release(bzla, bv[i]);
+    bzla_node_release(bzla, bools[i]);
+  }
+}
+
+static void
+bench_exp(uint32_t n, uint32_t w, uint32_t rw_level)
+{
+  uint32_t i;
+  double start, create, lookup;
+  Bzla *bzla;
+  BzlaSortId sort, bool_sort;
+  BzlaNode **bv, **bools, **bv2, **bools2;
+
+  bzla = bzla_new();
+  bzla_opt_set(bzla, BZLA_OPT_RW_LEVEL, rw_level);
+
+  sort      = bzla_sort_bv(bzla, w);
+  bool_sort = bzla_sort_bool(bzla);
+  BZLA_NEWN(bzla->mm, bv, n);
+  BZLA_NEWN(bzla->mm, bools, n);
+  BZLA_NEWN(bzla->mm, bv2, n);
+  BZLA_NEWN(bzla->mm, bools2, n);
+  for (i = 0; i < BENCH_EXP_NUM_VARS; i++)
+  {
+    bv[i]    = bv2[i]    = bzla_exp_var(bzla, sort, 0);
+    bools[i] = bools2[i] = bzla_exp_var(bzla, bool_sort, 0);
+  }
+
+  start = get_time();
+  create_terms(bzla, bv, bools, n);
+  create = get_time() - start;
+
+  start = get_time();
+  create_terms(bzla, bv2, bools2, n);
+  lookup = get_time() - start;
+
+  printf("rewrite level %u, width %2u: %8.1f ns/term (create), ",
+         rw_level,
+         w,
+         create * 1e9 / (2.0 * (n - BENCH_EXP_NUM_VARS)));
+  printf("%8.1f ns/term (lookup), %u nodes\n",
+         lookup * 1e9 / (2.0 * (n - BENCH_EXP_NUM_VARS)),
+         bzla->nodes_unique_table.num_elements);
+
+  release_terms(bzla, bv2, bools2, n);
+  release_terms(bzla, bv, bools, n);
+  for (i = 0; i < BENCH_EXP_NUM_VARS; i++)
+  {
+    bzla_node_release(bzla, bv[i]);
+    bzla_node_release(bzla, bools[i]);
+  }
+  BZLA_DELETEN(bzla->mm, bools2, n);
+  BZLA_DELETEN(bzla->mm, bv2, n);
+  BZLA_DELETEN(bzla->mm, bools, n);
+  BZLA_DELETEN(bzla->mm, bv, n);
+  bzla_sort_release(bzla, bool_sort);
+  bzla_sort_release(bzla, sort);
+  bzla_delete(bzla);
+}
+
+int32_t
+main(int32_t argc, char **argv)
+{
+  uint32_t n = argc > 1 ? (uint32_t) atoi(argv[1]) : 1000000;
+
+  if (n <= BENCH_EXP_NUM_VARS) n = BENCH_EXP_NUM_VARS + 1;
+  bench_exp(n, 8, 0);
+  bench_exp(n, 32, 0);
+  bench_exp(n, 8, 3);
+  bench_exp(n, 32, 3);
+  return 0;
+}
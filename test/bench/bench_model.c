@@ -0,0 +1,103 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+/* Measure the memory used for bit-vector values of a large model. The
+ * formula consists of 'n' 32-bit variables that are equal to one of 'k'
+ * constants and 'n' unasserted terms over these variables. Models are
+ * generated for all nodes. Constant and model values are stored in the term
+ * store of the instance, which shares equal values. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#include "bzlacore.h"
+#include "bzlaexp.h"
+#include "bzlatermstore.h"
+
+static double
+get_time(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static void
+bench_model(uint32_t n, uint32_t k)
+{
+  uint32_t i;
+  double start;
+  struct rusage usage;
+  Bzla *bzla;
+  BzlaSortId sort;
+  BzlaNode **vars, **terms, *c, *mask, *eq;
+  BzlaTermStoreStats stats;
+
+  bzla = bzla_new();
+  bzla_opt_set(bzla, BZLA_OPT_PRODUCE_MODELS, 2);
+  bzla_opt_set(bzla, BZLA_OPT_RW_LEVEL, 0);
+
+  sort = bzla_sort_bv(bzla, 32);
+  mask = bzla_exp_bv_unsigned(bzla, 0xff00, sort);
+  BZLA_NEWN(bzla->mm, vars, n);
+  BZLA_NEWN(bzla->mm, terms, n);
+  for (i = 0; i < n; i++)
+  {
+    vars[i] = bzla_exp_var(bzla, sort, 0);
+    c       = bzla_exp_bv_unsigned(bzla, (i % k) * 0x01010101u, sort);
+    eq      = bzla_exp_eq(bzla, vars[i], c);
+    bzla_assert_exp(bzla, eq);
+    bzla_node_release(bzla, eq);
+    bzla_node_release(bzla, c);
+    terms[i] = bzla_exp_bv_and(bzla, vars[i], mask);
+  }
+
+  start = get_time();
+  (void) bzla_check_sat(bzla, -1, -1);
+  start = get_time() - start;
+
+  bzla_term_store_get_stats(bzla->term_store, &stats);
+  getrusage(RUSAGE_SELF, &usage);
+  printf("%u variables, %u values: %zu model values in %.2f s, ",
+         n,
+         k,
+         bzla->bv_model ? bzla->bv_model->count : (size_t) 0,
+         start);
+  printf("%.1f MB max. RSS\n", usage.ru_maxrss / 1024.0);
+  printf("term store: %llu bit-vectors for %llu references, ",
+         (unsigned long long) stats.bvs,
+         (unsigned long long) stats.refs);
+  printf("%.2f MB allocated, %.2f MB saved\n",
+         stats.bytes / (double) (1 << 20),
+         stats.saved / (double) (1 << 20));
+
+  for (i = 0; i < n; i++)
+  {
+    bzla_node_release(bzla, terms[i]);
+    bzla_node_release(bzla, vars[i]);
+  }
+  BZLA_DELETEN(bzla->mm, terms, n);
+  BZLA_DELETEN(bzla->mm, vars, n);
+  bzla_node_release(bzla, mask);
+  bzla_sort_release(bzla, sort);
+  bzla_delete(bzla);
+}
+
+int32_t
+main(int32_t argc, char **argv)
+{
+  uint32_t n = argc > 1 ? (uint32_t) atoi(argv[1]) : 100000;
+  uint32_t k = argc > 2 ? (uint32_t) atoi(argv[2]) : 16;
+
+  bench_model(n, k);
+  return 0;
+}
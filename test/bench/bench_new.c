@@ -0,0 +1,105 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+/* Measure the cost of creating and deleting solver instances, with and
+ * without a small formula in between. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "api/c/bitwuzla.h"
+#include "bzlacore.h"
+#include "bzlaexp.h"
+
+static double
+get_time(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static void
+bench_bzla_new(uint32_t n)
+{
+  uint32_t i;
+  double start;
+  size_t bytes = 0;
+  Bzla *bzla;
+
+  start = get_time();
+  for (i = 0; i < n; i++)
+  {
+    bzla = bzla_new();
+    if (i == 0) bytes = bzla->mm->allocated;
+    bzla_delete(bzla);
+  }
+  printf("bzla_new/bzla_delete:      %8.2f us/instance, %zu bytes\n",
+         (get_time() - start) * 1e6 / n,
+         bytes);
+}
+
+static void
+bench_bitwuzla_new(uint32_t n)
+{
+  uint32_t i;
+  double start;
+  Bitwuzla *bitwuzla;
+
+  start = get_time();
+  for (i = 0; i < n; i++)
+  {
+    bitwuzla = bitwuzla_new();
+    bitwuzla_delete(bitwuzla);
+  }
+  printf("bitwuzla_new/delete:       %8.2f us/instance\n",
+         (get_time() - start) * 1e6 / n);
+}
+
+static void
+bench_bitwuzla_solve(uint32_t n)
+{
+  uint32_t i;
+  double start;
+  Bitwuzla *bitwuzla;
+  const BitwuzlaSort *sort;
+  const BitwuzlaTerm *x, *y, *c, *t;
+
+  start = get_time();
+  for (i = 0; i < n; i++)
+  {
+    bitwuzla = bitwuzla_new();
+    bitwuzla_set_option(bitwuzla, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+    sort = bitwuzla_mk_bv_sort(bitwuzla, 8);
+    x    = bitwuzla_mk_const(bitwuzla, sort, "x");
+    y    = bitwuzla_mk_const(bitwuzla, sort, "y");
+    c    = bitwuzla_mk_bv_value_uint64(bitwuzla, sort, i & 0xff);
+    t    = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_ADD, x, y);
+    bitwuzla_assert(bitwuzla,
+                    bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_EQUAL, t, c));
+    (void) bitwuzla_check_sat(bitwuzla);
+    bitwuzla_delete(bitwuzla);
+  }
+  printf("bitwuzla_new/solve/delete: %8.2f us/instance\n",
+         (get_time() - start) * 1e6 / n);
+}
+
+int32_t
+main(int32_t argc, char **argv)
+{
+  uint32_t n = argc > 1 ? (uint32_t) atoi(argv[1]) : 10000;
+
+  if (n == 0) n = 1;
+  bench_bzla_new(n);
+  bench_bitwuzla_new(n);
+  bench_bitwuzla_solve(n / 10 ? n / 10 : 1);
+  return 0;
+}
@@ -0,0 +1,87 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+/* Measure the latency of satisfiability checks with and without bit-blasting
+ * assertions in the background (option BITWUZLA_OPT_PIPELINE). Assertions
+ * are streamed in rounds, each round followed by a satisfiability check. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "api/c/bitwuzla.h"
+
+static double
+get_time(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/* Per round, assert 'n' constraints (x_i * y_i + z) u>= c_i over fresh
+ * 32-bit constants x_i, y_i, with c_i = 0. Rewriting is disabled, hence the
+ * constraints are expensive to bit-blast, but they are reduced to true on the
+ * AIG layer and thus do not require any SAT solving. */
+static void
+bench_rounds(uint32_t rounds, uint32_t n, uint32_t pipeline)
+{
+  uint32_t i, r;
+  double start, check, total;
+  Bitwuzla *bitwuzla;
+  BitwuzlaResult res;
+  const BitwuzlaSort *sort;
+  const BitwuzlaTerm *x, *y, *z, *c, *t;
+
+  bitwuzla = bitwuzla_new();
+  bitwuzla_set_option(bitwuzla, BITWUZLA_OPT_INCREMENTAL, 1);
+  bitwuzla_set_option(bitwuzla, BITWUZLA_OPT_PIPELINE, pipeline);
+  bitwuzla_set_option(bitwuzla, BITWUZLA_OPT_RW_LEVEL, 0);
+  sort  = bitwuzla_mk_bv_sort(bitwuzla, 32);
+  z     = bitwuzla_mk_const(bitwuzla, sort, "z");
+  check = 0;
+  res   = BITWUZLA_UNKNOWN;
+
+  total = get_time();
+  for (r = 0; r < rounds; r++)
+  {
+    for (i = 0; i < n; i++)
+    {
+      x = bitwuzla_mk_const(bitwuzla, sort, 0);
+      y = bitwuzla_mk_const(bitwuzla, sort, 0);
+      c = bitwuzla_mk_bv_zero(bitwuzla, sort);
+      t = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_MUL, x, y);
+      t = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_ADD, t, z);
+      bitwuzla_assert(bitwuzla,
+                      bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_UGE, t, c));
+    }
+    start = get_time();
+    res   = bitwuzla_check_sat(bitwuzla);
+    check += get_time() - start;
+  }
+  total = get_time() - total;
+  printf("pipeline=%u: %8.2f ms total, %8.2f ms in check-sat (%s)\n",
+         pipeline,
+         total * 1e3,
+         check * 1e3,
+         res == BITWUZLA_SAT ? "sat" : "not sat");
+  bitwuzla_delete(bitwuzla);
+}
+
+int32_t
+main(int32_t argc, char **argv)
+{
+  uint32_t rounds = argc > 1 ? (uint32_t) atoi(argv[1]) : 20;
+  uint32_t n      = argc > 2 ? (uint32_t) atoi(argv[2]) : 50;
+
+  bench_rounds(rounds, n, 0);
+  bench_rounds(rounds, n, 1);
+  return 0;
+}
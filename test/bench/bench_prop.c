@@ -0,0 +1,151 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+/* Measure moves per second and allocations per move of the propagation-based
+ * local search engine. Allocations through the memory manager and GMP are
+ * counted separately. The benchmark formula consists of random arithmetic
+ * constraints over 32-bit constants that are satisfied by a random assignment
+ * and the number of propagation steps is bounded. */
+
+#include <gmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "bzlacore.h"
+#include "bzlaexp.h"
+#include "bzlaslvprop.h"
+
+static double
+get_time(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/*------------------------------------------------------------------------*/
+
+static uint64_t gmp_num_allocs;
+static void *(*gmp_alloc)(size_t);
+static void *(*gmp_realloc)(void *, size_t, size_t);
+static void (*gmp_free)(void *, size_t);
+
+static void *
+count_alloc(size_t size)
+{
+  gmp_num_allocs++;
+  return gmp_alloc(size);
+}
+
+static void *
+count_realloc(void *p, size_t old_size, size_t new_size)
+{
+  gmp_num_allocs++;
+  return gmp_realloc(p, old_size, new_size);
+}
+
+/*------------------------------------------------------------------------*/
+
+static uint32_t
+udiv32(uint32_t a, uint32_t b)
+{
+  return b ? a / b : UINT32_MAX;
+}
+
+static uint32_t
+urem32(uint32_t a, uint32_t b)
+{
+  return b ? a % b : a;
+}
+
+static void
+bench_prop(uint32_t n, uint32_t nprops, uint32_t seed)
+{
+  uint32_t i, j, k, l, value;
+  uint32_t *vals;
+  uint64_t num_allocs, num_gmp_allocs;
+  double start;
+  Bzla *bzla;
+  BzlaSortId sort;
+  BzlaNode **vars, *e, *c;
+  BzlaPropSolver *slv;
+
+  bzla = bzla_new();
+  bzla_opt_set(bzla, BZLA_OPT_ENGINE, BZLA_ENGINE_PROP);
+  bzla_opt_set(bzla, BZLA_OPT_PROP_NPROPS, nprops);
+  bzla_opt_set(bzla, BZLA_OPT_SEED, seed);
+  bzla_opt_set(bzla, BZLA_OPT_AUTO_CLEANUP_INTERNAL, 1);
+
+  srand(seed);
+  sort = bzla_sort_bv(bzla, 32);
+  BZLA_NEWN(bzla->mm, vars, n);
+  BZLA_NEWN(bzla->mm, vals, n);
+  for (i = 0; i < n; i++)
+  {
+    vars[i] = bzla_exp_var(bzla, sort, 0);
+    vals[i] = ((uint32_t) rand() << 16) ^ (uint32_t) rand();
+  }
+
+  /* ((x_i * x_j) + (x_k urem x_l)) udiv (x_j[15:0] o x_l[31:16]) = value */
+  for (i = 0; i < n; i++)
+  {
+    j     = (i + 1) % n;
+    k     = (i + 2) % n;
+    l     = (i + 3) % n;
+    value = udiv32(vals[i] * vals[j] + urem32(vals[k], vals[l]),
+                   (vals[j] << 16) | (vals[l] >> 16));
+
+    e = bzla_exp_bv_add(bzla,
+                        bzla_exp_bv_mul(bzla, vars[i], vars[j]),
+                        bzla_exp_bv_urem(bzla, vars[k], vars[l]));
+    c = bzla_exp_bv_concat(bzla,
+                           bzla_exp_bv_slice(bzla, vars[j], 15, 0),
+                           bzla_exp_bv_slice(bzla, vars[l], 31, 16));
+    e = bzla_exp_bv_udiv(bzla, e, c);
+    bzla_assert_exp(
+        bzla, bzla_exp_eq(bzla, e, bzla_exp_bv_unsigned(bzla, value, sort)));
+  }
+
+  num_allocs     = bzla->mm->num_allocs;
+  num_gmp_allocs = gmp_num_allocs;
+  start          = get_time();
+  (void) bzla_check_sat(bzla, -1, -1);
+  start          = get_time() - start;
+  num_allocs     = bzla->mm->num_allocs - num_allocs;
+  num_gmp_allocs = gmp_num_allocs - num_gmp_allocs;
+
+  slv = BZLA_PROP_SOLVER(bzla);
+  printf("%u constraints, %u moves in %.2f s: %.0f moves/s, ",
+         n,
+         slv->stats.moves,
+         start,
+         slv->stats.moves / start);
+  printf("%.1f allocs/move (%.1f GMP)\n",
+         (double) (num_allocs + num_gmp_allocs) / slv->stats.moves,
+         (double) num_gmp_allocs / slv->stats.moves);
+
+  BZLA_DELETEN(bzla->mm, vals, n);
+  BZLA_DELETEN(bzla->mm, vars, n);
+  bzla_sort_release(bzla, sort);
+  bzla_delete(bzla);
+}
+
+int32_t
+main(int32_t argc, char **argv)
+{
+  uint32_t n      = argc > 1 ? (uint32_t) atoi(argv[1]) : 50;
+  uint32_t nprops = argc > 2 ? (uint32_t) atoi(argv[2]) : 200000;
+
+  mp_get_memory_functions(&gmp_alloc, &gmp_realloc, &gmp_free);
+  mp_set_memory_functions(count_alloc, count_realloc, gmp_free);
+  bench_prop(n, nprops, 0);
+  return 0;
+}
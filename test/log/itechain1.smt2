@@ -0,0 +1,9 @@
+(set-logic QF_BV)
+(declare-fun op () (_ BitVec 8))
+(declare-fun op2 () (_ BitVec 8))
+(define-fun lookup ((x (_ BitVec 8))) (_ BitVec 8)
+  (ite (= x #x00) #x01 (ite (= x #x01) #x04 (ite (= x #x02) #x07 (ite (= x #x03) #x0a (ite (= x #x04) #x0d (ite (= x #x05) #x10 (ite (= x #x06) #x13 (ite (= x #x07) #x16 (ite (= x #x08) #x19 (ite (= x #x09) #x1c (ite (= x #x0a) #x1f (ite (= x #x0b) #x22 (ite (= x #x0c) #x25 (ite (= x #x0d) #x28 (ite (= x #x0e) #x2b (ite (= x #x0f) #x2e #x00)))))))))))))))))
+(assert (= (bvadd (lookup op) (lookup op2)) #x20))
+(assert (bvugt op (bvadd op2 #x04)))
+(check-sat)
+(exit)
@@ -0,0 +1,22 @@
+(set-logic QF_BV)
+(set-option :incremental true)
+(set-option :produce-models true)
+(declare-const a (_ BitVec 8))
+(declare-const b (_ BitVec 8))
+(declare-const c (_ BitVec 8))
+(declare-const d (_ BitVec 8))
+(declare-const e (_ BitVec 8))
+(declare-const p Bool)
+(assert (= (bvmul c d) #x0f))
+(assert (bvult e #x10))
+(assert (= (bvadd e c) #x21))
+(assert (bvugt a b))
+(check-sat-assuming ((= a #x05)))
+(get-value ((bvmul c d) (bvadd e c) (bvugt a b)))
+(check-sat-assuming ((= (bvadd a b) #x00) (= a #x01)))
+(check-sat-assuming (p (= a b)))
+(check-sat-assuming ((= e #x00)))
+(get-value (c (bvmul c d)))
+(check-sat-assuming ((= e #x01) (= d #x01)))
+(check-sat)
+(exit)
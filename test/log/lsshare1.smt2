@@ -0,0 +1,10 @@
+(set-logic QF_BV)
+(set-option :incremental true)
+(declare-const x (_ BitVec 8))
+(declare-const y (_ BitVec 8))
+(declare-const z (_ BitVec 8))
+(assert (= (bvand x y) #xf0))
+(assert (= (bvmul z z) #x31))
+(check-sat)
+(assert (bvult x (bvmul y z)))
+(check-sat)
@@ -0,0 +1,7 @@
+(set-logic BV)
+(declare-const a (_ BitVec 8))
+(declare-const b (_ BitVec 8))
+(assert (forall ((x (_ BitVec 8))) (bvule (bvand x a) (bvor x b))))
+(assert (forall ((y (_ BitVec 8))) (=> (bvult y #x10) (bvult (bvadd y a) #x20))))
+(assert (forall ((z (_ BitVec 8))) (distinct (bvmul z b) #x01)))
+(check-sat)
@@ -0,0 +1,7 @@
+(set-logic BV)
+(declare-const a (_ BitVec 8))
+(declare-const b (_ BitVec 8))
+(assert (forall ((x (_ BitVec 8))) (bvuge (bvor x a) a)))
+(assert (forall ((y (_ BitVec 8))) (=> (bvult y #x80) (bvule (bvand y b) #x7f))))
+(assert (forall ((z (_ BitVec 8))) (distinct (bvadd z b) a)))
+(check-sat)
@@ -0,0 +1,21 @@
+(set-logic QF_BV)
+(declare-const x0 (_ BitVec 8))
+(declare-const x1 (_ BitVec 8))
+(declare-const x2 (_ BitVec 8))
+(declare-const x3 (_ BitVec 8))
+(declare-const x4 (_ BitVec 8))
+(declare-const x5 (_ BitVec 8))
+(declare-const x6 (_ BitVec 8))
+(declare-const x7 (_ BitVec 8))
+(assert (= x3 x2))
+(assert (= x1 x0))
+(assert (= x2 x1))
+(assert (= x1 x4))
+(assert (= x4 x3))
+(assert (= x5 (bvadd x3 #x01)))
+(assert (= x6 x5))
+(assert (= x4 (bvsub x6 #x01)))
+(assert (= x7 (bvmul x6 x2)))
+(assert (= x7 #x06))
+(check-sat)
+(exit)
@@ -0,0 +1,124 @@
+###
+# Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+#
+# This file is part of Bitwuzla.
+#
+# Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+#
+# See COPYING for more information on using this software.
+##
+
+import os
+import pytest
+import threading
+import time
+from pybitwuzla import *
+
+# Factoring semi-primes p * q with 1 < x < p, which is unsatisfiable.
+# With 20-bit factors, solving takes a fraction of a second.
+def mk_factor(width = 20, p = 4093, q = 65521):
+    bzla = Bitwuzla()
+    sort = bzla.mk_bv_sort(width)
+    wide = bzla.mk_bv_sort(2 * width)
+    x = bzla.mk_const(sort, 'x')
+    y = bzla.mk_const(sort, 'y')
+    one = bzla.mk_bv_value(sort, 1)
+    xx = bzla.mk_term(Kind.BV_ZERO_EXTEND, [x], [width])
+    yy = bzla.mk_term(Kind.BV_ZERO_EXTEND, [y], [width])
+    bzla.assert_formula(
+        bzla.mk_term(Kind.EQUAL,
+                     [bzla.mk_term(Kind.BV_MUL, [xx, yy]),
+                      bzla.mk_bv_value(wide, p * q)]))
+    bzla.assert_formula(bzla.mk_term(Kind.BV_UGT, [x, one]))
+    bzla.assert_formula(bzla.mk_term(Kind.BV_UGT, [y, one]))
+    bzla.assert_formula(
+        bzla.mk_term(Kind.BV_ULT, [x, bzla.mk_bv_value(sort, p)]))
+    return bzla
+
+
+def solve(bzla, results, i):
+    results[i] = bzla.check_sat()
+
+
+def run_threads(instances):
+    results = [None] * len(instances)
+    threads = [threading.Thread(target=solve, args=(b, results, i))
+               for i, b in enumerate(instances)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    return results
+
+
+def test_check_sat_releases_gil():
+    bzla = mk_factor()
+    results = [None]
+    t = threading.Thread(target=solve, args=(bzla, results, 0))
+    t.start()
+    # The main thread only makes progress while the solver thread does not
+    # hold the GIL.
+    ticks = 0
+    while t.is_alive():
+        ticks += 1
+        time.sleep(0.001)
+    t.join()
+    assert results[0] == Result.UNSAT
+    assert ticks > 10
+
+
+def test_terminate_threads():
+    def termfun(calls, i):
+        calls[i] += 1
+        return True
+
+    instances = [mk_factor() for _ in range(4)]
+    calls = [0] * len(instances)
+    for i, bzla in enumerate(instances):
+        bzla.set_term(termfun, [calls, i])
+    results = run_threads(instances)
+    assert all(r == Result.UNKNOWN for r in results)
+    assert all(c > 0 for c in calls)
+
+
+def test_terminate_exception_threads():
+    def termfun():
+        raise ValueError('termination callback failed')
+
+    instances = [mk_factor(), mk_factor()]
+    instances[0].set_term(termfun, None)
+    errors = [None, None]
+
+    def solve_catch(i):
+        try:
+            instances[i].check_sat()
+        except BitwuzlaException as e:
+            errors[i] = e
+
+    threads = [threading.Thread(target=solve_catch, args=(i,))
+               for i in range(2)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert errors[0] is not None
+    assert errors[1] is None
+
+
+@pytest.mark.skipif((os.cpu_count() or 1) < 2,
+                    reason="requires at least two CPUs")
+def test_threads_speedup():
+    n = min(os.cpu_count(), 4)
+
+    start = time.time()
+    for bzla in [mk_factor() for _ in range(n)]:
+        assert bzla.check_sat() == Result.UNSAT
+    seq = time.time() - start
+
+    start = time.time()
+    results = run_threads([mk_factor() for _ in range(n)])
+    par = time.time() - start
+
+    assert all(r == Result.UNSAT for r in results)
+    # Near-linear would be n, be tolerant w.r.t. noisy machines.
+    assert seq / par > 0.5 * n
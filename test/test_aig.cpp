@@ -7,6 +7,8 @@
  *
  * See COPYING for more information on using this software.
  */
+#include <vector>
+
 #include "test.h"
 
 extern "C" {
@@ -66,7 +68,7 @@ TEST_F(TestAig, var)
   open_log_file("var_aig");
   BzlaAIGMgr *amgr = bzla_aig_mgr_new(d_bzla);
   BzlaAIG *var     = bzla_aig_var(amgr);
-  ASSERT_TRUE(bzla_aig_is_var(var));
+  ASSERT_TRUE(bzla_aig_is_var(amgr, var));
   bzla_dumpaig_dump_aig(amgr, 0, d_log_file, var);
   bzla_aig_release(amgr, var);
   bzla_aig_mgr_delete(amgr);
@@ -145,3 +147,55 @@ TEST_F(TestAig, aig_to_sat)
   bzla_aig_release(amgr, and3);
   bzla_aig_mgr_delete(amgr);
 }
+
+TEST_F(TestAig, store)
+{
+  BzlaAIGMgr *amgr = bzla_aig_mgr_new(d_bzla);
+  BzlaAIG *var1    = bzla_aig_var(amgr);
+  BzlaAIG *var2    = bzla_aig_var(amgr);
+  BzlaAIG *and1    = bzla_aig_and(amgr, var1, BZLA_INVERT_AIG(var2));
+
+  /* literals are 2 * id + sign, ids 0 and 1 are reserved */
+  ASSERT_EQ(BZLA_AIG_GET_LIT(var1), 4u);
+  ASSERT_EQ(BZLA_AIG_GET_LIT(var2), 6u);
+  ASSERT_EQ(BZLA_AIG_GET_LIT(BZLA_INVERT_AIG(var2)), 7u);
+  ASSERT_EQ(bzla_aig_get_id(BZLA_INVERT_AIG(and1)), -4);
+  ASSERT_EQ(bzla_aig_get_by_id(amgr, -4), BZLA_INVERT_AIG(and1));
+  ASSERT_TRUE(bzla_aig_is_var(amgr, var1));
+  ASSERT_FALSE(bzla_aig_is_and(amgr, var1));
+  ASSERT_TRUE(bzla_aig_is_and(amgr, BZLA_INVERT_AIG(and1)));
+  ASSERT_EQ(bzla_aig_get_left_child(amgr, and1), var1);
+  ASSERT_EQ(bzla_aig_get_right_child(amgr, and1), BZLA_INVERT_AIG(var2));
+  ASSERT_EQ(bzla_aig_get_refs(amgr, var1), 2u);
+  ASSERT_EQ(bzla_aig_get_cnf_id(amgr, and1), 0);
+
+  /* enlarge the store, existing AIGs are preserved */
+  std::vector<BzlaAIG *> aigs;
+  BzlaAIG *cur = and1;
+  for (uint32_t i = 0; i < 1000; i++)
+  {
+    BzlaAIG *var = bzla_aig_var(amgr);
+    cur          = bzla_aig_and(amgr, cur, var);
+    aigs.push_back(var);
+    aigs.push_back(cur);
+  }
+  ASSERT_GE(amgr->size_ids, amgr->num_ids);
+  ASSERT_EQ(amgr->num_ids, 2005u);
+  ASSERT_EQ(bzla_aig_get_right_child(amgr, and1), BZLA_INVERT_AIG(var2));
+  for (uint32_t i = 1; i < aigs.size(); i += 2)
+  {
+    ASSERT_EQ(bzla_aig_get_right_child(amgr, aigs[i]), aigs[i - 1]);
+  }
+  ASSERT_EQ(bzla_aig_and(amgr, and1, aigs[0]), aigs[1]);
+  bzla_aig_release(amgr, aigs[1]);
+
+  for (BzlaAIG *aig : aigs) bzla_aig_release(amgr, aig);
+  ASSERT_EQ(amgr->cur_num_aigs, 1u);
+  ASSERT_EQ(amgr->cur_num_aig_vars, 2u);
+  bzla_aig_release(amgr, var1);
+  bzla_aig_release(amgr, var2);
+  bzla_aig_release(amgr, and1);
+  ASSERT_EQ(amgr->cur_num_aigs, 0u);
+  ASSERT_EQ(amgr->cur_num_aig_vars, 0u);
+  bzla_aig_mgr_delete(amgr);
+}
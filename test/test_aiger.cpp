@@ -0,0 +1,243 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include <fstream>
+
+#include "test.h"
+
+extern "C" {
+#include "bzlaaig.h"
+#include "bzlacore.h"
+#include "bzlaexp.h"
+#include "dumper/bzladumpaig.h"
+#include "parser/bzlaaiger.h"
+}
+
+class TestAiger : public TestBzla
+{
+ protected:
+  void SetUp() override
+  {
+    TestBzla::SetUp();
+    d_amgr = bzla_aig_mgr_new(d_bzla);
+    BZLA_INIT_STACK(d_bzla->mm, d_inputs);
+    BZLA_INIT_STACK(d_bzla->mm, d_outputs);
+  }
+
+  void TearDown() override
+  {
+    release_stack(d_inputs);
+    release_stack(d_outputs);
+    BZLA_RELEASE_STACK(d_inputs);
+    BZLA_RELEASE_STACK(d_outputs);
+    bzla_aig_mgr_delete(d_amgr);
+    TestBzla::TearDown();
+  }
+
+  void release_stack(BzlaAIGPtrStack &stack)
+  {
+    while (!BZLA_EMPTY_STACK(stack))
+      bzla_aig_release(d_amgr, BZLA_POP_STACK(stack));
+  }
+
+  /* Dump 'roots' and import the model again, the imported outputs must be
+   * the original roots. */
+  void round_trip(bool is_binary, std::vector<BzlaAIG *> &roots)
+  {
+    FILE *file = tmpfile();
+    BzlaAIGPtrStack inputs;
+
+    BZLA_INIT_STACK(d_bzla->mm, inputs);
+    bzla_dumpaig_dump_roots(
+        d_amgr, is_binary, file, roots.size(), roots.data(), &inputs);
+    rewind(file);
+    ASSERT_EQ(bzla_aiger_import(d_amgr,
+                                file,
+                                BZLA_COUNT_STACK(inputs),
+                                inputs.start,
+                                &d_outputs),
+              nullptr);
+    fclose(file);
+    ASSERT_EQ(BZLA_COUNT_STACK(d_outputs), roots.size());
+    for (size_t i = 0; i < roots.size(); i++)
+    {
+      ASSERT_EQ(BZLA_PEEK_STACK(d_outputs, i), roots[i]);
+    }
+    release_stack(d_outputs);
+    BZLA_RELEASE_STACK(inputs);
+  }
+
+  const char *import(const char *model, uint32_t ninputs)
+  {
+    const char *res;
+    FILE *file = tmpfile();
+
+    fputs(model, file);
+    rewind(file);
+    while (BZLA_COUNT_STACK(d_inputs) < ninputs)
+      BZLA_PUSH_STACK(d_inputs, bzla_aig_var(d_amgr));
+    res = bzla_aiger_import(d_amgr, file, ninputs, d_inputs.start, &d_outputs);
+    fclose(file);
+    return res;
+  }
+
+  BzlaAIGMgr *d_amgr;
+  BzlaAIGPtrStack d_inputs;
+  BzlaAIGPtrStack d_outputs;
+};
+
+TEST_F(TestAiger, round_trip)
+{
+  std::vector<BzlaAIG *> vars, roots;
+
+  for (uint32_t i = 0; i < 4; i++) vars.push_back(bzla_aig_var(d_amgr));
+  roots.push_back(bzla_aig_and(d_amgr, vars[0], vars[1]));
+  roots.push_back(bzla_aig_or(d_amgr, vars[2], BZLA_INVERT_AIG(roots[0])));
+  roots.push_back(bzla_aig_eq(d_amgr, vars[3], roots[1]));
+  roots.push_back(bzla_aig_cond(d_amgr, vars[0], roots[2], vars[3]));
+  roots.push_back(bzla_aig_copy(d_amgr, BZLA_AIG_TRUE));
+  roots.push_back(bzla_aig_copy(d_amgr, BZLA_AIG_FALSE));
+  roots.push_back(bzla_aig_copy(d_amgr, BZLA_INVERT_AIG(vars[1])));
+
+  round_trip(false, roots);
+  round_trip(true, roots);
+
+  for (BzlaAIG *aig : roots) bzla_aig_release(d_amgr, aig);
+  for (BzlaAIG *aig : vars) bzla_aig_release(d_amgr, aig);
+}
+
+TEST_F(TestAiger, import_ascii)
+{
+  /* AND gates are not required to be ordered in the ascii format */
+  ASSERT_EQ(import("aag 5 2 0 2 3\n2\n4\n10\n1\n10 8 7\n8 6 2\n6 2 4\n", 2),
+            nullptr);
+  ASSERT_EQ(BZLA_COUNT_STACK(d_outputs), 2u);
+  BzlaAIG *a = BZLA_PEEK_STACK(d_inputs, 0);
+  BzlaAIG *b = BZLA_PEEK_STACK(d_inputs, 1);
+  BzlaAIG *and_ab = bzla_aig_and(d_amgr, a, b);
+  BzlaAIG *and_aab = bzla_aig_and(d_amgr, and_ab, a);
+  BzlaAIG *res =
+      bzla_aig_and(d_amgr, and_aab, BZLA_INVERT_AIG(and_ab));
+  ASSERT_EQ(BZLA_PEEK_STACK(d_outputs, 0), res);
+  ASSERT_EQ(BZLA_PEEK_STACK(d_outputs, 1), BZLA_AIG_TRUE);
+  bzla_aig_release(d_amgr, res);
+  bzla_aig_release(d_amgr, and_aab);
+  bzla_aig_release(d_amgr, and_ab);
+}
+
+TEST_F(TestAiger, import_errors)
+{
+  ASSERT_NE(import("aug 0 0 0 0 0\n", 0), nullptr);
+  ASSERT_NE(import("aag 1 1 0 0 0\n2\n", 2), nullptr);
+  ASSERT_NE(import("aag 1 0 1 0 0\n2 3\n", 0), nullptr);
+  ASSERT_NE(import("aag 1 1 0 1 0\n2\n4\n", 1), nullptr);
+  ASSERT_NE(import("aag 3 1 0 1 2\n2\n6\n6 4 2\n4 6 2\n", 1), nullptr);
+  ASSERT_NE(import("aag 2 1 0 1 1\n2\n4\n4 2\n", 1), nullptr);
+  ASSERT_NE(import("aig 2 1 0 1 1\n4\n", 1), nullptr);
+  ASSERT_EQ(BZLA_COUNT_STACK(d_outputs), 0u);
+}
+
+/*------------------------------------------------------------------------*/
+
+class TestAigerOptimizer : public TestBzla
+{
+ protected:
+  void SetUp() override
+  {
+    TestBzla::SetUp();
+    /* do not simplify the constraints before bit-blasting */
+    bzla_opt_set(d_bzla, BZLA_OPT_RW_LEVEL, 0);
+  }
+
+  /* Assert x * y = 1 and optionally that x is even. */
+  void assert_mul(bool even)
+  {
+    BzlaSortId sort = bzla_sort_bv(d_bzla, 8);
+    BzlaNode *x     = bzla_exp_var(d_bzla, sort, "x");
+    BzlaNode *y     = bzla_exp_var(d_bzla, sort, "y");
+    BzlaNode *mul   = bzla_exp_bv_mul(d_bzla, x, y);
+    BzlaNode *one   = bzla_exp_bv_one(d_bzla, sort);
+    BzlaNode *eq    = bzla_exp_eq(d_bzla, mul, one);
+    bzla_assert_exp(d_bzla, eq);
+    if (even)
+    {
+      BzlaNode *lsb = bzla_exp_bv_slice(d_bzla, x, 0, 0);
+      bzla_assert_exp(d_bzla, bzla_node_invert(lsb));
+      bzla_node_release(d_bzla, lsb);
+    }
+    bzla_node_release(d_bzla, eq);
+    bzla_node_release(d_bzla, one);
+    bzla_node_release(d_bzla, mul);
+    bzla_node_release(d_bzla, y);
+    bzla_node_release(d_bzla, x);
+    bzla_sort_release(d_bzla, sort);
+  }
+
+  /* Copies the model, i.e., the identity optimizer. */
+  static int32_t copy(void *state, const char *in, const char *out)
+  {
+    std::ifstream src(in, std::ios::binary);
+    std::ofstream dst(out, std::ios::binary);
+    dst << src.rdbuf();
+    *static_cast<uint32_t *>(state) += 1;
+    return 0;
+  }
+
+  static int32_t fail(void *state, const char *in, const char *out)
+  {
+    (void) in;
+    (void) out;
+    *static_cast<uint32_t *>(state) += 1;
+    return 1;
+  }
+
+  static int32_t garbage(void *state, const char *in, const char *out)
+  {
+    (void) in;
+    std::ofstream dst(out);
+    dst << "aag 1 0 0 1 0\n3\n";
+    *static_cast<uint32_t *>(state) += 1;
+    return 0;
+  }
+
+  uint32_t d_calls = 0;
+};
+
+TEST_F(TestAigerOptimizer, identity)
+{
+  bzla_set_aig_optimizer(d_bzla, copy, &d_calls);
+  assert_mul(false);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_SAT);
+  ASSERT_EQ(d_calls, 1u);
+}
+
+TEST_F(TestAigerOptimizer, identity_unsat)
+{
+  bzla_set_aig_optimizer(d_bzla, copy, &d_calls);
+  assert_mul(true);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_UNSAT);
+  ASSERT_EQ(d_calls, 1u);
+}
+
+TEST_F(TestAigerOptimizer, fail)
+{
+  bzla_set_aig_optimizer(d_bzla, fail, &d_calls);
+  assert_mul(true);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_UNSAT);
+  ASSERT_EQ(d_calls, 1u);
+}
+
+TEST_F(TestAigerOptimizer, mismatch)
+{
+  bzla_set_aig_optimizer(d_bzla, garbage, &d_calls);
+  assert_mul(true);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_UNSAT);
+  ASSERT_EQ(d_calls, 1u);
+}
@@ -97,7 +97,7 @@ TEST_F(TestAigvec, invert)
   for (i = 0; i < width; i++)
   {
     ASSERT_TRUE(!BZLA_IS_INVERTED_AIG(av1->aigs[i]));
-    ASSERT_TRUE(bzla_aig_is_var(av1->aigs[i]));
+    ASSERT_TRUE(bzla_aig_is_var(avmgr->amgr, av1->aigs[i]));
   }
   bzla_aigvec_invert(avmgr, av1);
   for (i = 0; i < width; i++) ASSERT_TRUE(BZLA_IS_INVERTED_AIG(av1->aigs[i]));
@@ -105,7 +105,7 @@ TEST_F(TestAigvec, invert)
   for (i = 0; i < width; i++)
   {
     ASSERT_TRUE(!BZLA_IS_INVERTED_AIG(av1->aigs[i]));
-    ASSERT_TRUE(bzla_aig_is_var(av1->aigs[i]));
+    ASSERT_TRUE(bzla_aig_is_var(avmgr->amgr, av1->aigs[i]));
   }
   ASSERT_TRUE(av2->aigs[0] == BZLA_AIG_TRUE);
   ASSERT_TRUE(av2->aigs[1] == BZLA_AIG_FALSE);
@@ -293,3 +293,51 @@ TEST_F(TestAigvec, cond)
   bzla_aigvec_release_delete(avmgr, av4);
   bzla_aigvec_mgr_delete(avmgr);
 }
+
+TEST_F(TestAigvec, select)
+{
+  uint32_t i, j, k;
+  uint64_t values[4] = {1, 4, 6, 7};
+  BzlaBitVector *consts[4], *bits;
+  BzlaAIGVec *cases[4], *av_sel, *av_def, *av_res, *av_exp;
+  BzlaAIGVecMgr *avmgr = bzla_aigvec_mgr_new(d_bzla);
+
+  for (i = 0; i < 4; i++)
+  {
+    consts[i] = bzla_bv_uint64_to_bv(d_bzla->mm, values[i], 3);
+    cases[i]  = bzla_aigvec_var(avmgr, 8);
+  }
+  av_def = bzla_aigvec_var(avmgr, 8);
+
+  /* with a constant selector, the selected case is propagated */
+  for (i = 0; i < 8; i++)
+  {
+    bits   = bzla_bv_uint64_to_bv(d_bzla->mm, i, 3);
+    av_sel = bzla_aigvec_const(avmgr, bits);
+    av_res = bzla_aigvec_select(avmgr, av_sel, 4, consts, cases, av_def);
+    ASSERT_EQ(av_res->width, 8u);
+    for (j = 0, k = 4; j < 4; j++)
+    {
+      if (values[j] == i) k = j;
+    }
+    av_exp = k < 4 ? cases[k] : av_def;
+    ASSERT_EQ(memcmp(av_res->aigs, av_exp->aigs, sizeof(BzlaAIG *) * 8), 0);
+    bzla_aigvec_release_delete(avmgr, av_res);
+    bzla_aigvec_release_delete(avmgr, av_sel);
+    bzla_bv_free(d_bzla->mm, bits);
+  }
+
+  av_sel = bzla_aigvec_var(avmgr, 3);
+  av_res = bzla_aigvec_select(avmgr, av_sel, 4, consts, cases, av_def);
+  ASSERT_EQ(av_res->width, 8u);
+  bzla_aigvec_release_delete(avmgr, av_res);
+  bzla_aigvec_release_delete(avmgr, av_sel);
+
+  for (i = 0; i < 4; i++)
+  {
+    bzla_aigvec_release_delete(avmgr, cases[i]);
+    bzla_bv_free(d_bzla->mm, consts[i]);
+  }
+  bzla_aigvec_release_delete(avmgr, av_def);
+  bzla_aigvec_mgr_delete(avmgr);
+}
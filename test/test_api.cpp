@@ -232,9 +232,8 @@ class TestApi : public TestBitwuzla
   const char *d_error_unsat            = "if input formula is not unsat";
   const char *d_error_unsat_cores      = "unsat core production not enabled";
   const char *d_error_sat              = "if input formula is not sat";
+  const char *d_error_async = "asynchronous satisfiability check in progress";
   const char *d_error_format           = "unknown format";
-  const char *d_error_inc_quant =
-      "incremental solving is currently not supported with quantifiers";
 };
 
 /* -------------------------------------------------------------------------- */
@@ -2680,6 +2679,14 @@ TEST_F(TestApi, get_unsat_assumptions)
     bitwuzla_assert(d_bzla, unsat_ass[i]);
   }
   ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_UNSAT);
+
+  bitwuzla_set_option(d_other_bzla, BITWUZLA_OPT_INCREMENTAL, 1);
+  bitwuzla_assert(d_other_bzla, d_other_exists);
+  bitwuzla_assume(d_other_bzla, bitwuzla_mk_false(d_other_bzla));
+  ASSERT_EQ(bitwuzla_check_sat(d_other_bzla), BITWUZLA_UNSAT);
+  ASSERT_DEATH(
+      bitwuzla_get_unsat_assumptions(d_other_bzla, &size),
+      "unsat assumptions are currently not supported with quantifiers");
 }
 
 TEST_F(TestApi, get_unsat_core)
@@ -2778,7 +2785,8 @@ TEST_F(TestApi, check_sat)
 
   bitwuzla_set_option(d_other_bzla, BITWUZLA_OPT_INCREMENTAL, 1);
   bitwuzla_assert(d_other_bzla, d_other_exists);
-  ASSERT_DEATH(bitwuzla_check_sat(d_other_bzla), d_error_inc_quant);
+  ASSERT_EQ(bitwuzla_check_sat(d_other_bzla), BITWUZLA_SAT);
+  ASSERT_EQ(bitwuzla_check_sat(d_other_bzla), BITWUZLA_SAT);
 
   Bitwuzla *bzla = bitwuzla_new();
   bitwuzla_set_option(bzla, BITWUZLA_OPT_INCREMENTAL, 1);
@@ -2786,6 +2794,71 @@ TEST_F(TestApi, check_sat)
   bitwuzla_delete(bzla);
 }
 
+TEST_F(TestApi, check_sat_async)
+{
+  ASSERT_DEATH(bitwuzla_check_sat_async(nullptr), d_error_not_null);
+  ASSERT_DEATH(bitwuzla_check_sat_poll(nullptr), d_error_not_null);
+  ASSERT_DEATH(bitwuzla_check_sat_wait(nullptr, -1), d_error_not_null);
+  ASSERT_DEATH(bitwuzla_check_sat_cancel(nullptr), d_error_not_null);
+  ASSERT_DEATH(bitwuzla_check_sat_join(nullptr), d_error_not_null);
+
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_INCREMENTAL, 1);
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+  bitwuzla_assert(d_bzla, d_bv_const1);
+
+  BitwuzlaCheckSatHandle *handle = bitwuzla_check_sat_async(d_bzla);
+  ASSERT_TRUE(bitwuzla_check_sat_wait(handle, -1));
+  ASSERT_TRUE(bitwuzla_check_sat_poll(handle));
+  ASSERT_DEATH(bitwuzla_assert(d_bzla, d_not_bv_const1), d_error_async);
+  ASSERT_DEATH(bitwuzla_check_sat(d_bzla), d_error_async);
+  ASSERT_DEATH(bitwuzla_check_sat_async(d_bzla), d_error_async);
+  ASSERT_DEATH(bitwuzla_get_value(d_bzla, d_bv_const1), d_error_async);
+  ASSERT_EQ(bitwuzla_check_sat_join(handle), BITWUZLA_SAT);
+  ASSERT_NO_FATAL_FAILURE(bitwuzla_get_value(d_bzla, d_bv_const1));
+
+  bitwuzla_assume(d_bzla, d_not_bv_const1);
+  handle = bitwuzla_check_sat_async(d_bzla);
+  ASSERT_EQ(bitwuzla_check_sat_join(handle), BITWUZLA_UNSAT);
+  ASSERT_TRUE(bitwuzla_is_unsat_assumption(d_bzla, d_not_bv_const1));
+}
+
+TEST_F(TestApi, check_sat_async_cancel)
+{
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_INCREMENTAL, 1);
+  /* local search does not terminate on unsatisfiable inputs */
+  bitwuzla_set_option_str(d_bzla, BITWUZLA_OPT_ENGINE, "prop");
+
+  /* odd squares are congruent to 1 modulo 8 */
+  const BitwuzlaTerm *x = bitwuzla_mk_const(d_bzla, d_bv_sort32, "x");
+  const BitwuzlaTerm *xx =
+      bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_BV_MUL, x, x);
+  const BitwuzlaTerm *three =
+      bitwuzla_mk_bv_value_uint64(d_bzla, d_bv_sort32, 3);
+
+  bitwuzla_push(d_bzla, 1);
+  bitwuzla_assert(d_bzla,
+                  bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_EQUAL, xx, three));
+  BitwuzlaCheckSatHandle *handle = bitwuzla_check_sat_async(d_bzla);
+  ASSERT_FALSE(bitwuzla_check_sat_wait(handle, 50));
+  ASSERT_FALSE(bitwuzla_check_sat_poll(handle));
+  bitwuzla_check_sat_cancel(handle);
+  ASSERT_TRUE(bitwuzla_check_sat_wait(handle, -1));
+  ASSERT_EQ(bitwuzla_check_sat_join(handle), BITWUZLA_UNKNOWN);
+
+  /* cancellation does not affect subsequent checks */
+  bitwuzla_pop(d_bzla, 1);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+}
+
+TEST_F(TestApi, check_sat_async_term)
+{
+  bitwuzla_set_termination_callback(
+      d_bzla, [](void *) { return 1; }, nullptr);
+  bitwuzla_assert(d_bzla, d_bv_const1);
+  BitwuzlaCheckSatHandle *handle = bitwuzla_check_sat_async(d_bzla);
+  ASSERT_EQ(bitwuzla_check_sat_join(handle), BITWUZLA_UNKNOWN);
+}
+
 TEST_F(TestApi, get_value)
 {
   bitwuzla_set_option(d_bzla, BITWUZLA_OPT_INCREMENTAL, 1);
@@ -2805,12 +2878,9 @@ TEST_F(TestApi, get_value)
   bitwuzla_assert(d_other_bzla, d_other_exists);
   ASSERT_DEATH(bitwuzla_get_value(d_other_bzla, d_other_bv_const8),
                d_error_sat);
-  ASSERT_DEATH(bitwuzla_check_sat(d_other_bzla),
-               "Quantifiers support is disabled.");
-// Disabled since quantifiers support was disabled.
-//  ASSERT_EQ(bitwuzla_check_sat(d_other_bzla), BITWUZLA_SAT);
-//  ASSERT_DEATH(bitwuzla_get_value(d_other_bzla, d_other_bv_const8),
-//               "'get-value' is currently not supported with quantifiers");
+  ASSERT_EQ(bitwuzla_check_sat(d_other_bzla), BITWUZLA_SAT);
+  ASSERT_DEATH(bitwuzla_get_value(d_other_bzla, d_other_bv_const8),
+               "'get-value' is currently not supported with quantifiers");
 }
 
 TEST_F(TestApi, get_bv_value)
@@ -3001,12 +3071,9 @@ TEST_F(TestApi, print_model)
 
   bitwuzla_set_option(d_other_bzla, BITWUZLA_OPT_PRODUCE_MODELS, 1);
   bitwuzla_assert(d_other_bzla, d_other_exists);
-  ASSERT_DEATH(bitwuzla_check_sat(d_other_bzla),
-               "Quantifiers support is disabled.");
-// Disabled since quantifiers support was disabled.
-//  ASSERT_EQ(bitwuzla_check_sat(d_other_bzla), BITWUZLA_SAT);
-//  ASSERT_NO_FATAL_FAILURE(bitwuzla_print_model(d_other_bzla, "btor", stdout));
-//  ASSERT_NO_FATAL_FAILURE(bitwuzla_print_model(d_other_bzla, "smt2", stdout));
+  ASSERT_EQ(bitwuzla_check_sat(d_other_bzla), BITWUZLA_SAT);
+  ASSERT_NO_FATAL_FAILURE(bitwuzla_print_model(d_other_bzla, "btor", stdout));
+  ASSERT_NO_FATAL_FAILURE(bitwuzla_print_model(d_other_bzla, "smt2", stdout));
 }
 
 TEST_F(TestApi, dump_formula1)
@@ -3874,6 +3941,30 @@ TEST_F(TestApi, reset)
   bitwuzla_delete(bzla);
 }
 
+TEST_F(TestApi, term_store)
+{
+  BitwuzlaTermStore *store = bitwuzla_term_store_new();
+  Bitwuzla *bzla           = bitwuzla_new();
+  ASSERT_DEATH(bitwuzla_set_term_store(nullptr, store), d_error_not_null);
+  ASSERT_DEATH(bitwuzla_set_term_store(bzla, nullptr), d_error_not_null);
+  bitwuzla_set_term_store(d_bzla, store);
+  bitwuzla_set_term_store(bzla, store);
+  ASSERT_DEATH(bitwuzla_set_term_store(bzla, store), "already attached");
+  /* The store is kept alive by the instances it is attached to. */
+  bitwuzla_term_store_delete(store);
+
+  const BitwuzlaSort *s = bitwuzla_mk_bv_sort(bzla, 8);
+  const BitwuzlaTerm *x = bitwuzla_mk_const(bzla, s, "x");
+  const BitwuzlaTerm *c = bitwuzla_mk_bv_value_uint64(bzla, s, 42);
+  bitwuzla_assert(bzla, bitwuzla_mk_term2(bzla, BITWUZLA_KIND_EQUAL, x, c));
+  ASSERT_EQ(BITWUZLA_SAT, bitwuzla_check_sat(bzla));
+  bitwuzla_reset(bzla);
+  s = bitwuzla_mk_bv_sort(bzla, 8);
+  c = bitwuzla_mk_bv_value_uint64(bzla, s, 42);
+  ASSERT_EQ(BITWUZLA_SAT, bitwuzla_check_sat(bzla));
+  bitwuzla_delete(bzla);
+}
+
 TEST_F(TestApi, indexed)
 {
   const BitwuzlaSort *fp_sort = bitwuzla_mk_fp_sort(d_bzla, 5, 11);
@@ -0,0 +1,136 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include "test.h"
+
+extern "C" {
+#include "bzlaautoconf.h"
+#include "bzlacore.h"
+#include "bzlaexp.h"
+}
+
+class TestAutoConf : public TestBzla
+{
+ protected:
+  void SetUp() override
+  {
+    TestBzla::SetUp();
+    bzla_opt_set(d_bzla, BZLA_OPT_ENGINE, BZLA_ENGINE_AUTO);
+  }
+
+  /* Assert x * y = 1 for fresh variables x, y of bit-width 'width'. */
+  void assert_mul(uint32_t width)
+  {
+    BzlaSortId sort = bzla_sort_bv(d_bzla, width);
+    BzlaNode *x     = bzla_exp_var(d_bzla, sort, 0);
+    BzlaNode *y     = bzla_exp_var(d_bzla, sort, 0);
+    BzlaNode *mul   = bzla_exp_bv_mul(d_bzla, x, y);
+    BzlaNode *one   = bzla_exp_bv_one(d_bzla, sort);
+    BzlaNode *eq    = bzla_exp_eq(d_bzla, mul, one);
+    bzla_assert_exp(d_bzla, eq);
+    bzla_node_release(d_bzla, eq);
+    bzla_node_release(d_bzla, one);
+    bzla_node_release(d_bzla, mul);
+    bzla_node_release(d_bzla, y);
+    bzla_node_release(d_bzla, x);
+    bzla_sort_release(d_bzla, sort);
+  }
+
+  double d_features[BZLA_AUTOCONF_F_NUM];
+};
+
+TEST_F(TestAutoConf, features)
+{
+  assert_mul(32);
+  bzla_autoconf_features(d_bzla, d_features);
+  /* eq, mul, x, y, one */
+  ASSERT_EQ(d_features[BZLA_AUTOCONF_F_NODES], 5);
+  ASSERT_EQ(d_features[BZLA_AUTOCONF_F_VARS], 2);
+  ASSERT_EQ(d_features[BZLA_AUTOCONF_F_MAX_WIDTH], 32);
+  ASSERT_GT(d_features[BZLA_AUTOCONF_F_ARITH], 0);
+  ASSERT_EQ(d_features[BZLA_AUTOCONF_F_ARRAYS], 0);
+  ASSERT_EQ(d_features[BZLA_AUTOCONF_F_QUANTIFIERS], 0);
+  ASSERT_EQ(d_features[BZLA_AUTOCONF_F_FP], 0);
+  ASSERT_EQ(d_features[BZLA_AUTOCONF_F_AIGS], 7 * 32 * 32 + 4 * 32);
+}
+
+TEST_F(TestAutoConf, classify)
+{
+  BzlaAutoConfNode model[] = {
+      {BZLA_AUTOCONF_F_VARS, 10, 1, 2, 0, -1, false},
+      {-1, 0, 0, 0, BZLA_ENGINE_PROP, -1, false},
+      {-1, 0, 0, 0, BZLA_ENGINE_FUN, BZLA_SAT_ENGINE_CADICAL, true},
+  };
+
+  for (uint32_t i = 0; i < BZLA_AUTOCONF_F_NUM; i++) d_features[i] = 0;
+  d_features[BZLA_AUTOCONF_F_VARS] = 10;
+  ASSERT_EQ(bzla_autoconf_classify(model, d_features), &model[1]);
+  d_features[BZLA_AUTOCONF_F_VARS] = 11;
+  ASSERT_EQ(bzla_autoconf_classify(model, d_features), &model[2]);
+}
+
+TEST_F(TestAutoConf, select_fun)
+{
+  assert_mul(8);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_SAT);
+  ASSERT_EQ(bzla_opt_get(d_bzla, BZLA_OPT_ENGINE), BZLA_ENGINE_FUN);
+  ASSERT_EQ(bzla_opt_get(d_bzla, BZLA_OPT_FUN_PREPROP), 0u);
+}
+
+TEST_F(TestAutoConf, select_preprop)
+{
+  /* large multiplications: prop preprocessing before bit-blasting */
+  assert_mul(256);
+  assert_mul(256);
+  bzla_autoconf(d_bzla);
+  ASSERT_EQ(bzla_opt_get(d_bzla, BZLA_OPT_ENGINE), BZLA_ENGINE_FUN);
+  ASSERT_EQ(bzla_opt_get(d_bzla, BZLA_OPT_FUN_PREPROP), 1u);
+  ASSERT_GT(bzla_opt_get(d_bzla, BZLA_OPT_PROP_NPROPS), 0u);
+}
+
+TEST_F(TestAutoConf, select_preprop_incremental)
+{
+  /* prop preprocessing is not used in incremental mode */
+  bzla_opt_set(d_bzla, BZLA_OPT_INCREMENTAL, 1);
+  assert_mul(256);
+  assert_mul(256);
+  bzla_autoconf(d_bzla);
+  ASSERT_EQ(bzla_opt_get(d_bzla, BZLA_OPT_ENGINE), BZLA_ENGINE_FUN);
+  ASSERT_EQ(bzla_opt_get(d_bzla, BZLA_OPT_FUN_PREPROP), 0u);
+}
+
+TEST_F(TestAutoConf, select_quant)
+{
+  BzlaSortId sort = bzla_sort_bv(d_bzla, 8);
+  BzlaNode *x     = bzla_exp_var(d_bzla, sort, 0);
+  BzlaNode *p     = bzla_exp_param(d_bzla, sort, 0);
+  BzlaNode *band  = bzla_exp_bv_and(d_bzla, p, x);
+  BzlaNode *eq    = bzla_exp_eq(d_bzla, band, p);
+  BzlaNode *all   = bzla_exp_forall(d_bzla, p, eq);
+  bzla_assert_exp(d_bzla, all);
+  bzla_autoconf(d_bzla);
+  ASSERT_EQ(bzla_opt_get(d_bzla, BZLA_OPT_ENGINE), BZLA_ENGINE_QUANT);
+  bzla_node_release(d_bzla, all);
+  bzla_node_release(d_bzla, eq);
+  bzla_node_release(d_bzla, band);
+  bzla_node_release(d_bzla, p);
+  bzla_node_release(d_bzla, x);
+  bzla_sort_release(d_bzla, sort);
+}
+
+TEST_F(TestAutoConf, no_auto)
+{
+  bzla_opt_set(d_bzla, BZLA_OPT_ENGINE, BZLA_ENGINE_PROP);
+  assert_mul(256);
+  assert_mul(256);
+  bzla_autoconf(d_bzla);
+  ASSERT_EQ(bzla_opt_get(d_bzla, BZLA_OPT_ENGINE), BZLA_ENGINE_PROP);
+  ASSERT_EQ(bzla_opt_get(d_bzla, BZLA_OPT_FUN_PREPROP), 0u);
+}
@@ -366,6 +366,41 @@ class TestBv : public TestBzla
     bzla_bv_free(d_mm, zero);
   }
 
+  void binary_into_bitvec(BzlaBitVector *(*bitvec_func)(BzlaMemMgr *,
+                                                        const BzlaBitVector *,
+                                                        const BzlaBitVector *),
+                          void (*into_func)(BzlaBitVector *,
+                                            const BzlaBitVector *,
+                                            const BzlaBitVector *),
+                          uint32_t bit_width)
+  {
+    uint32_t i;
+    BzlaBitVector *bv1, *bv2, *exp, *res;
+
+    res = bzla_bv_new(d_mm, bit_width);
+    for (i = 0; i < TEST_BITVEC_TESTS / 10; i++)
+    {
+      bv1 = bzla_bv_new_random(d_mm, d_rng, bit_width);
+      bv2 = bzla_bv_new_random(d_mm, d_rng, bit_width);
+      exp = bitvec_func(d_mm, bv1, bv2);
+      /* result is a separate bit-vector */
+      into_func(res, bv1, bv2);
+      ASSERT_EQ(bzla_bv_compare(res, exp), 0);
+      /* result is the first operand */
+      bzla_bv_set(res, bv1);
+      into_func(res, res, bv2);
+      ASSERT_EQ(bzla_bv_compare(res, exp), 0);
+      /* result is the second operand */
+      bzla_bv_set(res, bv2);
+      into_func(res, bv1, res);
+      ASSERT_EQ(bzla_bv_compare(res, exp), 0);
+      bzla_bv_free(d_mm, exp);
+      bzla_bv_free(d_mm, bv1);
+      bzla_bv_free(d_mm, bv2);
+    }
+    bzla_bv_free(d_mm, res);
+  }
+
   void binary_signed_bitvec(
       int64_t (*int_func)(int64_t, int64_t, uint32_t),
       BzlaBitVector *(*bitvec_func)(BzlaMemMgr *,
@@ -4286,4 +4321,99 @@ TEST_F(TestBv, test_get_num_leading_ones)
   test_get_num(176, bzla_bv_get_num_leading_ones, true, false);
 }
 
+TEST_F(TestBv, get_num_diff_bits)
+{
+  BzlaBitVector *a, *b;
+
+  a = bzla_bv_uint64_to_bv(d_mm, 13, 67);
+  b = bzla_bv_uint64_to_bv(d_mm, 6, 67);
+  bzla_bv_set_bit(b, 66, 1);
+  ASSERT_EQ(bzla_bv_get_num_diff_bits(a, b), 4u);
+  ASSERT_EQ(bzla_bv_get_num_diff_bits(a, a), 0u);
+  bzla_bv_free(d_mm, a);
+  bzla_bv_free(d_mm, b);
+}
+
+TEST_F(TestBv, is_bits_subset)
+{
+  BzlaBitVector *a, *b;
+
+  a = bzla_bv_uint64_to_bv(d_mm, 5, 67);
+  b = bzla_bv_uint64_to_bv(d_mm, 7, 67);
+  bzla_bv_set_bit(b, 66, 1);
+  ASSERT_TRUE(bzla_bv_is_bits_subset(a, b));
+  ASSERT_FALSE(bzla_bv_is_bits_subset(b, a));
+  ASSERT_TRUE(bzla_bv_is_bits_subset(a, a));
+  bzla_bv_free(d_mm, a);
+  bzla_bv_free(d_mm, b);
+}
+
+TEST_F(TestBv, binary_into)
+{
+  uint32_t bws[] = {1, 7, 32, 64, 65, 128};
+
+  for (uint32_t bw : bws)
+  {
+    binary_into_bitvec(bzla_bv_add, bzla_bv_add_into, bw);
+    binary_into_bitvec(bzla_bv_sub, bzla_bv_sub_into, bw);
+    binary_into_bitvec(bzla_bv_and, bzla_bv_and_into, bw);
+    binary_into_bitvec(bzla_bv_or, bzla_bv_or_into, bw);
+    binary_into_bitvec(bzla_bv_xor, bzla_bv_xor_into, bw);
+    binary_into_bitvec(bzla_bv_mul, bzla_bv_mul_into, bw);
+    binary_into_bitvec(bzla_bv_udiv, bzla_bv_udiv_into, bw);
+    binary_into_bitvec(bzla_bv_urem, bzla_bv_urem_into, bw);
+    binary_into_bitvec(bzla_bv_sll, bzla_bv_sll_into, bw);
+    binary_into_bitvec(bzla_bv_srl, bzla_bv_srl_into, bw);
+    binary_into_bitvec(bzla_bv_sra, bzla_bv_sra_into, bw);
+  }
+}
+
+TEST_F(TestBv, set_random_range)
+{
+  BzlaBitVector *from, *to, *res;
+
+  from = bzla_bv_uint64_to_bv(d_mm, 3, 8);
+  to   = bzla_bv_uint64_to_bv(d_mm, 17, 8);
+  res  = bzla_bv_new(d_mm, 8);
+  for (uint32_t i = 0; i < 1000; i++)
+  {
+    bzla_bv_set_random_range(res, d_rng, from, to);
+    ASSERT_GE(bzla_bv_compare(res, from), 0);
+    ASSERT_LE(bzla_bv_compare(res, to), 0);
+  }
+  /* 'res' may be 'to' */
+  bzla_bv_set_random_range(to, d_rng, from, to);
+  ASSERT_GE(bzla_bv_compare(to, from), 0);
+  ASSERT_LE(bzla_bv_to_uint64(to), 17u);
+  bzla_bv_free(d_mm, res);
+  bzla_bv_free(d_mm, to);
+  bzla_bv_free(d_mm, from);
+}
+
+TEST_F(TestBv, scratch)
+{
+  uint32_t mark;
+  BzlaBitVector *a, *b, *c;
+  BzlaBitVectorScratch scratch;
+
+  bzla_bv_scratch_init(d_mm, &scratch);
+  mark = bzla_bv_scratch_mark(&scratch);
+  ASSERT_EQ(mark, 0u);
+  a = bzla_bv_scratch_get(&scratch, 8);
+  b = bzla_bv_scratch_get(&scratch, 100);
+  ASSERT_EQ(bzla_bv_get_width(a), 8u);
+  ASSERT_EQ(bzla_bv_get_width(b), 100u);
+  bzla_bv_set_ones(a);
+  bzla_bv_set_ones(b);
+  ASSERT_EQ(bzla_bv_scratch_mark(&scratch), 2u);
+  bzla_bv_scratch_release(&scratch, mark);
+  ASSERT_EQ(bzla_bv_scratch_mark(&scratch), 0u);
+  /* released bit-vectors are reused and reset */
+  c = bzla_bv_scratch_get(&scratch, 16);
+  ASSERT_EQ(c, a);
+  ASSERT_EQ(bzla_bv_get_width(c), 16u);
+  ASSERT_TRUE(bzla_bv_is_zero(c));
+  bzla_bv_scratch_delete(&scratch);
+}
+
 // TODO bzla_bv_get_assignment
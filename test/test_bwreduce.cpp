@@ -0,0 +1,133 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include "test.h"
+
+extern "C" {
+#include "bzlacore.h"
+#include "bzlaexp.h"
+#include "bzlamodel.h"
+}
+
+class TestBwReduce : public TestBzla
+{
+ protected:
+  void SetUp() override
+  {
+    TestBzla::SetUp();
+    bzla_opt_set(d_bzla, BZLA_OPT_PRODUCE_MODELS, 1);
+    bzla_opt_set(d_bzla, BZLA_OPT_BW_REDUCE, 4);
+    d_sort = bzla_sort_bv(d_bzla, 32);
+    d_x    = bzla_exp_var(d_bzla, d_sort, "x");
+    d_y    = bzla_exp_var(d_bzla, d_sort, "y");
+  }
+
+  void TearDown() override
+  {
+    bzla_node_release(d_bzla, d_x);
+    bzla_node_release(d_bzla, d_y);
+    bzla_sort_release(d_bzla, d_sort);
+    TestBzla::TearDown();
+  }
+
+  /* Assert e0 <op> e1 == c. */
+  void assert_eq_const(BzlaNode *(*op)(Bzla *, BzlaNode *, BzlaNode *),
+                       BzlaNode *e0,
+                       BzlaNode *e1,
+                       uint32_t c)
+  {
+    BzlaNode *app = op(d_bzla, e0, e1);
+    BzlaNode *val = bzla_exp_bv_unsigned(d_bzla, c, d_sort);
+    BzlaNode *eq  = bzla_exp_eq(d_bzla, app, val);
+    bzla_assert_exp(d_bzla, eq);
+    bzla_node_release(d_bzla, eq);
+    bzla_node_release(d_bzla, val);
+    bzla_node_release(d_bzla, app);
+  }
+
+  /* Assert lo <u e <u hi. */
+  void assert_range(BzlaNode *e, uint32_t lo, uint32_t hi)
+  {
+    BzlaNode *vlo = bzla_exp_bv_unsigned(d_bzla, lo, d_sort);
+    BzlaNode *vhi = bzla_exp_bv_unsigned(d_bzla, hi, d_sort);
+    BzlaNode *l   = bzla_exp_bv_ult(d_bzla, vlo, e);
+    BzlaNode *h   = bzla_exp_bv_ult(d_bzla, e, vhi);
+    bzla_assert_exp(d_bzla, l);
+    bzla_assert_exp(d_bzla, h);
+    bzla_node_release(d_bzla, h);
+    bzla_node_release(d_bzla, l);
+    bzla_node_release(d_bzla, vhi);
+    bzla_node_release(d_bzla, vlo);
+  }
+
+  uint64_t get_value(BzlaNode *exp)
+  {
+    return bzla_bv_to_uint64(bzla_model_get_bv(d_bzla, exp));
+  }
+
+  BzlaSortId d_sort = 0;
+  BzlaNode *d_x     = nullptr;
+  BzlaNode *d_y     = nullptr;
+};
+
+TEST_F(TestBwReduce, sat_small)
+{
+  /* x * y = 6 and x + y = 5 has solutions with 4-bit values */
+  assert_eq_const(bzla_exp_bv_mul, d_x, d_y, 6);
+  assert_eq_const(bzla_exp_bv_add, d_x, d_y, 5);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_SAT);
+  ASSERT_EQ(d_bzla->stats.bw_reduce_abstractions, 1u);
+  ASSERT_EQ(d_bzla->stats.bw_reduce_sat, 1u);
+  uint64_t x = get_value(d_x), y = get_value(d_y);
+  ASSERT_EQ((uint32_t) (x * y), 6u);
+  ASSERT_EQ((uint32_t) (x + y), 5u);
+}
+
+TEST_F(TestBwReduce, sat_negative)
+{
+  /* sign-extended values cover small negative numbers */
+  assert_eq_const(bzla_exp_bv_add, d_x, d_y, 0xfffffffe);
+  assert_eq_const(bzla_exp_bv_mul, d_x, d_y, 1);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_SAT);
+  ASSERT_EQ(d_bzla->stats.bw_reduce_sat, 1u);
+  ASSERT_EQ(get_value(d_x), 0xffffffffu);
+  ASSERT_EQ(get_value(d_y), 0xffffffffu);
+}
+
+TEST_F(TestBwReduce, sat_widen)
+{
+  /* requires more than 8 bits, solved with 16 bits */
+  assert_range(d_x, 1000, 1100);
+  assert_eq_const(bzla_exp_bv_mul, d_x, d_y, 2100);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_SAT);
+  ASSERT_EQ(d_bzla->stats.bw_reduce_abstractions, 3u);
+  ASSERT_EQ(d_bzla->stats.bw_reduce_sat, 1u);
+  ASSERT_EQ(get_value(d_x), 1050u);
+  ASSERT_EQ(get_value(d_y), 2u);
+}
+
+TEST_F(TestBwReduce, sat_full_width)
+{
+  /* no reduced abstraction is satisfiable, fall back to full bit-width */
+  assert_range(d_y, 0, 3);
+  assert_eq_const(bzla_exp_bv_mul, d_x, d_y, 0x80000000);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_SAT);
+  ASSERT_EQ(d_bzla->stats.bw_reduce_abstractions, 3u);
+  ASSERT_EQ(d_bzla->stats.bw_reduce_sat, 0u);
+  ASSERT_EQ((uint32_t) (get_value(d_x) * get_value(d_y)), 0x80000000u);
+}
+
+TEST_F(TestBwReduce, unsat)
+{
+  assert_eq_const(bzla_exp_bv_sub, d_x, d_y, 1);
+  assert_eq_const(bzla_exp_bv_sub, d_y, d_x, 1);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_UNSAT);
+  ASSERT_EQ(d_bzla->stats.bw_reduce_sat, 0u);
+}
@@ -28,6 +28,18 @@ TEST_F(TestHash, new_delete)
   ASSERT_EQ(allocated, d_mm->allocated);
 }
 
+TEST_F(TestHash, empty)
+{
+  BzlaPtrHashTable *ht = bzla_hashptr_table_new(d_mm, 0, 0);
+  ASSERT_EQ(ht->size, 0u);
+  ASSERT_EQ(bzla_hashptr_table_get(ht, (void *) "one"), nullptr);
+  bzla_hashptr_table_add(ht, (void *) "one")->data.as_int = 1;
+  ASSERT_EQ(bzla_hashptr_table_get(ht, (void *) "one")->data.as_int, 1);
+  bzla_hashptr_table_remove(ht, (void *) "one", 0, 0);
+  ASSERT_EQ(bzla_hashptr_table_get(ht, (void *) "one"), nullptr);
+  bzla_hashptr_table_delete(ht);
+}
+
 TEST_F(TestHash, str2i)
 {
   BzlaPtrHashTable *ht = bzla_hashptr_table_new(d_mm, 0, 0);
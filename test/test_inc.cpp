@@ -9,13 +9,58 @@
  */
 
 #include <sstream>
+#include <vector>
 
 #include "test.h"
 
 extern "C" {
+#include "bzlacore.h"
+#include "bzlaexp.h"
 #include "bzlaopt.h"
 }
 
+class TestIncAssumptionCache : public TestBzla
+{
+ protected:
+  void SetUp() override
+  {
+    TestBzla::SetUp();
+    bzla_opt_set(d_bzla, BZLA_OPT_INCREMENTAL, 1);
+    d_sort = bzla_sort_bv(d_bzla, 8);
+    d_x    = bzla_exp_var(d_bzla, d_sort, "x");
+    for (uint32_t i = 0; i < 4; i++)
+    {
+      BzlaNode *c = bzla_exp_bv_unsigned(d_bzla, i, d_sort);
+      d_ne[i]     = bzla_exp_ne(d_bzla, d_x, c);
+      bzla_node_release(d_bzla, c);
+    }
+    BzlaNode *four = bzla_exp_bv_unsigned(d_bzla, 4, d_sort);
+    BzlaNode *ult  = bzla_exp_bv_ult(d_bzla, d_x, four);
+    bzla_assert_exp(d_bzla, ult);
+    bzla_node_release(d_bzla, ult);
+    bzla_node_release(d_bzla, four);
+  }
+
+  void TearDown() override
+  {
+    for (uint32_t i = 0; i < 4; i++) bzla_node_release(d_bzla, d_ne[i]);
+    bzla_node_release(d_bzla, d_x);
+    bzla_sort_release(d_bzla, d_sort);
+    TestBzla::TearDown();
+  }
+
+  /* Assume x != i for all i in 'idxs' and check satisfiability. */
+  int32_t check_sat_assuming(std::vector<uint32_t> idxs)
+  {
+    for (uint32_t i : idxs) bzla_assume_exp(d_bzla, d_ne[i]);
+    return bzla_check_sat(d_bzla, -1, -1);
+  }
+
+  BzlaSortId d_sort;
+  BzlaNode *d_x;
+  BzlaNode *d_ne[4];
+};
+
 class TestInc : public TestBitwuzla
 {
  protected:
@@ -228,3 +273,216 @@ TEST_F(TestInc, lemmas_on_demand1)
   sat_result = bitwuzla_check_sat(d_bzla);
   ASSERT_EQ(sat_result, BITWUZLA_SAT);
 }
+
+TEST_F(TestInc, elim_slices_push_pop)
+{
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_INCREMENTAL, 1);
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+  const BitwuzlaSort *s8  = bitwuzla_mk_bv_sort(d_bzla, 8);
+  const BitwuzlaSort *s4  = bitwuzla_mk_bv_sort(d_bzla, 4);
+  const BitwuzlaTerm *x   = bitwuzla_mk_const(d_bzla, s8, "x");
+  const BitwuzlaTerm *hi  = bitwuzla_mk_term1_indexed2(
+      d_bzla, BITWUZLA_KIND_BV_EXTRACT, x, 7, 4);
+  const BitwuzlaTerm *lo  = bitwuzla_mk_term1_indexed2(
+      d_bzla, BITWUZLA_KIND_BV_EXTRACT, x, 3, 0);
+  const BitwuzlaTerm *mid = bitwuzla_mk_term1_indexed2(
+      d_bzla, BITWUZLA_KIND_BV_EXTRACT, x, 5, 2);
+
+  const BitwuzlaTerm *eq_hi  = bitwuzla_mk_term2(
+      d_bzla,
+      BITWUZLA_KIND_EQUAL,
+      hi,
+      bitwuzla_mk_bv_value_uint64(d_bzla, s4, 0xa));
+  const BitwuzlaTerm *eq_lo  = bitwuzla_mk_term2(
+      d_bzla,
+      BITWUZLA_KIND_EQUAL,
+      lo,
+      bitwuzla_mk_bv_value_uint64(d_bzla, s4, 0x5));
+  const BitwuzlaTerm *eq_mid = bitwuzla_mk_term2(
+      d_bzla,
+      BITWUZLA_KIND_EQUAL,
+      mid,
+      bitwuzla_mk_bv_zero(d_bzla, s4));
+
+  bitwuzla_push(d_bzla, 1);
+  bitwuzla_assert(d_bzla, eq_hi);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+  ASSERT_EQ(std::string(bitwuzla_get_bv_value(d_bzla, hi)), "1010");
+  bitwuzla_pop(d_bzla, 1);
+
+  /* slices introduced after the first call are eliminated, too */
+  bitwuzla_assert(d_bzla, eq_lo);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+  ASSERT_EQ(std::string(bitwuzla_get_bv_value(d_bzla, lo)), "0101");
+
+  bitwuzla_push(d_bzla, 1);
+  bitwuzla_assert(d_bzla, eq_hi);
+  bitwuzla_assert(d_bzla, eq_mid);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_UNSAT);
+  bitwuzla_pop(d_bzla, 1);
+
+  bitwuzla_push(d_bzla, 1);
+  bitwuzla_assert(d_bzla, eq_hi);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+  ASSERT_EQ(std::string(bitwuzla_get_bv_value(d_bzla, x)), "10100101");
+  bitwuzla_pop(d_bzla, 1);
+
+  bitwuzla_assert(d_bzla, bitwuzla_mk_term1(d_bzla, BITWUZLA_KIND_NOT, eq_hi));
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+}
+
+TEST_F(TestInc, beta_reduce_all_push_pop)
+{
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_INCREMENTAL, 1);
+  const BitwuzlaSort *s   = bitwuzla_mk_bv_sort(d_bzla, 8);
+  const BitwuzlaTerm *p   = bitwuzla_mk_var(d_bzla, s, "p");
+  const BitwuzlaTerm *a   = bitwuzla_mk_const(d_bzla, s, "a");
+  const BitwuzlaTerm *fun = bitwuzla_mk_term2(
+      d_bzla,
+      BITWUZLA_KIND_LAMBDA,
+      p,
+      bitwuzla_mk_term2(
+          d_bzla, BITWUZLA_KIND_BV_ADD, p, bitwuzla_mk_bv_one(d_bzla, s)));
+  const BitwuzlaTerm *app =
+      bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_APPLY, fun, a);
+
+  ASSERT_EQ(std::string(bitwuzla_get_option_str(
+                d_bzla, BITWUZLA_OPT_PP_BETA_REDUCE)),
+            "none");
+  bitwuzla_push(d_bzla, 1);
+  bitwuzla_assert(d_bzla,
+                  bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_EQUAL, app, a));
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_UNSAT);
+  ASSERT_EQ(std::string(bitwuzla_get_option_str(
+                d_bzla, BITWUZLA_OPT_PP_BETA_REDUCE)),
+            "all");
+  bitwuzla_pop(d_bzla, 1);
+  /* restored on pop */
+  ASSERT_EQ(std::string(bitwuzla_get_option_str(
+                d_bzla, BITWUZLA_OPT_PP_BETA_REDUCE)),
+            "none");
+  bitwuzla_assert(d_bzla,
+                  bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_DISTINCT, app, a));
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+}
+
+TEST_F(TestInc, quant_push_pop)
+{
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_INCREMENTAL, 1);
+  const BitwuzlaSort *s  = bitwuzla_mk_bv_sort(d_bzla, 8);
+  const BitwuzlaTerm *x  = bitwuzla_mk_var(d_bzla, s, "x");
+  const BitwuzlaTerm *y  = bitwuzla_mk_var(d_bzla, s, "y");
+  const BitwuzlaTerm *a  = bitwuzla_mk_const(d_bzla, s, "a");
+  const BitwuzlaTerm *b  = bitwuzla_mk_const(d_bzla, s, "b");
+  const BitwuzlaTerm *c1 = bitwuzla_mk_bv_one(d_bzla, s);
+
+  /* forall x . x & a = x & b, i.e., a = b */
+  const BitwuzlaTerm *eq = bitwuzla_mk_term2(
+      d_bzla,
+      BITWUZLA_KIND_FORALL,
+      x,
+      bitwuzla_mk_term2(d_bzla,
+                        BITWUZLA_KIND_EQUAL,
+                        bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_BV_AND, x, a),
+                        bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_BV_AND, x, b)));
+  /* exists y . y + y = a, i.e., a is even */
+  const BitwuzlaTerm *even = bitwuzla_mk_term2(
+      d_bzla,
+      BITWUZLA_KIND_EXISTS,
+      y,
+      bitwuzla_mk_term2(d_bzla,
+                        BITWUZLA_KIND_EQUAL,
+                        bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_BV_ADD, y, y),
+                        a));
+  const BitwuzlaTerm *ne =
+      bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_DISTINCT, a, b);
+  const BitwuzlaTerm *b1 =
+      bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_EQUAL, b, c1);
+
+  bitwuzla_assert(d_bzla, eq);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+
+  bitwuzla_push(d_bzla, 1);
+  bitwuzla_assert(d_bzla, ne);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_UNSAT);
+  bitwuzla_pop(d_bzla, 1);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+
+  bitwuzla_push(d_bzla, 1);
+  bitwuzla_assert(d_bzla, even);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+  bitwuzla_assume(d_bzla, b1);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_UNSAT);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+  bitwuzla_pop(d_bzla, 1);
+
+  bitwuzla_assume(d_bzla, b1);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+  bitwuzla_assert(d_bzla, even);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+  bitwuzla_assume(d_bzla, b1);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_UNSAT);
+}
+
+TEST_F(TestInc, quant_after_check_sat)
+{
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_INCREMENTAL, 1);
+  const BitwuzlaSort *s = bitwuzla_mk_bv_sort(d_bzla, 8);
+  const BitwuzlaTerm *x = bitwuzla_mk_var(d_bzla, s, "x");
+  const BitwuzlaTerm *a = bitwuzla_mk_const(d_bzla, s, "a");
+
+  bitwuzla_assert(
+      d_bzla,
+      bitwuzla_mk_term2(
+          d_bzla, BITWUZLA_KIND_BV_ULE, a, bitwuzla_mk_bv_one(d_bzla, s)));
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+  bitwuzla_assert(
+      d_bzla,
+      bitwuzla_mk_term2(d_bzla,
+                        BITWUZLA_KIND_FORALL,
+                        x,
+                        bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_BV_ULE, a, x)));
+  ASSERT_DEATH(bitwuzla_check_sat(d_bzla),
+               "quantifiers must be asserted before the first check-sat call");
+}
+
+TEST_F(TestIncAssumptionCache, reuse)
+{
+  ASSERT_EQ(check_sat_assuming({0, 1, 2}), BZLA_RESULT_SAT);
+  ASSERT_EQ(d_bzla->stats.assumptions_synthesized, 3u);
+  ASSERT_EQ(check_sat_assuming({0, 1, 2, 3}), BZLA_RESULT_UNSAT);
+  ASSERT_TRUE(bzla_failed_exp(d_bzla, d_ne[3]));
+  ASSERT_EQ(check_sat_assuming({1, 3}), BZLA_RESULT_SAT);
+  ASSERT_EQ(check_sat_assuming({3, 2, 1, 0}), BZLA_RESULT_UNSAT);
+  /* every assumption is bit-blasted once */
+  ASSERT_EQ(d_bzla->stats.assumptions_synthesized, 4u);
+  ASSERT_GE(d_bzla->stats.assumptions_cached, 9u);
+}
+
+TEST_F(TestIncAssumptionCache, conjunction)
+{
+  BzlaNode *and01 = bzla_exp_bv_and(d_bzla, d_ne[0], d_ne[1]);
+  BzlaNode *and23 = bzla_exp_bv_and(d_bzla, d_ne[2], d_ne[3]);
+  bzla_assume_exp(d_bzla, and01);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_SAT);
+  bzla_assume_exp(d_bzla, and01);
+  bzla_assume_exp(d_bzla, and23);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_UNSAT);
+  ASSERT_EQ(d_bzla->stats.assumptions_synthesized, 2u);
+  bzla_node_release(d_bzla, and01);
+  bzla_node_release(d_bzla, and23);
+}
+
+TEST_F(TestIncAssumptionCache, simplified)
+{
+  ASSERT_EQ(check_sat_assuming({0, 1}), BZLA_RESULT_SAT);
+  /* x = 2 simplifies the cached assumptions */
+  BzlaNode *two = bzla_exp_bv_unsigned(d_bzla, 2, d_sort);
+  BzlaNode *eq  = bzla_exp_eq(d_bzla, d_x, two);
+  bzla_assert_exp(d_bzla, eq);
+  ASSERT_EQ(check_sat_assuming({0, 1}), BZLA_RESULT_SAT);
+  ASSERT_EQ(check_sat_assuming({1, 2}), BZLA_RESULT_UNSAT);
+  bzla_node_release(d_bzla, eq);
+  bzla_node_release(d_bzla, two);
+}
@@ -0,0 +1,63 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include <stdlib.h>
+
+#include "test.h"
+
+extern "C" {
+#include "bzlaclone.h"
+#include "bzlacore.h"
+#include "bzlaopt.h"
+}
+
+class TestOpt : public TestBzla
+{
+};
+
+TEST_F(TestOpt, shared)
+{
+  Bzla *bzla = bzla_new();
+  ASSERT_EQ(bzla->options, d_bzla->options);
+  ASSERT_EQ(bzla->str2opt, d_bzla->str2opt);
+
+  bzla_opt_set(bzla, BZLA_OPT_RW_LEVEL, 1);
+  ASSERT_EQ(bzla_opt_get(bzla, BZLA_OPT_RW_LEVEL), 1u);
+  ASSERT_EQ(bzla_opt_get(d_bzla, BZLA_OPT_RW_LEVEL),
+            bzla_opt_get_dflt(d_bzla, BZLA_OPT_RW_LEVEL));
+  ASSERT_STREQ(bzla_opt_get_lng(bzla, BZLA_OPT_RW_LEVEL), "rewrite-level");
+  bzla_delete(bzla);
+}
+
+TEST_F(TestOpt, env)
+{
+  setenv("BZLAREWRITELEVEL", "1", 1);
+  Bzla *bzla = bzla_new();
+  unsetenv("BZLAREWRITELEVEL");
+  ASSERT_EQ(bzla_opt_get(bzla, BZLA_OPT_RW_LEVEL), 1u);
+  ASSERT_EQ(bzla_opt_get_dflt(bzla, BZLA_OPT_RW_LEVEL), 3u);
+  bzla_delete(bzla);
+
+  bzla = bzla_new();
+  ASSERT_EQ(bzla_opt_get(bzla, BZLA_OPT_RW_LEVEL), 3u);
+  bzla_delete(bzla);
+}
+
+TEST_F(TestOpt, clone)
+{
+  bzla_opt_set(d_bzla, BZLA_OPT_RW_LEVEL, 2);
+  bzla_opt_set_str(d_bzla, BZLA_OPT_SAT_ENGINE, "plain=1");
+  Bzla *clone = bzla_clone(d_bzla);
+  ASSERT_EQ(bzla_opt_get(clone, BZLA_OPT_RW_LEVEL), 2u);
+  ASSERT_STREQ(bzla_opt_get_valstr(clone, BZLA_OPT_SAT_ENGINE), "plain=1");
+  ASSERT_NE(bzla_opt_get_valstr(clone, BZLA_OPT_SAT_ENGINE),
+            bzla_opt_get_valstr(d_bzla, BZLA_OPT_SAT_ENGINE));
+  bzla_delete(clone);
+}
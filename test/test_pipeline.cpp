@@ -0,0 +1,218 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include <vector>
+
+#include "test.h"
+
+class TestPipeline : public TestBitwuzla
+{
+ protected:
+  /* Assert a chain of multiplications x_i * x_{i+1} = c_i over 'n' variables
+   * of width 'w' and return the result of checking satisfiability. If 'fix'
+   * is given, additionally assert x_0 = fix. */
+  BitwuzlaResult check_chain(Bitwuzla *bitwuzla,
+                             uint32_t n,
+                             uint32_t w,
+                             int64_t fix)
+  {
+    const BitwuzlaSort *sort = bitwuzla_mk_bv_sort(bitwuzla, w);
+    std::vector<const BitwuzlaTerm *> vars;
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+      vars.push_back(bitwuzla_mk_const(bitwuzla, sort, nullptr));
+    }
+    for (uint32_t i = 0; i + 1 < n; i++)
+    {
+      const BitwuzlaTerm *mul = bitwuzla_mk_term2(
+          bitwuzla, BITWUZLA_KIND_BV_MUL, vars[i], vars[i + 1]);
+      const BitwuzlaTerm *c =
+          bitwuzla_mk_bv_value_uint64(bitwuzla, sort, 2 * i + 3);
+      bitwuzla_assert(
+          bitwuzla, bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_EQUAL, mul, c));
+    }
+    if (fix >= 0)
+    {
+      bitwuzla_assert(
+          bitwuzla,
+          bitwuzla_mk_term2(
+              bitwuzla,
+              BITWUZLA_KIND_EQUAL,
+              vars[0],
+              bitwuzla_mk_bv_value_uint64(bitwuzla, sort, (uint64_t) fix)));
+    }
+    return bitwuzla_check_sat(bitwuzla);
+  }
+};
+
+TEST_F(TestPipeline, opt)
+{
+  ASSERT_EQ(bitwuzla_get_option(d_bzla, BITWUZLA_OPT_PIPELINE), 0);
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_PIPELINE, 1);
+  ASSERT_EQ(bitwuzla_get_option(d_bzla, BITWUZLA_OPT_PIPELINE), 1);
+}
+
+TEST_F(TestPipeline, sat_unsat)
+{
+  for (int64_t fix : {-1, 1, 2, 3})
+  {
+    Bitwuzla *seq = bitwuzla_new();
+    Bitwuzla *pip = bitwuzla_new();
+    bitwuzla_set_option(pip, BITWUZLA_OPT_PIPELINE, 1);
+    ASSERT_EQ(check_chain(seq, 20, 8, fix), check_chain(pip, 20, 8, fix));
+    bitwuzla_delete(seq);
+    bitwuzla_delete(pip);
+  }
+}
+
+TEST_F(TestPipeline, model)
+{
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_PIPELINE, 1);
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+
+  const BitwuzlaSort *sort = bitwuzla_mk_bv_sort(d_bzla, 16);
+  const BitwuzlaTerm *x    = bitwuzla_mk_const(d_bzla, sort, "x");
+  const BitwuzlaTerm *y    = bitwuzla_mk_const(d_bzla, sort, "y");
+  const BitwuzlaTerm *add =
+      bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_BV_ADD, x, y);
+  bitwuzla_assert(
+      d_bzla,
+      bitwuzla_mk_term2(d_bzla,
+                        BITWUZLA_KIND_EQUAL,
+                        add,
+                        bitwuzla_mk_bv_value_uint64(d_bzla, sort, 1000)));
+  bitwuzla_assert(
+      d_bzla,
+      bitwuzla_mk_term2(d_bzla,
+                        BITWUZLA_KIND_BV_UGT,
+                        x,
+                        bitwuzla_mk_bv_value_uint64(d_bzla, sort, 600)));
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+
+  uint64_t vx = std::stoull(bitwuzla_get_bv_value(d_bzla, x), nullptr, 2);
+  uint64_t vy = std::stoull(bitwuzla_get_bv_value(d_bzla, y), nullptr, 2);
+  ASSERT_GT(vx, 600u);
+  ASSERT_EQ((vx + vy) & 0xffff, 1000u);
+}
+
+TEST_F(TestPipeline, incremental)
+{
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_PIPELINE, 1);
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_INCREMENTAL, 1);
+
+  const BitwuzlaSort *sort = bitwuzla_mk_bv_sort(d_bzla, 32);
+  const BitwuzlaTerm *x    = bitwuzla_mk_const(d_bzla, sort, "x");
+  const BitwuzlaTerm *sum  = x;
+
+  for (uint32_t i = 1; i <= 8; i++)
+  {
+    const BitwuzlaTerm *c = bitwuzla_mk_bv_value_uint64(d_bzla, sort, i);
+    sum = bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_BV_MUL, sum, c);
+    bitwuzla_assert(d_bzla,
+                    bitwuzla_mk_term2(d_bzla,
+                                      BITWUZLA_KIND_BV_ULT,
+                                      c,
+                                      bitwuzla_mk_bv_value_uint64(
+                                          d_bzla, sort, 100)));
+    ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+  }
+
+  /* x * 8! is even */
+  bitwuzla_push(d_bzla, 1);
+  bitwuzla_assert(
+      d_bzla,
+      bitwuzla_mk_term2(d_bzla,
+                        BITWUZLA_KIND_EQUAL,
+                        sum,
+                        bitwuzla_mk_bv_value_uint64(d_bzla, sort, 1)));
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_UNSAT);
+  bitwuzla_pop(d_bzla, 1);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+
+  bitwuzla_assert(
+      d_bzla,
+      bitwuzla_mk_term2(d_bzla,
+                        BITWUZLA_KIND_EQUAL,
+                        sum,
+                        bitwuzla_mk_bv_value_uint64(d_bzla, sort, 40320)));
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+}
+
+TEST_F(TestPipeline, background)
+{
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_PIPELINE, 1);
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_RW_LEVEL, 0);
+
+  const BitwuzlaSort *sort = bitwuzla_mk_bv_sort(d_bzla, 16);
+  const BitwuzlaTerm *x    = bitwuzla_mk_const(d_bzla, sort, "x");
+  const BitwuzlaTerm *y    = bitwuzla_mk_const(d_bzla, sort, "y");
+  bitwuzla_assert(
+      d_bzla,
+      bitwuzla_mk_term2(d_bzla,
+                        BITWUZLA_KIND_DISTINCT,
+                        bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_BV_MUL, x, y),
+                        bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_BV_MUL, y, x)));
+
+  /* without rewriting, commutativity is only detected on the AIG layer */
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_UNSAT);
+}
+
+TEST_F(TestPipeline, unsupported)
+{
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_PIPELINE, 1);
+
+  const BitwuzlaSort *bv8 = bitwuzla_mk_bv_sort(d_bzla, 8);
+  const BitwuzlaSort *fun = bitwuzla_mk_fun_sort(d_bzla, 1, &bv8, bv8);
+  const BitwuzlaTerm *f   = bitwuzla_mk_const(d_bzla, fun, "f");
+  const BitwuzlaTerm *x   = bitwuzla_mk_const(d_bzla, bv8, "x");
+  const BitwuzlaTerm *v   = bitwuzla_mk_var(d_bzla, bv8, "v");
+  const BitwuzlaTerm *fx =
+      bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_APPLY, f, x);
+  const BitwuzlaTerm *lambda = bitwuzla_mk_term2(
+      d_bzla,
+      BITWUZLA_KIND_LAMBDA,
+      v,
+      bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_BV_ADD, v, fx));
+
+  /* functions are not bit-blasted in the background */
+  bitwuzla_assert(
+      d_bzla,
+      bitwuzla_mk_term2(d_bzla,
+                        BITWUZLA_KIND_EQUAL,
+                        bitwuzla_mk_term2(
+                            d_bzla, BITWUZLA_KIND_APPLY, lambda, x),
+                        x));
+  bitwuzla_assert(d_bzla,
+                  bitwuzla_mk_term2(d_bzla,
+                                    BITWUZLA_KIND_DISTINCT,
+                                    fx,
+                                    bitwuzla_mk_bv_zero(d_bzla, bv8)));
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_UNSAT);
+}
+
+TEST_F(TestPipeline, delete_pending)
+{
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_PIPELINE, 1);
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    const BitwuzlaSort *sort = bitwuzla_mk_bv_sort(d_bzla, 64);
+    const BitwuzlaTerm *x    = bitwuzla_mk_const(d_bzla, sort, nullptr);
+    const BitwuzlaTerm *y    = bitwuzla_mk_const(d_bzla, sort, nullptr);
+    bitwuzla_assert(
+        d_bzla,
+        bitwuzla_mk_term2(
+            d_bzla,
+            BITWUZLA_KIND_DISTINCT,
+            bitwuzla_mk_term2(d_bzla, BITWUZLA_KIND_BV_UDIV, x, y),
+            bitwuzla_mk_bv_zero(d_bzla, sort)));
+  }
+  /* TearDown deletes the instance while formulas may still be queued */
+}
@@ -54,6 +54,8 @@ class TestPropCons : public TestPropCommon
 
     bzla_opt_set(bzla, BZLA_OPT_INCREMENTAL, 1);
     bzla_opt_set(bzla, BZLA_OPT_CHECK_MODEL, 0);
+    /* slice elimination would substitute the inputs of 'expr' */
+    bzla_opt_set(bzla, BZLA_OPT_PP_ELIMINATE_EXTRACTS, 0);
 
     if (expr_fun == bzla_exp_bv_slt)
     {
@@ -254,6 +256,8 @@ class TestPropCons : public TestPropCommon
 
     bzla_opt_set(bzla, BZLA_OPT_INCREMENTAL, 1);
     bzla_opt_set(bzla, BZLA_OPT_CHECK_MODEL, 0);
+    /* slice elimination would substitute the inputs of 'expr' */
+    bzla_opt_set(bzla, BZLA_OPT_PP_ELIMINATE_EXTRACTS, 0);
 
     sort_x = bzla_sort_bv(bzla, TEST_PROPCONS_BW);
 
@@ -432,6 +436,8 @@ class TestPropCons : public TestPropCommon
 
     bzla_opt_set(bzla, BZLA_OPT_INCREMENTAL, 1);
     bzla_opt_set(bzla, BZLA_OPT_CHECK_MODEL, 0);
+    /* slice elimination would substitute the inputs of 'expr' */
+    bzla_opt_set(bzla, BZLA_OPT_PP_ELIMINATE_EXTRACTS, 0);
 
     sort_bool = bzla_sort_bool(bzla);
     sort_bv   = bzla_sort_bv(bzla, TEST_PROPCONS_BW);
@@ -62,6 +62,8 @@ class TestPropInv : public TestPropCommon
 
     bzla_opt_set(bzla, BZLA_OPT_INCREMENTAL, 1);
     bzla_opt_set(bzla, BZLA_OPT_CHECK_MODEL, 0);
+    /* slice elimination would substitute the inputs of 'expr' */
+    bzla_opt_set(bzla, BZLA_OPT_PP_ELIMINATE_EXTRACTS, 0);
     bzla_opt_set(bzla, BZLA_OPT_PROP_USE_INV_LT_CONCAT, 1);
     bzla_opt_set(bzla, BZLA_OPT_PROP_ASHR, 1);
     bzla_opt_set(bzla, BZLA_OPT_PROP_XOR, 1);
@@ -321,6 +323,8 @@ class TestPropInv : public TestPropCommon
 
     bzla_opt_set(bzla, BZLA_OPT_INCREMENTAL, 1);
     bzla_opt_set(bzla, BZLA_OPT_CHECK_MODEL, 0);
+    /* slice elimination would substitute the inputs of 'expr' */
+    bzla_opt_set(bzla, BZLA_OPT_PP_ELIMINATE_EXTRACTS, 0);
 
     sort_x = bzla_sort_bv(bzla, TEST_PROPINV_BW);
 
@@ -510,6 +514,8 @@ class TestPropInv : public TestPropCommon
 
     bzla_opt_set(bzla, BZLA_OPT_INCREMENTAL, 1);
     bzla_opt_set(bzla, BZLA_OPT_CHECK_MODEL, 0);
+    /* slice elimination would substitute the inputs of 'expr' */
+    bzla_opt_set(bzla, BZLA_OPT_PP_ELIMINATE_EXTRACTS, 0);
 
     sort_bool = bzla_sort_bool(bzla);
     sort_bv   = bzla_sort_bv(bzla, TEST_PROPINV_BW);
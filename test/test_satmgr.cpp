@@ -42,3 +42,28 @@ TEST_F(TestSatMgr, next_cnf_id)
   ASSERT_EQ(bzla_sat_mgr_next_cnf_id(d_smgr), 4);
   bzla_sat_reset(d_smgr);
 }
+
+TEST_F(TestSatMgr, phase)
+{
+  int32_t x, y;
+
+  bzla_sat_enable_solver(d_smgr);
+  bzla_sat_init(d_smgr);
+  if (!d_smgr->api.phase)
+  {
+    /* not supported by SAT solver */
+    bzla_sat_reset(d_smgr);
+    return;
+  }
+  x = bzla_sat_mgr_next_cnf_id(d_smgr);
+  y = bzla_sat_mgr_next_cnf_id(d_smgr);
+  bzla_sat_add(d_smgr, x);
+  bzla_sat_add(d_smgr, y);
+  bzla_sat_add(d_smgr, 0);
+  bzla_sat_phase(d_smgr, -x);
+  bzla_sat_phase(d_smgr, y);
+  ASSERT_EQ(bzla_sat_check_sat(d_smgr, -1), BZLA_RESULT_SAT);
+  ASSERT_EQ(bzla_sat_deref(d_smgr, x), -1);
+  ASSERT_EQ(bzla_sat_deref(d_smgr, y), 1);
+  bzla_sat_reset(d_smgr);
+}
@@ -0,0 +1,244 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include <thread>
+#include <vector>
+
+#include "test.h"
+
+extern "C" {
+#include "bzlaclone.h"
+#include "bzlacore.h"
+#include "bzlaexp.h"
+#include "bzlamodel.h"
+#include "bzlatermstore.h"
+}
+
+class TestTermStore : public TestBzla
+{
+ protected:
+  void SetUp() override
+  {
+    TestBzla::SetUp();
+    d_store = bzla_term_store_new();
+    d_other = bzla_new();
+    bzla_set_term_store(d_bzla, d_store);
+    bzla_set_term_store(d_other, d_store);
+  }
+
+  void TearDown() override
+  {
+    if (d_other)
+    {
+      bzla_delete(d_other);
+    }
+    TestBzla::TearDown();
+    bzla_term_store_delete(d_store);
+  }
+
+  BzlaNode *mk_const(Bzla *bzla, uint32_t value, uint32_t width)
+  {
+    BzlaSortId sort = bzla_sort_bv(bzla, width);
+    BzlaNode *res   = bzla_exp_bv_unsigned(bzla, value, sort);
+    bzla_sort_release(bzla, sort);
+    return res;
+  }
+
+  uint64_t num_bvs()
+  {
+    BzlaTermStoreStats stats;
+    bzla_term_store_get_stats(d_store, &stats);
+    return stats.bvs;
+  }
+
+  BzlaTermStore *d_store = nullptr;
+  Bzla *d_other          = nullptr;
+};
+
+TEST_F(TestTermStore, shared_const)
+{
+  uint64_t n = num_bvs();
+
+  BzlaNode *c0 = mk_const(d_bzla, 42, 32);
+  BzlaNode *c1 = mk_const(d_other, 42, 32);
+  ASSERT_EQ(num_bvs(), n + 1);
+  ASSERT_EQ(bzla_node_bv_const_get_bits_ptr(c0),
+            bzla_node_bv_const_get_bits_ptr(c1));
+
+  /* inverted values are created on demand */
+  ASSERT_EQ(bzla_node_bv_const_get_invbits_ptr(c0), nullptr);
+  BzlaBitVector *inv0 = bzla_node_bv_const_get_bits(bzla_node_invert(c0));
+  BzlaBitVector *inv1 = bzla_node_bv_const_get_bits(bzla_node_invert(c1));
+  ASSERT_EQ(num_bvs(), n + 2);
+  ASSERT_EQ(inv0, inv1);
+  ASSERT_EQ(inv0, bzla_node_bv_const_get_invbits_ptr(c0));
+  ASSERT_EQ(bzla_bv_to_uint64(inv0), ~42u);
+
+  bzla_node_release(d_bzla, c0);
+  ASSERT_EQ(num_bvs(), n + 2);
+  bzla_node_release(d_other, c1);
+  ASSERT_EQ(num_bvs(), n);
+}
+
+TEST_F(TestTermStore, attach_existing)
+{
+  uint64_t n   = num_bvs();
+  Bzla *bzla   = bzla_new();
+  BzlaNode *c0 = mk_const(bzla, 7, 16);
+  BzlaNode *c1 = mk_const(d_bzla, 7, 16);
+  ASSERT_NE(bzla_node_bv_const_get_bits_ptr(c0),
+            bzla_node_bv_const_get_bits_ptr(c1));
+
+  bzla_set_term_store(bzla, d_store);
+  ASSERT_EQ(bzla_node_bv_const_get_bits_ptr(c0),
+            bzla_node_bv_const_get_bits_ptr(c1));
+
+  bzla_node_release(bzla, c0);
+  bzla_node_release(d_bzla, c1);
+  bzla_delete(bzla);
+  ASSERT_EQ(num_bvs(), n);
+}
+
+TEST_F(TestTermStore, clone)
+{
+  uint64_t n  = num_bvs();
+  BzlaNode *c = mk_const(d_bzla, 3, 8);
+  Bzla *clone = bzla_clone(d_bzla);
+  BzlaNode *cc =
+      BZLA_PEEK_STACK(clone->nodes_id_table, bzla_node_real_addr(c)->id);
+  ASSERT_EQ(bzla_node_bv_const_get_bits_ptr(c),
+            bzla_node_bv_const_get_bits_ptr(cc));
+
+  bzla_node_release(d_bzla, c);
+  bzla_delete(clone);
+  ASSERT_EQ(num_bvs(), n);
+}
+
+TEST_F(TestTermStore, update)
+{
+  BzlaTermStore *store = bzla_term_store_new();
+  BzlaMemMgr *mm       = d_bzla->mm;
+  BzlaBitVector *one   = bzla_bv_one(mm, 16);
+  BzlaBitVector *two   = bzla_bv_uint64_to_bv(mm, 2, 16);
+  BzlaBitVector *a, *b, *c;
+  BzlaTermStoreStats stats;
+
+  /* unshared value is updated in place */
+  a = bzla_term_store_get_bv(store, one);
+  b = bzla_term_store_update_bv(store, a, two);
+  ASSERT_EQ(a, b);
+  ASSERT_EQ(bzla_bv_compare(b, two), 0);
+
+  /* shared value is copied */
+  c = bzla_term_store_get_bv(store, two);
+  ASSERT_EQ(b, c);
+  a = bzla_term_store_update_bv(store, c, one);
+  ASSERT_NE(a, b);
+  ASSERT_EQ(bzla_bv_compare(a, one), 0);
+  ASSERT_EQ(bzla_bv_compare(b, two), 0);
+
+  /* existing value is shared */
+  c = bzla_term_store_update_bv(store, b, one);
+  ASSERT_EQ(a, c);
+  bzla_term_store_get_stats(store, &stats);
+  ASSERT_EQ(stats.bvs, 1);
+  ASSERT_EQ(stats.refs, 2);
+  ASSERT_EQ(stats.saved, bzla_bv_size(one));
+
+  bzla_term_store_release_bv(store, a);
+  bzla_term_store_release_bv(store, c);
+  bzla_bv_free(mm, one);
+  bzla_bv_free(mm, two);
+  bzla_term_store_delete(store);
+}
+
+TEST_F(TestTermStore, many)
+{
+  BzlaTermStore *store = bzla_term_store_new();
+  BzlaMemMgr *mm       = d_bzla->mm;
+  std::vector<BzlaBitVector *> bvs;
+  BzlaTermStoreStats stats;
+
+  for (uint32_t i = 0; i < 1000; i++)
+  {
+    BzlaBitVector *bv = bzla_bv_uint64_to_bv(mm, i % 300, 32);
+    bvs.push_back(bzla_term_store_get_bv(store, bv));
+    bzla_bv_free(mm, bv);
+  }
+  bzla_term_store_get_stats(store, &stats);
+  ASSERT_EQ(stats.bvs, 300);
+  ASSERT_EQ(stats.refs, 1000);
+  /* release in an order different from insertion */
+  for (uint32_t i = 0; i < 1000; i++)
+  {
+    uint32_t j = (i * 7) % 1000;
+    ASSERT_EQ(bzla_bv_to_uint64(bvs[j]), j % 300);
+    bzla_term_store_release_bv(store, bvs[j]);
+  }
+  bzla_term_store_get_stats(store, &stats);
+  ASSERT_EQ(stats.bvs, 0);
+  bzla_term_store_delete(store);
+}
+
+TEST_F(TestTermStore, model)
+{
+  bzla_opt_set(d_bzla, BZLA_OPT_PRODUCE_MODELS, 1);
+
+  BzlaSortId sort = bzla_sort_bv(d_bzla, 8);
+  BzlaNode *x     = bzla_exp_var(d_bzla, sort, 0);
+  BzlaNode *y     = bzla_exp_var(d_bzla, sort, 0);
+  BzlaNode *c     = mk_const(d_bzla, 5, 8);
+  BzlaNode *eq0   = bzla_exp_eq(d_bzla, x, c);
+  BzlaNode *eq1   = bzla_exp_eq(d_bzla, y, c);
+  bzla_assert_exp(d_bzla, eq0);
+  bzla_assert_exp(d_bzla, eq1);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_SAT);
+
+  /* equal model values are shared */
+  const BzlaBitVector *bv = bzla_model_get_bv(d_bzla, x);
+  ASSERT_EQ(bv, bzla_model_get_bv(d_bzla, y));
+  ASSERT_EQ(bv, bzla_node_bv_const_get_bits(c));
+  ASSERT_EQ(bzla_model_get_bv(d_bzla, bzla_node_invert(x)),
+            bzla_model_get_bv(d_bzla, bzla_node_invert(y)));
+
+  bzla_node_release(d_bzla, eq1);
+  bzla_node_release(d_bzla, eq0);
+  bzla_node_release(d_bzla, c);
+  bzla_node_release(d_bzla, y);
+  bzla_node_release(d_bzla, x);
+  bzla_sort_release(d_bzla, sort);
+}
+
+TEST_F(TestTermStore, threads)
+{
+  auto solve = [this](Bzla *bzla) {
+    for (uint32_t i = 0; i < 100; i++)
+    {
+      BzlaSortId sort = bzla_sort_bv(bzla, 16);
+      BzlaNode *x     = bzla_exp_var(bzla, sort, 0);
+      BzlaNode *c     = mk_const(bzla, i, 16);
+      BzlaNode *add   = bzla_exp_bv_add(bzla, x, c);
+      BzlaNode *eq    = bzla_exp_eq(bzla, add, c);
+      bzla_assume_exp(bzla, eq);
+      bzla_node_release(bzla, eq);
+      bzla_node_release(bzla, add);
+      bzla_node_release(bzla, c);
+      bzla_node_release(bzla, x);
+      bzla_sort_release(bzla, sort);
+    }
+    ASSERT_EQ(bzla_check_sat(bzla, -1, -1), BZLA_RESULT_SAT);
+  };
+
+  bzla_opt_set(d_bzla, BZLA_OPT_INCREMENTAL, 1);
+  bzla_opt_set(d_other, BZLA_OPT_INCREMENTAL, 1);
+  std::thread t(solve, d_other);
+  solve(d_bzla);
+  t.join();
+}